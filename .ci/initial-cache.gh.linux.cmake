@@ -25,11 +25,14 @@ set(ENABLE_yarppm_depthimage_to_rgb ON CACHE BOOL "")
 set(ENABLE_yarppm_segmentationimage_to_rgb ON CACHE BOOL "")
 set(ENABLE_yarppm_image_compression_ffmpeg ON CACHE BOOL "")
 set(ENABLE_yarppm_image_rotation ON CACHE BOOL "")
+set(ENABLE_yarppm_image_roi ON CACHE BOOL "")
 set(ENABLE_yarppm_sound_compression_mp3 ON CACHE BOOL "")
 set(ENABLE_yarppm_sound_marker ON CACHE BOOL "")
 set(ENABLE_yarppm_soundfilter_resample ON CACHE BOOL "")
 set(ENABLE_yarppm_bottle_compression_zlib ON CACHE BOOL "")
 set(ENABLE_yarppm_depthimage_compression_zlib ON CACHE BOOL "")
+set(ENABLE_yarppm_pointcloud_compression_zlib ON CACHE BOOL "")
+set(ENABLE_yarppm_jointstate_fields ON CACHE BOOL "")
 
 set(ENABLE_yarpmod_AudioPlayerWrapper ON CACHE BOOL "")
 set(ENABLE_yarpmod_AudioRecorderWrapper ON CACHE BOOL "")
@@ -394,9 +394,6 @@ checkandset_dependency(GObject)
 find_package(GLIB2 QUIET)
 checkandset_dependency(GLIB2)
 
-find_package(SOXR QUIET)
-checkandset_dependency(SOXR)
-
 set(GStreamer_REQUIRED_VERSION 1.4)
 find_package(GStreamer ${GStreamer_REQUIRED_VERSION} QUIET)
 checkandset_dependency(GStreamer)
@@ -685,7 +682,6 @@ print_dependency(I2C)
 print_dependency(Libv4l2)
 print_dependency(Libv4lconvert)
 print_dependency(ZLIB)
-print_dependency(SOXR)
 
 ################################################################################
 # Print information for user
@@ -729,6 +725,7 @@ yarp_print_feature(YARP_DISABLE_FAILING_VALGRIND_TESTS 1 "Disable tests on which
 yarp_print_feature(YARP_ENABLE_BROKEN_TESTS 1 "Enable broken tests")
 yarp_print_feature(YARP_ENABLE_INTEGRATION_TESTS 1 "Run integration tests")
 yarp_print_feature(YARP_ENABLE_EXAMPLES_AS_TESTS 1 "Compile examples as unit tests")
+yarp_print_feature(YARP_COMPILE_BENCHMARKS 1 "Compile the yarp-benchmarks suite")
 yarp_print_feature(YARP_VALGRIND_TESTS 1 "Run YARP tests under Valgrind")
 
 
@@ -186,6 +186,9 @@ mark_as_advanced(YARP_ENABLE_INTEGRATION_TESTS)
 cmake_dependent_option(YARP_ENABLE_EXAMPLES_AS_TESTS OFF "Compile examples as unit tests" YARP_COMPILE_TESTS OFF)
 mark_as_advanced(YARP_ENABLE_EXAMPLES_AS_TESTS)
 
+cmake_dependent_option(YARP_COMPILE_BENCHMARKS "Compile the yarp-benchmarks suite" OFF YARP_COMPILE_TESTS OFF)
+mark_as_advanced(YARP_COMPILE_BENCHMARKS)
+
 
 #########################################################################
 # Test timeout.
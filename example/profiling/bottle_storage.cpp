@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Time.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace yarp::os;
+
+// Measure the cost of building, serializing and parsing a Bottle, in the
+// pattern used by the modules that stream data, i.e. clearing and refilling
+// the same Bottle for each message.
+//
+// The heap allocations are counted by replacing the global new and delete
+// operators of the program.
+//
+// Parameters:
+// --elements: number of elements in the Bottle (default: 100)
+// --iterations: number of iterations for each test (default: 100000)
+//
+// The output is one line per content type, reporting the allocations and the
+// time per message when writing (clear, add and serialize) and when reading
+// (parse and access all the elements).
+
+namespace {
+
+std::atomic<size_t> allocations{0};
+
+void fill(Bottle& b, const std::string& type, int elements)
+{
+    b.clear();
+    if (type == "float64") {
+        for (int i = 0; i < elements; i++) {
+            b.addFloat64(i * 0.5);
+        }
+    } else if (type == "int32") {
+        for (int i = 0; i < elements; i++) {
+            b.addInt32(i);
+        }
+    } else {
+        for (int i = 0; i < elements / 4; i++) {
+            b.addInt32(i);
+            b.addFloat64(i * 0.5);
+            b.addString("joint");
+            Bottle& l = b.addList();
+            l.addFloat64(0.1);
+            l.addFloat64(0.2);
+            l.addFloat64(0.3);
+        }
+    }
+}
+
+double consume(const Bottle& b)
+{
+    double sum = 0;
+    for (size_t i = 0; i < b.size(); i++) {
+        const Value& v = b.get(i);
+        if (v.isList()) {
+            sum += consume(*v.asList());
+        } else if (!v.isString()) {
+            sum += v.asFloat64();
+        }
+    }
+    return sum;
+}
+
+void runBenchmark(const std::string& type, int elements, int iterations)
+{
+    Bottle out;
+    Bottle in;
+    size_t size = 0;
+    double sum = 0;
+
+    // Warm up, so that the buffers reach their steady state size
+    fill(out, type, elements);
+    out.toBinary(&size);
+
+    size_t a0 = allocations;
+    double t0 = Time::now();
+    for (int i = 0; i < iterations; i++) {
+        fill(out, type, elements);
+        out.toBinary(&size);
+    }
+    double t1 = Time::now();
+    size_t a1 = allocations;
+
+    const char* bytes = out.toBinary(&size);
+    std::string copy(bytes, size);
+    in.fromBinary(copy.data(), copy.size());
+
+    size_t a2 = allocations;
+    double t2 = Time::now();
+    for (int i = 0; i < iterations; i++) {
+        in.fromBinary(copy.data(), copy.size());
+        sum += consume(in);
+    }
+    double t3 = Time::now();
+    size_t a3 = allocations;
+
+    printf("%-8s %4d elements, %6zu bytes | write %7.1f allocs %8.2f us | read %7.1f allocs %8.2f us | %g\n",
+           type.c_str(),
+           elements,
+           size,
+           static_cast<double>(a1 - a0) / iterations,
+           (t1 - t0) / iterations * 1e6,
+           static_cast<double>(a3 - a2) / iterations,
+           (t3 - t2) / iterations * 1e6,
+           sum / iterations);
+}
+
+} // namespace
+
+void* operator new(std::size_t n)
+{
+    allocations++;
+    if (void* p = std::malloc(n == 0 ? 1 : n)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    int elements = options.check("elements", Value(100)).asInt32();
+    int iterations = options.check("iterations", Value(100000)).asInt32();
+
+    for (const char* type : {"float64", "int32", "mixed"}) {
+        runBenchmark(type, elements, iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Semaphore.h>
+#include <yarp/os/Time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace yarp::os;
+
+// Compare the latency and the throughput of the carriers available for
+// ports on the same host: tcp, unix_stream, shmem and shm_ring.
+//
+// Latency is measured sending one message at a time, and waiting until it
+// is received before sending the next one.  Throughput is measured sending
+// the messages back to back.  The carriers that cannot be used (e.g. shmem
+// when YARP is compiled without ACE) are skipped.
+//
+// Parameters:
+// --carriers: list of carriers (default: (tcp unix_stream shmem shm_ring))
+// --sizes: list of payload sizes [bytes]
+//          (default: (64 6220800 3686400), i.e. a small message, a 1920x1080
+//          rgb image and a point cloud of 307200 xyz float points)
+// --messages: number of messages for each test (default: 200)
+//
+// The output is one line per carrier and payload size, reporting the median
+// and the 99th percentile of the latency, and the throughput.
+
+namespace {
+
+class Receiver :
+        public BufferedPort<Bottle>
+{
+public:
+    using BufferedPort<Bottle>::onRead;
+    void onRead(Bottle& b) override
+    {
+        YARP_UNUSED(b);
+        received.post();
+    }
+
+    Semaphore received{0};
+};
+
+std::vector<std::string> getList(const Property& options, const std::string& key, const std::vector<std::string>& fallback)
+{
+    std::vector<std::string> values;
+    Bottle* list = options.find(key).asList();
+    if (list != nullptr) {
+        for (size_t i = 0; i < list->size(); i++) {
+            values.push_back(list->get(i).toString());
+        }
+    } else if (options.check(key)) {
+        values.push_back(options.find(key).toString());
+    } else {
+        values = fallback;
+    }
+    return values;
+}
+
+void send(BufferedPort<Bottle>& sender, const std::vector<char>& payload, int i)
+{
+    Bottle& b = sender.prepare();
+    b.clear();
+    b.addInt32(i);
+    b.add(Value(payload.data(), static_cast<int>(payload.size())));
+    sender.writeStrict();
+}
+
+void runBenchmark(const std::string& carrier, size_t size, int messages)
+{
+    Receiver receiver;
+    receiver.setStrict();
+    receiver.useCallback();
+    receiver.open("/bench/in");
+
+    BufferedPort<Bottle> sender;
+    sender.open("/bench/out");
+    if (!Network::connect(sender.getName(), receiver.getName(), carrier, true)) {
+        printf("%-12s size %9zu | not available\n", carrier.c_str(), size);
+        sender.close();
+        receiver.close();
+        return;
+    }
+    Network::sync(sender.getName());
+
+    std::vector<char> payload(size, 42);
+
+    // Latency
+    std::vector<double> latency;
+    latency.reserve(messages);
+    for (int i = 0; i < messages; i++) {
+        double t0 = Time::now();
+        send(sender, payload, i);
+        receiver.received.wait();
+        latency.push_back(Time::now() - t0);
+    }
+    std::sort(latency.begin(), latency.end());
+
+    // Throughput
+    double t0 = Time::now();
+    for (int i = 0; i < messages; i++) {
+        send(sender, payload, i);
+    }
+    for (int i = 0; i < messages; i++) {
+        receiver.received.wait();
+    }
+    double t1 = Time::now();
+
+    sender.close();
+    receiver.close();
+
+    printf("%-12s size %9zu | latency median %9.1f us, p99 %9.1f us | %9.1f MB/s | %8.1f msg/s\n",
+           carrier.c_str(),
+           size,
+           latency[latency.size() / 2] * 1e6,
+           latency[latency.size() * 99 / 100] * 1e6,
+           static_cast<double>(size) * messages / (t1 - t0) / 1e6,
+           messages / (t1 - t0));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+    Network::setLocalMode(true);
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    auto carriers = getList(options, "carriers", {"tcp", "unix_stream", "shmem", "shm_ring"});
+    auto sizes = getList(options, "sizes", {"64", "6220800", "3686400"});
+    int messages = std::max(options.check("messages", Value(200)).asInt32(), 1);
+
+    for (const auto& size : sizes) {
+        for (const auto& carrier : carriers) {
+            runBenchmark(carrier, std::stoul(size), messages);
+        }
+    }
+
+    return 0;
+}
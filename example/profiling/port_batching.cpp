@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/QosStyle.h>
+#include <yarp/os/Semaphore.h>
+#include <yarp/os/Stamp.h>
+#include <yarp/os/Time.h>
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+#include <dlfcn.h>
+#include <sys/socket.h>
+
+using namespace yarp::os;
+
+// Compare a stream of small messages (e.g. joint states) sent one by one,
+// with the same stream coalesced in batches (QosStyle::setBatching()).
+//
+// The socket calls are counted by wrapping the send(), sendmsg(), recv()
+// and recvmsg() functions of the C library, and include the
+// acknowledgements of the tcp carrier.
+//
+// Parameters:
+// --carrier: the carrier (default: tcp)
+// --rate: messages per second (default: 1000)
+// --messages: number of messages (default: 2000)
+// --batch: messages in a batch (default: 16)
+// --delay: maximum delay of a message in a batch [s] (default: 0.01)
+//
+// The output is one line per mode, reporting the number of socket calls per
+// message and the number of callbacks received.
+
+namespace {
+
+std::atomic<size_t> sendCalls{0};
+std::atomic<size_t> recvCalls{0};
+
+template <typename F>
+F next(const char* name)
+{
+    return reinterpret_cast<F>(dlsym(RTLD_NEXT, name));
+}
+
+class Receiver :
+        public BufferedPort<Bottle>
+{
+public:
+    using BufferedPort<Bottle>::onRead;
+    void onRead(Bottle& b) override
+    {
+        Stamp stamp;
+        getEnvelope(stamp);
+        if (stamp.getCount() != b.get(0).asInt32()) {
+            wrongStamps++;
+        }
+        if (++count == expected) {
+            done.post();
+        }
+    }
+
+    std::atomic<int> count{0};
+    std::atomic<int> wrongStamps{0};
+    int expected{0};
+    Semaphore done{0};
+};
+
+void runBenchmark(const std::string& carrier, int batch, double delay, double rate, int messages)
+{
+    Receiver receiver;
+    receiver.expected = messages;
+    receiver.setStrict();
+    receiver.useCallback();
+    receiver.open("/bench/in");
+
+    BufferedPort<Bottle> sender;
+    sender.open("/bench/out");
+    Network::connect(sender.getName(), receiver.getName(), carrier, true);
+    Network::sync(sender.getName());
+    if (batch > 1) {
+        QosStyle style;
+        style.setBatching(batch, delay);
+        NetworkBase::setConnectionQos(sender.getName(), receiver.getName(), style, QosStyle());
+    }
+
+    size_t send0 = sendCalls;
+    size_t recv0 = recvCalls;
+    double t0 = Time::now();
+    for (int i = 0; i < messages; i++) {
+        Bottle& b = sender.prepare();
+        b.clear();
+        b.addInt32(i);
+        for (int j = 0; j < 6; j++) {
+            b.addFloat64(j * 0.1);
+        }
+        Stamp stamp(i, Time::now());
+        sender.setEnvelope(stamp);
+        sender.writeStrict();
+        Time::delay(t0 + (i + 1) / rate - Time::now());
+    }
+    receiver.done.wait();
+    size_t sends = sendCalls - send0;
+    size_t recvs = recvCalls - recv0;
+
+    sender.close();
+    receiver.close();
+
+    printf("%-10s batch %3d | send %6.3f | recv %6.3f per message | %d callbacks, %d wrong stamps\n",
+           carrier.c_str(),
+           batch,
+           static_cast<double>(sends) / messages,
+           static_cast<double>(recvs) / messages,
+           receiver.count.load(),
+           receiver.wrongStamps.load());
+}
+
+} // namespace
+
+extern "C" {
+
+ssize_t send(int fd, const void* buf, size_t n, int flags)
+{
+    static auto real = next<ssize_t (*)(int, const void*, size_t, int)>("send");
+    sendCalls++;
+    return real(fd, buf, n, flags);
+}
+
+ssize_t sendmsg(int fd, const struct msghdr* msg, int flags)
+{
+    static auto real = next<ssize_t (*)(int, const struct msghdr*, int)>("sendmsg");
+    sendCalls++;
+    return real(fd, msg, flags);
+}
+
+ssize_t recv(int fd, void* buf, size_t n, int flags)
+{
+    static auto real = next<ssize_t (*)(int, void*, size_t, int)>("recv");
+    recvCalls++;
+    return real(fd, buf, n, flags);
+}
+
+ssize_t recvmsg(int fd, struct msghdr* msg, int flags)
+{
+    static auto real = next<ssize_t (*)(int, struct msghdr*, int)>("recvmsg");
+    recvCalls++;
+    return real(fd, msg, flags);
+}
+
+} // extern "C"
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+    Network::setLocalMode(true);
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    std::string carrier = options.check("carrier", Value("tcp")).asString();
+    double rate = options.check("rate", Value(1000.0)).asFloat64();
+    int messages = options.check("messages", Value(2000)).asInt32();
+    int batch = options.check("batch", Value(16)).asInt32();
+    double delay = options.check("delay", Value(0.01)).asFloat64();
+
+    runBenchmark(carrier, 1, delay, rate, messages);
+    runBenchmark(carrier, batch, delay, rate, messages);
+
+    return 0;
+}
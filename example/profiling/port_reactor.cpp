@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/conf/environment.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+using namespace yarp::os;
+
+// Compare the default thread-per-connection mode of the ports with the
+// reactor mode (YARP_PORT_REACTOR=1).
+//
+// For each number of connections, a grid of sender and receiver ports is
+// created in this process, and every sender is connected to every receiver.
+// Each sender then writes timestamped messages in background, and the
+// receivers measure the latency in their callback.
+//
+// Parameters:
+// --connections: list of connection counts (default: (10 100 1000))
+// --messages: number of messages written by each sender (default: 200)
+// --period: period between two writes [s] (default: 0.01)
+// --carrier: carrier used for the connections (default: tcp)
+//
+// The output is one line per mode and connection count, reporting the number
+// of threads of the process, the CPU time used while streaming, and the
+// average and maximum latency.
+
+namespace {
+
+class Stats
+{
+public:
+    void add(double latency)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        count++;
+        sum += latency;
+        max = std::max(max, latency);
+    }
+
+    std::mutex mutex;
+    size_t count{0};
+    double sum{0.0};
+    double max{0.0};
+};
+
+class Receiver :
+        public BufferedPort<Bottle>
+{
+public:
+    explicit Receiver(Stats& stats) :
+            stats(stats)
+    {
+    }
+
+    using BufferedPort<Bottle>::onRead;
+    void onRead(Bottle& b) override
+    {
+        stats.add(Time::now() - b.get(0).asFloat64());
+    }
+
+private:
+    Stats& stats;
+};
+
+size_t countThreads()
+{
+    size_t count = 0;
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator("/proc/self/task")) {
+        count++;
+    }
+    return count;
+}
+
+double cpuTime()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+
+void runBenchmark(bool reactor, int connections, int messages, double period, const std::string& carrier)
+{
+    yarp::conf::environment::set_string("YARP_PORT_REACTOR", reactor ? "1" : "0");
+
+    auto receiverCount = static_cast<int>(std::ceil(std::sqrt(connections)));
+    auto senderCount = (connections + receiverCount - 1) / receiverCount;
+
+    Stats stats;
+    std::vector<std::unique_ptr<Receiver>> receivers;
+    std::vector<std::unique_ptr<BufferedPort<Bottle>>> senders;
+
+    for (int i = 0; i < receiverCount; i++) {
+        receivers.emplace_back(std::make_unique<Receiver>(stats));
+        receivers.back()->useCallback();
+        receivers.back()->open("/bench/in/" + std::to_string(i));
+    }
+    int made = 0;
+    for (int i = 0; i < senderCount; i++) {
+        senders.emplace_back(std::make_unique<BufferedPort<Bottle>>());
+        senders.back()->open("/bench/out/" + std::to_string(i));
+        for (int j = 0; j < receiverCount && made < connections; j++, made++) {
+            Network::connect(senders.back()->getName(), receivers[j]->getName(), carrier, true);
+        }
+    }
+    for (auto& s : senders) {
+        Network::sync(s->getName());
+    }
+
+    double cpu0 = cpuTime();
+    double t0 = Time::now();
+    for (int m = 0; m < messages; m++) {
+        for (auto& s : senders) {
+            Bottle& b = s->prepare();
+            b.clear();
+            b.addFloat64(Time::now());
+            s->write();
+        }
+        Time::delay(period);
+    }
+    for (auto& s : senders) {
+        s->waitForWrite();
+    }
+    Time::delay(0.5);
+    double t1 = Time::now();
+    double cpu1 = cpuTime();
+    size_t threads = countThreads();
+
+    for (auto& s : senders) {
+        s->close();
+    }
+    for (auto& r : receivers) {
+        r->close();
+    }
+
+    std::lock_guard<std::mutex> lock(stats.mutex);
+    printf("%-8s connections %5d | threads %5zu | cpu %6.1f%% | received %8zu | latency avg %8.3f ms max %8.3f ms\n",
+           reactor ? "reactor" : "threads",
+           made,
+           threads,
+           100.0 * (cpu1 - cpu0) / (t1 - t0),
+           stats.count,
+           (stats.count > 0) ? 1000.0 * stats.sum / static_cast<double>(stats.count) : 0.0,
+           1000.0 * stats.max);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+    Network::setLocalMode(true);
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    std::vector<int> connections;
+    Bottle* list = options.find("connections").asList();
+    if (list != nullptr) {
+        for (size_t i = 0; i < list->size(); i++) {
+            connections.push_back(list->get(i).asInt32());
+        }
+    } else if (options.check("connections")) {
+        connections.push_back(options.find("connections").asInt32());
+    } else {
+        connections = {10, 100, 1000};
+    }
+    int messages = options.check("messages", Value(200)).asInt32();
+    double period = options.check("period", Value(0.01)).asFloat64();
+    std::string carrier = options.check("carrier", Value("tcp")).asString();
+
+    for (int n : connections) {
+        runBenchmark(false, n, messages, period, carrier);
+        runBenchmark(true, n, messages, period, carrier);
+    }
+
+    return 0;
+}
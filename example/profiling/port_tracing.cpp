@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Vocab.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace yarp::os;
+
+// Report the latency of the messages received by a port, from the
+// timestamps added by the writers when tracing is enabled on them, i.e.
+// when they are started with YARP_PORT_TRACING=1, or after sending
+// "trac on" to their administrative interface (yarp admin rpc /writer).
+//
+// Parameters:
+// --port: the receiving port
+// --out: if set, the latest messages are written in this file, in the
+//        Chrome trace format, that can be opened in https://ui.perfetto.dev
+// --clear: forget the messages received so far
+//
+// The output is one line per connection and hop, reporting the mean, the
+// median, the 99th percentile and the maximum latency.
+
+namespace {
+
+bool admin(const std::string& port, const std::string& command, Bottle& reply)
+{
+    Bottle cmd;
+    cmd.fromString(command);
+    if (!Network::write(port, cmd, reply, true)) {
+        fprintf(stderr, "Cannot send \"%s\" to %s\n", command.c_str(), port.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    std::string port = options.find("port").asString();
+    if (port.empty()) {
+        fprintf(stderr, "Usage: port_tracing --port /port [--out trace.json] [--clear]\n");
+        return 1;
+    }
+
+    Bottle reply;
+    if (!admin(port, "[trac] [get]", reply)) {
+        return 1;
+    }
+    for (size_t i = 0; i < reply.size(); i++) {
+        Bottle* connection = reply.get(i).asList();
+        if (connection == nullptr) {
+            continue;
+        }
+        printf("%s -> %s, %lld messages\n",
+               connection->find("from").asString().c_str(),
+               port.c_str(),
+               static_cast<long long>(connection->find("messages").asInt64()));
+        for (const char* hop : {"queue", "serialize", "transport", "read", "total"}) {
+            Bottle* stats = connection->find(hop).asList();
+            if (stats == nullptr) {
+                continue;
+            }
+            printf("  %-10s mean %10.1f us | median %10.1f us | p99 %10.1f us | max %10.1f us\n",
+                   hop,
+                   stats->find("mean").asFloat64(),
+                   stats->find("p50").asFloat64(),
+                   stats->find("p99").asFloat64(),
+                   stats->find("max").asFloat64());
+        }
+    }
+
+    if (options.check("out")) {
+        if (!admin(port, "[trac] [json]", reply)) {
+            return 1;
+        }
+        std::ofstream out(options.find("out").asString());
+        out << reply.get(0).asString();
+    }
+
+    if (options.check("clear")) {
+        admin(port, "[trac] [clr]", reply);
+    }
+
+    return 0;
+}
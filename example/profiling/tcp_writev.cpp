@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/conf/environment.h>
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Semaphore.h>
+#include <yarp/os/Time.h>
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <dlfcn.h>
+#include <sys/socket.h>
+
+using namespace yarp::os;
+
+// Compare the tcp carrier sending each block of a message with its own
+// send() call (YARP_TCP_WRITEV=0) with the scatter-gather mode, where the
+// header, the index and the payload of a message are sent with a single
+// sendmsg() call (YARP_TCP_WRITEV=1, the default).
+//
+// The socket calls are counted by wrapping the send(), sendmsg() and
+// setsockopt() functions of the C library.  The counts include the
+// acknowledgement sent back by the receiver for each message.
+//
+// Parameters:
+// --sizes: list of payload sizes [bytes] (default: (16 65536 6220800))
+// --messages: number of messages for each size (default: 200)
+//
+// The output is one line per mode and payload size, reporting the number of
+// socket calls per message and the throughput.
+
+namespace {
+
+std::atomic<size_t> sendCalls{0};
+std::atomic<size_t> sendmsgCalls{0};
+std::atomic<size_t> setsockoptCalls{0};
+
+template <typename F>
+F next(const char* name)
+{
+    return reinterpret_cast<F>(dlsym(RTLD_NEXT, name));
+}
+
+class Receiver :
+        public BufferedPort<Bottle>
+{
+public:
+    using BufferedPort<Bottle>::onRead;
+    void onRead(Bottle& b) override
+    {
+        YARP_UNUSED(b);
+        if (++count == expected) {
+            done.post();
+        }
+    }
+
+    std::atomic<int> count{0};
+    int expected{0};
+    Semaphore done{0};
+};
+
+void runBenchmark(bool gather, size_t size, int messages)
+{
+    yarp::conf::environment::set_string("YARP_TCP_WRITEV", gather ? "1" : "0");
+
+    Receiver receiver;
+    receiver.expected = messages;
+    receiver.setStrict();
+    receiver.useCallback();
+    receiver.open("/bench/in");
+
+    BufferedPort<Bottle> sender;
+    sender.open("/bench/out");
+    Network::connect(sender.getName(), receiver.getName(), "tcp", true);
+    Network::sync(sender.getName());
+
+    std::vector<char> payload(size, 42);
+
+    size_t send0 = sendCalls;
+    size_t sendmsg0 = sendmsgCalls;
+    size_t setsockopt0 = setsockoptCalls;
+    double t0 = Time::now();
+    for (int i = 0; i < messages; i++) {
+        Bottle& b = sender.prepare();
+        b.clear();
+        b.addInt32(i);
+        b.add(Value(payload.data(), static_cast<int>(payload.size())));
+        sender.writeStrict();
+    }
+    sender.waitForWrite();
+    receiver.done.wait();
+    double t1 = Time::now();
+    size_t sends = sendCalls - send0;
+    size_t sendmsgs = sendmsgCalls - sendmsg0;
+    size_t setsockopts = setsockoptCalls - setsockopt0;
+
+    sender.close();
+    receiver.close();
+
+    auto perMessage = [messages](size_t calls) { return static_cast<double>(calls) / messages; };
+    printf("%-7s size %9zu | send %6.2f | sendmsg %6.2f | setsockopt %6.2f per message | %9.1f MB/s | %8.1f msg/s\n",
+           gather ? "writev" : "send",
+           size,
+           perMessage(sends),
+           perMessage(sendmsgs),
+           perMessage(setsockopts),
+           static_cast<double>(size) * messages / (t1 - t0) / 1e6,
+           messages / (t1 - t0));
+}
+
+} // namespace
+
+extern "C" {
+
+ssize_t send(int fd, const void* buf, size_t n, int flags)
+{
+    static auto real = next<ssize_t (*)(int, const void*, size_t, int)>("send");
+    sendCalls++;
+    return real(fd, buf, n, flags);
+}
+
+ssize_t sendmsg(int fd, const struct msghdr* msg, int flags)
+{
+    static auto real = next<ssize_t (*)(int, const struct msghdr*, int)>("sendmsg");
+    sendmsgCalls++;
+    return real(fd, msg, flags);
+}
+
+int setsockopt(int fd, int level, int optname, const void* optval, socklen_t optlen)
+{
+    static auto real = next<int (*)(int, int, int, const void*, socklen_t)>("setsockopt");
+    setsockoptCalls++;
+    return real(fd, level, optname, optval, optlen);
+}
+
+} // extern "C"
+
+int main(int argc, char* argv[])
+{
+    Network yarp;
+    Network::setLocalMode(true);
+
+    Property options;
+    options.fromCommand(argc, argv);
+
+    std::vector<size_t> sizes;
+    Bottle* list = options.find("sizes").asList();
+    if (list != nullptr) {
+        for (size_t i = 0; i < list->size(); i++) {
+            sizes.push_back(static_cast<size_t>(list->get(i).asInt64()));
+        }
+    } else if (options.check("sizes")) {
+        sizes.push_back(static_cast<size_t>(options.find("sizes").asInt64()));
+    } else {
+        sizes = {16, 65536, 6220800}; // 6220800 = 1920x1080 rgb24
+    }
+    int messages = options.check("messages", Value(200)).asInt32();
+
+    for (size_t size : sizes) {
+        runBenchmark(false, size, messages);
+        runBenchmark(true, size, messages);
+    }
+
+    return 0;
+}
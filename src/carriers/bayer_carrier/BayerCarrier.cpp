@@ -8,9 +8,16 @@
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/Route.h>
 #include <yarp/sig/ImageDraw.h>
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 
+// SSE2 is always available on x86-64
+#if defined(__SSE2__) || defined(_M_X64)
+#    define YARP_BAYER_SSE2 1
+#    include <emmintrin.h>
+#endif
+
 #ifndef USE_LIBDC1394
 extern "C" {
 #include "conversions.h"
@@ -29,6 +36,94 @@ YARP_LOG_COMPONENT(BAYERCARRIER,
                    yarp::os::Log::LogTypeReserved,
                    yarp::os::Log::printCallback(),
                    nullptr)
+
+// Not a libdc1394 method, implemented by BayerCarrier::debayerMalvarRows()
+constexpr int BAYER_METHOD_MALVAR = DC1394_BAYER_METHOD_MAX + 1;
+
+// Reflect a coordinate out of the image back in it.  The reflection is
+// centered on the border pixel, so that the bayer pattern is preserved.
+inline int mirror(int i, int n)
+{
+    if (i < 0) {
+        return -i;
+    }
+    if (i >= n) {
+        return 2 * (n - 1) - i;
+    }
+    return i;
+}
+
+// Convert a value scaled by 16 to a pixel
+inline PixelMono toPixel(int v)
+{
+    return static_cast<PixelMono>(std::clamp((v + 8) >> 4, 0, 255));
+}
+
+#if defined(YARP_BAYER_SSE2)
+inline __m128i load8(const PixelMono* p)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+}
+
+inline __m128i blend(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// The same computation of BayerCarrier::debayerMalvarRows() on the 8 pixels
+// starting from x, with 16 bit integers.  The pixels from x-2 to x+9 of the
+// rows r0...r4 (from y-2 to y+2) must be in the image.
+inline void malvarSse2(const PixelMono* r0, const PixelMono* r1, const PixelMono* r2,
+                       const PixelMono* r3, const PixelMono* r4,
+                       int x, bool firstGreen, bool redRow, PixelRgb* po)
+{
+    const __m128i c = load8(r2 + x);
+    const __m128i n1s1 = _mm_add_epi16(load8(r1 + x), load8(r3 + x));
+    const __m128i n2s2 = _mm_add_epi16(load8(r0 + x), load8(r4 + x));
+    const __m128i w1e1 = _mm_add_epi16(load8(r2 + x - 1), load8(r2 + x + 1));
+    const __m128i w2e2 = _mm_add_epi16(load8(r2 + x - 2), load8(r2 + x + 2));
+    const __m128i diag = _mm_add_epi16(_mm_add_epi16(load8(r1 + x - 1), load8(r1 + x + 1)),
+                                       _mm_add_epi16(load8(r3 + x - 1), load8(r3 + x + 1)));
+
+    const __m128i c10 = _mm_mullo_epi16(c, _mm_set1_epi16(10));
+    const __m128i diag2 = _mm_slli_epi16(diag, 1);
+    // 10*c + 8*(w1+e1) - 2*(w2+e2) - 2*diag + (n2+s2)
+    const __m128i hor = _mm_add_epi16(_mm_sub_epi16(_mm_add_epi16(c10, _mm_slli_epi16(w1e1, 3)),
+                                                    _mm_add_epi16(_mm_slli_epi16(w2e2, 1), diag2)),
+                                      n2s2);
+    // 10*c + 8*(n1+s1) - 2*(n2+s2) - 2*diag + (w2+e2)
+    const __m128i ver = _mm_add_epi16(_mm_sub_epi16(_mm_add_epi16(c10, _mm_slli_epi16(n1s1, 3)),
+                                                    _mm_add_epi16(_mm_slli_epi16(n2s2, 1), diag2)),
+                                      w2e2);
+    const __m128i axial2 = _mm_add_epi16(n2s2, w2e2);
+    // 8*c + 4*(n1+s1+w1+e1) - 2*axial2
+    const __m128i g = _mm_sub_epi16(_mm_add_epi16(_mm_slli_epi16(c, 3), _mm_slli_epi16(_mm_add_epi16(n1s1, w1e1), 2)),
+                                    _mm_slli_epi16(axial2, 1));
+    // 12*c + 4*diag - 3*axial2
+    const __m128i other = _mm_sub_epi16(_mm_add_epi16(_mm_mullo_epi16(c, _mm_set1_epi16(12)), _mm_slli_epi16(diag, 2)),
+                                        _mm_mullo_epi16(axial2, _mm_set1_epi16(3)));
+    const __m128i c16 = _mm_slli_epi16(c, 4);
+
+    const __m128i green = firstGreen ? _mm_set1_epi32(0x0000FFFF) : _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+    __m128i r = blend(green, redRow ? hor : ver, redRow ? c16 : other);
+    __m128i gr = blend(green, c16, g);
+    __m128i b = blend(green, redRow ? ver : hor, redRow ? other : c16);
+
+    const __m128i round = _mm_set1_epi16(8);
+    r = _mm_srai_epi16(_mm_add_epi16(r, round), 4);
+    gr = _mm_srai_epi16(_mm_add_epi16(gr, round), 4);
+    b = _mm_srai_epi16(_mm_add_epi16(b, round), 4);
+
+    alignas(16) PixelMono out[32];
+    _mm_store_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(r, gr));
+    _mm_store_si128(reinterpret_cast<__m128i*>(out + 16), _mm_packus_epi16(b, b));
+    for (int i = 0; i < 8; ++i) {
+        po[x + i].r = out[i];
+        po[x + i].g = out[8 + i];
+        po[x + i].b = out[16 + i];
+    }
+}
+#endif
 }
 
 // can't seem to do ipl/opencv/yarp style end-of-row padding
@@ -134,14 +229,33 @@ yarp::os::ConnectionReader& BayerCarrier::modifyIncomingData(yarp::os::Connectio
                 m = DC1394_BAYER_METHOD_SIMPLE;
             } else if (method=="vng") {
                 m = DC1394_BAYER_METHOD_VNG;
+            } else if (method=="malvar") {
+                m = BAYER_METHOD_MALVAR;
             } else {
-                yCWarning/*Once*/(BAYERCARRIER, "bayer method %s not recognized, try: ahd bilinear downsample edgesense hqlinear nearest simple vng", method.c_str());
+                yCWarning/*Once*/(BAYERCARRIER, "bayer method %s not recognized, try: ahd bilinear downsample edgesense hqlinear malvar nearest simple vng", method.c_str());
                 happy = false;
                 local->setSize(0);
                 return *local;
             }
         }
 
+        threads = 1;
+        if (config.check("threads")) {
+            int n = config.find("threads").asInt32();
+            if (n < 1) {
+                yCWarning(BAYERCARRIER, "invalid number of threads %d", n);
+                happy = false;
+                local->setSize(0);
+                return *local;
+            }
+            threads = static_cast<size_t>(n);
+        }
+        if (threads <= 1) {
+            workers.reset();
+        } else if (!workers || workers->getThreads() != threads) {
+            workers = std::make_unique<WorkerPool>(threads);
+        }
+
         setFormat(config.check("order",Value("grbg")).asString().c_str());
         header_in.setFromImage(in);
         yCTrace(BAYERCARRIER, "Need reset.");
@@ -159,7 +273,7 @@ yarp::os::ConnectionReader& BayerCarrier::modifyIncomingData(yarp::os::Connectio
 bool BayerCarrier::debayerHalf(yarp::sig::ImageOf<PixelMono>& src,
                                yarp::sig::ImageOf<PixelRgb>& dest) {
     // dc1394 doesn't seem safe for arbitrary data widths
-    if (src.width()%8==0) {
+    if (src.width()%8==0 && threads<=1) {
         dc1394video_frame_t dc_src;
         dc1394video_frame_t dc_dest;
         setDcImage(src,&dc_src,dcformat);
@@ -168,20 +282,28 @@ bool BayerCarrier::debayerHalf(yarp::sig::ImageOf<PixelMono>& src,
         return true;
     }
 
-    if (bayer_method_set) {
+    if (bayer_method_set && src.width()%8!=0) {
         yCWarning/*Once*/(BAYERCARRIER, "Not using dc1394 debayer methods (image width not a multiple of 8)");
     }
 
     // a safer implementation that doesn't use dc1394
+    forEachBand(static_cast<int>(dest.height()), [&](int y0, int y1) {
+        debayerHalfRows(src, dest, y0, y1);
+    });
+    return true;
+}
+
+void BayerCarrier::debayerHalfRows(yarp::sig::ImageOf<PixelMono>& src,
+                                   yarp::sig::ImageOf<PixelRgb>& dest,
+                                   int y0, int y1) {
     int w = src.width();
     int h = src.height();
     int wo = dest.width();
-    int ho = dest.height();
     int goff1 = 1-goff;
     int roffx = roff?goff:goff1;
     int boff = 1-roff;
     int boffx = boff?goff:goff1;
-    for (int yo=0; yo<ho; yo++) {
+    for (int yo=y0; yo<y1; yo++) {
         for (int xo=0; xo<wo; xo++) {
             PixelRgb& po = dest.pixel(xo,yo);
             int x = xo*2;
@@ -195,13 +317,22 @@ bool BayerCarrier::debayerHalf(yarp::sig::ImageOf<PixelMono>& src,
             po.g = static_cast<PixelMono>(0.5*(src.pixel(x+goff,y)+src.pixel(x+goff1,y+1)));
         }
     }
-    return true;
 }
 
 bool BayerCarrier::debayerFull(yarp::sig::ImageOf<PixelMono>& src,
                                yarp::sig::ImageOf<PixelRgb>& dest) {
+    int h = dest.height();
+    if (bayer_method==BAYER_METHOD_MALVAR && src.width()>=3 && src.height()>=3) {
+        forEachBand(h, [&](int y0, int y1) {
+            debayerMalvarRows(src, dest, y0, y1);
+        });
+        return true;
+    }
+
     // dc1394 doesn't seem safe for arbitrary data widths
-    if (src.width()%8==0) {
+    // the bilinear method is split in bands by our implementation
+    if (src.width()%8==0 && bayer_method!=BAYER_METHOD_MALVAR &&
+        (threads<=1 || bayer_method!=DC1394_BAYER_METHOD_BILINEAR)) {
         dc1394video_frame_t dc_src;
         dc1394video_frame_t dc_dest;
         setDcImage(src,&dc_src,dcformat);
@@ -211,91 +342,221 @@ bool BayerCarrier::debayerFull(yarp::sig::ImageOf<PixelMono>& src,
         return true;
     }
 
-    if (bayer_method_set) {
+    if (bayer_method_set && src.width()%8!=0 && bayer_method!=BAYER_METHOD_MALVAR) {
         yCWarning/*Once*/(BAYERCARRIER, "Not using dc1394 debayer methods (image width not a multiple of 8)");
     }
+    forEachBand(h, [&](int y0, int y1) {
+        debayerBilinearRows(src, dest, y0, y1);
+    });
+    return true;
+}
+
+void BayerCarrier::debayerBilinearRows(yarp::sig::ImageOf<PixelMono>& src,
+                                       yarp::sig::ImageOf<PixelRgb>& dest,
+                                       int y0, int y1) {
     int w = dest.width();
     int h = dest.height();
     int goff1 = 1-goff;
     int roffx = roff?goff:goff1;
     int boff = 1-roff;
     int boffx = boff?goff:goff1;
-    for (int y=0; y<h; y++) {
-        for (int x=0; x<w; x++) {
-            PixelRgb& po = dest.pixel(x,y);
+    auto convert = [&](int x, int y) {
+        PixelRgb& po = dest.pixel(x,y);
 
-            // G
-            if ((x+y)%2==goff) {
-                po.g = src.pixel(x,y);
-            } else {
-                float g = 0;
-                int ct = 0;
-                if (x>0) { g += src.pixel(x-1,y); ct++; }
-                if (x<w-1) { g += src.pixel(x+1,y); ct++; }
-                if (y>0) { g += src.pixel(x,y-1); ct++; }
-                if (y<h-1) { g += src.pixel(x,y+1); ct++; }
-                if (ct>0) { g /= ct; }
-                po.g = static_cast<int>(g);
+        // G
+        if ((x+y)%2==goff) {
+            po.g = src.pixel(x,y);
+        } else {
+            float g = 0;
+            int ct = 0;
+            if (x>0) { g += src.pixel(x-1,y); ct++; }
+            if (x<w-1) { g += src.pixel(x+1,y); ct++; }
+            if (y>0) { g += src.pixel(x,y-1); ct++; }
+            if (y<h-1) { g += src.pixel(x,y+1); ct++; }
+            if (ct>0) { g /= ct; }
+            po.g = static_cast<int>(g);
+        }
+
+        // B
+        if (y%2==boff && x%2==boffx) {
+            po.b = src.pixel(x,y);
+        } else if (y%2==boff) {
+            float b = 0;
+            int ct = 0;
+            if (x>0) { b += src.pixel(x-1,y); ct++; }
+            if (x<w-1) { b += src.pixel(x+1,y); ct++; }
+            if (ct>0) { b /= ct; }
+            po.b = static_cast<int>(b);
+        } else if (x%2==boffx) {
+            float b = 0;
+            int ct = 0;
+            if (y>0) { b += src.pixel(x,y-1); ct++; }
+            if (y<h-1) { b += src.pixel(x,y+1); ct++; }
+            if (ct>0) { b /= ct; }
+            po.b = static_cast<int>(b);
+        } else {
+            float b = 0;
+            int ct = 0;
+            if (x>0&&y>0) { b += src.pixel(x-1,y-1); ct++; }
+            if (x>0&&y<h-1) { b += src.pixel(x-1,y+1); ct++; }
+            if (x<w-1&&y>0) { b += src.pixel(x+1,y-1); ct++; }
+            if (x<w-1&&y<h-1) { b += src.pixel(x+1,y+1); ct++; }
+            if (ct>0) { b /= ct; }
+            po.b = static_cast<int>(b);
+        }
+
+        // R
+        if (y%2==roff && x%2==roffx) {
+            po.r = src.pixel(x,y);
+        } else if (y%2==roff) {
+            float r = 0;
+            int ct = 0;
+            if (x>0) { r += src.pixel(x-1,y); ct++; }
+            if (x<w-1) { r += src.pixel(x+1,y); ct++; }
+            if (ct>0) { r /= ct; }
+            po.r = static_cast<int>(r);
+        } else if (x%2==roffx) {
+            float r = 0;
+            int ct = 0;
+            if (y>0) { r += src.pixel(x,y-1); ct++; }
+            if (y<h-1) { r += src.pixel(x,y+1); ct++; }
+            if (ct>0) { r /= ct; }
+            po.r = static_cast<int>(r);
+        } else {
+            float r = 0;
+            int ct = 0;
+            if (x>0&&y>0) { r += src.pixel(x-1,y-1); ct++; }
+            if (x>0&&y<h-1) { r += src.pixel(x-1,y+1); ct++; }
+            if (x<w-1&&y>0) { r += src.pixel(x+1,y-1); ct++; }
+            if (x<w-1&&y<h-1) { r += src.pixel(x+1,y+1); ct++; }
+            if (ct>0) { r /= ct; }
+            po.r = static_cast<int>(r);
+        }
+    };
+
+    for (int y=y0; y<y1; y++) {
+        if (y==0 || y==h-1 || w<3) {
+            for (int x=0; x<w; x++) {
+                convert(x, y);
             }
+            continue;
+        }
 
-            // B
-            if (y%2==boff && x%2==boffx) {
-                po.b = src.pixel(x,y);
-            } else if (y%2==boff) {
-                float b = 0;
-                int ct = 0;
-                if (x>0) { b += src.pixel(x-1,y); ct++; }
-                if (x<w-1) { b += src.pixel(x+1,y); ct++; }
-                if (ct>0) { b /= ct; }
-                po.b = static_cast<int>(b);
-            } else if (x%2==boffx) {
-                float b = 0;
-                int ct = 0;
-                if (y>0) { b += src.pixel(x,y-1); ct++; }
-                if (y<h-1) { b += src.pixel(x,y+1); ct++; }
-                if (ct>0) { b /= ct; }
-                po.b = static_cast<int>(b);
+        // the inner pixels, that have all the neighbors in the image
+        const PixelMono* r1 = src.getRow(y-1);
+        const PixelMono* r2 = src.getRow(y);
+        const PixelMono* r3 = src.getRow(y+1);
+        auto* po = reinterpret_cast<PixelRgb*>(dest.getRow(y));
+        const bool redRow = (y%2==roff);
+        auto inner = [=](int x, bool green) {
+            const int c = r2[x];
+            PixelRgb p;
+            if (green) {
+                const int hor = (r2[x-1]+r2[x+1])/2;
+                const int ver = (r1[x]+r3[x])/2;
+                p.r = static_cast<PixelMono>(redRow ? hor : ver);
+                p.g = static_cast<PixelMono>(c);
+                p.b = static_cast<PixelMono>(redRow ? ver : hor);
             } else {
-                float b = 0;
-                int ct = 0;
-                if (x>0&&y>0) { b += src.pixel(x-1,y-1); ct++; }
-                if (x>0&&y<h-1) { b += src.pixel(x-1,y+1); ct++; }
-                if (x<w-1&&y>0) { b += src.pixel(x+1,y-1); ct++; }
-                if (x<w-1&&y<h-1) { b += src.pixel(x+1,y+1); ct++; }
-                if (ct>0) { b /= ct; }
-                po.b = static_cast<int>(b);
+                const int other = (r1[x-1]+r1[x+1]+r3[x-1]+r3[x+1])/4;
+                p.r = static_cast<PixelMono>(redRow ? c : other);
+                p.g = static_cast<PixelMono>((r1[x]+r3[x]+r2[x-1]+r2[x+1])/4);
+                p.b = static_cast<PixelMono>(redRow ? other : c);
             }
+            po[x] = p;
+        };
 
-            // R
-            if (y%2==roff && x%2==roffx) {
-                po.r = src.pixel(x,y);
-            } else if (y%2==roff) {
-                float r = 0;
-                int ct = 0;
-                if (x>0) { r += src.pixel(x-1,y); ct++; }
-                if (x<w-1) { r += src.pixel(x+1,y); ct++; }
-                if (ct>0) { r /= ct; }
-                po.r = static_cast<int>(r);
-            } else if (x%2==roffx) {
-                float r = 0;
-                int ct = 0;
-                if (y>0) { r += src.pixel(x,y-1); ct++; }
-                if (y<h-1) { r += src.pixel(x,y+1); ct++; }
-                if (ct>0) { r /= ct; }
-                po.r = static_cast<int>(r);
+        convert(0, y);
+        const bool firstGreen = ((1+y)%2==goff);
+        int x = 1;
+        for (; x+1<w-1; x+=2) {
+            inner(x, firstGreen);
+            inner(x+1, !firstGreen);
+        }
+        if (x<w-1) {
+            inner(x, firstGreen);
+        }
+        convert(w-1, y);
+    }
+}
+
+void BayerCarrier::debayerMalvarRows(yarp::sig::ImageOf<PixelMono>& src,
+                                     yarp::sig::ImageOf<PixelRgb>& dest,
+                                     int y0, int y1) {
+    // Malvar, He, Cutler, "High-quality linear interpolation for demosaicing
+    // of Bayer-patterned color images", ICASSP 2004.
+    // The 5x5 kernels are scaled by 16 to use only integers.
+    const int w = src.width();
+    const int h = src.height();
+    for (int y=y0; y<y1; y++) {
+        const PixelMono* r0 = src.getRow(mirror(y-2, h));
+        const PixelMono* r1 = src.getRow(mirror(y-1, h));
+        const PixelMono* r2 = src.getRow(y);
+        const PixelMono* r3 = src.getRow(mirror(y+1, h));
+        const PixelMono* r4 = src.getRow(mirror(y+2, h));
+        auto* po = reinterpret_cast<PixelRgb*>(dest.getRow(y));
+        const bool redRow = (y%2==roff);
+
+        auto convert = [=](int x, int xm2, int xm1, int xp1, int xp2, bool green) {
+            const int c = r2[x];
+            const int diag = r1[xm1] + r1[xp1] + r3[xm1] + r3[xp1];
+            PixelRgb p;
+            if (green) {
+                // interpolate the color of the horizontal and of the
+                // vertical neighbors
+                const int hor = 10*c + 8*(r2[xm1]+r2[xp1]) - 2*(r2[xm2]+r2[xp2]) - 2*diag + (r0[x]+r4[x]);
+                const int ver = 10*c + 8*(r1[x]+r3[x]) - 2*(r0[x]+r4[x]) - 2*diag + (r2[xm2]+r2[xp2]);
+                p.r = toPixel(redRow ? hor : ver);
+                p.g = static_cast<PixelMono>(c);
+                p.b = toPixel(redRow ? ver : hor);
             } else {
-                float r = 0;
-                int ct = 0;
-                if (x>0&&y>0) { r += src.pixel(x-1,y-1); ct++; }
-                if (x>0&&y<h-1) { r += src.pixel(x-1,y+1); ct++; }
-                if (x<w-1&&y>0) { r += src.pixel(x+1,y-1); ct++; }
-                if (x<w-1&&y<h-1) { r += src.pixel(x+1,y+1); ct++; }
-                if (ct>0) { r /= ct; }
-                po.r = static_cast<int>(r);
+                // interpolate green, and the other color from the diagonal
+                // neighbors
+                const int axial2 = r0[x] + r4[x] + r2[xm2] + r2[xp2];
+                const int g = 8*c + 4*(r1[x]+r3[x]+r2[xm1]+r2[xp1]) - 2*axial2;
+                const int other = 12*c + 4*diag - 3*axial2;
+                p.r = redRow ? static_cast<PixelMono>(c) : toPixel(other);
+                p.g = toPixel(g);
+                p.b = redRow ? toPixel(other) : static_cast<PixelMono>(c);
             }
+            po[x] = p;
+        };
+
+        // the borders, where the neighbors are reflected in the image
+        for (int x : {0, 1, w-2, w-1}) {
+            convert(x, mirror(x-2, w), mirror(x-1, w), mirror(x+1, w), mirror(x+2, w), (x+y)%2==goff);
+        }
+
+        // the inner pixels, two by two to avoid checking their color
+        const bool firstGreen = ((2+y)%2==goff);
+        int x = 2;
+#if defined(YARP_BAYER_SSE2)
+        for (; x+10<=w; x+=8) {
+            malvarSse2(r0, r1, r2, r3, r4, x, firstGreen, redRow, po);
+        }
+#endif
+        for (; x+1<w-2; x+=2) {
+            convert(x, x-2, x-1, x+1, x+2, firstGreen);
+            convert(x+1, x-1, x, x+2, x+3, !firstGreen);
+        }
+        if (x<w-2) {
+            convert(x, x-2, x-1, x+1, x+2, firstGreen);
         }
     }
-    return true;
+}
+
+void BayerCarrier::forEachBand(int rows, const std::function<void(int, int)>& fn) const {
+    const int n = static_cast<int>(std::min(threads, static_cast<size_t>(std::max(rows, 1))));
+    if (n<=1 || !workers) {
+        fn(0, rows);
+        return;
+    }
+    const int band = (rows+n-1)/n;
+    workers->run(n, [&](size_t i, size_t) {
+        const int y0 = std::min(rows, static_cast<int>(i)*band);
+        const int y1 = std::min(rows, static_cast<int>(i+1)*band);
+        fn(y0, y1);
+    });
 }
 
 bool BayerCarrier::processBuffered() const {
@@ -0,0 +1,350 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Time.h>
+#include <yarp/sig/Image.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+namespace {
+
+const PixelRgb color {200, 120, 40};
+
+// A grbg bayer image of a scene of uniform color
+void fillBayer(ImageOf<PixelMono>& img, size_t width, size_t height)
+{
+    img.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            if ((x + y) % 2 == 0) {
+                img.pixel(x, y) = color.g;
+            } else if (y % 2 == 0) {
+                img.pixel(x, y) = color.r;
+            } else {
+                img.pixel(x, y) = color.b;
+            }
+        }
+    }
+}
+
+bool hasColor(const ImageOf<PixelRgb>& img, size_t border)
+{
+    for (size_t y = border; y < img.height() - border; y++) {
+        for (size_t x = border; x < img.width() - border; x++) {
+            const PixelRgb& p = img.pixel(x, y);
+            if (p.r != color.r || p.g != color.g || p.b != color.b) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// A grbg bayer image of a non uniform scene: horizontal and vertical
+// gradients, with a checkerboard of 4x4 squares that gives sharp edges and
+// values saturating at both ends
+void fillPattern(ImageOf<PixelMono>& img, size_t width, size_t height)
+{
+    img.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            const int gradient = static_cast<int>(x * 5 + y * 3);
+            const bool dark = ((x / 4) + (y / 4)) % 2 == 0;
+            img.pixel(x, y) = static_cast<PixelMono>(dark ? gradient % 64 : 255 - (gradient % 64));
+        }
+    }
+}
+
+bool sameImage(const ImageOf<PixelRgb>& a, const ImageOf<PixelRgb>& b)
+{
+    if (a.width() != b.width() || a.height() != b.height()) {
+        return false;
+    }
+    for (size_t y = 0; y < a.height(); y++) {
+        for (size_t x = 0; x < a.width(); x++) {
+            const PixelRgb& pa = a.pixel(x, y);
+            const PixelRgb& pb = b.pixel(x, y);
+            if (pa.r != pb.r || pa.g != pb.g || pa.b != pb.b) {
+                UNSCOPED_INFO("pixel (" << x << ", " << y << "): "
+                              << int(pa.r) << " " << int(pa.g) << " " << int(pa.b) << " instead of "
+                              << int(pb.r) << " " << int(pb.g) << " " << int(pb.b));
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// The offsets used by the carrier for the given order
+void offsets(const std::string& order, int& goff, int& roff)
+{
+    goff = (order[0] == 'g') ? 0 : 1;
+    roff = (order[0] == 'r' || order[1] == 'r') ? 0 : 1;
+}
+
+// The bilinear conversion of the carrier, as it was before the fast path
+// for the inner pixels, one pixel at a time
+ImageOf<PixelRgb> referenceBilinear(const ImageOf<PixelMono>& src, const std::string& order)
+{
+    int goff;
+    int roff;
+    offsets(order, goff, roff);
+    const int w = src.width();
+    const int h = src.height();
+    const int goff1 = 1 - goff;
+    const int roffx = roff ? goff : goff1;
+    const int boff = 1 - roff;
+    const int boffx = boff ? goff : goff1;
+    auto at = [&](int x, int y) { return static_cast<float>(src.pixel(x, y)); };
+    // the average of the neighbors in the image, among the given offsets
+    auto average = [&](int x, int y, std::initializer_list<std::pair<int, int>> neighbors) {
+        float sum = 0;
+        int ct = 0;
+        for (const auto& n : neighbors) {
+            const int xn = x + n.first;
+            const int yn = y + n.second;
+            if (xn >= 0 && xn < w && yn >= 0 && yn < h) {
+                sum += at(xn, yn);
+                ct++;
+            }
+        }
+        return static_cast<PixelMono>(static_cast<int>(ct > 0 ? sum / ct : 0));
+    };
+    // the value of a color that is at (xoff, yoff) in each 2x2 block
+    auto color = [&](int x, int y, int xoff, int yoff) {
+        if (y % 2 == yoff && x % 2 == xoff) {
+            return src.pixel(x, y);
+        }
+        if (y % 2 == yoff) {
+            return average(x, y, {{-1, 0}, {1, 0}});
+        }
+        if (x % 2 == xoff) {
+            return average(x, y, {{0, -1}, {0, 1}});
+        }
+        return average(x, y, {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}});
+    };
+
+    ImageOf<PixelRgb> dest;
+    dest.resize(w, h);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            PixelRgb& po = dest.pixel(x, y);
+            po.g = ((x + y) % 2 == goff) ? src.pixel(x, y) : average(x, y, {{-1, 0}, {1, 0}, {0, -1}, {0, 1}});
+            po.b = color(x, y, boffx, boff);
+            po.r = color(x, y, roffx, roff);
+        }
+    }
+    return dest;
+}
+
+// The malvar conversion computed with the 5x5 kernels of the paper, one
+// pixel at a time, with the image reflected around the border pixels
+ImageOf<PixelRgb> referenceMalvar(const ImageOf<PixelMono>& src, const std::string& order)
+{
+    int goff;
+    int roff;
+    offsets(order, goff, roff);
+    const int w = src.width();
+    const int h = src.height();
+    auto mirror = [](int i, int n) { return i < 0 ? -i : (i >= n ? 2 * (n - 1) - i : i); };
+    auto at = [&](int x, int y) { return static_cast<int>(src.pixel(mirror(x, w), mirror(y, h))); };
+    auto clamp = [](int v) { return static_cast<PixelMono>(std::clamp((v + 8) >> 4, 0, 255)); };
+
+    ImageOf<PixelRgb> dest;
+    dest.resize(w, h);
+    for (int y = 0; y < h; y++) {
+        const bool redRow = (y % 2 == roff);
+        for (int x = 0; x < w; x++) {
+            const int c = at(x, y);
+            const int n1 = at(x, y - 1);
+            const int s1 = at(x, y + 1);
+            const int w1 = at(x - 1, y);
+            const int e1 = at(x + 1, y);
+            const int n2 = at(x, y - 2);
+            const int s2 = at(x, y + 2);
+            const int w2 = at(x - 2, y);
+            const int e2 = at(x + 2, y);
+            const int diag = at(x - 1, y - 1) + at(x + 1, y - 1) + at(x - 1, y + 1) + at(x + 1, y + 1);
+            PixelRgb& po = dest.pixel(x, y);
+            if ((x + y) % 2 == goff) {
+                // the color of the same row, and the one of the same column
+                const int row = 10 * c + 8 * (w1 + e1) - 2 * (w2 + e2) - 2 * diag + (n2 + s2);
+                const int col = 10 * c + 8 * (n1 + s1) - 2 * (n2 + s2) - 2 * diag + (w2 + e2);
+                po.g = static_cast<PixelMono>(c);
+                po.r = clamp(redRow ? row : col);
+                po.b = clamp(redRow ? col : row);
+            } else {
+                const int g = 8 * c + 4 * (n1 + s1 + w1 + e1) - 2 * (n2 + s2 + w2 + e2);
+                const int other = 12 * c + 4 * diag - 3 * (n2 + s2 + w2 + e2);
+                po.g = clamp(g);
+                po.r = redRow ? static_cast<PixelMono>(c) : clamp(other);
+                po.b = redRow ? clamp(other) : static_cast<PixelMono>(c);
+            }
+        }
+    }
+    return dest;
+}
+
+} // namespace
+
+TEST_CASE("carriers::bayer", "[carriers]")
+{
+    YARP_REQUIRE_PLUGIN("bayer", "carrier");
+
+    Network::setLocalMode(true);
+
+    struct TestCase {
+        std::string carrier;
+        size_t width;
+        size_t border;
+    };
+
+    auto tc = GENERATE(
+        TestCase {"tcp+recv.bayer", 64, 1},
+        TestCase {"tcp+recv.bayer+threads.3", 64, 1},
+        TestCase {"tcp+recv.bayer+threads.3", 37, 1},
+        TestCase {"tcp+recv.bayer+method.malvar", 64, 0},
+        TestCase {"tcp+recv.bayer+method.malvar+threads.3", 37, 0}
+    );
+
+    SECTION("demosaicing with " + tc.carrier)
+    {
+        BufferedPort<ImageOf<PixelMono>> out;
+        BufferedPort<ImageOf<PixelRgb>> in;
+        out.setStrict();
+        in.setStrict();
+        REQUIRE(out.open("/bayer/out"));
+        REQUIRE(in.open("/bayer/in"));
+        REQUIRE(Network::connect(out.getName(), in.getName(), tc.carrier));
+        Network::sync(out.getName());
+
+        constexpr size_t height = 21;
+        fillBayer(out.prepare(), tc.width, height);
+        out.writeStrict();
+
+        ImageOf<PixelRgb>* received = in.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == tc.width);
+        REQUIRE(received->height() == height);
+        CHECK(hasColor(*received, tc.border));
+
+        out.close();
+        in.close();
+    }
+
+    Network::setLocalMode(false);
+}
+
+TEST_CASE("carriers::bayer_pattern", "[carriers]")
+{
+    YARP_REQUIRE_PLUGIN("bayer", "carrier");
+
+    Network::setLocalMode(true);
+
+    struct TestCase {
+        std::string carrier;
+        std::string order;
+        size_t width;
+        bool malvar;
+    };
+
+    // The bilinear method uses libdc1394 with one thread when the width is a
+    // multiple of 8, and the carrier's code otherwise.  Wide images make the
+    // malvar method use the SSE2 code for most of the row, the narrow ones
+    // use the scalar code only.
+    auto tc = GENERATE(
+        TestCase {"tcp+recv.bayer", "grbg", 37, false},
+        TestCase {"tcp+recv.bayer+threads.3", "grbg", 64, false},
+        TestCase {"tcp+recv.bayer+threads.4+order.bggr", "bggr", 37, false},
+        TestCase {"tcp+recv.bayer+threads.2+order.gbrg", "gbrg", 6, false},
+        TestCase {"tcp+recv.bayer+method.malvar", "grbg", 64, true},
+        TestCase {"tcp+recv.bayer+method.malvar", "grbg", 11, true},
+        TestCase {"tcp+recv.bayer+method.malvar+threads.3", "grbg", 37, true},
+        TestCase {"tcp+recv.bayer+method.malvar+order.rggb", "rggb", 45, true},
+        TestCase {"tcp+recv.bayer+method.malvar+threads.5+order.gbrg", "gbrg", 64, true}
+    );
+
+    SECTION("comparing " + tc.carrier + " with the reference conversion, width " + std::to_string(tc.width))
+    {
+        BufferedPort<ImageOf<PixelMono>> out;
+        BufferedPort<ImageOf<PixelRgb>> in;
+        out.setStrict();
+        in.setStrict();
+        REQUIRE(out.open("/bayer/out"));
+        REQUIRE(in.open("/bayer/in"));
+        REQUIRE(Network::connect(out.getName(), in.getName(), tc.carrier));
+        Network::sync(out.getName());
+
+        constexpr size_t height = 21;
+        ImageOf<PixelMono>& bayer = out.prepare();
+        fillPattern(bayer, tc.width, height);
+        ImageOf<PixelRgb> expected = tc.malvar ? referenceMalvar(bayer, tc.order) : referenceBilinear(bayer, tc.order);
+        out.writeStrict();
+
+        ImageOf<PixelRgb>* received = in.read();
+        REQUIRE(received != nullptr);
+        CHECK(sameImage(*received, expected));
+
+        out.close();
+        in.close();
+    }
+
+    Network::setLocalMode(false);
+}
+
+TEST_CASE("carriers::bayer_threads", "[carriers]")
+{
+    YARP_REQUIRE_PLUGIN("bayer", "carrier");
+
+    Network::setLocalMode(true);
+
+    auto method = GENERATE(std::string(""), std::string("+method.malvar"), std::string("+size.half"));
+    // the widths are not multiples of 8, otherwise libdc1394 would be used
+    // with one thread
+    auto width = GENERATE(size_t{62}, size_t{37});
+
+    SECTION("comparing one and several threads, tcp+recv.bayer" + method + ", width " + std::to_string(width))
+    {
+        BufferedPort<ImageOf<PixelMono>> out;
+        BufferedPort<ImageOf<PixelRgb>> in1;
+        BufferedPort<ImageOf<PixelRgb>> in4;
+        out.setStrict();
+        in1.setStrict();
+        in4.setStrict();
+        REQUIRE(out.open("/bayer/out"));
+        REQUIRE(in1.open("/bayer/in1"));
+        REQUIRE(in4.open("/bayer/in4"));
+        REQUIRE(Network::connect(out.getName(), in1.getName(), "tcp+recv.bayer" + method));
+        REQUIRE(Network::connect(out.getName(), in4.getName(), "tcp+recv.bayer+threads.4" + method));
+        Network::sync(out.getName());
+
+        constexpr size_t height = 23;
+        fillPattern(out.prepare(), width, height);
+        out.writeStrict();
+
+        ImageOf<PixelRgb>* received1 = in1.read();
+        ImageOf<PixelRgb>* received4 = in4.read();
+        REQUIRE(received1 != nullptr);
+        REQUIRE(received4 != nullptr);
+        CHECK(sameImage(*received4, *received1));
+
+        out.close();
+        in1.close();
+        in4.close();
+    }
+
+    Network::setLocalMode(false);
+}
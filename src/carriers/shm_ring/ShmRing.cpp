@@ -0,0 +1,404 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmRing.h"
+
+#include <yarp/os/LogStream.h>
+
+#include "ShmRingLogComponent.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint32_t segmentMagic = 0x52534859; // "YHSR"
+constexpr uint32_t segmentVersion = 1;
+
+// Waiting is interrupted periodically to check if the other side is alive
+constexpr long waitTimeoutNs = 100000000;
+
+enum ReaderState : uint32_t
+{
+    readerFree = 0,
+    readerClaimed = 1,
+    readerActive = 2,
+    readerClosed = 3
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+// @return false if the wait timed out
+bool futexWait(std::atomic<uint32_t>& word, uint32_t expected)
+{
+    timespec timeout {0, waitTimeoutNs};
+    long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+    return !(ret == -1 && errno == ETIMEDOUT);
+}
+
+void futexWake(std::atomic<uint32_t>& word)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+bool isProcessAlive(int32_t pid)
+{
+    return pid <= 0 || ::kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+size_t roundUp(size_t value, size_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+} // namespace
+
+
+struct ShmRing::Slot
+{
+    std::atomic<uint64_t> seq;      // sequence number of the content
+    std::atomic<uint64_t> length;   // bytes used
+    std::atomic<uint32_t> start;    // first slot of a message
+};
+
+struct ShmRing::Reader
+{
+    std::atomic<uint32_t> state;
+    std::atomic<uint32_t> generation;
+    std::atomic<uint64_t> readSeq;  // next slot to read, the previous ones are released
+    std::atomic<int32_t> pid;
+};
+
+struct ShmRing::Header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t slotCount;
+    uint64_t slotSize;
+    uint64_t dataOffset;
+    std::atomic<int32_t> writerPid;
+    std::atomic<uint32_t> closed;
+
+    // written by the writer
+    alignas(64) std::atomic<uint64_t> published;   // number of slots published
+    std::atomic<uint32_t> publishFutex;
+    std::atomic<uint32_t> readersWaiting;
+
+    // written by the readers
+    alignas(64) std::atomic<uint32_t> releaseFutex;
+    std::atomic<uint32_t> writerWaiting;
+
+    alignas(64) Reader readers[ShmRing::maxReaders];
+};
+
+
+ShmRing::~ShmRing()
+{
+    close();
+}
+
+bool ShmRing::create(const std::string& segmentName, size_t count, size_t size)
+{
+    close();
+
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    count = std::max<size_t>(count, 2);
+    size = roundUp(std::max<size_t>(size, 1), pageSize);
+    const size_t dataOffset = roundUp(sizeof(Header) + count * sizeof(Slot), pageSize);
+    const size_t totalSize = dataOffset + count * size;
+
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        yCError(SHMRING_CARRIER, "shm_open(%s) failed: %s", segmentName.c_str(), strerror(errno));
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(totalSize)) != 0 || !map(fd, totalSize)) {
+        yCError(SHMRING_CARRIER, "Cannot allocate %zu bytes for %s: %s", totalSize, segmentName.c_str(), strerror(errno));
+        ::close(fd);
+        shm_unlink(segmentName.c_str());
+        return false;
+    }
+    ::close(fd);
+
+    header = new (header) Header;
+    header->magic = segmentMagic;
+    header->version = segmentVersion;
+    header->slotCount = count;
+    header->slotSize = size;
+    header->dataOffset = dataOffset;
+    header->writerPid = static_cast<int32_t>(::getpid());
+    header->closed = 0;
+    header->published = 0;
+    header->publishFutex = 0;
+    header->readersWaiting = 0;
+    header->releaseFutex = 0;
+    header->writerWaiting = 0;
+    for (auto& reader : header->readers) {
+        reader.state = readerFree;
+        reader.generation = 0;
+        reader.readSeq = 0;
+        reader.pid = 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        auto* s = new (&slots[i]) Slot;
+        s->seq = UINT64_MAX; // not published yet
+        s->length = 0;
+        s->start = 0;
+    }
+
+    name = segmentName;
+    owner = true;
+    slotCount = count;
+    slotSize = size;
+    data = reinterpret_cast<char*>(header) + dataOffset;
+    writeSeq = 0;
+    return true;
+}
+
+bool ShmRing::open(const std::string& segmentName)
+{
+    close();
+
+    int fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        yCError(SHMRING_CARRIER, "shm_open(%s) failed: %s", segmentName.c_str(), strerror(errno));
+        return false;
+    }
+    struct stat st;
+    bool ok = (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(Header));
+    ok = ok && map(fd, static_cast<size_t>(st.st_size));
+    ::close(fd);
+    if (!ok) {
+        yCError(SHMRING_CARRIER, "Cannot map %s", segmentName.c_str());
+        return false;
+    }
+
+    if (header->magic != segmentMagic || header->version != segmentVersion ||
+        header->dataOffset + header->slotCount * header->slotSize > mappedSize) {
+        yCError(SHMRING_CARRIER, "%s is not a valid segment", segmentName.c_str());
+        close();
+        return false;
+    }
+
+    name = segmentName;
+    owner = false;
+    slotCount = header->slotCount;
+    slotSize = header->slotSize;
+    data = reinterpret_cast<char*>(header) + header->dataOffset;
+    return true;
+}
+
+bool ShmRing::map(int fd, size_t size)
+{
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    header = static_cast<Header*>(base);
+    slots = reinterpret_cast<Slot*>(static_cast<char*>(base) + sizeof(Header));
+    mappedSize = size;
+    return true;
+}
+
+void ShmRing::close()
+{
+    if (header == nullptr) {
+        return;
+    }
+    if (owner) {
+        header->closed = 1;
+        wakeReaders();
+        shm_unlink(name.c_str());
+    }
+    munmap(header, mappedSize);
+    header = nullptr;
+    slots = nullptr;
+    data = nullptr;
+    mappedSize = 0;
+    slotCount = 0;
+    slotSize = 0;
+    owner = false;
+}
+
+ShmRing::Slot& ShmRing::slot(uint64_t seq) const
+{
+    return slots[seq % slotCount];
+}
+
+char* ShmRing::slotData(uint64_t seq) const
+{
+    return data + (seq % slotCount) * slotSize;
+}
+
+bool ShmRing::canWrite(uint64_t seq) const
+{
+    for (const auto& reader : header->readers) {
+        if (reader.state == readerActive && seq - reader.readSeq >= slotCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShmRing::removeDeadReaders()
+{
+    for (auto& reader : header->readers) {
+        if (reader.state == readerActive && !isProcessAlive(reader.pid)) {
+            yCWarning(SHMRING_CARRIER, "Reader process %d of %s is gone", static_cast<int>(reader.pid), name.c_str());
+            reader.state = readerFree;
+        }
+    }
+}
+
+bool ShmRing::isWriterAlive() const
+{
+    return header->closed == 0 && isProcessAlive(header->writerPid);
+}
+
+char* ShmRing::beginSlot(const std::atomic<bool>& stop)
+{
+    while (!stop) {
+        uint32_t released = header->releaseFutex;
+        if (canWrite(writeSeq)) {
+            return slotData(writeSeq);
+        }
+        header->writerWaiting = 1;
+        if (canWrite(writeSeq)) {
+            continue;
+        }
+        if (!futexWait(header->releaseFutex, released)) {
+            removeDeadReaders();
+        }
+    }
+    return nullptr;
+}
+
+void ShmRing::publishSlot(size_t length, bool start)
+{
+    Slot& s = slot(writeSeq);
+    s.length = length;
+    s.start = start ? 1 : 0;
+    s.seq = writeSeq;
+    writeSeq++;
+    header->published = writeSeq;
+    header->publishFutex++;
+    if (header->readersWaiting.exchange(0) != 0) {
+        futexWake(header->publishFutex);
+    }
+}
+
+void ShmRing::closeReader(int index, uint32_t generation)
+{
+    Reader& reader = header->readers[index];
+    uint32_t expected = readerActive;
+    if (reader.generation == generation && reader.state.compare_exchange_strong(expected, readerClosed)) {
+        wakeReaders();
+    }
+}
+
+bool ShmRing::isReaderAlive(int index, uint32_t generation) const
+{
+    const Reader& reader = header->readers[index];
+    return reader.state == readerActive && reader.generation == generation;
+}
+
+int ShmRing::addReader(uint32_t& generation)
+{
+    for (size_t i = 0; i < maxReaders; i++) {
+        Reader& reader = header->readers[i];
+        uint32_t expected = readerFree;
+        if (!reader.state.compare_exchange_strong(expected, readerClaimed)) {
+            continue;
+        }
+        generation = ++reader.generation;
+        reader.pid = static_cast<int32_t>(::getpid());
+        reader.readSeq = header->published.load();
+        reader.state = readerActive;
+        // The writer might have started overwriting the slot before seeing
+        // this reader active, but not the slots published after this point.
+        reader.readSeq = header->published.load();
+        skipToStart = true;
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void ShmRing::removeReader(int index)
+{
+    header->readers[index].state = readerFree;
+    wakeWriter();
+}
+
+const char* ShmRing::acquireSlot(int index, size_t& length, const std::atomic<bool>& stop)
+{
+    Reader& reader = header->readers[index];
+    while (!stop) {
+        if (reader.state != readerActive) {
+            return nullptr;
+        }
+        uint32_t futex = header->publishFutex;
+        uint64_t seq = reader.readSeq;
+        if (header->published > seq) {
+            Slot& s = slot(seq);
+            if (s.seq != seq) {
+                // Cannot happen unless the reader was removed as dead
+                yCError(SHMRING_CARRIER, "Lost data on %s", name.c_str());
+                return nullptr;
+            }
+            if (skipToStart && s.start == 0) {
+                releaseSlot(index);
+                continue;
+            }
+            skipToStart = false;
+            length = s.length;
+            return slotData(seq);
+        }
+        if (header->closed != 0) {
+            return nullptr;
+        }
+        header->readersWaiting = 1;
+        if (header->published > seq) {
+            continue;
+        }
+        if (!futexWait(header->publishFutex, futex) && !isWriterAlive()) {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void ShmRing::releaseSlot(int index)
+{
+    header->readers[index].readSeq++;
+    header->releaseFutex++;
+    if (header->writerWaiting.exchange(0) != 0) {
+        futexWake(header->releaseFutex);
+    }
+}
+
+void ShmRing::wakeReaders()
+{
+    header->publishFutex++;
+    futexWake(header->publishFutex);
+}
+
+void ShmRing::wakeWriter()
+{
+    header->releaseFutex++;
+    futexWake(header->releaseFutex);
+}
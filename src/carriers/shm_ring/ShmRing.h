@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SHMRING_SHMRING_H
+#define YARP_SHMRING_SHMRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A ring of fixed size slots in POSIX shared memory, with one writer and
+ * several readers (possibly in different processes).
+ *
+ * The writer fills one slot at a time and publishes it.  Each reader has its
+ * own cursor in the ring and "borrows" the slot it is reading, i.e. the slot
+ * is not overwritten until all the readers have released it, therefore the
+ * data can be copied straight from the shared memory to its destination.
+ * The writer waits when the oldest slot was not released by all readers
+ * yet.  Waiting and waking up use futexes in the shared memory, no socket
+ * or semaphore is involved.
+ *
+ * Messages larger than a slot are split across consecutive slots, and the
+ * first slot of each message is marked, so that a reader attaching in the
+ * middle of a message can skip to the beginning of the next one.
+ */
+class ShmRing
+{
+public:
+    static constexpr size_t maxReaders = 16;
+
+    ShmRing() = default;
+    ShmRing(const ShmRing&) = delete;
+    ShmRing(ShmRing&&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+    ShmRing& operator=(ShmRing&&) = delete;
+    ~ShmRing();
+
+    /**
+     * Create a new segment, as the writer.
+     *
+     * @param name name of the segment (see shm_open())
+     * @param slotCount number of slots in the ring
+     * @param slotSize size of each slot, rounded up to a multiple of the page size
+     */
+    bool create(const std::string& name, size_t slotCount, size_t slotSize);
+
+    /**
+     * Map an existing segment, as a reader.
+     */
+    bool open(const std::string& name);
+
+    /**
+     * Unmap the segment. The writer also removes its name, and wakes up the
+     * readers, that will see the end of the stream.
+     */
+    void close();
+
+    bool isOpen() const { return header != nullptr; }
+    const std::string& getName() const { return name; }
+    size_t getSlotCount() const { return slotCount; }
+    size_t getSlotSize() const { return slotSize; }
+
+    // Writer side
+
+    /**
+     * Wait until the next slot can be written.
+     *
+     * @param stop checked periodically while waiting
+     * @return a pointer to the slot, or nullptr if stopped
+     */
+    char* beginSlot(const std::atomic<bool>& stop);
+
+    /**
+     * Make the slot returned by beginSlot() available to the readers.
+     *
+     * @param length the number of bytes written in the slot
+     * @param start true if this slot is the first one of a message
+     */
+    void publishSlot(size_t length, bool start);
+
+    /**
+     * Close the stream of a reader (e.g. when its connection is removed).
+     */
+    void closeReader(int index, uint32_t generation);
+
+    /**
+     * @return true if the reader is still attached to the ring.
+     */
+    bool isReaderAlive(int index, uint32_t generation) const;
+
+    // Reader side
+
+    /**
+     * Register a new reader, that will receive the messages starting from
+     * the next one published.
+     *
+     * @return the index of the reader, or -1 if there is no room left.
+     */
+    int addReader(uint32_t& generation);
+
+    /**
+     * Unregister a reader.
+     */
+    void removeReader(int index);
+
+    /**
+     * Wait for the next slot.
+     *
+     * @param index the reader
+     * @param length the number of bytes available in the slot
+     * @param stop checked periodically while waiting
+     * @return a pointer to the slot, or nullptr if the stream is over (or
+     *         stopped).
+     */
+    const char* acquireSlot(int index, size_t& length, const std::atomic<bool>& stop);
+
+    /**
+     * Give back the slot returned by acquireSlot() to the writer.
+     */
+    void releaseSlot(int index);
+
+    /**
+     * Wake up all the readers waiting for data.
+     */
+    void wakeReaders();
+
+    /**
+     * Wake up the writer, if it is waiting for a slot.
+     */
+    void wakeWriter();
+
+private:
+    struct Header;
+    struct Reader;
+    struct Slot;
+
+    bool map(int fd, size_t size);
+    Slot& slot(uint64_t seq) const;
+    char* slotData(uint64_t seq) const;
+    bool canWrite(uint64_t seq) const;
+    void removeDeadReaders();
+    bool isWriterAlive() const;
+
+    std::string name;
+    bool owner {false};
+    Header* header {nullptr};
+    Slot* slots {nullptr};
+    char* data {nullptr};
+    size_t mappedSize {0};
+
+    size_t slotCount {0};
+    size_t slotSize {0};
+
+    // the next slot to write (writer only)
+    uint64_t writeSeq {0};
+    // a new reader skips the slots until the beginning of a message
+    bool skipToStart {true};
+};
+
+#endif // YARP_SHMRING_SHMRING_H
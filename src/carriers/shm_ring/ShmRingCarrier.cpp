@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmRingCarrier.h"
+#include "ShmRingStream.h"
+
+#include <yarp/os/ConnectionState.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/NetInt32.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Route.h>
+
+#include "ShmRingLogComponent.h"
+
+#include <string>
+
+using namespace yarp::os;
+
+namespace {
+
+// Segment names are short (see shm_open()), reject anything else
+constexpr NetInt32 maxNameLength = 255;
+
+bool writeInt(ConnectionState& proto, NetInt32 value)
+{
+    Bytes b(reinterpret_cast<char*>(&value), sizeof(value));
+    proto.os().write(b);
+    return proto.os().isOk();
+}
+
+bool readInt(ConnectionState& proto, NetInt32& value)
+{
+    Bytes b(reinterpret_cast<char*>(&value), sizeof(value));
+    return proto.is().readFull(b) == static_cast<yarp::conf::ssize_t>(sizeof(value));
+}
+
+} // namespace
+
+ShmRingCarrier::~ShmRingCarrier()
+{
+    if (writer) {
+        writer->removeSender(this);
+    }
+}
+
+Carrier* ShmRingCarrier::create() const
+{
+    return new ShmRingCarrier();
+}
+
+std::string ShmRingCarrier::getName() const
+{
+    return name;
+}
+
+bool ShmRingCarrier::requireAck() const
+{
+    return false;
+}
+
+bool ShmRingCarrier::isConnectionless() const
+{
+    return false;
+}
+
+bool ShmRingCarrier::supportReply() const
+{
+    return false;
+}
+
+bool ShmRingCarrier::isActive() const
+{
+    // Only one of the connections of a port writes in the shared ring
+    return !writer || writer->isElect(this);
+}
+
+bool ShmRingCarrier::isBroadcast() const
+{
+    return true;
+}
+
+bool ShmRingCarrier::checkHeader(const Bytes& header)
+{
+    if (header.length() != headerSize) {
+        return false;
+    }
+    for (size_t i = 0; i < headerSize; i++) {
+        if (header.get()[i] != headerCode[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShmRingCarrier::getHeader(Bytes& header) const
+{
+    for (size_t i = 0; i < headerSize && i < header.length(); i++) {
+        header.get()[i] = headerCode[i];
+    }
+}
+
+bool ShmRingCarrier::sendHeader(ConnectionState& proto)
+{
+    // I am the sender
+    writer = ShmRingWriter::get(proto.getRoute().getFromName(), slots, slotSize);
+    if (!writer) {
+        return false;
+    }
+    if (!defaultSendHeader(proto)) {
+        return false;
+    }
+    segmentName = writer->getRing().getName();
+    if (!writeInt(proto, static_cast<NetInt32>(segmentName.length()))) {
+        return false;
+    }
+    Bytes b(const_cast<char*>(segmentName.c_str()), segmentName.length());
+    proto.os().write(b);
+    return proto.os().isOk();
+}
+
+bool ShmRingCarrier::expectExtraHeader(ConnectionState& proto)
+{
+    // I am the receiver
+    NetInt32 len = 0;
+    if (!readInt(proto, len) || len <= 0 || len > maxNameLength) {
+        yCError(SHMRING_CARRIER, "Problem with the shm_ring header");
+        return false;
+    }
+    segmentName.resize(static_cast<size_t>(len));
+    Bytes b(segmentName.data(), segmentName.length());
+    if (proto.is().readFull(b) != len) {
+        yCError(SHMRING_CARRIER, "Problem with the shm_ring header");
+        return false;
+    }
+    return true;
+}
+
+bool ShmRingCarrier::respondToHeader(ConnectionState& proto)
+{
+    // I am the receiver
+    Contact remote = proto.getStreams().getRemoteAddress();
+    Contact local = proto.getStreams().getLocalAddress();
+    if (remote.getHost() != local.getHost()) {
+        yCError(SHMRING_CARRIER, "The ports are on different machines, shm_ring not supported");
+        return false;
+    }
+
+    auto* stream = new ShmRingStream;
+    stream->setAddresses(local, remote);
+    bool ok = stream->openReceiver(segmentName);
+
+    // Tell the sender which reader was assigned to this connection
+    writeInt(proto, ok ? stream->getReaderIndex() : -1);
+    writeInt(proto, ok ? static_cast<NetInt32>(stream->getGeneration()) : 0);
+    proto.os().flush();
+    if (!ok) {
+        delete stream;
+        return false;
+    }
+
+    proto.takeStreams(nullptr); // free up port from tcp
+    proto.takeStreams(stream);
+    yCDebug(SHMRING_CARRIER, "Reading %s as reader %d", segmentName.c_str(), stream->getReaderIndex());
+    return true;
+}
+
+bool ShmRingCarrier::expectReplyToHeader(ConnectionState& proto)
+{
+    // I am the sender
+    NetInt32 index = -1;
+    NetInt32 generation = 0;
+    if (!readInt(proto, index) || !readInt(proto, generation) || index < 0) {
+        yCError(SHMRING_CARRIER, "The receiver could not attach to %s", segmentName.c_str());
+        return false;
+    }
+
+    auto* stream = new ShmRingStream;
+    stream->setAddresses(proto.getStreams().getLocalAddress(), proto.getStreams().getRemoteAddress());
+    stream->openSender(writer, index, static_cast<uint32_t>(generation));
+
+    proto.takeStreams(nullptr); // free up port from tcp
+    proto.takeStreams(stream);
+    writer->addSender(this);
+    yCDebug(SHMRING_CARRIER, "Writing %s for reader %d", segmentName.c_str(), static_cast<int>(index));
+    return true;
+}
+
+bool ShmRingCarrier::configure(ConnectionState& proto)
+{
+    Property options;
+    options.fromString(proto.getSenderSpecifier());
+    return configureFromProperty(options);
+}
+
+bool ShmRingCarrier::configureFromProperty(Property& options)
+{
+    if (options.check("slots")) {
+        int value = options.find("slots").asInt32();
+        if (value < 2) {
+            yCError(SHMRING_CARRIER, "At least 2 slots are required");
+            return false;
+        }
+        slots = static_cast<size_t>(value);
+    }
+    if (options.check("slot_size")) {
+        int64_t value = options.find("slot_size").asInt64();
+        if (value <= 0) {
+            yCError(SHMRING_CARRIER, "Invalid slot size");
+            return false;
+        }
+        slotSize = static_cast<size_t>(value);
+    }
+    return true;
+}
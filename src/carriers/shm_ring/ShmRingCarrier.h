@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SHMRING_SHMRINGCARRIER_H
+#define YARP_SHMRING_SHMRINGCARRIER_H
+
+#include <yarp/os/AbstractCarrier.h>
+
+#include "ShmRingWriter.h"
+
+#include <memory>
+
+/**
+ * \ingroup carriers_lists
+ * Communicating between ports on the same host through a ring of slots in
+ * POSIX shared memory, synchronized with futexes.
+ *
+ * All the shm_ring connections leaving a port share the same ring, and each
+ * message is written once regardless of the number of readers.
+ *
+ * The size of the ring can be set when connecting, e.g.
+ * `shm_ring+slots.4+slot_size.8388608`.  The options of the first
+ * connection of a port are used.
+ */
+class ShmRingCarrier :
+        public yarp::os::AbstractCarrier
+{
+public:
+    ShmRingCarrier() = default;
+    ShmRingCarrier(const ShmRingCarrier&) = delete;
+    ShmRingCarrier(ShmRingCarrier&&) = delete;
+    ShmRingCarrier& operator=(const ShmRingCarrier&) = delete;
+    ShmRingCarrier& operator=(ShmRingCarrier&&) = delete;
+
+    ~ShmRingCarrier() override;
+
+    yarp::os::Carrier* create() const override;
+
+    std::string getName() const override;
+
+    bool requireAck() const override;
+    bool isConnectionless() const override;
+    bool supportReply() const override;
+    bool isActive() const override;
+    bool isBroadcast() const override;
+
+    bool checkHeader(const yarp::os::Bytes& header) override;
+    void getHeader(yarp::os::Bytes& header) const override;
+
+    bool sendHeader(yarp::os::ConnectionState& proto) override;
+    bool expectExtraHeader(yarp::os::ConnectionState& proto) override;
+    bool respondToHeader(yarp::os::ConnectionState& proto) override;
+    bool expectReplyToHeader(yarp::os::ConnectionState& proto) override;
+
+    bool configure(yarp::os::ConnectionState& proto) override;
+    bool configureFromProperty(yarp::os::Property& options) override;
+
+private:
+    static constexpr const char* name = "shm_ring";
+    static constexpr const char* headerCode = "SHM_RING";
+    static constexpr size_t headerSize = 8;
+
+    static constexpr size_t defaultSlots = 8;
+    static constexpr size_t defaultSlotSize = 1024 * 1024;
+
+    size_t slots {defaultSlots};
+    size_t slotSize {defaultSlotSize};
+
+    std::string segmentName;
+    std::shared_ptr<ShmRingWriter> writer;
+};
+
+#endif // YARP_SHMRING_SHMRINGCARRIER_H
@@ -0,0 +1,13 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmRingLogComponent.h"
+
+YARP_LOG_COMPONENT(SHMRING_CARRIER,
+                   "yarp.carrier.ShmRingCarrier",
+                   yarp::os::Log::minimumPrintLevel(),
+                   yarp::os::Log::LogTypeReserved,
+                   yarp::os::Log::printCallback(),
+                   nullptr)
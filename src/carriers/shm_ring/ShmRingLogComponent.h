@@ -0,0 +1,13 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SHMRING_SHMRINGLOGCOMPONENT_H
+#define YARP_SHMRING_SHMRINGLOGCOMPONENT_H
+
+#include <yarp/os/LogComponent.h>
+
+YARP_DECLARE_LOG_COMPONENT(SHMRING_CARRIER)
+
+#endif // YARP_SHMRING_SHMRINGLOGCOMPONENT_H
@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmRingStream.h"
+
+#include <yarp/os/LogStream.h>
+
+#include "ShmRingLogComponent.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace yarp::os;
+
+ShmRingStream::~ShmRingStream()
+{
+    close();
+    ring.close();
+}
+
+bool ShmRingStream::openSender(std::shared_ptr<ShmRingWriter> w, int index, uint32_t gen)
+{
+    writer = std::move(w);
+    readerIndex = index;
+    generation = gen;
+    return writer != nullptr;
+}
+
+bool ShmRingStream::openReceiver(const std::string& name)
+{
+    if (!ring.open(name)) {
+        return false;
+    }
+    readerIndex = ring.addReader(generation);
+    if (readerIndex < 0) {
+        yCError(SHMRING_CARRIER, "Too many readers on %s", name.c_str());
+        ring.close();
+        return false;
+    }
+    return true;
+}
+
+void ShmRingStream::setAddresses(const Contact& local, const Contact& remote)
+{
+    localAddress = local;
+    remoteAddress = remote;
+}
+
+InputStream& ShmRingStream::getInputStream()
+{
+    return *this;
+}
+
+OutputStream& ShmRingStream::getOutputStream()
+{
+    return *this;
+}
+
+const Contact& ShmRingStream::getLocalAddress() const
+{
+    return localAddress;
+}
+
+const Contact& ShmRingStream::getRemoteAddress() const
+{
+    return remoteAddress;
+}
+
+void ShmRingStream::interrupt()
+{
+    stop = true;
+    if (writer) {
+        writer->getRing().wakeWriter();
+    } else if (ring.isOpen()) {
+        ring.wakeReaders();
+    }
+}
+
+void ShmRingStream::close()
+{
+    if (closed.exchange(true)) {
+        return;
+    }
+    interrupt();
+    if (writer) {
+        writer->getRing().closeReader(readerIndex, generation);
+    } else if (ring.isOpen() && readerIndex >= 0) {
+        // The segment is unmapped in the destructor, since a read might
+        // still be in progress in another thread.
+        ring.removeReader(readerIndex);
+    }
+}
+
+bool ShmRingStream::isOk() const
+{
+    if (closed || !happy) {
+        return false;
+    }
+    if (writer) {
+        return writer->getRing().isReaderAlive(readerIndex, generation);
+    }
+    return ring.isOpen();
+}
+
+void ShmRingStream::reset()
+{
+}
+
+yarp::conf::ssize_t ShmRingStream::read(Bytes& b)
+{
+    if (writer || !ring.isOpen() || closed) {
+        return -1;
+    }
+    while (current == nullptr) {
+        current = ring.acquireSlot(readerIndex, currentLength, stop);
+        if (current == nullptr) {
+            happy = false;
+            return -1;
+        }
+        currentOffset = 0;
+        if (currentLength == 0) {
+            ring.releaseSlot(readerIndex);
+            current = nullptr;
+        }
+    }
+    size_t n = std::min(b.length(), currentLength - currentOffset);
+    memcpy(b.get(), current + currentOffset, n);
+    currentOffset += n;
+    if (currentOffset == currentLength) {
+        ring.releaseSlot(readerIndex);
+        current = nullptr;
+    }
+    return static_cast<yarp::conf::ssize_t>(n);
+}
+
+void ShmRingStream::write(const Bytes& b)
+{
+    writev(&b, 1);
+}
+
+void ShmRingStream::writev(const Bytes* blocks, size_t count)
+{
+    // Nothing is sent back by the receiver
+    if (!writer || closed) {
+        return;
+    }
+    if (!writer->write(blocks, count, stop)) {
+        happy = false;
+    }
+}
+
+void ShmRingStream::flush()
+{
+    if (writer) {
+        writer->flush();
+    }
+}
+
+void ShmRingStream::beginPacket()
+{
+    if (writer) {
+        writer->beginMessage();
+    }
+}
+
+void ShmRingStream::endPacket()
+{
+    flush();
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SHMRING_SHMRINGSTREAM_H
+#define YARP_SHMRING_SHMRINGSTREAM_H
+
+#include "ShmRing.h"
+#include "ShmRingWriter.h"
+
+#include <yarp/os/Contact.h>
+#include <yarp/os/TwoWayStream.h>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * A one way stream over a shm_ring. The sender side writes in the ring
+ * shared by all the connections of the port, the receiver side reads using
+ * its own reader.
+ */
+class ShmRingStream :
+        public yarp::os::TwoWayStream,
+        public yarp::os::InputStream,
+        public yarp::os::OutputStream
+{
+public:
+    ShmRingStream() = default;
+    ShmRingStream(const ShmRingStream&) = delete;
+    ShmRingStream(ShmRingStream&&) = delete;
+    ShmRingStream& operator=(const ShmRingStream&) = delete;
+    ShmRingStream& operator=(ShmRingStream&&) = delete;
+
+    ~ShmRingStream() override;
+
+    /**
+     * Open the sender side, for the reader registered by the receiver.
+     */
+    bool openSender(std::shared_ptr<ShmRingWriter> writer, int readerIndex, uint32_t generation);
+
+    /**
+     * Open the receiver side, registering a new reader in the ring.
+     */
+    bool openReceiver(const std::string& name);
+
+    int getReaderIndex() const { return readerIndex; }
+    uint32_t getGeneration() const { return generation; }
+
+    void setAddresses(const yarp::os::Contact& local, const yarp::os::Contact& remote);
+
+    InputStream& getInputStream() override;
+    OutputStream& getOutputStream() override;
+    const yarp::os::Contact& getLocalAddress() const override;
+    const yarp::os::Contact& getRemoteAddress() const override;
+
+    void interrupt() override;
+    void close() override;
+    bool isOk() const override;
+    void reset() override;
+
+    using yarp::os::InputStream::read;
+    yarp::conf::ssize_t read(yarp::os::Bytes& b) override;
+
+    using yarp::os::OutputStream::write;
+    void write(const yarp::os::Bytes& b) override;
+    void writev(const yarp::os::Bytes* blocks, size_t count) override;
+    void flush() override;
+
+    void beginPacket() override;
+    void endPacket() override;
+
+private:
+    // sender
+    std::shared_ptr<ShmRingWriter> writer;
+
+    // receiver
+    ShmRing ring;
+    const char* current {nullptr};
+    size_t currentLength {0};
+    size_t currentOffset {0};
+
+    int readerIndex {-1};
+    uint32_t generation {0};
+
+    std::atomic<bool> stop {false};
+    std::atomic<bool> closed {false};
+    bool happy {true};
+
+    yarp::os::Contact localAddress;
+    yarp::os::Contact remoteAddress;
+};
+
+#endif // YARP_SHMRING_SHMRINGSTREAM_H
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmRingWriter.h"
+
+#include <yarp/os/LogStream.h>
+
+#include "ShmRingLogComponent.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <unistd.h>
+
+using namespace yarp::os;
+
+std::shared_ptr<ShmRingWriter> ShmRingWriter::get(const std::string& portName, size_t slotCount, size_t slotSize)
+{
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<ShmRingWriter>> writers;
+    static size_t counter = 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = writers.find(portName);
+    if (it != writers.end()) {
+        if (auto writer = it->second.lock()) {
+            return writer;
+        }
+        writers.erase(it);
+    }
+
+    // The segment name is unique on the host, port names are not valid names
+    std::string name = "/yarp-shm_ring-" + std::to_string(::getpid()) + "-" + std::to_string(counter++);
+    std::shared_ptr<ShmRingWriter> writer(new ShmRingWriter);
+    if (!writer->ring.create(name, slotCount, slotSize)) {
+        return nullptr;
+    }
+    yCDebug(SHMRING_CARRIER,
+            "Created %s for %s (%zu slots of %zu bytes)",
+            name.c_str(),
+            portName.c_str(),
+            writer->ring.getSlotCount(),
+            writer->ring.getSlotSize());
+    writers[portName] = writer;
+    return writer;
+}
+
+void ShmRingWriter::addSender(const void* sender)
+{
+    std::lock_guard<std::mutex> lock(sendersMutex);
+    senders.push_back(sender);
+}
+
+void ShmRingWriter::removeSender(const void* sender)
+{
+    std::lock_guard<std::mutex> lock(sendersMutex);
+    senders.erase(std::remove(senders.begin(), senders.end(), sender), senders.end());
+}
+
+bool ShmRingWriter::isElect(const void* sender) const
+{
+    std::lock_guard<std::mutex> lock(sendersMutex);
+    return !senders.empty() && senders.front() == sender;
+}
+
+void ShmRingWriter::beginMessage()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (used != 0) {
+        publish();
+    }
+    start = true;
+}
+
+bool ShmRingWriter::write(const Bytes* blocks, size_t count, const std::atomic<bool>& stop)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    for (size_t i = 0; i < count; i++) {
+        const char* src = blocks[i].get();
+        size_t remaining = blocks[i].length();
+        while (remaining > 0) {
+            if (slot == nullptr) {
+                slot = ring.beginSlot(stop);
+                if (slot == nullptr) {
+                    return false;
+                }
+            }
+            size_t n = std::min(remaining, ring.getSlotSize() - used);
+            memcpy(slot + used, src, n);
+            used += n;
+            src += n;
+            remaining -= n;
+            if (used == ring.getSlotSize()) {
+                publish();
+            }
+        }
+    }
+    return true;
+}
+
+void ShmRingWriter::flush()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (used != 0) {
+        publish();
+    }
+}
+
+void ShmRingWriter::publish()
+{
+    ring.publishSlot(used, start);
+    start = false;
+    slot = nullptr;
+    used = 0;
+}
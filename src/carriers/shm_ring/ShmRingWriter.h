@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SHMRING_SHMRINGWRITER_H
+#define YARP_SHMRING_SHMRINGWRITER_H
+
+#include "ShmRing.h"
+
+#include <yarp/os/Bytes.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * The writer side of a ring, shared by all the shm_ring connections leaving
+ * the same port.
+ *
+ * Each connection has its own reader in the ring, but the messages are
+ * written only once, by the first connection still alive (the "elect"), the
+ * other connections are inactive (as in the mcast carrier).
+ */
+class ShmRingWriter
+{
+public:
+    /**
+     * Get the writer of a port, creating the ring if needed.
+     * The slotCount and slotSize are used only when the ring is created.
+     */
+    static std::shared_ptr<ShmRingWriter> get(const std::string& portName, size_t slotCount, size_t slotSize);
+
+    ShmRingWriter(const ShmRingWriter&) = delete;
+    ShmRingWriter(ShmRingWriter&&) = delete;
+    ShmRingWriter& operator=(const ShmRingWriter&) = delete;
+    ShmRingWriter& operator=(ShmRingWriter&&) = delete;
+    ~ShmRingWriter() = default;
+
+    ShmRing& getRing() { return ring; }
+
+    void addSender(const void* sender);
+    void removeSender(const void* sender);
+    bool isElect(const void* sender) const;
+
+    /**
+     * The next bytes written are the beginning of a message.
+     */
+    void beginMessage();
+
+    /**
+     * Copy the blocks to the ring, waiting for free slots if needed.
+     *
+     * @return false if interrupted
+     */
+    bool write(const yarp::os::Bytes* blocks, size_t count, const std::atomic<bool>& stop);
+
+    /**
+     * Publish the slot partially written, if any.
+     */
+    void flush();
+
+private:
+    ShmRingWriter() = default;
+
+    void publish();
+
+    ShmRing ring;
+
+    mutable std::mutex sendersMutex;
+    std::vector<const void*> senders;
+
+    std::mutex writeMutex;
+    char* slot {nullptr};
+    size_t used {0};
+    bool start {false};
+};
+
+#endif // YARP_SHMRING_SHMRINGWRITER_H
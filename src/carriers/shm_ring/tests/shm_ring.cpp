@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Time.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <string>
+
+using namespace yarp::os;
+
+TEST_CASE("carriers::shm_ring", "[carriers]")
+{
+    YARP_REQUIRE_PLUGIN("shm_ring", "carrier");
+
+    Network::setLocalMode(true);
+
+    SECTION("messages larger than a slot")
+    {
+        BufferedPort<Bottle> out;
+        BufferedPort<Bottle> in;
+        out.setStrict();
+        in.setStrict();
+        REQUIRE(out.open("/shm_ring/out"));
+        REQUIRE(in.open("/shm_ring/in"));
+        REQUIRE(Network::connect(out.getName(), in.getName(), "shm_ring+slots.2+slot_size.4096"));
+        Network::sync(out.getName());
+
+        std::string blob(20000, 'x');
+        for (int i = 0; i < 10; i++) {
+            blob[i] = static_cast<char>('a' + i);
+            Bottle& b = out.prepare();
+            b.clear();
+            b.addInt32(i);
+            b.addString(blob);
+            out.writeStrict();
+
+            Bottle* received = in.read();
+            REQUIRE(received != nullptr);
+            CHECK(received->get(0).asInt32() == i);
+            CHECK(received->get(1).asString() == blob);
+        }
+
+        out.close();
+        in.close();
+    }
+
+    SECTION("several readers of one writer")
+    {
+        BufferedPort<Bottle> out;
+        BufferedPort<Bottle> in1;
+        BufferedPort<Bottle> in2;
+        out.setStrict();
+        in1.setStrict();
+        in2.setStrict();
+        REQUIRE(out.open("/shm_ring/out"));
+        REQUIRE(in1.open("/shm_ring/in1"));
+        REQUIRE(in2.open("/shm_ring/in2"));
+        REQUIRE(Network::connect(out.getName(), in1.getName(), "shm_ring"));
+        REQUIRE(Network::connect(out.getName(), in2.getName(), "shm_ring"));
+        Network::sync(out.getName());
+
+        for (int i = 0; i < 20; i++) {
+            Bottle& b = out.prepare();
+            b.clear();
+            b.addInt32(i);
+            out.writeStrict();
+        }
+        for (int i = 0; i < 20; i++) {
+            Bottle* b1 = in1.read();
+            Bottle* b2 = in2.read();
+            REQUIRE(b1 != nullptr);
+            REQUIRE(b2 != nullptr);
+            CHECK(b1->get(0).asInt32() == i);
+            CHECK(b2->get(0).asInt32() == i);
+        }
+
+        // The remaining reader still receives after a disconnection
+        REQUIRE(Network::disconnect(out.getName(), in1.getName()));
+        Network::sync(out.getName());
+        Bottle& b = out.prepare();
+        b.clear();
+        b.addInt32(42);
+        out.writeStrict();
+        Bottle* b2 = in2.read();
+        REQUIRE(b2 != nullptr);
+        CHECK(b2->get(0).asInt32() == 42);
+
+        out.close();
+        in1.close();
+        in2.close();
+    }
+
+    Network::setLocalMode(false);
+}
@@ -188,6 +188,14 @@ bool UnixSockTwoWayStream::isOk() const
     return happy;
 }
 
+int UnixSockTwoWayStream::getPollHandle() const
+{
+    if (closed || !happy) {
+        return -1;
+    }
+    return openedAsReader ? sender_fd : reader_fd;
+}
+
 void UnixSockTwoWayStream::reset()
 {
 }
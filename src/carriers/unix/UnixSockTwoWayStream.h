@@ -46,6 +46,8 @@ public:
 
     bool isOk() const override;
 
+    int getPollHandle() const override;
+
     void reset() override;
 
     void beginPacket() override;
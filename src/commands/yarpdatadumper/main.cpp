@@ -19,6 +19,7 @@
 #include <string>
 #include <array>
 #include <deque>
+#include <vector>
 #include <utility>
 #include <mutex>
 #include <algorithm>
@@ -91,6 +92,7 @@ class DumpImage : public DumpObj
 {
 private:
     Image *p;
+    std::vector<unsigned char> encoded;
 #ifdef ADD_VIDEO
     cv::Mat img;
 #endif
@@ -102,10 +104,14 @@ public:
     const DumpImage &operator=(const DumpImage &obj) { *p=*(obj.p); return *this; }
     ~DumpImage() { delete p; }
 
-    const std::string toFile(const std::string &dirName, unsigned int cnt) override
+    const Image &getYarpImage() const { return *p; }
+
+    // The image already encoded in the file format, if any
+    void setEncoded(std::vector<unsigned char> data) { encoded=std::move(data); }
+
+    file::image_fileformat getFileFormat(std::string &ext) const
     {
         file::image_fileformat fileformat = file::FORMAT_NULL;
-        std::string ext;
 
         int code=p->getPixelCode();
         switch (code)
@@ -157,12 +163,27 @@ public:
                 }
             break;
         }
+        return fileformat;
+    }
+
+    const std::string toFile(const std::string &dirName, unsigned int cnt) override
+    {
+        std::string ext;
+        file::image_fileformat fileformat = getFileFormat(ext);
 
         std::ostringstream fName;
         fName << std::setw(8) << std::setfill('0') << cnt << ext;
-        file::write(*p,dirName+"/"+fName.str(), fileformat);
+        if (!encoded.empty())
+        {
+            std::ofstream fout(dirName+"/"+fName.str(), std::ios::binary);
+            fout.write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+        }
+        else
+        {
+            file::write(*p,dirName+"/"+fName.str(), fileformat);
+        }
 
-        return (fName.str()+" ["+Vocab32::decode(code)+"]");
+        return (fName.str()+" ["+Vocab32::decode(p->getPixelCode())+"]");
     }
 
 #ifdef ADD_VIDEO
@@ -352,6 +373,8 @@ private:
     bool            txTime;
     bool            closing;
 
+    file::ImageEncoderPool encoder;
+
 #ifdef ADD_VIDEO
     std::ofstream   ftimecodes;
     std::string     videoFile;
@@ -482,6 +505,35 @@ public:
         return true;
     }
 
+    // Encode the JPG/PNG images on several threads, before writing them
+    void encodeImages(std::vector<DumpItem> &items)
+    {
+        if ((type != DumpFormat::image_jpg) && (type != DumpFormat::image_png)) {
+            return;
+        }
+        file::image_fileformat format = (type == DumpFormat::image_jpg) ? file::FORMAT_JPG : file::FORMAT_PNG;
+
+        std::vector<DumpImage*> images;
+        std::vector<const Image*> src;
+        for (auto &item : items)
+        {
+            auto* image=dynamic_cast<DumpImage*>(item.obj);
+            std::string ext;
+            if ((image != nullptr) && (image->getFileFormat(ext) == format))
+            {
+                images.push_back(image);
+                src.push_back(&image->getYarpImage());
+            }
+        }
+
+        // The images that fail are written later one by one, reporting the error
+        std::vector<std::vector<unsigned char>> encoded;
+        encoder.encode(src, encoded, format);
+        for (size_t i=0; i<images.size(); i++) {
+            images[i]->setEncoded(std::move(encoded[i]));
+        }
+    }
+
     void run() override
     {
         //!!! access to size must be protected: problem spotted with Linux stl
@@ -528,13 +580,23 @@ public:
             }
         #endif
 
-            // save to disk
+            std::vector<DumpItem> items;
+            items.reserve(sz);
+            buf.lock();
             for (unsigned int i=0; i<sz; i++)
             {
-                buf.lock();
-                DumpItem item=buf.front();
+                items.push_back(buf.front());
                 buf.pop_front();
-                buf.unlock();
+            }
+            buf.unlock();
+
+            if (saveData) {
+                encodeImages(items);
+            }
+
+            // save to disk
+            for (auto &item : items)
+            {
 
                 fdata << item.seqNumber << ' ' << item.timeStamp.getString() << ' ';
                 if (saveData) {
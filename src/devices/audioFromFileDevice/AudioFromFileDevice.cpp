@@ -87,8 +87,6 @@ bool AudioFromFileDevice::open(yarp::os::Searchable &config)
     //AudioBufferSize buffer_size(m_audiorecorder_cfg.numSamples* c_EXTRA_SPACE, m_audiorecorder_cfg.numChannels, m_audiorecorder_cfg.bytesPerSample);
     //m_inputBuffer = new yarp::dev::CircularAudioBuffer_16t("fake_mic_buffer", buffer_size);
 
-    m_datap = m_audioFile.getInterleavedAudioRawData();
-
     //start the capture thread
     start();
     return true;
@@ -131,18 +129,23 @@ void AudioFromFileDevice::run()
     //just restart from the beginning in an endless loop
     size_t chan_num = m_audioFile.getChannels();
     size_t fsize_in_samples = m_audioFile.getSamples();
-    for (size_t i = 0; i < m_driver_frame_size; i++)
+    if (fsize_in_samples == 0)
+    {
+        return;
+    }
+    m_frame.resize(m_driver_frame_size * chan_num);
+    auto* frame = reinterpret_cast<yarp::sig::Sound::audio_sample*>(m_frame.data());
+    for (size_t i = 0; i < m_driver_frame_size;)
     {
         if (m_bpnt >= fsize_in_samples)
         {
             m_bpnt = 0;
         }
-        for (size_t c=0; c< chan_num; c++)
-        {
-            m_inputBuffer->write((unsigned short)(m_datap.at(m_bpnt* chan_num +c).get()));
-        }
-        m_bpnt++;
+        size_t copied = m_audioFile.copyToInterleaved(frame + i * chan_num, m_bpnt, m_driver_frame_size - i);
+        i += copied;
+        m_bpnt += copied;
     }
+    m_inputBuffer->write(m_frame.data(), m_frame.size());
 
     if (m_audiobase_debug)
     {
@@ -58,5 +58,5 @@ public:
 private:
     yarp::sig::Sound m_audioFile;
     size_t m_bpnt = 0;
-    std::vector<std::reference_wrapper<yarp::sig::Sound::audio_sample>> m_datap;
+    std::vector<unsigned short> m_frame; // samples of a frame, interleaved
 };
@@ -48,6 +48,8 @@ bool ControlBoardRemapper::parseOptions(Property& prop)
 {
     bool ok = true;
 
+    parallelSubDevices = prop.check("parallel_subdevices", Value(false), "call the subcontrolboards concurrently").asBool();
+
     usingAxesNamesForAttachAll  = prop.check("axesNames", "list of networks merged by this wrapper");
     usingNetworksForAttachAll = prop.check("networks", "list of networks merged by this wrapper");
 
@@ -475,6 +477,9 @@ bool ControlBoardRemapper::attachAllUsingNetworks(const PolyDriverList &polylist
 bool ControlBoardRemapper::detachAll()
 {
     //check if we already instantiated a subdevice previously
+    workers.reset();
+    workerResults.clear();
+
     int devices=remappedControlBoards.getNrOfSubControlBoards();
     for (int k = 0; k < devices; k++) {
         remappedControlBoards.getSubControlBoard(k)->detach();
@@ -488,6 +493,89 @@ void ControlBoardRemapper::configureBuffers()
 {
     allJointsBuffers.configure(remappedControlBoards);
     selectedJointsBuffers.configure(remappedControlBoards);
+
+    size_t nrOfSubControlBoards = remappedControlBoards.getNrOfSubControlBoards();
+    if (parallelSubDevices && nrOfSubControlBoards > 1)
+    {
+        workers = std::make_unique<yarp::os::WorkerPool>(nrOfSubControlBoards);
+        workerResults.resize(nrOfSubControlBoards);
+    }
+    else
+    {
+        workers.reset();
+        workerResults.clear();
+    }
+}
+
+template <typename F>
+ReturnValue ControlBoardRemapper::forEachSubControlBoard(F&& f)
+{
+    size_t nrOfSubControlBoards = remappedControlBoards.getNrOfSubControlBoards();
+    ReturnValue ret=ReturnValue_ok;
+
+    // If the workers are busy with a call from another thread, the
+    // subcontrolboards are called by this thread, one after the other
+    auto task = [&](size_t ctrlBrd, size_t)
+    {
+        workerResults[ctrlBrd] = f(ctrlBrd, remappedControlBoards.getSubControlBoard(ctrlBrd));
+    };
+    if (workers && workers->tryRun(nrOfSubControlBoards, task))
+    {
+        for (size_t ctrlBrd = 0; ctrlBrd < nrOfSubControlBoards; ctrlBrd++)
+        {
+            ret = ret && workerResults[ctrlBrd];
+        }
+        return ret;
+    }
+
+    for (size_t ctrlBrd = 0; ctrlBrd < nrOfSubControlBoards; ctrlBrd++)
+    {
+        ReturnValue ok = f(ctrlBrd, remappedControlBoards.getSubControlBoard(ctrlBrd));
+        ret = ret && ok;
+    }
+    return ret;
+}
+
+template <typename F>
+ReturnValue ControlBoardRemapper::forEachRemappedAxis(F&& f)
+{
+    if (!workers)
+    {
+        ReturnValue ret=ReturnValue_ok;
+        for(int l=0;l<controlledJoints;l++)
+        {
+            int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
+            size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
+
+            RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
+            if (!p)
+            {
+                return ReturnValue::return_code::return_value_error_generic;
+            }
+
+            ReturnValue ok = f(l, off, p);
+            ret = ret && ok;
+        }
+        return ret;
+    }
+
+    // The axes are grouped by subcontrolboard, one task for each of them
+    return forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
+    {
+        if (!p)
+        {
+            return ReturnValue::return_code::return_value_error_generic;
+        }
+
+        ReturnValue ret=ReturnValue_ok;
+        for (int l : allJointsBuffers.m_axesInSubControlBoard[ctrlBrd])
+        {
+            int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
+            ReturnValue ok = f(l, off, p);
+            ret = ret && ok;
+        }
+        return ret;
+    });
 }
 
 
@@ -544,28 +632,14 @@ ReturnValue ControlBoardRemapper::setPids(const PidControlTypeEnum& pidtype, con
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->setPid(pidtype, off, ps[l]);
-            ret=ret&&ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->setPid(pidtype, off, ps[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -593,28 +667,14 @@ ReturnValue ControlBoardRemapper::setPidReferences(const PidControlTypeEnum& pid
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->setPidReference(pidtype, off, refs[l]);
-            ret=ret&&ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->setPidReference(pidtype, off, refs[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -641,28 +701,14 @@ ReturnValue ControlBoardRemapper::setPidErrorLimits(const PidControlTypeEnum& pi
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->setPidErrorLimit(pidtype, off, limits[l]);
-            ret=ret&&ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->setPidErrorLimit(pidtype, off, limits[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -690,27 +736,14 @@ ReturnValue ControlBoardRemapper::getPidErrors(const PidControlTypeEnum& pidtype
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->getPidError(pidtype, off, errs+l);
-            ret=ret&&ok;
+            return p->pid->getPidError(pidtype, off, errs+l);
         }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
-        }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -737,27 +770,14 @@ ReturnValue ControlBoardRemapper::getPidOutputs(const PidControlTypeEnum& pidtyp
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ret=ret&&p->pid->getPidOutput(pidtype, off, outs+l);
+            return p->pid->getPidOutput(pidtype, off, outs+l);
         }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
-        }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -860,27 +880,14 @@ ReturnValue ControlBoardRemapper::getPids(const PidControlTypeEnum& pidtype, Pid
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->getPid(pidtype, off, pids+l);
-            ret = ok && ret;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->getPid(pidtype, off, pids+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -908,28 +915,14 @@ ReturnValue ControlBoardRemapper::getPidReferences(const PidControlTypeEnum& pid
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->getPidReference(pidtype, off, refs+l);
-            ret=ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->getPidReference(pidtype, off, refs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -956,29 +949,14 @@ ReturnValue ControlBoardRemapper::getPidErrorLimits(const PidControlTypeEnum& pi
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->getPidErrorLimit(pidtype, off, limits+l);
-            ret=ret&&ok;
+            return p->pid->getPidErrorLimit(pidtype, off, limits+l);
         }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
-        }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -1081,27 +1059,14 @@ ReturnValue ControlBoardRemapper::getPidExtraInfos(const PidControlTypeEnum& pid
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->pid)
         {
-            ReturnValue ok = p->pid->getPidExtraInfo(pidtype, off, units[l]);
-            ret = ok && ret;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->pid->getPidExtraInfo(pidtype, off, units[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -1140,10 +1105,8 @@ ReturnValue ControlBoardRemapper::positionMove(const double *refs)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(refs,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->positionMove(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1153,8 +1116,8 @@ ReturnValue ControlBoardRemapper::positionMove(const double *refs)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1166,10 +1129,8 @@ ReturnValue ControlBoardRemapper::positionMove(const int n_joints, const int *jo
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(refs,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->positionMove(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1179,8 +1140,8 @@ ReturnValue ControlBoardRemapper::positionMove(const int n_joints, const int *jo
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1211,10 +1172,8 @@ ReturnValue ControlBoardRemapper::getTargetPositions(double *spds)
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->pos )
@@ -1228,8 +1187,8 @@ ReturnValue ControlBoardRemapper::getTargetPositions(double *spds)
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(spds,remappedControlBoards);
 
@@ -1245,10 +1204,8 @@ ReturnValue ControlBoardRemapper::getTargetPositions(const int n_joints, const i
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->pos )
@@ -1262,8 +1219,8 @@ ReturnValue ControlBoardRemapper::getTargetPositions(const int n_joints, const i
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(targets,n_joints,joints,remappedControlBoards);
 
@@ -1297,9 +1254,8 @@ ReturnValue ControlBoardRemapper::relativeMove(const double *deltas)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(deltas,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->relativeMove(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1309,8 +1265,8 @@ ReturnValue ControlBoardRemapper::relativeMove(const double *deltas)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1322,9 +1278,8 @@ ReturnValue ControlBoardRemapper::relativeMove(const int n_joints, const int *jo
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(deltas,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->relativeMove(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1334,8 +1289,8 @@ ReturnValue ControlBoardRemapper::relativeMove(const int n_joints, const int *jo
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1454,10 +1409,8 @@ ReturnValue ControlBoardRemapper::setTrajSpeeds(const double *spds)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(spds,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->setTrajSpeeds(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1467,8 +1420,8 @@ ReturnValue ControlBoardRemapper::setTrajSpeeds(const double *spds)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1480,10 +1433,8 @@ ReturnValue ControlBoardRemapper::setTrajSpeeds(const int n_joints, const int *j
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(spds,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->setTrajSpeeds(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1493,8 +1444,8 @@ ReturnValue ControlBoardRemapper::setTrajSpeeds(const int n_joints, const int *j
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1526,10 +1477,8 @@ ReturnValue ControlBoardRemapper::setTrajAccelerations(const double *accs)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(accs,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->setTrajAccelerations(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1539,8 +1488,8 @@ ReturnValue ControlBoardRemapper::setTrajAccelerations(const double *accs)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1552,10 +1501,8 @@ ReturnValue ControlBoardRemapper::setTrajAccelerations(const int n_joints, const
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(accs,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->setTrajAccelerations(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1565,8 +1512,8 @@ ReturnValue ControlBoardRemapper::setTrajAccelerations(const int n_joints, const
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1596,10 +1543,8 @@ ReturnValue ControlBoardRemapper::getTrajSpeeds(double *spds)
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if( p->pos )
         {
@@ -1612,8 +1557,8 @@ ReturnValue ControlBoardRemapper::getTrajSpeeds(double *spds)
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(spds,remappedControlBoards);
 
@@ -1629,10 +1574,8 @@ ReturnValue ControlBoardRemapper::getTrajSpeeds(const int n_joints, const int *j
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->pos )
@@ -1646,8 +1589,8 @@ ReturnValue ControlBoardRemapper::getTrajSpeeds(const int n_joints, const int *j
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(spds,n_joints,joints,remappedControlBoards);
 
@@ -1679,10 +1622,8 @@ ReturnValue ControlBoardRemapper::getTrajAccelerations(double *accs)
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->pos )
@@ -1696,8 +1637,8 @@ ReturnValue ControlBoardRemapper::getTrajAccelerations(double *accs)
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(accs,remappedControlBoards);
 
@@ -1712,10 +1653,8 @@ ReturnValue ControlBoardRemapper::getTrajAccelerations(const int n_joints, const
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if( p->pos )
         {
@@ -1728,8 +1667,8 @@ ReturnValue ControlBoardRemapper::getTrajAccelerations(const int n_joints, const
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(accs,n_joints,joints,remappedControlBoards);
 
@@ -1761,10 +1700,8 @@ ReturnValue ControlBoardRemapper::stop()
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->stop(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1774,8 +1711,8 @@ ReturnValue ControlBoardRemapper::stop()
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1789,9 +1726,8 @@ ReturnValue ControlBoardRemapper::stop(const int n_joints, const int *joints)
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(buffers.dummyBuffer.data(),n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
         ReturnValue ok = ReturnValue_ok;
         if (p->pos) {
             ok = p->pos->stop(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1801,8 +1737,8 @@ ReturnValue ControlBoardRemapper::stop(const int n_joints, const int *joints)
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1857,10 +1793,8 @@ ReturnValue ControlBoardRemapper::velocityMove(const double *v)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(v,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->vel) {
             ok = p->vel->velocityMove(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -1870,8 +1804,8 @@ ReturnValue ControlBoardRemapper::velocityMove(const double *v)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -1900,27 +1834,14 @@ ReturnValue ControlBoardRemapper::resetEncoders()
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->resetEncoder(off);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iJntEnc->resetEncoder(off);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -1948,28 +1869,14 @@ ReturnValue ControlBoardRemapper::setEncoders(const double *vals)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off = (int) remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex = remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p = remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->setEncoder(off, vals[l]);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iJntEnc->setEncoder(off, vals[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -1997,28 +1904,14 @@ ReturnValue ControlBoardRemapper::getEncoders(double *encs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->getEncoder(off, encs+l);
-            ret = ret && ok;
+            return p->iJntEnc->getEncoder(off, encs+l);
         }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
-        }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2026,28 +1919,14 @@ ReturnValue ControlBoardRemapper::getEncodersTimed(double *encs, double *t)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->getEncoderTimed(off, encs+l, t+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iJntEnc->getEncoderTimed(off, encs+l, t+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2095,28 +1974,14 @@ ReturnValue ControlBoardRemapper::getEncoderSpeeds(double *spds)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->getEncoderSpeed(off, spds+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iJntEnc->getEncoderSpeed(off, spds+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2144,28 +2009,14 @@ ReturnValue ControlBoardRemapper::getEncoderAccelerations(double *accs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iJntEnc)
         {
-            ReturnValue ok = p->iJntEnc->getEncoderAcceleration(off, accs+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iJntEnc->getEncoderAcceleration(off, accs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2199,26 +2050,14 @@ ReturnValue ControlBoardRemapper::getTemperature(int m, double* val)
 ReturnValue ControlBoardRemapper::getTemperatures(double *vals)
 {
     ReturnValue ret=ReturnValue_ok;
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->imotor)
         {
-            ret=ret&&p->imotor->getTemperature(off, vals+l);
+            return p->imotor->getTemperature(off, vals+l);
         }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
-        }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2424,27 +2263,14 @@ ReturnValue ControlBoardRemapper::resetMotorEncoders()
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ReturnValue ok = p->iMotEnc->resetMotorEncoder(off);
-            ret= ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->resetMotorEncoder(off);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -2473,28 +2299,14 @@ ReturnValue ControlBoardRemapper::setMotorEncoders(const double *vals)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ReturnValue ok = p->iMotEnc->setMotorEncoder(off, vals[l]);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->setMotorEncoder(off, vals[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -2563,23 +2375,14 @@ ReturnValue ControlBoardRemapper::getMotorEncoders(double *encs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p) {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ret=ret&&p->iMotEnc->getMotorEncoder(off, encs+l);
-        } else {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->getMotorEncoder(off, encs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2587,28 +2390,14 @@ ReturnValue ControlBoardRemapper::getMotorEncodersTimed(double *encs, double *t)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ReturnValue ok = p->iMotEnc->getMotorEncoderTimed(off, encs, t);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->getMotorEncoderTimed(off, encs, t);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2656,28 +2445,14 @@ ReturnValue ControlBoardRemapper::getMotorEncoderSpeeds(double *spds)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off = (int) remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex = remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p = remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ReturnValue ok = p->iMotEnc->getMotorEncoderSpeed(off, spds + l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->getMotorEncoderSpeed(off, spds + l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -2705,28 +2480,14 @@ ReturnValue ControlBoardRemapper::getMotorEncoderAccelerations(double *accs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iMotEnc)
         {
-            ReturnValue ok = p->iMotEnc->getMotorEncoderAcceleration(off, accs+l);
-            ret=ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iMotEnc->getMotorEncoderAcceleration(off, accs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -2768,28 +2529,14 @@ ReturnValue ControlBoardRemapper::getAmpStatus(int *st)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->amp)
         {
-            ReturnValue ok = p->amp->getAmpStatus(off, st+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->amp->getAmpStatus(off, st+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -3412,28 +3159,14 @@ ReturnValue ControlBoardRemapper::getRefTorques(double *refs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iTorque)
         {
-            ReturnValue ok = p->iTorque->getRefTorque(off, refs+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret = ReturnValue::return_code::return_value_error_generic;
+            return p->iTorque->getRefTorque(off, refs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
 }
 
@@ -3463,10 +3196,8 @@ ReturnValue ControlBoardRemapper::setRefTorques(const double *t)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(t,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok;
 
         if( p->iTorque )
@@ -3479,9 +3210,8 @@ ReturnValue ControlBoardRemapper::setRefTorques(const double *t)
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -3511,15 +3241,13 @@ ReturnValue ControlBoardRemapper::setRefTorques(const int n_joints, const int *j
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(t,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = p->iTorque->setRefTorques(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
                                             selectedJointsBuffers.m_jointsInSubControlBoard[ctrlBrd].data(),
                                             selectedJointsBuffers.m_bufferForSubControlBoard[ctrlBrd].data());
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -3628,28 +3356,14 @@ ReturnValue ControlBoardRemapper::getTorques(double *t)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iTorque)
         {
-            ReturnValue ok = p->iTorque->getTorque(off, t+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iTorque->getTorque(off, t+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
  }
@@ -3678,28 +3392,14 @@ ReturnValue ControlBoardRemapper::getTorqueRanges(double *min, double *max)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iTorque)
         {
-            ReturnValue ok = p->iTorque->getTorqueRange(off, min+l, max+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iTorque->getTorqueRange(off, min+l, max+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
     return ret;
  }
 
@@ -3813,10 +3513,8 @@ ReturnValue ControlBoardRemapper::getControlModes(std::vector<yarp::dev::Control
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok;
 
         if( p->iMode )
@@ -3828,9 +3526,8 @@ ReturnValue ControlBoardRemapper::getControlModes(std::vector<yarp::dev::Control
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(modes.data(),remappedControlBoards);
 
@@ -3846,10 +3543,8 @@ ReturnValue ControlBoardRemapper::getControlModes(const std::vector<int>& joints
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(joints.size(),joints.data(),remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok;
 
         if( p->iMode )
@@ -3861,9 +3556,8 @@ ReturnValue ControlBoardRemapper::getControlModes(const std::vector<int>& joints
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(modes.data(),joints.size(),joints.data(),remappedControlBoards);
 
@@ -3903,10 +3597,8 @@ ReturnValue ControlBoardRemapper::setControlModes(const std::vector<int>& joints
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(modes.data(),joints.size(),joints.data(),remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->iMode) {
             ok = p->iMode->setControlModes(  selectedJointsBuffers.m_jointsInSubControlBoard[ctrlBrd],
@@ -3915,8 +3607,8 @@ ReturnValue ControlBoardRemapper::setControlModes(const std::vector<int>& joints
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -3928,10 +3620,8 @@ ReturnValue ControlBoardRemapper::setControlModes(const std::vector<yarp::dev::S
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(modes.data(),remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->iMode) {
             ok = p->iMode->setControlModes(allJointsBuffers.m_jointsInSubControlBoard[ctrlBrd],
@@ -3940,8 +3630,8 @@ ReturnValue ControlBoardRemapper::setControlModes(const std::vector<yarp::dev::S
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -3973,10 +3663,8 @@ ReturnValue ControlBoardRemapper::setPositions(const int n_joints, const int *jo
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(dpos,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->posDir) {
             ok = p->posDir->setPositions(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -3986,8 +3674,8 @@ ReturnValue ControlBoardRemapper::setPositions(const int n_joints, const int *jo
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -3999,10 +3687,8 @@ ReturnValue ControlBoardRemapper::setPositions(const double *refs)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(refs,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->posDir) {
             ok = p->posDir->setPositions(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -4012,8 +3698,8 @@ ReturnValue ControlBoardRemapper::setPositions(const double *refs)
         else {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -4082,10 +3768,8 @@ ReturnValue ControlBoardRemapper::getRefPositions(double *spds)
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->posDir )
@@ -4099,8 +3783,8 @@ ReturnValue ControlBoardRemapper::getRefPositions(double *spds)
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(spds,remappedControlBoards);
 
@@ -4116,10 +3800,8 @@ ReturnValue ControlBoardRemapper::getRefPositions(const int n_joints, const int
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->posDir )
@@ -4133,8 +3815,8 @@ ReturnValue ControlBoardRemapper::getRefPositions(const int n_joints, const int
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(targets,n_joints,joints,remappedControlBoards);
 
@@ -4151,10 +3833,8 @@ ReturnValue ControlBoardRemapper::velocityMove(const int n_joints, const int *jo
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(spds,n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
         if (p->vel) {
             ok = p->vel->velocityMove(selectedJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
@@ -4165,8 +3845,8 @@ ReturnValue ControlBoardRemapper::velocityMove(const int n_joints, const int *jo
         {
             ok = ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -4198,10 +3878,8 @@ ReturnValue ControlBoardRemapper::getTargetVelocities(double* vels)
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->vel )
@@ -4215,8 +3893,8 @@ ReturnValue ControlBoardRemapper::getTargetVelocities(double* vels)
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(vels,remappedControlBoards);
 
@@ -4231,10 +3909,8 @@ ReturnValue ControlBoardRemapper::getTargetVelocities(const int n_joints, const
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(n_joints,joints,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->vel )
@@ -4248,8 +3924,8 @@ ReturnValue ControlBoardRemapper::getTargetVelocities(const int n_joints, const
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(vels,n_joints,joints,remappedControlBoards);
 
@@ -4284,10 +3960,8 @@ ReturnValue ControlBoardRemapper::getInteractionModes(const std::vector<int>& jo
     // Resize the input buffers
     selectedJointsBuffers.resizeSubControlBoardBuffers(joints.size(),joints.data(),remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->iMode )
@@ -4300,8 +3974,8 @@ ReturnValue ControlBoardRemapper::getInteractionModes(const std::vector<int>& jo
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     selectedJointsBuffers.fillArbitraryJointVectorFromSubControlBoardBuffers(modes.data(), joints.size(), joints.data(), remappedControlBoards);
 
@@ -4313,10 +3987,8 @@ ReturnValue ControlBoardRemapper::getInteractionModes(std::vector<yarp::dev::Int
     ReturnValue ret=ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = ReturnValue_ok;
 
         if( p->iMode )
@@ -4329,8 +4001,8 @@ ReturnValue ControlBoardRemapper::getInteractionModes(std::vector<yarp::dev::Int
             ok = ReturnValue::return_code::return_value_error_generic;
         }
 
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     allJointsBuffers.fillCompleteJointVectorFromSubControlBoardBuffers(modes.data(), remappedControlBoards);
 
@@ -4364,14 +4036,12 @@ ReturnValue ControlBoardRemapper::setInteractionModes(const std::vector<int>& jo
 
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(modes.data(), joints.size(), joints.data(), remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = p->iInteract->setInteractionModes(selectedJointsBuffers.m_jointsInSubControlBoard[ctrlBrd],
                                                            selectedJointsBuffers.m_bufferForSubControlBoardInteractionModes[ctrlBrd]);
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -4383,15 +4053,13 @@ ReturnValue ControlBoardRemapper::setInteractionModes(const std::vector<yarp::de
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(modes.data(),remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = p->iInteract->setInteractionModes(
                                                     allJointsBuffers.m_jointsInSubControlBoard[ctrlBrd],
                                                     allJointsBuffers.m_bufferForSubControlBoardInteractionModes[ctrlBrd]);
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -4417,28 +4085,14 @@ ReturnValue ControlBoardRemapper::setRefDutyCycles(const double* refs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iPwm)
         {
-            ReturnValue ok = p->iPwm->setRefDutyCycle(off, refs[l]);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iPwm->setRefDutyCycle(off, refs[l]);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4464,28 +4118,14 @@ ReturnValue ControlBoardRemapper::getRefDutyCycles(double* refs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iPwm)
         {
-            ReturnValue ok = p->iPwm->getRefDutyCycle(off, refs+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iPwm->getRefDutyCycle(off, refs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4511,28 +4151,14 @@ ReturnValue ControlBoardRemapper::getDutyCycles(double* vals)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iPwm)
         {
-            ReturnValue ok = p->iPwm->getDutyCycle(off, vals+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iPwm->getDutyCycle(off, vals+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4558,28 +4184,14 @@ ReturnValue ControlBoardRemapper::getCurrents(double *vals)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iCurr)
         {
-            ReturnValue ok = p->iCurr->getCurrent(off, vals+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iCurr->getCurrent(off, vals+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4605,28 +4217,14 @@ ReturnValue ControlBoardRemapper::getCurrentRanges(double* min, double* max)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iCurr)
         {
-            ReturnValue ok = p->iCurr->getCurrentRange(off, min+l, max+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iCurr->getCurrentRange(off, min+l, max+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4681,15 +4279,13 @@ ReturnValue ControlBoardRemapper::setRefCurrents(const double* currs)
 
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(currs,remappedControlBoards);
 
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(ctrlBrd);
-
         ReturnValue ok = p->iCurr->setRefCurrents(allJointsBuffers.m_nJointsInSubControlBoard[ctrlBrd],
                                            allJointsBuffers.m_jointsInSubControlBoard[ctrlBrd].data(),
                                            allJointsBuffers.m_bufferForSubControlBoard[ctrlBrd].data());
-        ret = ret && ok;
-    }
+        return ok;
+    });
 
     return ret;
 }
@@ -4715,28 +4311,14 @@ ReturnValue ControlBoardRemapper::getRefCurrents(double* currs)
 {
     ReturnValue ret=ReturnValue_ok;
 
-    for(int l=0;l<controlledJoints;l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off=(int)remappedControlBoards.lut[l].axisIndexInSubControlBoard;
-        size_t subIndex=remappedControlBoards.lut[l].subControlBoardIndex;
-
-        RemappedSubControlBoard *p=remappedControlBoards.getSubControlBoard(subIndex);
-
-        if (!p)
-        {
-            return ReturnValue::return_code::return_value_error_generic;
-        }
-
         if (p->iCurr)
         {
-            ReturnValue ok = p->iCurr->getRefCurrent(off, currs+l);
-            ret = ret && ok;
-        }
-        else
-        {
-            ret=ReturnValue::return_code::return_value_error_generic;
+            return p->iCurr->getRefCurrent(off, currs+l);
         }
-    }
+        return ReturnValue::return_code::return_value_error_generic;
+    });
 
     return ret;
 }
@@ -4829,17 +4411,15 @@ yarp::dev::ReturnValue ControlBoardRemapper::setRefVelocity(const std::vector<do
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
     allJointsBuffers.fillSubControlBoardBuffersFromCompleteJointVector(vels.data(), remappedControlBoards);
 
-    for (size_t ctrlBrd = 0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard* p = remappedControlBoards.getSubControlBoard(ctrlBrd);
         if (!p || !p->iVelDir)
         {
-            ret = ReturnValue::return_code::return_value_error_generic;
-            continue;
+            return ReturnValue::return_code::return_value_error_generic;
         }
         std::vector<double> subVels = allJointsBuffers.m_bufferForSubControlBoard[ctrlBrd];
-        ret = ret && p->iVelDir->setRefVelocity(subVels);
-    }
+        return p->iVelDir->setRefVelocity(subVels);
+    });
     return ret;
 }
 
@@ -4853,18 +4433,16 @@ yarp::dev::ReturnValue ControlBoardRemapper::setRefVelocity(const std::vector<in
     std::lock_guard<std::mutex> lock(selectedJointsBuffers.mutex);
     selectedJointsBuffers.fillSubControlBoardBuffersFromArbitraryJointVector(vels.data(), static_cast<int>(jnts.size()), jnts.data(), remappedControlBoards);
 
-    for (size_t ctrlBrd = 0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    ret = forEachSubControlBoard([&](size_t ctrlBrd, RemappedSubControlBoard* p) -> ReturnValue
     {
-        RemappedSubControlBoard* p = remappedControlBoards.getSubControlBoard(ctrlBrd);
         if (!p || !p->iVelDir)
         {
-            ret = ReturnValue::return_code::return_value_error_generic;
-            continue;
+            return ReturnValue::return_code::return_value_error_generic;
         }
         std::vector<int> subJnts = selectedJointsBuffers.m_jointsInSubControlBoard[ctrlBrd];
         std::vector<double> subVels = selectedJointsBuffers.m_bufferForSubControlBoard[ctrlBrd];
-        ret = ret && p->iVelDir->setRefVelocity(subJnts, subVels);
-    }
+        return p->iVelDir->setRefVelocity(subJnts, subVels);
+    });
     return ret;
 }
 
@@ -4887,18 +4465,14 @@ yarp::dev::ReturnValue ControlBoardRemapper::getRefVelocity(std::vector<double>&
     ReturnValue ret = ReturnValue_ok;
     std::lock_guard<std::mutex> lock(allJointsBuffers.mutex);
 
-    for (int l = 0; l < controlledJoints; l++)
+    ret = forEachRemappedAxis([&](int l, int off, RemappedSubControlBoard* p) -> ReturnValue
     {
-        int off = static_cast<int>(remappedControlBoards.lut[l].axisIndexInSubControlBoard);
-        size_t subIndex = remappedControlBoards.lut[l].subControlBoardIndex;
-        RemappedSubControlBoard* p = remappedControlBoards.getSubControlBoard(subIndex);
-        if (!p || !p->iVelDir)
+        if (!p->iVelDir)
         {
-            ret = ReturnValue::return_code::return_value_error_generic;
-            continue;
+            return ReturnValue::return_code::return_value_error_generic;
         }
-        ret = ret && p->iVelDir->getRefVelocity(off, vels[l]);
-    }
+        return p->iVelDir->getRefVelocity(off, vels[l]);
+    });
     return ret;
 }
 
@@ -7,6 +7,7 @@
 #define YARP_DEV_CONTROLBOARDREMAPPER_CONTROLBOARDREMAPPER_H
 
 #include <yarp/os/Network.h>
+#include <yarp/os/WorkerPool.h>
 
 #include <yarp/dev/ControlBoardInterfaces.h>
 #include <yarp/dev/PolyDriver.h>
@@ -15,6 +16,7 @@
 #include <yarp/os/Semaphore.h>
 #include <yarp/dev/IMultipleWrapper.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,6 +40,7 @@
  * | Parameter name | SubParameter   | Type    | Units          | Default Value | Required                    | Description                                                       | Notes |
  * |:--------------:|:--------------:|:-------:|:--------------:|:-------------:|:--------------------------: |:-----------------------------------------------------------------:|:-----:|
  * | axesNames     |      -         | vector of strings  | -      |   -           | Yes     | Ordered list of the axes that are part of the remapped device. |  |
+ * | parallel_subdevices | -        | bool    | -              |   false       | No      | If true, the methods that involve all the axes call the subcontrolboards concurrently, one thread for each subcontrolboard. | Useful when the subcontrolboards are remote, the time of a call is the maximum of their latencies instead of the sum. |
  *
  * The axes are then mapped to the wrapped controlboard in the attachAll method, using the
  * values returned by the getAxisName method of the controlboard. If different axes
@@ -115,6 +118,31 @@ private:
     // Buffer data for multiple arbitrary joint methods
     ControlBoardArbitraryAxesDecomposition selectedJointsBuffers;
 
+    /** If true, the subcontrolboards are called concurrently */
+    bool parallelSubDevices{false};
+
+    // Threads used to call the subcontrolboards concurrently
+    std::unique_ptr<yarp::os::WorkerPool> workers;
+
+    // Result of the call to each subcontrolboard executed by the workers
+    std::vector<yarp::dev::ReturnValue> workerResults;
+
+    /**
+     * Call f(ctrlBrd, p) for each subcontrolboard, and combine the results.
+     * The calls are concurrent if the parallel_subdevices option is enabled.
+     */
+    template <typename F>
+    yarp::dev::ReturnValue forEachSubControlBoard(F&& f);
+
+    /**
+     * Call f(l, off, p) for each axis l of the remapped controlboard, where
+     * off is the index of the axis in the subcontrolboard p, and combine the
+     * results.  If the parallel_subdevices option is enabled, the axes of
+     * different subcontrolboards are processed concurrently.
+     */
+    template <typename F>
+    yarp::dev::ReturnValue forEachRemappedAxis(F&& f);
+
     /**
      * Set the number of controlled axes, resizing appropriately
      * all the necessary buffers.
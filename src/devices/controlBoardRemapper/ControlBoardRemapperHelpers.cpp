@@ -8,6 +8,8 @@
 
 #include <yarp/os/LogStream.h>
 
+#include <algorithm>
+
 
 using namespace yarp::os;
 using namespace yarp::dev;
@@ -225,6 +227,8 @@ bool ControlBoardSubControlBoardAxesDecomposition::configure(const RemappedContr
 
     m_nJointsInSubControlBoard.resize(nrOfSubControlBoards,0);
     m_jointsInSubControlBoard.resize(nrOfSubControlBoards);
+    m_axesInSubControlBoard.resize(nrOfSubControlBoards);
+    m_copyRanges.clear();
 
     m_bufferForSubControlBoard.resize(nrOfSubControlBoards);
     m_bufferForSubControlBoardControlModesEnum.resize(nrOfSubControlBoards);
@@ -237,6 +241,7 @@ bool ControlBoardSubControlBoardAxesDecomposition::configure(const RemappedContr
     {
         m_nJointsInSubControlBoard[ctrlBrd] = 0;
         m_jointsInSubControlBoard[ctrlBrd].clear();
+        m_axesInSubControlBoard[ctrlBrd].clear();
         m_bufferForSubControlBoard[ctrlBrd].clear();
         m_bufferForSubControlBoardSelectableControlModesEnum[ctrlBrd].clear();
         m_bufferForSubControlBoardControlModesEnum[ctrlBrd].clear();
@@ -249,8 +254,20 @@ bool ControlBoardSubControlBoardAxesDecomposition::configure(const RemappedContr
         int off=(int)remappedControlBoards.lut[j].axisIndexInSubControlBoard;
         size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
 
+        // Consecutive axes in the same subcontrolboard are copied together
+        if (!m_copyRanges.empty() &&
+            m_copyRanges.back().subControlBoardIndex == subIndex)
+        {
+            m_copyRanges.back().nrOfAxes++;
+        }
+        else
+        {
+            m_copyRanges.push_back({subIndex, j, m_jointsInSubControlBoard[subIndex].size(), 1});
+        }
+
         m_nJointsInSubControlBoard[subIndex]++;
         m_jointsInSubControlBoard[subIndex].push_back(off);
+        m_axesInSubControlBoard[subIndex].push_back(static_cast<int>(j));
     }
 
     // Allocate enough space in buffers
@@ -269,94 +286,52 @@ bool ControlBoardSubControlBoardAxesDecomposition::configure(const RemappedContr
 
 
 
-void ControlBoardSubControlBoardAxesDecomposition::fillSubControlBoardBuffersFromCompleteJointVector(const double* full, const RemappedControlBoards & remappedControlBoards)
+template <typename T>
+void ControlBoardSubControlBoardAxesDecomposition::scatter(const T* full, std::vector< std::vector<T> >& buffers) const
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
+    for (const auto& range : m_copyRanges)
     {
-        m_bufferForSubControlBoard[ctrlBrd].clear();
+        std::copy_n(full + range.firstAxis, range.nrOfAxes, buffers[range.subControlBoardIndex].data() + range.firstInBuffer);
     }
+}
 
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
+template <typename T>
+void ControlBoardSubControlBoardAxesDecomposition::gather(T* full, const std::vector< std::vector<T> >& buffers) const
+{
+    for (const auto& range : m_copyRanges)
     {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-
-        m_bufferForSubControlBoard[subIndex].push_back(full[j]);
+        std::copy_n(buffers[range.subControlBoardIndex].data() + range.firstInBuffer, range.nrOfAxes, full + range.firstAxis);
     }
 }
 
-void ControlBoardSubControlBoardAxesDecomposition::fillCompleteJointVectorFromSubControlBoardBuffers(double* full, const RemappedControlBoards& remappedControlBoards)
+void ControlBoardSubControlBoardAxesDecomposition::fillSubControlBoardBuffersFromCompleteJointVector(const double* full, const RemappedControlBoards & remappedControlBoards)
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
-    {
-        m_counterForControlBoard[ctrlBrd] = 0;
-    }
+    scatter(full, m_bufferForSubControlBoard);
+}
 
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
-    {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-        full[j] = m_bufferForSubControlBoard[subIndex][m_counterForControlBoard[subIndex]];
-        m_counterForControlBoard[subIndex]++;
-    }
+void ControlBoardSubControlBoardAxesDecomposition::fillCompleteJointVectorFromSubControlBoardBuffers(double* full, const RemappedControlBoards& remappedControlBoards)
+{
+    gather(full, m_bufferForSubControlBoard);
 }
 
 void ControlBoardSubControlBoardAxesDecomposition::fillSubControlBoardBuffersFromCompleteJointVector(const yarp::dev::SelectableControlModeEnum* full, const RemappedControlBoards & remappedControlBoards)
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
-    {
-        m_bufferForSubControlBoardSelectableControlModesEnum[ctrlBrd].clear();
-    }
-
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
-    {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-
-        m_bufferForSubControlBoardSelectableControlModesEnum[subIndex].push_back(full[j]);
-    }
+    scatter(full, m_bufferForSubControlBoardSelectableControlModesEnum);
 }
 
 void ControlBoardSubControlBoardAxesDecomposition::fillCompleteJointVectorFromSubControlBoardBuffers(yarp::dev::ControlModeEnum* full, const RemappedControlBoards& remappedControlBoards)
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
-    {
-        m_counterForControlBoard[ctrlBrd] = 0;
-    }
-
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
-    {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-        full[j] = m_bufferForSubControlBoardControlModesEnum[subIndex][m_counterForControlBoard[subIndex]];
-        m_counterForControlBoard[subIndex]++;
-    }
+    gather(full, m_bufferForSubControlBoardControlModesEnum);
 }
 
 void ControlBoardSubControlBoardAxesDecomposition::fillSubControlBoardBuffersFromCompleteJointVector(const InteractionModeEnum* full, const RemappedControlBoards & remappedControlBoards)
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
-    {
-        m_bufferForSubControlBoardInteractionModes[ctrlBrd].clear();
-    }
-
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
-    {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-
-        m_bufferForSubControlBoardInteractionModes[subIndex].push_back(full[j]);
-    }
+    scatter(full, m_bufferForSubControlBoardInteractionModes);
 }
 
 void ControlBoardSubControlBoardAxesDecomposition::fillCompleteJointVectorFromSubControlBoardBuffers(InteractionModeEnum* full, const RemappedControlBoards& remappedControlBoards)
 {
-    for(size_t ctrlBrd=0; ctrlBrd < remappedControlBoards.getNrOfSubControlBoards(); ctrlBrd++)
-    {
-        m_counterForControlBoard[ctrlBrd] = 0;
-    }
-
-    for(int j=0; j < m_nrOfControlledAxesInRemappedCtrlBrd; j++)
-    {
-        size_t subIndex=remappedControlBoards.lut[j].subControlBoardIndex;
-        full[j] = m_bufferForSubControlBoardInteractionModes[subIndex][m_counterForControlBoard[subIndex]];
-        m_counterForControlBoard[subIndex]++;
-    }
+    gather(full, m_bufferForSubControlBoardInteractionModes);
 }
 
 bool ControlBoardArbitraryAxesDecomposition::configure(const RemappedControlBoards& remappedControlBoards)
@@ -218,6 +218,24 @@ public:
      */
     std::mutex mutex;
 
+    /**
+     * Range of consecutive axes of the remapped controlboard that are
+     * also consecutive in the buffer of a SubControlBoard.
+     */
+    struct CopyRange
+    {
+        size_t subControlBoardIndex;
+        size_t firstAxis;
+        size_t firstInBuffer;
+        size_t nrOfAxes;
+    };
+
+    // Plan used to copy the full vectors to and from the buffers
+    std::vector<CopyRange> m_copyRanges;
+
+    // Axes of the remapped controlboard in each SubControlBoard
+    std::vector< std::vector<int> > m_axesInSubControlBoard;
+
     // Buffer to be used in MultiJoint version of the
     int m_nrOfControlledAxesInRemappedCtrlBrd;
     std::vector<int> m_nJointsInSubControlBoard;
@@ -231,6 +249,13 @@ public:
 
 
     std::vector<int> m_counterForControlBoard;
+
+private:
+    template <typename T>
+    void scatter(const T* full, std::vector< std::vector<T> >& buffers) const;
+
+    template <typename T>
+    void gather(T* full, const std::vector< std::vector<T> >& buffers) const;
 };
 
 /**
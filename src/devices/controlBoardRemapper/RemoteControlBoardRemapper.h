@@ -26,6 +26,7 @@
  * | remoteControlBoards |     -     | vector of strings  | -   |   -           | Yes          | List of remote prefix used by the remote controlboards.           | The element of this list are then passed as "remote" parameter to the RemoteControlBoard device. |
  * | localPortPrefix |     -         | string             | -   |   -           | Yes          | All ports opened by this device will start with this prefix       |       |
  * | REMOTE_CONTROLBOARD_OPTIONS | - | group              | -   |   -           | No           | Options that will be passed directly to the controlBoard_nwc_yarp devices | |
+ * | parallel_subdevices | -        | bool               | -   |   false       | No           | If true, the remote controlboards are called concurrently by the methods that involve all the axes | See ControlBoardRemapper |
  * All the passed remote controlboards are opened, and then the axesNames and the opened device are
  * passed to the ControlBoardRemapper device. If different axes
  * in two attached controlboard have the same name, the behaviour of this device is undefined.
@@ -5,10 +5,14 @@
 
 #include <yarp/os/Time.h>
 #include <yarp/dev/ControlBoardInterfaces.h>
+#include <yarp/dev/Drivers.h>
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/PolyDriverList.h>
 #include <yarp/dev/IMultipleWrapper.h>
 
+#include <algorithm>
+#include <atomic>
+#include <string>
 #include <vector>
 
 #include <yarp/dev/tests/ParametersTest.h>
@@ -67,6 +71,87 @@ const char *wrapperC_file_content   = "device controlBoard_nws_yarp\n"
                                       "period 0.01\n";
 
 
+// Controlboard whose encoders take some time to be read, counting the reads
+// that are in progress at the same time
+class SlowEncodersTest :
+        public yarp::dev::DeviceDriver,
+        public yarp::dev::IEncodersTimed,
+        public yarp::dev::IAxisInfo
+{
+public:
+    static constexpr double readDelay = 0.02;
+    static std::atomic<int> readsInProgress;
+    static std::atomic<int> maxReadsInProgress;
+
+    bool open(yarp::os::Searchable& config) override
+    {
+        prefix = config.check("prefix", Value("slow")).asString();
+        axes = config.check("joints", Value(2)).asInt32();
+        return true;
+    }
+
+    bool close() override { return true; }
+
+    ReturnValue getAxes(size_t& ax) override { ax = axes; return ReturnValue_ok; }
+
+    ReturnValue getAxisName(int axis, std::string& name) override
+    {
+        name = prefix + std::to_string(axis);
+        return ReturnValue_ok;
+    }
+
+    ReturnValue getEncoder(int j, double* v) override
+    {
+        int inProgress = ++readsInProgress;
+        int max = maxReadsInProgress;
+        while (inProgress > max && !maxReadsInProgress.compare_exchange_weak(max, inProgress)) {
+        }
+        yarp::os::Time::delay(readDelay);
+        *v = j;
+        readsInProgress--;
+        return ReturnValue_ok;
+    }
+
+    ReturnValue getEncoderTimed(int j, double* v, double* t) override
+    {
+        *t = yarp::os::Time::now();
+        return getEncoder(j, v);
+    }
+
+    ReturnValue getEncoders(double* encs) override
+    {
+        ReturnValue ret = ReturnValue_ok;
+        for (int j = 0; j < static_cast<int>(axes); j++) {
+            ret = ret && getEncoder(j, encs + j);
+        }
+        return ret;
+    }
+
+    ReturnValue getEncodersTimed(double* encs, double* time) override
+    {
+        for (size_t j = 0; j < axes; j++) {
+            time[j] = yarp::os::Time::now();
+        }
+        return getEncoders(encs);
+    }
+
+    ReturnValue resetEncoder(int j) override { return ReturnValue_ok; }
+    ReturnValue resetEncoders() override { return ReturnValue_ok; }
+    ReturnValue setEncoder(int j, double val) override { return ReturnValue_ok; }
+    ReturnValue setEncoders(const double* vals) override { return ReturnValue_ok; }
+    ReturnValue getEncoderSpeed(int j, double* sp) override { *sp = 0.0; return ReturnValue_ok; }
+    ReturnValue getEncoderSpeeds(double* spds) override { std::fill(spds, spds + axes, 0.0); return ReturnValue_ok; }
+    ReturnValue getEncoderAcceleration(int j, double* spds) override { *spds = 0.0; return ReturnValue_ok; }
+    ReturnValue getEncoderAccelerations(double* accs) override { std::fill(accs, accs + axes, 0.0); return ReturnValue_ok; }
+
+private:
+    std::string prefix;
+    size_t axes{0};
+};
+
+std::atomic<int> SlowEncodersTest::readsInProgress{0};
+std::atomic<int> SlowEncodersTest::maxReadsInProgress{0};
+
 static void checkRemapper(yarp::dev::PolyDriver & ddRemapper, int rand, size_t nrOfRemappedAxes)
 {
     IPositionControl *pos = nullptr;
@@ -366,6 +451,24 @@ TEST_CASE("dev::ControlBoardRemapperTest", "[yarp::dev]")
         // Test the controlboardremapper
         checkRemapper(ddRemapper,200,nrOfRemappedAxes);
 
+        // Test the controlboardremapper calling the subcontrolboards concurrently
+        PolyDriver ddParallelRemapper;
+        Property pParallelRemapper(pRemapper);
+        pParallelRemapper.put("parallel_subdevices", true);
+
+        REQUIRE(ddParallelRemapper.open(pParallelRemapper)); // parallel controlboardremapper open reported successful
+
+        yarp::dev::IMultipleWrapper *imultwrapParallel = nullptr;
+        REQUIRE(ddParallelRemapper.view(imultwrapParallel)); // interface for multiple wrapper correctly opened
+        REQUIRE(imultwrapParallel);
+
+        REQUIRE(imultwrapParallel->attachAll(fmcList)); // attachAll for parallel controlboardremapper successful
+
+        checkRemapper(ddParallelRemapper,300,nrOfRemappedAxes);
+
+        imultwrapParallel->detachAll();
+        ddParallelRemapper.close();
+
         // Open the remotecontrolboardremapper
         PolyDriver ddRemoteRemapper;
         Property pRemoteRemapper;
@@ -589,3 +692,85 @@ TEST_CASE("dev::ControlBoardRemapperTest", "[yarp::dev]")
 
     Network::setLocalMode(false);
 }
+
+TEST_CASE("dev::ControlBoardRemapperParallelTest", "[yarp::dev]")
+{
+    YARP_REQUIRE_PLUGIN("controlboardremapper", "device");
+
+    Network::setLocalMode(true);
+
+    Drivers::factory().add(new DriverCreatorOf<SlowEncodersTest>("slowEncodersTest",
+                                                                 "",
+                                                                 "SlowEncodersTest"));
+
+    // Three slow controlboards, with two axes each
+    std::vector<PolyDriver*> slowbs(3);
+    yarp::dev::PolyDriverList slowList;
+    for (int i = 0; i < 3; i++)
+    {
+        Property p;
+        p.put("device", "slowEncodersTest");
+        p.put("prefix", "slow" + std::to_string(i) + "_");
+        p.put("joints", 2);
+        slowbs[i] = new PolyDriver();
+        REQUIRE(slowbs[i]->open(p)); // slow controlboard open reported successful
+        slowList.push(slowbs[i], ("slowControlBoard" + std::to_string(i)).c_str());
+    }
+
+    for (bool parallel : {false, true})
+    {
+        PolyDriver ddRemapper;
+        Property pRemapper;
+        pRemapper.put("device","controlboardremapper");
+        pRemapper.put("parallel_subdevices", parallel);
+        pRemapper.addGroup("axesNames");
+        Bottle & axesList = pRemapper.findGroup("axesNames").addList();
+        for (int i = 0; i < 3; i++)
+        {
+            axesList.addString("slow" + std::to_string(i) + "_0");
+            axesList.addString("slow" + std::to_string(i) + "_1");
+        }
+
+        REQUIRE(ddRemapper.open(pRemapper)); // controlboardremapper open reported successful
+
+        yarp::dev::IMultipleWrapper *imultwrap = nullptr;
+        REQUIRE(ddRemapper.view(imultwrap)); // interface for multiple wrapper correctly opened
+        REQUIRE(imultwrap);
+        REQUIRE(imultwrap->attachAll(slowList)); // attachAll for controlboardremapper successful
+
+        IEncoders *encs = nullptr;
+        REQUIRE(ddRemapper.view(encs)); // interface encoders correctly opened
+        REQUIRE(encs);
+
+        SlowEncodersTest::readsInProgress = 0;
+        SlowEncodersTest::maxReadsInProgress = 0;
+
+        std::vector<double> readEncoders(6);
+        CHECK(encs->getEncoders(readEncoders.data())); // getEncoders correctly called
+        for (size_t l = 0; l < readEncoders.size(); l++)
+        {
+            CHECK(readEncoders[l] == static_cast<double>(l % 2)); // encoder read from the right subcontrolboard
+        }
+
+        if (parallel)
+        {
+            // The subcontrolboards are read at the same time
+            CHECK(SlowEncodersTest::maxReadsInProgress > 1);
+        }
+        else
+        {
+            CHECK(SlowEncodersTest::maxReadsInProgress == 1);
+        }
+
+        imultwrap->detachAll();
+        ddRemapper.close();
+    }
+
+    for (auto* slowb : slowbs)
+    {
+        slowb->close();
+        delete slowb;
+    }
+
+    Network::setLocalMode(false);
+}
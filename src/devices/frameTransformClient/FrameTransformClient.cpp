@@ -454,66 +454,6 @@ yarp::dev::ReturnValue FrameTransformClient::allFramesAsString(std::string &all_
     return ReturnValue_ok;
 }
 
-FrameTransformClient::ConnectionType FrameTransformClient::priv_getConnectionType(const std::string &target_frame, const std::string &source_frame, std::string* commonAncestor = nullptr)
-{
-    if (target_frame == source_frame) {return ConnectionType::IDENTITY;}
-
-    FrameTransformContainer* p_cont = nullptr;
-    bool br = m_ift_util->getInternalContainer(p_cont);
-    if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return ConnectionType::DISCONNECTED; }
-
-    size_t                     i, j;
-    std::vector<std::string>   tar2root_vec;
-    std::vector<std::string>   src2root_vec;
-    std::string                ancestor, child;
-    child = target_frame;
-
-    //protect the internal container from concurrent access
-    std::lock_guard<std::recursive_mutex> l(p_cont->m_trf_mutex);
-
-    //process data
-    while(getParent(child, ancestor))
-    {
-        if(ancestor == source_frame)
-        {
-            return ConnectionType::DIRECT;
-        }
-
-        tar2root_vec.push_back(ancestor);
-        child = ancestor;
-    }
-    child = source_frame;
-    while(getParent(child, ancestor))
-    {
-        if(ancestor == target_frame)
-        {
-            return ConnectionType::INVERSE;
-        }
-
-        src2root_vec.push_back(ancestor);
-        child = ancestor;
-    }
-
-    for(i = 0; i < tar2root_vec.size(); i++)
-    {
-        std::string a;
-        a = tar2root_vec[i];
-        for(j = 0; j < src2root_vec.size(); j++)
-        {
-            if(a == src2root_vec[j])
-            {
-                if(commonAncestor)
-                {
-                    *commonAncestor = a;
-                }
-                return ConnectionType::UNDIRECT;
-            }
-        }
-    }
-
-    return ConnectionType::DISCONNECTED;
-}
-
 yarp::dev::ReturnValue FrameTransformClient::canTransform(const std::string &target_frame, const std::string &source_frame, bool& canTransform)
 {
     if(!m_ift_util)
@@ -521,15 +461,12 @@ yarp::dev::ReturnValue FrameTransformClient::canTransform(const std::string &tar
         yCError(FRAMETRANSFORMCLIENT, "%s: No IFrameTransformStorageUtils interface found. Your device is wrongly configured", __func__);
         return ReturnValue::return_code::return_value_error_generic;
     }
-    auto conntype = priv_getConnectionType(target_frame, source_frame);
-    if (conntype != ConnectionType::DISCONNECTED)
-    {
-        canTransform = true;
-    }
-    else
-    {
-        canTransform = false;
-    }
+    FrameTransformContainer* p_cont = nullptr;
+    auto br = m_ift_util->getInternalContainer(p_cont);
+    if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return ReturnValue::return_code::return_value_error_generic; }
+
+    //the lookup does not need to lock the internal container
+    canTransform = p_cont->canTransform(target_frame, source_frame);
     return ReturnValue_ok;
 }
 
@@ -627,18 +564,10 @@ yarp::dev::ReturnValue FrameTransformClient::getParent(const std::string &frame_
     auto br = m_ift_util->getInternalContainer(p_cont);
     if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return ReturnValue::return_code::return_value_error_generic; }
 
-    //protect the internal container from concurrent access
-    std::lock_guard<std::recursive_mutex> l(p_cont->m_trf_mutex);
-
-    //process data
-    for (auto it = p_cont->begin(); it != p_cont->end(); it++)
+    //the lookup does not need to lock the internal container
+    if (p_cont->getParent(frame_id, parent_frame_id))
     {
-        std::string par(it->dst_frame_id);
-        if (it->dst_frame_id == frame_id)
-        {
-            parent_frame_id = it->src_frame_id;
-            return ReturnValue_ok;
-        }
+        return ReturnValue_ok;
     }
     return ReturnValue::return_code::return_value_error_method_failed;
 }
@@ -663,84 +592,44 @@ bool FrameTransformClient::priv_canExplicitTransform(const std::string& target_f
     return false;
 }
 
-bool FrameTransformClient::priv_getChainedTransform(const std::string& target_frame_id, const std::string& source_frame_id, yarp::sig::Matrix& transform) const
+yarp::dev::ReturnValue FrameTransformClient::getTransform(const std::string& target_frame_id, const std::string& source_frame_id, yarp::sig::Matrix& transform)
 {
+    if(!m_ift_util)
+    {
+        yCError(FRAMETRANSFORMCLIENT, "%s: No IFrameTransformStorageUtils interface found. Your device is wrongly configured",__func__);
+        return ReturnValue::return_code::return_value_error_not_ready;
+    }
     FrameTransformContainer* p_cont = nullptr;
-    bool br = m_ift_util->getInternalContainer(p_cont);
-    if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return false; }
-
-    //protect the internal container from concurrent access
-    std::lock_guard<std::recursive_mutex> l(p_cont->m_trf_mutex);
+    auto br = m_ift_util->getInternalContainer(p_cont);
+    if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return ReturnValue::return_code::return_value_error_generic; }
 
-    //process data
-    for (auto it = p_cont->begin(); it != p_cont->end(); it++)
+    //the lookup does not need to lock the internal container
+    if (p_cont->getTransform(target_frame_id, source_frame_id, transform))
     {
-        if (it->dst_frame_id == target_frame_id)
-        {
-            if (it->src_frame_id == source_frame_id)
-            {
-                transform = it->toMatrix();
-                return true;
-            }
-            else
-            {
-                yarp::sig::Matrix m;
-                if (priv_getChainedTransform(it->src_frame_id, source_frame_id, m))
-                {
-                    transform = m * it->toMatrix();
-                    return true;
-                }
-            }
-        }
+        return ReturnValue_ok;
     }
-    return false;
+
+    yCErrorThrottle(FRAMETRANSFORMCLIENT, LOG_THROTTLE_PERIOD) << "getTransform(): Frames " << source_frame_id << " and " << target_frame_id << " are not connected";
+    return ReturnValue::return_code::return_value_error_method_failed;
 }
 
-yarp::dev::ReturnValue FrameTransformClient::getTransform(const std::string& target_frame_id, const std::string& source_frame_id, yarp::sig::Matrix& transform)
+yarp::dev::ReturnValue FrameTransformClient::getTransform(const std::string& target_frame_id, const std::string& source_frame_id, double timestamp, yarp::sig::Matrix& transform)
 {
     if(!m_ift_util)
     {
         yCError(FRAMETRANSFORMCLIENT, "%s: No IFrameTransformStorageUtils interface found. Your device is wrongly configured",__func__);
         return ReturnValue::return_code::return_value_error_not_ready;
     }
-    ConnectionType ct;
-    std::string ancestor;
-    ct = priv_getConnectionType(target_frame_id, source_frame_id, &ancestor);
-    if (ct == ConnectionType::DIRECT)
-    {
-        bool ok = priv_getChainedTransform(target_frame_id, source_frame_id, transform);
-        if (ok)
-        {
-            return ReturnValue_ok;
-        }
-        else
-        {
-            return ReturnValue::return_code::return_value_error_method_failed;
-        }
-    }
-    else if (ct == ConnectionType::INVERSE)
-    {
-        yarp::sig::Matrix m(4, 4);
-        priv_getChainedTransform(source_frame_id, target_frame_id, m);
-        transform = yarp::math::SE3inv(m);
-        return ReturnValue_ok;
-    }
-    else if(ct == ConnectionType::UNDIRECT)
-    {
-        yarp::sig::Matrix root2tar(4, 4), root2src(4, 4);
-        priv_getChainedTransform(source_frame_id, ancestor, root2src);
-        priv_getChainedTransform(target_frame_id, ancestor, root2tar);
-        transform = yarp::math::SE3inv(root2src) * root2tar;
-        return ReturnValue_ok;
-    }
-    else if (ct == ConnectionType::IDENTITY)
+    FrameTransformContainer* p_cont = nullptr;
+    auto br = m_ift_util->getInternalContainer(p_cont);
+    if (!br || p_cont == nullptr) { yCError(FRAMETRANSFORMCLIENT) << "Failure"; return ReturnValue::return_code::return_value_error_generic; }
+
+    if (p_cont->getTransform(target_frame_id, source_frame_id, timestamp, transform))
     {
-        yarp::sig::Matrix tmp(4, 4); tmp.eye();
-        transform = tmp;
         return ReturnValue_ok;
     }
 
-    yCErrorThrottle(FRAMETRANSFORMCLIENT, LOG_THROTTLE_PERIOD) << "getTransform(): Frames " << source_frame_id << " and " << target_frame_id << " are not connected";
+    yCErrorThrottle(FRAMETRANSFORMCLIENT, LOG_THROTTLE_PERIOD) << "getTransform(): Frames " << source_frame_id << " and " << target_frame_id << " are not connected at time " << std::to_string(timestamp);
     return ReturnValue::return_code::return_value_error_method_failed;
 }
 
@@ -55,12 +55,7 @@ class FrameTransformClient :
         public FrameTransformClient_ParamsParser
 {
 private:
-    enum class ConnectionType {DISCONNECTED = 0, DIRECT, INVERSE, UNDIRECT, IDENTITY};
-
-    FrameTransformClient::ConnectionType priv_getConnectionType(const std::string &target_frame, const std::string &source_frame, std::string* commonAncestor);
-
     bool priv_canExplicitTransform(const std::string& target_frame_id, const std::string& source_frame_id) const;
-    bool priv_getChainedTransform(const std::string &target_frame_id, const std::string &source_frame_id, yarp::sig::Matrix &transform) const;
 
 protected:
 
@@ -113,6 +108,7 @@ public:
     yarp::dev::ReturnValue  getAllFrameIds(std::vector< std::string > &ids) override;
     yarp::dev::ReturnValue  getParent(const std::string &frame_id, std::string &parent_frame_id) override;
     yarp::dev::ReturnValue  getTransform(const std::string &target_frame_id, const std::string &source_frame_id, yarp::sig::Matrix &transform) override;
+    yarp::dev::ReturnValue  getTransform(const std::string &target_frame_id, const std::string &source_frame_id, double timestamp, yarp::sig::Matrix &transform) override;
     yarp::dev::ReturnValue  setTransform(const std::string &target_frame_id, const std::string &source_frame_id, const yarp::sig::Matrix &transform) override;
     yarp::dev::ReturnValue  setTransformStatic(const std::string &target_frame_id, const std::string &source_frame_id, const yarp::sig::Matrix &transform) override;
     yarp::dev::ReturnValue  deleteTransform(const std::string &target_frame_id, const std::string &source_frame_id) override;
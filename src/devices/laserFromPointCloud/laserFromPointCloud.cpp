@@ -284,7 +284,8 @@ bool LaserFromPointCloud::acquireDataFromHW()
     t3 = yarp::os::Time::now();
 #endif
 
-    bool depth_ok = m_iRGBD->getDepthImage(m_depth_image);
+    yarp::os::Stamp depth_stamp;
+    bool depth_ok = m_iRGBD->getDepthImage(m_depth_image, &depth_stamp);
     if (depth_ok == false)
     {
         yCError(LASER_FROM_POINTCLOUD) << "getDepthImage failed";
@@ -326,7 +327,16 @@ bool LaserFromPointCloud::acquireDataFromHW()
     m = yarp::math::rpy2dcm(vvv);
     m(2, 3) = 1.2; //z translation
 #else
-    bool frame_exists = m_iTc->getTransform(m_camera_frame_id, m_ground_frame_id, m_transform_mtrx);
+    //the transform at the time of the depth image is used, if available
+    bool frame_exists = false;
+    if (depth_stamp.isValid())
+    {
+        frame_exists = m_iTc->getTransform(m_camera_frame_id, m_ground_frame_id, depth_stamp.getTime(), m_transform_mtrx);
+    }
+    if (frame_exists == false)
+    {
+        frame_exists = m_iTc->getTransform(m_camera_frame_id, m_ground_frame_id, m_transform_mtrx);
+    }
     if (frame_exists == false)
     {
         yCWarning(LASER_FROM_POINTCLOUD) << "Unable to found m matrix";
@@ -164,6 +164,27 @@ bool ControlBoard_nwc_yarp::open(Searchable& config)
         return false;
     }
 
+    // The subscription to a subset of the fields of the state, or to one
+    // state every state_decimation, is handled by the jointstate_fields
+    // portmonitor on the connection with the server.
+    std::string stateCarrier = m_carrier;
+    if (!m_state_fields.empty() || m_state_decimation != 1)
+    {
+        if (m_state_decimation < 1)
+        {
+            yCError(CONTROLBOARD_NWC_YARP, "Found state_decimation option with wrong value. It must be greater than 0");
+            return false;
+        }
+        stateCarrier += "+send.portmonitor+file.jointstate_fields+type.dll";
+        if (!m_state_fields.empty()) {
+            stateCarrier += "+fields." + m_state_fields;
+        }
+        if (m_state_decimation > 1) {
+            stateCarrier += "+decimation." + std::to_string(m_state_decimation);
+        }
+        stateCarrier += "+recv.portmonitor+file.jointstate_fields+type.dll";
+    }
+
     //open ports
     bool portProblem = false;
     if (m_local != "") {
@@ -207,25 +228,6 @@ bool ControlBoard_nwc_yarp::open(Searchable& config)
         if (m_local_qos_enable || m_remote_qos_enable) {
             NetworkBase::setConnectionQos(command_p.getName(), s1, localQos, remoteQos, false);
         }
-
-        s1 = m_remote;
-        s1 += "/stateExt:o";
-        s2 = m_local;
-        s2 += "/stateExt:i";
-        // not checking return value for now since it is wip (different machines can have different compilation flags
-        ok = Network::connect(s1, extendedIntputStatePort.getName(), m_carrier);
-        if (ok)
-        {
-            // set the QoS preferences for the 'state' port
-            if (m_local_qos_enable || m_remote_qos_enable) {
-                NetworkBase::setConnectionQos(s1, extendedIntputStatePort.getName(), remoteQos, localQos, false);
-            }
-        }
-        else
-        {
-            yCError(CONTROLBOARD_NWC_YARP, "Problem connecting to %s, is the remote device available?", s1.c_str());
-            connectionProblem = true;
-        }
     }
 
     if (connectionProblem||portProblem)
@@ -289,6 +291,31 @@ bool ControlBoard_nwc_yarp::open(Searchable& config)
         }
     }
 
+    // the state port is connected once the number of joints is known, so
+    // that its buffers are allocated before the first sample is received
+    extendedIntputStatePort.init(m_nj);
+    if (m_remote != "")
+    {
+        std::string s1 = m_remote;
+        s1 += "/stateExt:o";
+        bool ok = Network::connect(s1, extendedIntputStatePort.getName(), stateCarrier);
+        if (ok)
+        {
+            // set the QoS preferences for the 'state' port
+            if (m_local_qos_enable || m_remote_qos_enable) {
+                NetworkBase::setConnectionQos(s1, extendedIntputStatePort.getName(), remoteQos, localQos, false);
+            }
+        }
+        else
+        {
+            yCError(CONTROLBOARD_NWC_YARP, "Problem connecting to %s, is the remote device available?", s1.c_str());
+            command_p.close();
+            extendedIntputStatePort.close();
+            m_rpcPort.close();
+            return false;
+        }
+    }
+
     if (m_diagnostic)
     {
         diagnosticThread = new DiagnosticThread(DIAGNOSTIC_THREAD_PERIOD);
@@ -788,9 +815,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoder(int j, double *v)
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER, v, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER, v, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -798,10 +825,10 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoderTimed(int j, double *v,
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER, v, m_lastStamp, localArrivalTime);
-    *t=m_lastStamp.getTime();
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER, v, stamp, localArrivalTime);
+    *t=stamp.getTime();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -809,9 +836,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoders(double *encs)
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODERS, encs, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODERS, encs, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -819,10 +846,10 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncodersTimed(double *encs, dou
 {
     double localArrivalTime=0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODERS, encs, m_lastStamp, localArrivalTime);
-    std::fill_n(ts, m_nj, m_lastStamp.getTime());
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODERS, encs, stamp, localArrivalTime);
+    std::fill_n(ts, m_nj, stamp.getTime());
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -830,9 +857,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoderSpeed(int j, double *sp)
 {
     double localArrivalTime=0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER_SPEED, sp, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER_SPEED, sp, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -840,27 +867,27 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoderSpeeds(double *spds)
 {
     double localArrivalTime=0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODER_SPEEDS, spds, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODER_SPEEDS, spds, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoderAcceleration(int j, double *acc)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER_ACCELERATION, acc, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_ENCODER_ACCELERATION, acc, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getEncoderAccelerations(double *accs)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODER_ACCELERATIONS, accs, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_ENCODER_ACCELERATIONS, accs, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -924,9 +951,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getTemperature      (int m, double
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(m, VOCAB_TEMPERATURE, val, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(m, VOCAB_TEMPERATURE, val, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -934,9 +961,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getTemperatures     (double *vals)
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_TEMPERATURE, vals, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_TEMPERATURES, vals, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -1062,9 +1089,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoder(int j, double *v)
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER, v, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER, v, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -1072,10 +1099,10 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoderTimed(int j, double
 {
     double localArrivalTime = 0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER, v, m_lastStamp, localArrivalTime);
-    *t=m_lastStamp.getTime();
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER, v, stamp, localArrivalTime);
+    *t=stamp.getTime();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -1083,9 +1110,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoders(double *encs)
 {
     double localArrivalTime=0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODERS, encs, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODERS, encs, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -1093,46 +1120,46 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncodersTimed(double *encs
 {
     double localArrivalTime=0.0;
 
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODERS, encs, m_lastStamp, localArrivalTime);
-    std::fill_n(ts, m_nj, m_lastStamp.getTime());
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODERS, encs, stamp, localArrivalTime);
+    std::fill_n(ts, m_nj, stamp.getTime());
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoderSpeed(int j, double *sp)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER_SPEED, sp, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER_SPEED, sp, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoderSpeeds(double *spds)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODER_SPEEDS, spds, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODER_SPEEDS, spds, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoderAcceleration(int j, double *acc)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER_ACCELERATION, acc, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_MOTOR_ENCODER_ACCELERATION, acc, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorEncoderAccelerations(double *accs)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODER_SPEEDS, accs, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_MOTOR_ENCODER_SPEEDS, accs, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -1158,11 +1185,18 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getNumberOfMotorEncoders(int *num)
  */
 Stamp ControlBoard_nwc_yarp::getLastInputStamp()
 {
-    Stamp ret;
-//    mutex.lock();
-    ret = m_lastStamp;
-//    mutex.unlock();
-    return ret;
+    std::lock_guard<std::mutex> lock(extendedPortMutex);
+    return m_lastStamp;
+}
+
+void ControlBoard_nwc_yarp::setLastStamp(const Stamp& stamp)
+{
+    // the stamp is not valid if no sample was received yet
+    if (stamp.isValid())
+    {
+        std::lock_guard<std::mutex> lock(extendedPortMutex);
+        m_lastStamp = stamp;
+    }
 }
 
 // END IPreciselyTimed
@@ -1695,9 +1729,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::setPeakCurrent(int m, const double
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getPWM(int m, double* val)
 {
     double localArrivalTime = 0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(m, VOCAB_PWMCONTROL_PWM_OUTPUT, val, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(m, VOCAB_PWMCONTROL_PWM_OUTPUT, val, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -2077,18 +2111,18 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getMotorTorqueParams(int j, MotorT
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getTorque(int j, double *t)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_TRQ, t, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_TRQ, t, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getTorques(double *t)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_TRQS, t, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_TRQS, t, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -2203,48 +2237,43 @@ ReturnValue ControlBoard_nwc_yarp::getAvailableControlModes(int j, std::vector<y
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getControlMode(int j, yarp::dev::ControlModeEnum& mode)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
+    Stamp stamp;
     int mode_tmp;
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_CM_CONTROL_MODE, &mode_tmp, m_lastStamp, localArrivalTime);
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_CM_CONTROL_MODE, &mode_tmp, stamp, localArrivalTime);
     mode = (yarp::dev::ControlModeEnum) mode_tmp;
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getControlModes(std::vector<yarp::dev::ControlModeEnum>& modes)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_CM_CONTROL_MODES, last_wholePart.controlMode.data(), m_lastStamp, localArrivalTime);
+    Stamp stamp;
+    yarp::dev::JointStateData last;
+    bool ret = extendedIntputStatePort.getLastFields(StateExtendedInputPort::FIELD_CONTROL_MODE, last, stamp, localArrivalTime) && last.controlMode_isValid;
     if(ret)
     {
         for (int i = 0; i < modes.size(); i++) {
-            modes[i] = (yarp::dev::ControlModeEnum) last_wholePart.controlMode[i];
+            modes[i] = (yarp::dev::ControlModeEnum) last.controlMode[i];
         }
-    } else {
-        ret = false;
     }
-
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getControlModes(const std::vector<int>& joints, std::vector<yarp::dev::ControlModeEnum>& modes)
 {
     double localArrivalTime=0.0;
-
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_CM_CONTROL_MODES, last_wholePart.controlMode.data(), m_lastStamp, localArrivalTime);
+    Stamp stamp;
+    yarp::dev::JointStateData last;
+    bool ret = extendedIntputStatePort.getLastFields(StateExtendedInputPort::FIELD_CONTROL_MODE, last, stamp, localArrivalTime) && last.controlMode_isValid;
     if(ret)
     {
         for (int i = 0; i < joints.size(); i++) {
-            modes[i] = (yarp::dev::ControlModeEnum)last_wholePart.controlMode[joints[i]];
+            modes[i] = (yarp::dev::ControlModeEnum)last.controlMode[joints[i]];
         }
-    } else {
-        ret = false;
     }
-
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -2502,47 +2531,43 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getTargetVelocities(const int n_jo
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getInteractionMode(int axis, yarp::dev::InteractionModeEnum& mode)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
+    Stamp stamp;
     int mode_tmp;
-    bool ret = extendedIntputStatePort.getLastSingle(axis, VOCAB_INTERACTION_MODE, &mode_tmp, m_lastStamp, localArrivalTime);
+    bool ret = extendedIntputStatePort.getLastSingle(axis, VOCAB_INTERACTION_MODE, &mode_tmp, stamp, localArrivalTime);
     mode = (yarp::dev::InteractionModeEnum)mode_tmp;
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getInteractionModes(const std::vector<int>& joints, std::vector<yarp::dev::InteractionModeEnum>& modes)
 {
     double localArrivalTime=0.0;
-
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_INTERACTION_MODES, last_wholePart.interactionMode.data(), m_lastStamp, localArrivalTime);
+    Stamp stamp;
+    yarp::dev::JointStateData last;
+    bool ret = extendedIntputStatePort.getLastFields(StateExtendedInputPort::FIELD_INTERACTION_MODE, last, stamp, localArrivalTime) && last.interactionMode_isValid;
     if(ret)
     {
         for (int i = 0; i < joints.size(); i++) {
-            modes[i] = (yarp::dev::InteractionModeEnum)last_wholePart.interactionMode[joints[i]];
+            modes[i] = (yarp::dev::InteractionModeEnum)last.interactionMode[joints[i]];
         }
-    } else {
-        ret = false;
     }
-
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getInteractionModes(std::vector<yarp::dev::InteractionModeEnum>& modes)
 {
     double localArrivalTime=0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_INTERACTION_MODES, last_wholePart.interactionMode.data(), m_lastStamp, localArrivalTime);
+    Stamp stamp;
+    yarp::dev::JointStateData last;
+    bool ret = extendedIntputStatePort.getLastFields(StateExtendedInputPort::FIELD_INTERACTION_MODE, last, stamp, localArrivalTime) && last.interactionMode_isValid;
     if(ret)
     {
         for (int i = 0; i < modes.size(); i++) {
-            modes[i] = (yarp::dev::InteractionModeEnum) last_wholePart.interactionMode[i];
+            modes[i] = (yarp::dev::InteractionModeEnum) last.interactionMode[i];
         }
-    } else {
-        ret = false;
     }
-    extendedPortMutex.unlock();
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
@@ -2795,9 +2820,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getCurrents(double *vals)
             return ReturnValue::return_code::return_value_error_not_ready;
         }
         double localArrivalTime=0.0;
-        extendedPortMutex.lock();
-        bool ret = extendedIntputStatePort.getLastVector(VOCAB_AMP_CURRENTS, vals, m_lastStamp, localArrivalTime);
-        extendedPortMutex.unlock();
+        Stamp stamp;
+        bool ret = extendedIntputStatePort.getLastVector(VOCAB_AMP_CURRENTS, vals, stamp, localArrivalTime);
+        setLastStamp(stamp);
         return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
     }
     else
@@ -2822,9 +2847,9 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getCurrent(int j, double *val)
             return ReturnValue::return_code::return_value_error_not_ready;
         }
         double localArrivalTime = 0.0;
-        extendedPortMutex.lock();
-        bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_AMP_CURRENT, val, m_lastStamp, localArrivalTime);
-        extendedPortMutex.unlock();
+        Stamp stamp;
+        bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_AMP_CURRENT, val, stamp, localArrivalTime);
+        setLastStamp(stamp);
         return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
     }
     else
@@ -2940,18 +2965,18 @@ yarp::dev::ReturnValue ControlBoard_nwc_yarp::getRefDutyCycles(double *refs)
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getDutyCycle(int j, double *out)
 {
     double localArrivalTime = 0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_PWMCONTROL_PWM_OUTPUT, out, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastSingle(j, VOCAB_PWMCONTROL_PWM_OUTPUT, out, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 
 yarp::dev::ReturnValue ControlBoard_nwc_yarp::getDutyCycles(double *outs)
 {
     double localArrivalTime = 0.0;
-    extendedPortMutex.lock();
-    bool ret = extendedIntputStatePort.getLastVector(VOCAB_PWMCONTROL_PWM_OUTPUTS, outs, m_lastStamp, localArrivalTime);
-    extendedPortMutex.unlock();
+    Stamp stamp;
+    bool ret = extendedIntputStatePort.getLastVector(VOCAB_PWMCONTROL_PWM_OUTPUTS, outs, stamp, localArrivalTime);
+    setLastStamp(stamp);
     return ret?ReturnValue_ok:ReturnValue::return_code::return_value_error_not_ready;
 }
 // END IPWMControl
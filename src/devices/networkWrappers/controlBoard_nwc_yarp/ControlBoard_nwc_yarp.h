@@ -95,11 +95,12 @@ protected:
     // Buffer associated to the extendedOutputStatePort port; in this case we will use the type generated
     // from the YARP .thrift file
     StateExtendedInputPort                          extendedIntputStatePort;  // Buffered port storing new data
-    std::mutex extendedPortMutex;
+    std::mutex extendedPortMutex;                   // protects m_lastStamp
     yarp::dev::JointStateData last_singleJoint;     // tmp to store last received data for a particular joint
     yarp::dev::JointStateData last_wholePart;         // tmp to store last received data for whole part
 
     mutable Stamp m_lastStamp;  //this is shared among all calls that read encoders
+    void setLastStamp(const Stamp& stamp);
     size_t m_nj{0};
     bool m_njIsKnown{false};
 
@@ -35,6 +35,8 @@ std::vector<std::string> ControlBoard_nwc_yarp_ParamsParser::getListOfParams() c
     params.push_back("carrier_cmd");
     params.push_back("timeout");
     params.push_back("use_streaming");
+    params.push_back("state_fields");
+    params.push_back("state_decimation");
     params.push_back("local_qos::enable");
     params.push_back("local_qos::thread_priority");
     params.push_back("local_qos::thread_policy");
@@ -86,6 +88,16 @@ bool ControlBoard_nwc_yarp_ParamsParser::getParamValue(const std::string& paramN
         else paramValue = "false";
         return true;
     }
+    if (paramName =="state_fields")
+    {
+        paramValue = m_state_fields;
+        return true;
+    }
+    if (paramName =="state_decimation")
+    {
+        paramValue = std::to_string(m_state_decimation);
+        return true;
+    }
     if (paramName =="local_qos::enable")
     {
         if (m_local_qos_enable==true) paramValue = "true";
@@ -263,6 +275,34 @@ bool      ControlBoard_nwc_yarp_ParamsParser::parseParams(const yarp::os::Search
         prop_check.unput("use_streaming");
     }
 
+    //Parser of parameter state_fields
+    {
+        if (config.check("state_fields"))
+        {
+            m_state_fields = config.find("state_fields").asString();
+            yCInfo(ControlBoard_nwc_yarpParamsCOMPONENT) << "Parameter 'state_fields' using value:" << m_state_fields;
+        }
+        else
+        {
+            yCInfo(ControlBoard_nwc_yarpParamsCOMPONENT) << "Parameter 'state_fields' using DEFAULT value:" << m_state_fields;
+        }
+        prop_check.unput("state_fields");
+    }
+
+    //Parser of parameter state_decimation
+    {
+        if (config.check("state_decimation"))
+        {
+            m_state_decimation = config.find("state_decimation").asInt64();
+            yCInfo(ControlBoard_nwc_yarpParamsCOMPONENT) << "Parameter 'state_decimation' using value:" << m_state_decimation;
+        }
+        else
+        {
+            yCInfo(ControlBoard_nwc_yarpParamsCOMPONENT) << "Parameter 'state_decimation' using DEFAULT value:" << m_state_decimation;
+        }
+        prop_check.unput("state_decimation");
+    }
+
     //Parser of parameter local_qos::enable
     {
         yarp::os::Bottle sectionp;
@@ -448,6 +488,8 @@ std::string      ControlBoard_nwc_yarp_ParamsParser::getDocumentationOfDevicePar
     doc = doc + std::string("'carrier_cmd': carrier used for sending streamed commands\n");
     doc = doc + std::string("'timeout': timeout for the input port which receives the streamed robot state\n");
     doc = doc + std::string("'use_streaming': enable/disables the use of streaming commands. If disabled, rpc is used instead\n");
+    doc = doc + std::string("'state_fields': fields of the robot state to receive, e.g. pos_vel_trq. Uses jointstate_fields\n");
+    doc = doc + std::string("'state_decimation': receive only one robot state every state_decimation. Uses jointstate_fields\n");
     doc = doc + std::string("'local_qos::enable': Enable the usage of local Qos\n");
     doc = doc + std::string("'local_qos::thread_priority': Local Qos. See https://yarp.it/latest/channelprioritization.html\n");
     doc = doc + std::string("'local_qos::thread_policy': Local Qos. See https://yarp.it/latest/channelprioritization.html\n");
@@ -459,7 +501,7 @@ std::string      ControlBoard_nwc_yarp_ParamsParser::getDocumentationOfDevicePar
     doc = doc + std::string("'diagnostic': For development purpose only\n");
     doc = doc + std::string("\n");
     doc = doc + std::string("Here are some examples of invocation command with yarpdev, with all params:\n");
-    doc = doc + " yarpdev --device controlBoard_nwc_yarp --remote <mandatory_value> --local <mandatory_value> --writeStrict <optional_value> --carrier fast_tcp --carrier_cmd fast_tcp --timeout 0.5 --use_streaming true --local_qos::enable false --local_qos::thread_priority 0 --local_qos::thread_policy 0 --local_qos::packet_priority <optional_value> --remote_qos::enable false --remote_qos::thread_priority 0 --remote_qos::thread_policy 0 --remote_qos::packet_priority <optional_value> --diagnostic false\n";
+    doc = doc + " yarpdev --device controlBoard_nwc_yarp --remote <mandatory_value> --local <mandatory_value> --writeStrict <optional_value> --carrier fast_tcp --carrier_cmd fast_tcp --timeout 0.5 --use_streaming true --state_fields <optional_value> --state_decimation 1 --local_qos::enable false --local_qos::thread_priority 0 --local_qos::thread_policy 0 --local_qos::packet_priority <optional_value> --remote_qos::enable false --remote_qos::thread_priority 0 --remote_qos::thread_policy 0 --remote_qos::packet_priority <optional_value> --diagnostic false\n";
     doc = doc + std::string("Using only mandatory params:\n");
     doc = doc + " yarpdev --device controlBoard_nwc_yarp --remote <mandatory_value> --local <mandatory_value>\n";
     doc = doc + std::string("=============================================\n\n");    return doc;
@@ -23,28 +23,30 @@
 * This class is the parameters parser for class ControlBoard_nwc_yarp.
 *
 * These are the used parameters:
-* | Group name | Parameter name  | Type   | Units | Default Value | Required | Description                                                                     | Notes              |
-* |:----------:|:---------------:|:------:|:-----:|:-------------:|:--------:|:-------------------------------------------------------------------------------:|:------------------:|
-* | -          | remote          | string | -     | -             | 1        | Prefix of the port to which to connect.                                         | -                  |
-* | -          | local           | string | -     | -             | 1        | Port prefix of the port opened by this device.                                  | -                  |
-* | -          | writeStrict     | string | -     | -             | 0        | It can be 'on' or 'off'                                                         | See implementation |
-* | -          | carrier         | string | -     | fast_tcp      | 0        | carrier used for receiving streamed robot state                                 | -                  |
-* | -          | carrier_cmd     | string | -     | fast_tcp      | 0        | carrier used for sending streamed commands                                      | -                  |
-* | -          | timeout         | float  | -     | 0.5           | 0        | timeout for the input port which receives the streamed robot state              | -                  |
-* | -          | use_streaming   | bool   | -     | true          | 0        | enable/disables the use of streaming commands. If disabled, rpc is used instead | -                  |
-* | local_qos  | enable          | bool   | -     | false         | 0        | Enable the usage of local Qos                                                   | -                  |
-* | local_qos  | thread_priority | int    | -     | 0             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
-* | local_qos  | thread_policy   | int    | -     | 0             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
-* | local_qos  | packet_priority | string | -     | -             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
-* | remote_qos | enable          | bool   | -     | false         | 0        | Enable the usage of remote Qos                                                  | -                  |
-* | remote_qos | thread_priority | int    | -     | 0             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html               | -                  |
-* | remote_qos | thread_policy   | int    | -     | 0             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html.              | -                  |
-* | remote_qos | packet_priority | string | -     | -             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html.              | -                  |
-* | -          | diagnostic      | bool   | -     | false         | 0        | For development purpose only                                                    | -                  |
+* | Group name | Parameter name   | Type   | Units | Default Value | Required | Description                                                                     | Notes              |
+* |:----------:|:----------------:|:------:|:-----:|:-------------:|:--------:|:-------------------------------------------------------------------------------:|:------------------:|
+* | -          | remote           | string | -     | -             | 1        | Prefix of the port to which to connect.                                         | -                  |
+* | -          | local            | string | -     | -             | 1        | Port prefix of the port opened by this device.                                  | -                  |
+* | -          | writeStrict      | string | -     | -             | 0        | It can be 'on' or 'off'                                                         | See implementation |
+* | -          | carrier          | string | -     | fast_tcp      | 0        | carrier used for receiving streamed robot state                                 | -                  |
+* | -          | carrier_cmd      | string | -     | fast_tcp      | 0        | carrier used for sending streamed commands                                      | -                  |
+* | -          | timeout          | float  | -     | 0.5           | 0        | timeout for the input port which receives the streamed robot state              | -                  |
+* | -          | use_streaming    | bool   | -     | true          | 0        | enable/disables the use of streaming commands. If disabled, rpc is used instead | -                  |
+* | -          | state_fields     | string | -     | -             | 0        | fields of the robot state to receive, e.g. pos_vel_trq. Uses jointstate_fields  | -                  |
+* | -          | state_decimation | int    | -     | 1             | 0        | receive only one robot state every state_decimation. Uses jointstate_fields     | -                  |
+* | local_qos  | enable           | bool   | -     | false         | 0        | Enable the usage of local Qos                                                   | -                  |
+* | local_qos  | thread_priority  | int    | -     | 0             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
+* | local_qos  | thread_policy    | int    | -     | 0             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
+* | local_qos  | packet_priority  | string | -     | -             | 0        | Local Qos. See https://yarp.it/latest/channelprioritization.html                | -                  |
+* | remote_qos | enable           | bool   | -     | false         | 0        | Enable the usage of remote Qos                                                  | -                  |
+* | remote_qos | thread_priority  | int    | -     | 0             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html               | -                  |
+* | remote_qos | thread_policy    | int    | -     | 0             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html.              | -                  |
+* | remote_qos | packet_priority  | string | -     | -             | 0        | Remote Qos. See https://yarp.it/latest/channelprioritization.html.              | -                  |
+* | -          | diagnostic       | bool   | -     | false         | 0        | For development purpose only                                                    | -                  |
 *
 * The device can be launched by yarpdev using one of the following examples (with and without all optional parameters):
 * \code{.unparsed}
-* yarpdev --device controlBoard_nwc_yarp --remote <mandatory_value> --local <mandatory_value> --writeStrict <optional_value> --carrier fast_tcp --carrier_cmd fast_tcp --timeout 0.5 --use_streaming true --local_qos::enable false --local_qos::thread_priority 0 --local_qos::thread_policy 0 --local_qos::packet_priority <optional_value> --remote_qos::enable false --remote_qos::thread_priority 0 --remote_qos::thread_policy 0 --remote_qos::packet_priority <optional_value> --diagnostic false
+* yarpdev --device controlBoard_nwc_yarp --remote <mandatory_value> --local <mandatory_value> --writeStrict <optional_value> --carrier fast_tcp --carrier_cmd fast_tcp --timeout 0.5 --use_streaming true --state_fields <optional_value> --state_decimation 1 --local_qos::enable false --local_qos::thread_priority 0 --local_qos::thread_policy 0 --local_qos::packet_priority <optional_value> --remote_qos::enable false --remote_qos::thread_priority 0 --remote_qos::thread_policy 0 --remote_qos::packet_priority <optional_value> --diagnostic false
 * \endcode
 *
 * \code{.unparsed}
@@ -79,6 +81,8 @@ public:
     const std::string m_carrier_cmd_defaultValue = {"fast_tcp"};
     const std::string m_timeout_defaultValue = {"0.5"};
     const std::string m_use_streaming_defaultValue = {"true"};
+    const std::string m_state_fields_defaultValue = {""};
+    const std::string m_state_decimation_defaultValue = {"1"};
     const std::string m_local_qos_enable_defaultValue = {"false"};
     const std::string m_local_qos_thread_priority_defaultValue = {"0"};
     const std::string m_local_qos_thread_policy_defaultValue = {"0"};
@@ -96,6 +100,8 @@ public:
     std::string m_carrier_cmd = {"fast_tcp"};
     float m_timeout = {0.5};
     bool m_use_streaming = {true};
+    std::string m_state_fields = {}; //This default value of this string is an empty string. It is highly recommended to provide a suggested value also for optional string parameters.
+    int m_state_decimation = {1};
     bool m_local_qos_enable = {false};
     int m_local_qos_thread_priority = {0};
     int m_local_qos_thread_policy = {0};
@@ -5,6 +5,7 @@
 
 #include "stateExtendedReader.h"
 #include "ControlBoard_nwc_yarp_LogComponent.h"
+#include <algorithm>
 #include <cstring>
 
 #include <yarp/os/BufferedPort.h>
@@ -28,6 +29,28 @@ using namespace yarp::os;
 using namespace yarp::dev;
 using namespace yarp::sig;
 
+namespace {
+
+// calls f(field, a.field, a.field_isValid, b.field, b.field_isValid) for each field of JointStateData
+template <typename A, typename B, typename F>
+void forEachField(A& a, B& b, F&& f)
+{
+    f(StateExtendedInputPort::FIELD_JOINT_POSITION, a.jointPosition, a.jointPosition_isValid, b.jointPosition, b.jointPosition_isValid);
+    f(StateExtendedInputPort::FIELD_JOINT_VELOCITY, a.jointVelocity, a.jointVelocity_isValid, b.jointVelocity, b.jointVelocity_isValid);
+    f(StateExtendedInputPort::FIELD_JOINT_ACCELERATION, a.jointAcceleration, a.jointAcceleration_isValid, b.jointAcceleration, b.jointAcceleration_isValid);
+    f(StateExtendedInputPort::FIELD_MOTOR_POSITION, a.motorPosition, a.motorPosition_isValid, b.motorPosition, b.motorPosition_isValid);
+    f(StateExtendedInputPort::FIELD_MOTOR_VELOCITY, a.motorVelocity, a.motorVelocity_isValid, b.motorVelocity, b.motorVelocity_isValid);
+    f(StateExtendedInputPort::FIELD_MOTOR_ACCELERATION, a.motorAcceleration, a.motorAcceleration_isValid, b.motorAcceleration, b.motorAcceleration_isValid);
+    f(StateExtendedInputPort::FIELD_TORQUE, a.torque, a.torque_isValid, b.torque, b.torque_isValid);
+    f(StateExtendedInputPort::FIELD_PWM_DUTYCYCLE, a.pwmDutycycle, a.pwmDutycycle_isValid, b.pwmDutycycle, b.pwmDutycycle_isValid);
+    f(StateExtendedInputPort::FIELD_CURRENT, a.current, a.current_isValid, b.current, b.current_isValid);
+    f(StateExtendedInputPort::FIELD_CONTROL_MODE, a.controlMode, a.controlMode_isValid, b.controlMode, b.controlMode_isValid);
+    f(StateExtendedInputPort::FIELD_INTERACTION_MODE, a.interactionMode, a.interactionMode_isValid, b.interactionMode, b.interactionMode_isValid);
+    f(StateExtendedInputPort::FIELD_TEMPERATURE, a.temperature, a.temperature_isValid, b.temperature, b.temperature_isValid);
+}
+
+} // namespace
+
 void StateExtendedInputPort::resetStat()
 {
     mutex.lock();
@@ -35,43 +58,48 @@ void StateExtendedInputPort::resetStat()
     deltaT=0;
     deltaTMax=0;
     deltaTMin=1e22;
-    now=Time::now();
-    prev=now;
+    prev=Time::now();
     mutex.unlock();
 }
 
 StateExtendedInputPort::StateExtendedInputPort() : deltaT{0},
                                                    deltaTMax{0},
                                                    deltaTMin{1e22},
-                                                   now{Time::now()},
-                                                   prev{now},
+                                                   prev{Time::now()},
                                                    timeout{0.5},
-                                                   valid{false},
                                                    count{0}
 {
 }
 
+void StateExtendedInputPort::allocate(size_t numberOfJoints)
+{
+    nj = numberOfJoints;
+    for (auto& slot : slots)
+    {
+        forEachField(slot.data, slot.data, [this](unsigned int, auto& vec, bool&, auto&, bool&) { vec.resize(nj); });
+    }
+}
+
 void StateExtendedInputPort::init(int numberOfJoints)
 {
-    last.jointPosition.resize(numberOfJoints);
-    last.jointVelocity.resize(numberOfJoints);
-    last.jointAcceleration.resize(numberOfJoints);
-    last.motorPosition.resize(numberOfJoints);
-    last.motorVelocity.resize(numberOfJoints);
-    last.motorAcceleration.resize(numberOfJoints);
-    last.torque.resize(numberOfJoints);
-    last.pwmDutycycle.resize(numberOfJoints);
-    last.temperature.resize(numberOfJoints);
-    last.current.resize(numberOfJoints);
-    last.controlMode.resize(numberOfJoints);
-    last.interactionMode.resize(numberOfJoints);
+    // the slots cannot be resized after the first sample is published
+    if (lastSlot.load(std::memory_order_acquire) < 0)
+    {
+        allocate(numberOfJoints);
+    }
 }
 
 void StateExtendedInputPort::onRead(yarp::dev::JointStateData &v)
 {
-    now=Time::now();
-    mutex.lock();
+    double now=Time::now();
+    Stamp stamp;
+    getEnvelope(stamp);
+    //check that timestamp are available
+    if (!stamp.isValid()) {
+        stamp.update(now);
+    }
 
+    mutex.lock();
     if (count>0)
     {
         double tmpDT=now-prev;
@@ -83,245 +111,255 @@ void StateExtendedInputPort::onRead(yarp::dev::JointStateData &v)
             deltaTMin = tmpDT;
         }
     }
-
     prev=now;
     count++;
+    mutex.unlock();
 
-    valid=true;
-    last=v;
-    getEnvelope(lastStamp);
-    //check that timestamp are available
-    if (!lastStamp.isValid()) {
-        lastStamp.update(now);
+    int last = lastSlot.load(std::memory_order_relaxed);
+    if (last < 0 && nj == 0)
+    {
+        size_t n = 0;
+        forEachField(v, v, [&n](unsigned int, auto& vec, bool&, auto&, bool&) { n = std::max(n, vec.size()); });
+        allocate(n);
     }
-    mutex.unlock();
+
+    // write the slot after the last published one
+    Slot& slot = slots[(last + 1) % slotCount];
+    unsigned int seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    forEachField(slot.data, v, [](unsigned int, auto& dst, bool& dstValid, const auto& src, const bool& srcValid)
+    {
+        // a field with a different number of joints is not valid
+        if (src.size() == dst.size())
+        {
+            std::copy_n(src.data(), src.size(), dst.data());
+            dstValid = srcValid;
+        }
+        else
+        {
+            dstValid = false;
+        }
+    });
+    slot.stamp = stamp;
+    slot.arrivalTime = now;
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    lastSlot.store((last + 1) % slotCount, std::memory_order_release);
 }
 
 void StateExtendedInputPort::setTimeout(const double& timeout) {
     this->timeout = timeout;
 }
 
+template <typename F>
+bool StateExtendedInputPort::readLast(F&& copy, Stamp& stamp, double& localArrivalTime)
+{
+    while (true)
+    {
+        int last = lastSlot.load(std::memory_order_acquire);
+        if (last < 0) {
+            return false;
+        }
+        const Slot& slot = slots[last];
+        unsigned int seq = slot.seq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            continue;
+        }
+
+        bool ret = copy(slot.data);
+        Stamp tmpStamp = slot.stamp;
+        double arrivalTime = slot.arrivalTime;
+
+        // retry if onRead() has written the slot while it was copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != seq) {
+            continue;
+        }
+
+        localArrivalTime = arrivalTime;
+        stamp = tmpStamp;
+        if (ret && ((Time::now() - localArrivalTime) > timeout)) {
+            ret = false;
+        }
+        return ret;
+    }
+}
+
 bool StateExtendedInputPort::getLastSingle(int j, int field, double *data, Stamp &stamp, double &localArrivalTime)
 {
-    mutex.lock();
-    bool ret = valid;
-    if (ret)
+    return readLast([&](const yarp::dev::JointStateData& last)
     {
+        if (j < 0 || static_cast<size_t>(j) >= nj) {
+            return false;
+        }
         switch(field)
         {
             case VOCAB_ENCODER:
                 *data = last.jointPosition[j];
-                ret  = last.jointPosition_isValid;
-            break;
+                return last.jointPosition_isValid;
 
             case VOCAB_ENCODER_SPEED:
-                ret = last.jointVelocity_isValid;
                 *data = last.jointVelocity[j];
-                break;
+                return last.jointVelocity_isValid;
 
             case VOCAB_ENCODER_ACCELERATION:
-                ret = last.jointAcceleration_isValid;
                 *data = last.jointAcceleration[j];
-            break;
+                return last.jointAcceleration_isValid;
 
             case VOCAB_MOTOR_ENCODER:
-                ret = last.motorPosition_isValid;
                 *data = last.motorPosition[j];
-            break;
+                return last.motorPosition_isValid;
 
             case VOCAB_MOTOR_ENCODER_SPEED:
-                ret = last.motorVelocity_isValid;
                 *data = last.motorVelocity[j];
-            break;
+                return last.motorVelocity_isValid;
 
             case VOCAB_MOTOR_ENCODER_ACCELERATION:
-                ret = last.motorAcceleration_isValid;
                 *data = last.motorAcceleration[j];
-            break;
+                return last.motorAcceleration_isValid;
 
             case VOCAB_TRQ:
-                ret = last.torque_isValid;
                 *data = last.torque[j];
-            break;
+                return last.torque_isValid;
 
             case VOCAB_PWMCONTROL_PWM_OUTPUT:
-                ret = last.pwmDutycycle_isValid;
                 *data = double(last.pwmDutycycle[j]);
-            break;
+                return last.pwmDutycycle_isValid;
 
             case VOCAB_AMP_CURRENT:
-                ret = last.current_isValid;
                 *data = last.current[j];
-                break;
+                return last.current_isValid;
 
             case VOCAB_TEMPERATURE:
-                ret = last.temperature_isValid;
                 *data = double(last.temperature[j]);
-                break;
-
+                return last.temperature_isValid;
 
             default:
                 yCError(CONTROLBOARD_NWC_YARP) << "Internal error while reading data. Cannot get 'single' data of type " << yarp::os::Vocab32::decode(field);
-            break;
-        }
-
-        localArrivalTime=now;
-        stamp = lastStamp;
-        double current_time = Time::now();
-        if (ret && ((current_time - localArrivalTime) > timeout)) {
-            ret = false;
+                return false;
         }
-    }
-    mutex.unlock();
-
-    return ret;
+    }, stamp, localArrivalTime);
 }
 
 bool StateExtendedInputPort::getLastSingle(int j, int field, int *data, Stamp &stamp, double &localArrivalTime)
 {
-    mutex.lock();
-    bool ret = valid;
-    if (ret)
+    return readLast([&](const yarp::dev::JointStateData& last)
     {
+        if (j < 0 || static_cast<size_t>(j) >= nj) {
+            return false;
+        }
         switch(field)
         {
             case VOCAB_CM_CONTROL_MODE:
-                ret = last.controlMode_isValid;
                 *data = last.controlMode[j];
-            break;
+                return last.controlMode_isValid;
 
             case VOCAB_INTERACTION_MODE:
-                ret = last.interactionMode_isValid;
                 *data = last.interactionMode[j];
-            break;
+                return last.interactionMode_isValid;
 
             default:
                 yCError(CONTROLBOARD_NWC_YARP) << "Internal error while reading data. Cannot get 'single' data of type " << yarp::os::Vocab32::decode(field);
-            break;
-        }
-        localArrivalTime=now;
-        stamp = lastStamp;
-        double curr_time = Time::now();
-        if (ret && (( curr_time - localArrivalTime) > timeout)) {
-            ret = false;
+                return false;
         }
-    }
-    mutex.unlock();
-    return ret;
+    }, stamp, localArrivalTime);
 }
 
 bool StateExtendedInputPort::getLastVector(int field, double* data, Stamp& stamp, double& localArrivalTime)
 {
-    mutex.lock();
-    bool ret = valid;
-    if (ret)
+    return readLast([&](const yarp::dev::JointStateData& last)
     {
         switch(field)
         {
             case VOCAB_ENCODERS:
-                ret = last.jointPosition_isValid;
-                memcpy(data, last.jointPosition.data(), last.jointPosition.size() * last.jointPosition.getElementSize() );
-            break;
+                std::copy_n(last.jointPosition.data(), nj, data);
+                return last.jointPosition_isValid;
 
             case VOCAB_ENCODER_SPEEDS:
-                ret = last.jointVelocity_isValid;
-                memcpy(data, last.jointVelocity.data(), last.jointVelocity.size() * last.jointVelocity.getElementSize() );
-            break;
+                std::copy_n(last.jointVelocity.data(), nj, data);
+                return last.jointVelocity_isValid;
 
             case VOCAB_ENCODER_ACCELERATIONS:
-                ret = last.jointAcceleration_isValid;
-                memcpy(data, last.jointAcceleration.data(), last.jointAcceleration.size() * last.jointAcceleration.getElementSize() );
-            break;
+                std::copy_n(last.jointAcceleration.data(), nj, data);
+                return last.jointAcceleration_isValid;
 
             case VOCAB_MOTOR_ENCODERS:
-                ret = last.motorPosition_isValid;
-                memcpy(data, last.motorPosition.data(), last.motorPosition.size() * last.motorPosition.getElementSize() );
-            break;
+                std::copy_n(last.motorPosition.data(), nj, data);
+                return last.motorPosition_isValid;
 
             case VOCAB_MOTOR_ENCODER_SPEEDS:
-                ret = last.motorVelocity_isValid;
-                memcpy(data, last.motorVelocity.data(), last.motorVelocity.size() * last.motorVelocity.getElementSize() );
-            break;
+                std::copy_n(last.motorVelocity.data(), nj, data);
+                return last.motorVelocity_isValid;
 
             case VOCAB_MOTOR_ENCODER_ACCELERATIONS:
-                ret = last.motorAcceleration_isValid;
-                memcpy(data, last.motorAcceleration.data(), last.motorAcceleration.size() * last.motorAcceleration.getElementSize() );
-            break;
+                std::copy_n(last.motorAcceleration.data(), nj, data);
+                return last.motorAcceleration_isValid;
 
             case VOCAB_TRQS:
-                ret = last.torque_isValid;
-                memcpy(data, last.torque.data(), last.torque.size() * last.torque.getElementSize() );
-            break;
+                std::copy_n(last.torque.data(), nj, data);
+                return last.torque_isValid;
 
             case VOCAB_PWMCONTROL_PWM_OUTPUTS:
-                ret = last.pwmDutycycle_isValid;
-
-                // In the interface the pwmDutycycle is a double, but in the jointData it is a float so we need to copy it manually
-                for (size_t i = 0; i < last.pwmDutycycle.size(); i++) {
-                    data[i] = last.pwmDutycycle[i];
-                }
-            break;
+                // In the interface the pwmDutycycle is a double, but in the jointData it is a float
+                std::copy_n(last.pwmDutycycle.data(), nj, data);
+                return last.pwmDutycycle_isValid;
 
             case VOCAB_AMP_CURRENTS:
-                ret = last.current_isValid;
-                memcpy(data, last.current.data(), last.current.size() * last.current.getElementSize());
-                break;
+                std::copy_n(last.current.data(), nj, data);
+                return last.current_isValid;
 
             case VOCAB_TEMPERATURES:
-                ret = last.temperature_isValid;
-
-                // In the interface the temperature is a double, but in the jointData it is a float so we need to copy it manually
-                for (size_t i = 0; i < last.temperature.size(); i++) {
-                    data[i] = last.temperature[i];
-                }
-                break;
+                // In the interface the temperature is a double, but in the jointData it is a float
+                std::copy_n(last.temperature.data(), nj, data);
+                return last.temperature_isValid;
 
             default:
                 yCError(CONTROLBOARD_NWC_YARP) << "Internal error while reading data. Cannot get 'vector' data of type " << yarp::os::Vocab32::decode(field);
-            break;
+                return false;
         }
-
-        localArrivalTime=now;
-        stamp = lastStamp;
-        if (ret && ((Time::now() - localArrivalTime) > timeout)) {
-            ret = false;
-        }
-    }
-    mutex.unlock();
-
-    return ret;
+    }, stamp, localArrivalTime);
 }
 
 bool StateExtendedInputPort::getLastVector(int field, int* data, Stamp& stamp, double& localArrivalTime)
 {
-    mutex.lock();
-    bool ret = valid;
-    if (ret)
+    return readLast([&](const yarp::dev::JointStateData& last)
     {
         switch(field)
         {
             case VOCAB_CM_CONTROL_MODES:
-                ret = last.controlMode_isValid;
-                memcpy(data, last.controlMode.data(), last.controlMode.size() * last.controlMode.getElementSize());
-            break;
+                std::copy_n(last.controlMode.data(), nj, data);
+                return last.controlMode_isValid;
 
             case VOCAB_INTERACTION_MODES:
-                ret = last.interactionMode_isValid;
-                memcpy(data, last.interactionMode.data(), last.interactionMode.size() * last.interactionMode.getElementSize());
-            break;
+                std::copy_n(last.interactionMode.data(), nj, data);
+                return last.interactionMode_isValid;
 
             default:
                 yCError(CONTROLBOARD_NWC_YARP) << "Internal error while reading data. Cannot get 'vector' data of type " << yarp::os::Vocab32::decode(field);
-            break;
+                return false;
         }
-        localArrivalTime=now;
-        stamp = lastStamp;
-        if (ret && ((Time::now() - localArrivalTime) > timeout)) {
-            ret = false;
-        }
-    }
-    mutex.unlock();
-    return ret;
+    }, stamp, localArrivalTime);
+}
+
+bool StateExtendedInputPort::getLastFields(unsigned int fields, yarp::dev::JointStateData& data, Stamp& stamp, double& localArrivalTime)
+{
+    return readLast([&](const yarp::dev::JointStateData& last)
+    {
+        forEachField(data, last, [fields](unsigned int field, auto& dst, bool& dstValid, const auto& src, const bool& srcValid)
+        {
+            if (fields & field)
+            {
+                if (dst.size() != src.size()) {
+                    dst.resize(src.size());
+                }
+                std::copy_n(src.data(), src.size(), dst.data());
+                dstValid = srcValid;
+            }
+        });
+        return true;
+    }, stamp, localArrivalTime);
 }
 
 int StateExtendedInputPort::getIterations()
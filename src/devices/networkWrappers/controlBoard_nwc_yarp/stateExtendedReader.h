@@ -25,6 +25,8 @@
 
 #include <yarp/dev/JointStateData.h>
 
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <mutex>
 
@@ -38,23 +40,69 @@ using namespace yarp::sig;
 class StateExtendedInputPort :
         public yarp::os::BufferedPort<yarp::dev::JointStateData>
 {
-    yarp::dev::JointStateData last;
+    // The last received samples are stored in a small ring of slots, each
+    // protected by a sequence counter (seqlock): onRead() writes the slot
+    // after the last published one without waiting for the readers, and a
+    // reader copies the last published slot and retries only if onRead()
+    // wrote it in the meanwhile.
+    // The vectors of the slots are allocated once, before the first sample
+    // is published, and never resized.
+    struct Slot
+    {
+        std::atomic<unsigned int> seq{0}; // odd while onRead() is writing the slot
+        yarp::dev::JointStateData data;
+        Stamp stamp;
+        double arrivalTime{0.0};
+    };
+    static constexpr int slotCount = 3;
+    std::array<Slot, slotCount> slots;
+    std::atomic<int> lastSlot{-1}; // the last published slot, -1 until the first sample is received
+    size_t nj{0};
+
+    // the statistics, protected by mutex
     std::mutex mutex;
-    Stamp lastStamp;
     double deltaT;
     double deltaTMax;
     double deltaTMin;
-    double now;
     double prev;
     double timeout;
 
-    bool valid;
     int count;
+
+    void allocate(size_t numberOfJoints);
+
+    template <typename F>
+    bool readLast(F&& copy, Stamp& stamp, double& localArrivalTime);
+
 public:
 
+    // the fields of yarp::dev::JointStateData, used by getLastFields()
+    enum field_t : unsigned int
+    {
+        FIELD_JOINT_POSITION      = 1 << 0,
+        FIELD_JOINT_VELOCITY      = 1 << 1,
+        FIELD_JOINT_ACCELERATION  = 1 << 2,
+        FIELD_MOTOR_POSITION      = 1 << 3,
+        FIELD_MOTOR_VELOCITY      = 1 << 4,
+        FIELD_MOTOR_ACCELERATION  = 1 << 5,
+        FIELD_TORQUE              = 1 << 6,
+        FIELD_PWM_DUTYCYCLE       = 1 << 7,
+        FIELD_CURRENT             = 1 << 8,
+        FIELD_CONTROL_MODE        = 1 << 9,
+        FIELD_INTERACTION_MODE    = 1 << 10,
+        FIELD_TEMPERATURE         = 1 << 11,
+        FIELD_ALL                 = (1 << 12) - 1
+    };
+
     StateExtendedInputPort();
 
     void resetStat();
+
+    /**
+     * @brief init, allocate the memory for the given number of joints. It
+     * must be called before receiving the first sample, otherwise the number
+     * of joints of the first sample is used.
+     */
     void init(int numberOfJoints);
 
     using yarp::os::BufferedPort<yarp::dev::JointStateData>::onRead;
@@ -74,6 +122,16 @@ public:
     // get a value for all joints
     bool getLastVector(int field, double *data, Stamp &stamp, double &localArrivalTime);
     bool getLastVector(int field, int    *data, Stamp &stamp, double &localArrivalTime);
+
+    /**
+     * @brief getLastFields, get several fields of the same sample
+     * @param fields a mask of field_t values
+     * @param data the requested fields are copied here, with their _isValid flags
+     * (the vectors are resized only if they have not the right size)
+     * @return false if no recent sample was received
+     */
+    bool getLastFields(unsigned int fields, yarp::dev::JointStateData& data, Stamp &stamp, double &localArrivalTime);
+
     int  getIterations();
 
     // time is in ms
@@ -3,7 +3,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <yarp/os/BufferedPort.h>
 #include <yarp/os/Network.h>
+#include <yarp/os/Stamp.h>
+#include <yarp/dev/JointStateData.h>
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/WrapperSingle.h>
 #include <yarp/dev/tests/IPositionControlTest.h>
@@ -30,6 +33,10 @@
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 using namespace yarp::dev;
 using namespace yarp::os;
 
@@ -238,3 +245,179 @@ TEST_CASE("dev::controlBoard_nwc_yarp", "[yarp::dev]")
 
     Network::setLocalMode(false);
 }
+
+TEST_CASE("dev::controlBoard_nwc_yarp_streamed_state", "[yarp::dev]")
+{
+    YARP_REQUIRE_PLUGIN("fakeMotionControl", "device");
+    YARP_REQUIRE_PLUGIN("controlBoard_nws_yarp", "device");
+    YARP_REQUIRE_PLUGIN("controlBoard_nwc_yarp", "device");
+
+    Network::setLocalMode(true);
+
+    constexpr int nj = 2;
+
+    PolyDriver ddmc;
+    PolyDriver ddnws;
+    PolyDriver ddnwc;
+
+    {
+        Property p_cfg;
+        p_cfg.put("device", "fakeMotionControl");
+        Property& grp = p_cfg.addGroup("GENERAL");
+        grp.put("Joints", nj);
+        REQUIRE(ddmc.open(p_cfg));
+    }
+    {
+        Property p_cfg;
+        p_cfg.put("device", "controlBoard_nws_yarp");
+        p_cfg.put("name", "/controlboardserver");
+        REQUIRE(ddnws.open(p_cfg));
+    }
+    {
+        yarp::dev::WrapperSingle* ww_nws=nullptr; ddnws.view(ww_nws);
+        REQUIRE(ww_nws);
+        REQUIRE(ww_nws->attach(&ddmc));
+    }
+    {
+        Property p_cfg;
+        p_cfg.put("device", "controlBoard_nwc_yarp");
+        p_cfg.put("local", "/local_controlboard");
+        p_cfg.put("remote", "/controlboardserver");
+        REQUIRE(ddnwc.open(p_cfg));
+    }
+
+    IEncodersTimed* ienc = nullptr;
+    ITorqueControl* itrq = nullptr;
+    IControlMode* icmd = nullptr;
+    ddnwc.view(ienc); REQUIRE(ienc);
+    ddnwc.view(itrq); REQUIRE(itrq);
+    ddnwc.view(icmd); REQUIRE(icmd);
+
+    // The state is streamed by the test instead of the server
+    REQUIRE(Network::disconnect("/controlboardserver/stateExt:o", "/local_controlboard/stateExt:i"));
+    BufferedPort<JointStateData> statePort;
+    REQUIRE(statePort.open("/test/stateExt:o"));
+    REQUIRE(Network::connect("/test/stateExt:o", "/local_controlboard/stateExt:i"));
+
+    // Every field of the sample k is filled with k, the timestamp is k too.
+    // Empty vectors cannot be serialized, hence all the fields are filled.
+    auto writeSample = [&statePort](int k, size_t positionSize) {
+        JointStateData& s = statePort.prepare();
+        auto fill = [k](auto& field, bool& valid, size_t size) {
+            field.resize(size);
+            std::fill(field.begin(), field.end(), k);
+            valid = true;
+        };
+        fill(s.jointPosition, s.jointPosition_isValid, positionSize);
+        fill(s.jointVelocity, s.jointVelocity_isValid, nj);
+        fill(s.jointAcceleration, s.jointAcceleration_isValid, nj);
+        fill(s.motorPosition, s.motorPosition_isValid, nj);
+        fill(s.motorVelocity, s.motorVelocity_isValid, nj);
+        fill(s.motorAcceleration, s.motorAcceleration_isValid, nj);
+        fill(s.torque, s.torque_isValid, nj);
+        fill(s.pwmDutycycle, s.pwmDutycycle_isValid, nj);
+        fill(s.current, s.current_isValid, nj);
+        fill(s.controlMode, s.controlMode_isValid, nj);
+        fill(s.interactionMode, s.interactionMode_isValid, nj);
+        fill(s.temperature, s.temperature_isValid, nj);
+        Stamp stamp(k, k);
+        statePort.setEnvelope(stamp);
+        statePort.writeStrict();
+    };
+
+    auto waitTorque = [itrq](double value) {
+        for (int i = 0; i < 500; i++) {
+            double t = 0.0;
+            if (itrq->getTorque(0, &t) && t == value) {
+                return true;
+            }
+            yarp::os::Time::delay(0.01);
+        }
+        return false;
+    };
+
+    SECTION("Concurrent writes and reads return consistent samples")
+    {
+        constexpr int samples = 2000;
+        std::atomic<bool> done{false};
+        std::thread writer([&]() {
+            for (int k = 1; k <= samples; k++) {
+                writeSample(k, nj);
+            }
+            done = true;
+        });
+
+        double encs[nj];
+        double ts[nj];
+        double trqs[nj];
+        int reads = 0;
+        bool consistent = true;
+        while (!done) {
+            if (ienc->getEncodersTimed(encs, ts)) {
+                reads++;
+                for (int j = 0; j < nj; j++) {
+                    // positions and timestamps of the same sample
+                    consistent = consistent && encs[j] == encs[0] && ts[j] == encs[0];
+                }
+            }
+            if (itrq->getTorques(trqs)) {
+                consistent = consistent && trqs[1] == trqs[0];
+            }
+        }
+        writer.join();
+        CHECK(consistent);
+        CHECK(reads > 0);
+        CHECK(waitTorque(samples));
+        CHECK(ienc->getEncodersTimed(encs, ts));
+        CHECK(encs[0] == samples);
+        CHECK(ts[nj - 1] == samples);
+    }
+
+    SECTION("Joint index out of range")
+    {
+        writeSample(7, nj);
+        REQUIRE(waitTorque(7));
+        double v = 0.0;
+        CHECK(ienc->getEncoder(nj - 1, &v));
+        CHECK(v == 7);
+        CHECK_FALSE(ienc->getEncoder(nj, &v));
+        CHECK_FALSE(ienc->getEncoder(-1, &v));
+        CHECK_FALSE(itrq->getTorque(nj, &v));
+        yarp::dev::ControlModeEnum mode;
+        CHECK_FALSE(icmd->getControlMode(nj, mode));
+        CHECK_FALSE(icmd->getControlMode(-1, mode));
+    }
+
+    SECTION("Fields with a wrong number of joints")
+    {
+        // too many positions
+        writeSample(3, nj + 1);
+        REQUIRE(waitTorque(3));
+        double encs[nj + 1];
+        double v = 0.0;
+        CHECK_FALSE(ienc->getEncoders(encs));
+        CHECK_FALSE(ienc->getEncoder(0, &v));
+        CHECK(ienc->getEncoderSpeed(0, &v));
+        CHECK(v == 3);
+
+        // too few positions
+        writeSample(4, nj - 1);
+        REQUIRE(waitTorque(4));
+        CHECK_FALSE(ienc->getEncoders(encs));
+        CHECK_FALSE(ienc->getEncoder(0, &v));
+
+        // the following sample is valid again
+        writeSample(5, nj);
+        REQUIRE(waitTorque(5));
+        CHECK(ienc->getEncoders(encs));
+        CHECK(encs[0] == 5);
+        CHECK(encs[nj - 1] == 5);
+    }
+
+    statePort.close();
+    CHECK(ddnwc.close());
+    CHECK(ddnws.close());
+    CHECK(ddmc.close());
+
+    Network::setLocalMode(false);
+}
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "stateExtendedReader.h"
+
+#include <yarp/dev/JointStateData.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+using namespace yarp::dev;
+using namespace yarp::os;
+
+namespace {
+
+// A sample with all the fields set to k
+JointStateData makeSample(size_t nj, int k)
+{
+    JointStateData v;
+    auto fill = [&](auto& vec, bool& valid) {
+        vec.resize(nj);
+        std::fill(vec.begin(), vec.end(), k);
+        valid = true;
+    };
+    fill(v.jointPosition, v.jointPosition_isValid);
+    fill(v.jointVelocity, v.jointVelocity_isValid);
+    fill(v.jointAcceleration, v.jointAcceleration_isValid);
+    fill(v.motorPosition, v.motorPosition_isValid);
+    fill(v.motorVelocity, v.motorVelocity_isValid);
+    fill(v.motorAcceleration, v.motorAcceleration_isValid);
+    fill(v.torque, v.torque_isValid);
+    fill(v.pwmDutycycle, v.pwmDutycycle_isValid);
+    fill(v.current, v.current_isValid);
+    fill(v.controlMode, v.controlMode_isValid);
+    fill(v.interactionMode, v.interactionMode_isValid);
+    fill(v.temperature, v.temperature_isValid);
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("dev::controlBoard_nwc_yarp_stateExtendedReader", "[yarp::dev]")
+{
+    constexpr size_t nj = 4;
+    StateExtendedInputPort reader;
+    reader.init(nj);
+
+    JointStateData data;
+    Stamp stamp;
+    double arrivalTime = 0.0;
+    CHECK_FALSE(reader.getLastFields(StateExtendedInputPort::FIELD_ALL, data, stamp, arrivalTime));
+
+    SECTION("checking the requested fields")
+    {
+        JointStateData sample = makeSample(nj, 7);
+        sample.torque_isValid = false;
+        reader.onRead(sample);
+
+        REQUIRE(reader.getLastFields(StateExtendedInputPort::FIELD_JOINT_POSITION | StateExtendedInputPort::FIELD_TORQUE, data, stamp, arrivalTime));
+        CHECK(stamp.isValid());
+        CHECK(data.jointPosition.size() == nj);
+        CHECK(data.jointPosition[nj - 1] == 7);
+        CHECK(data.jointPosition_isValid);
+        CHECK(data.torque.size() == nj);
+        CHECK_FALSE(data.torque_isValid);
+        // the other fields are not copied
+        CHECK(data.jointVelocity.size() == 0);
+        CHECK(data.controlMode.size() == 0);
+    }
+
+    SECTION("checking that the fields come from the same sample")
+    {
+        std::atomic<bool> done{false};
+        std::thread writer([&]() {
+            for (int k = 1; k <= 2000; k++) {
+                JointStateData sample = makeSample(nj, k);
+                reader.onRead(sample);
+            }
+            done = true;
+        });
+
+        bool consistent = true;
+        int reads = 0;
+        while (!done || reads == 0) {
+            if (!reader.getLastFields(StateExtendedInputPort::FIELD_ALL, data, stamp, arrivalTime)) {
+                continue;
+            }
+            reads++;
+            const double k = data.jointPosition[0];
+            consistent = consistent &&
+                         data.jointPosition[nj - 1] == k &&
+                         data.motorVelocity[nj - 1] == k &&
+                         data.torque[0] == k &&
+                         data.temperature[nj - 1] == k &&
+                         data.controlMode[nj - 1] == static_cast<int>(k) &&
+                         data.interactionMode[0] == static_cast<int>(k);
+        }
+        writer.join();
+        CHECK(consistent);
+        CHECK(reads > 0);
+    }
+}
@@ -52,6 +52,12 @@
  *
  * \brief `controlBoard_nws_yarp`: A controlBoard network wrapper server for YARP.
  *
+ * The clients that need only some fields of the state, or a lower rate, can
+ * connect to the `/stateExt:o` port with the `jointstate_fields` portmonitor
+ * (see the `state_fields` and `state_decimation` parameters of
+ * `controlBoard_nwc_yarp`).  The requested fields are then packed in a
+ * compact binary message by this process, separately for each connection.
+ *
  * \section controlBoard_nws_yarp_device_parameters Description of input parameters
  *
  * Parameters required by this device are shown in class: ControlBoard_nws_yarp_ParamsParser
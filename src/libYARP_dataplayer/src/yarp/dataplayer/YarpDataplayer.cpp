@@ -721,6 +721,12 @@ int DataplayerWorker::sendImages(int part, int frame)
     }
 
     tmpPath = tmpPath + tmpName;
+    if (strcmp(utilities->partDetails[part].type.c_str(), "Image:jpg") == 0 ||
+        strcmp(utilities->partDetails[part].type.c_str(), "Image:png") == 0)
+    {
+        return sendEncodedImage(part, frame, tmpPath, code);
+    }
+
     std::unique_ptr<Image> img_yarp = nullptr;
 
 #ifdef HAS_OPENCV
@@ -806,6 +812,34 @@ int DataplayerWorker::sendImages(int part, int frame)
     return 0;
 }
 
+/**********************************************************/
+int DataplayerWorker::sendEncodedImage(int part, int frame, const std::string& path, int code)
+{
+    // The file is decoded directly in the pixel type of the image
+    decoded.setPixelCode(code != 0 ? code : VOCAB_PIXEL_RGB);
+    if (!codec.read(decoded, path)) {
+        if (utilities->verbose){
+            yError() << "Cannot load file " << path.c_str() ;
+        }
+        return 1;
+    }
+
+    yarp::os::BufferedPort<yarp::sig::Image>* the_port = dynamic_cast<yarp::os::BufferedPort<yarp::sig::Image>*> (utilities->partDetails[part].outputPort);
+    if (the_port == nullptr) { yFatal() << "dynamic_cast failed"; }
+
+    the_port->prepare()=decoded;
+
+    Stamp ts(frame,utilities->partDetails[part].timestamp[frame]);
+    the_port->setEnvelope(ts);
+
+    if (utilities->sendStrict) {
+        the_port->writeStrict();
+    } else {
+        the_port->write();
+    }
+    return 0;
+}
+
 /**********************************************************/
 void DataplayerWorker::setManager(yarp::yarpDataplayer::DataplayerUtilities *utilities)
 {
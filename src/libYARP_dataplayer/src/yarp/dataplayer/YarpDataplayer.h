@@ -203,6 +203,10 @@ protected:
     double frameRate, initTime, virtualTime;
     yarp::os::Semaphore semIndex;
     double startTime;
+    yarp::sig::file::ImageCodec codec;  //decoder of the jpg/png images, that keeps its buffers between the frames
+    yarp::sig::FlexImage decoded;       //last jpg/png image decoded
+
+    int sendEncodedImage(int part, int id, const std::string& path, int code);
 
 public:
     /**
@@ -117,11 +117,9 @@ bool AudioPlayerDeviceBase::appendSound(const yarp::sig::Sound& sound)
     size_t num_channels = sound.getChannels();
     size_t num_samples = sound.getSamples();
 
-    for (size_t i = 0; i < num_samples; i++) {
-        for (size_t j = 0; j < num_channels; j++) {
-            m_outputBuffer->write(sound.get(i, j));
-        }
-    }
+    m_interleaved.resize(num_samples * num_channels);
+    sound.copyToInterleaved(reinterpret_cast<Sound::audio_sample*>(m_interleaved.data()), 0, num_samples);
+    m_outputBuffer->write(m_interleaved.data(), m_interleaved.size());
 
     return true;
 }
@@ -134,11 +132,9 @@ bool AudioPlayerDeviceBase::immediateSound(const yarp::sig::Sound& sound)
     size_t num_channels = sound.getChannels();
     size_t num_samples = sound.getSamples();
 
-    for (size_t i = 0; i < num_samples; i++) {
-        for (size_t j = 0; j < num_channels; j++) {
-            m_outputBuffer->write(sound.get(i, j));
-        }
-    }
+    m_interleaved.resize(num_samples * num_channels);
+    sound.copyToInterleaved(reinterpret_cast<Sound::audio_sample*>(m_interleaved.data()), 0, num_samples);
+    m_outputBuffer->write(m_interleaved.data(), m_interleaved.size());
 
     return true;
 }
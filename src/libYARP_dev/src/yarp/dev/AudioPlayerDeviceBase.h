@@ -58,6 +58,7 @@ protected:
     double                              m_hw_gain = 1.0;
     bool                                m_audiobase_debug = false;
     enum { RENDER_APPEND = 0, RENDER_IMMEDIATE = 1 } m_renderMode= RENDER_APPEND;
+    std::vector<unsigned short>         m_interleaved; // samples written to m_outputBuffer
 
 public:
     virtual yarp::dev::ReturnValue renderSound(const yarp::sig::Sound& sound) override;
@@ -5,6 +5,7 @@
 
 #include <yarp/dev/AudioRecorderDeviceBase.h>
 #include <yarp/os/LogStream.h>
+#include <algorithm>
 #include <mutex>
 #include <limits>
 #include <functional>
@@ -98,24 +99,22 @@ ReturnValue AudioRecorderDeviceBase::getSound(yarp::sig::Sound& sound, size_t mi
     #if DEBUG_TIME_SPENT
     double ct1 = yarp::os::Time::now();
     #endif
-    for (size_t i = 0; i < samples_to_be_copied; i++)
+    m_interleaved.resize(samples_to_be_copied * this->m_audiorecorder_cfg.numChannels);
+    m_inputBuffer->read(m_interleaved.data(), m_interleaved.size());
+    const auto* samples = reinterpret_cast<const Sound::audio_sample*>(m_interleaved.data());
+    bool clipped = std::any_of(samples, samples + m_interleaved.size(), [this](int16_t s) {
+        return s > (std::numeric_limits<int16_t>::max() - m_cliptol) ||
+               s < (std::numeric_limits<int16_t>::min() + m_cliptol);
+    });
+    if (clipped)
     {
-        for (size_t j = 0; j < this->m_audiorecorder_cfg.numChannels; j++)
-        {
-            int16_t s = (int16_t)(m_inputBuffer->read());
-            if (s > (std::numeric_limits<int16_t>::max() - m_cliptol) ||
-                s < (std::numeric_limits<int16_t>::min() + m_cliptol))
-            {
-                yCWarningThrottle(AUDIORECORDER_BASE, 0.1) << "Sound clipped!";
-            }
-            sound.set(s, i, j);
-        }
+        yCWarningThrottle(AUDIORECORDER_BASE, 0.1) << "Sound clipped!";
     }
+    sound.copyFromInterleaved(samples, 0, samples_to_be_copied);
 
     //amplify if required
     if (m_sw_gain!=1.0) {sound.amplify(m_sw_gain);}
 
-    auto debug_p = sound.getInterleavedAudioRawData();
     #if DEBUG_TIME_SPENT
     double ct2 = yarp::os::Time::now();
     yCDebug(AUDIORECORDER_BASE) << ct2 - ct1;
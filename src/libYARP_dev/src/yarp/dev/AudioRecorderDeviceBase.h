@@ -55,6 +55,7 @@ protected:
     AudioDeviceDriverSettings m_audiorecorder_cfg;
     bool            m_audiobase_debug = false;
     int16_t         m_cliptol = 3;
+    std::vector<unsigned short> m_interleaved; // samples read from m_inputBuffer
 
 public:
     virtual yarp::dev::ReturnValue getSound(yarp::sig::Sound& sound, size_t min_number_of_samples, size_t max_number_of_samples, double max_samples_timeout_s) override;
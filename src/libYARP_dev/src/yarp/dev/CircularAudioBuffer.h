@@ -8,7 +8,9 @@
 
 #include <yarp/os/Log.h>
 #include <yarp/sig/AudioBufferSize.h>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <string>
 
 #include <yarp/os/LogStream.h>
@@ -52,17 +54,45 @@ class CircularAudioBuffer
         }
     }
 
-    yarp::sig::AudioBufferSize size()
+    /**
+     * Write a block of elements, e.g. a block of interleaved samples,
+     * overwriting the oldest ones if the buffer is full.
+     */
+    void write(const SAMPLE* data, size_t count)
+    {
+        const size_t capacity = maxsize.getBufferElements();
+        const size_t used = elements();
+        if (count >= capacity)
+        {
+            // Only the last ones fit
+            data += count - (capacity - 1);
+            count = capacity - 1;
+        }
+        size_t first = std::min(count, capacity - end);
+        memcpy(elems + end, data, first * sizeof(SAMPLE));
+        memcpy(elems, data + first, (count - first) * sizeof(SAMPLE));
+        end = (end + count) % capacity;
+        if (used + count > capacity - 1)
+        {
+            printf ("ERROR: %s buffer overrun!\n", name.c_str());
+            start = (end + 1) % capacity; // full, overwrite
+        }
+    }
+
+    /**
+     * The number of elements in the buffer, e.g. samples times channels.
+     */
+    size_t elements()
     {
-        size_t i;
-        if (end > start) {
-            i = end-start;
-        } else if (end == start) {
-            i = 0;
-        } else {
-            i = maxsize.getBufferElements() - start + end;
+        if (end >= start) {
+            return end - start;
         }
-        return yarp::sig::AudioBufferSize(i/maxsize.getChannels(), maxsize.getChannels(), sizeof(SAMPLE));
+        return maxsize.getBufferElements() - start + end;
+    }
+
+    yarp::sig::AudioBufferSize size()
+    {
+        return yarp::sig::AudioBufferSize(elements()/maxsize.getChannels(), maxsize.getChannels(), sizeof(SAMPLE));
     }
 
     SAMPLE read()
@@ -76,6 +106,22 @@ class CircularAudioBuffer
         return elem;
     }
 
+    /**
+     * Read a block of elements.
+     * @return the number of elements read, less than count if the buffer
+     *         does not contain enough of them.
+     */
+    size_t read(SAMPLE* data, size_t count)
+    {
+        const size_t capacity = maxsize.getBufferElements();
+        count = std::min(count, elements());
+        size_t first = std::min(count, capacity - start);
+        memcpy(data, elems + start, first * sizeof(SAMPLE));
+        memcpy(data + first, elems, (count - first) * sizeof(SAMPLE));
+        start = (start + count) % capacity;
+        return count;
+    }
+
     yarp::sig::AudioBufferSize getMaxSize()
     {
         return maxsize;
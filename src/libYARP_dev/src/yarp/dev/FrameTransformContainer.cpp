@@ -8,7 +8,11 @@
 #include <yarp/os/Log.h>
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/LogStream.h>
+#include <yarp/sig/MatrixN.h>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
 
 using namespace yarp::dev;
 using namespace yarp::os;
@@ -18,16 +22,267 @@ using namespace yarp::math;
 namespace {
 YARP_LOG_COMPONENT(FRAMETRANSFORMCONTAINER, "yarp.device.frameTransformContainer")
 
+using Matrix4 = yarp::sig::MatrixN<double, 4, 4>;
+constexpr size_t no_frame = std::numeric_limits<size_t>::max();
+
+// inverse of an homogeneous transformation
+Matrix4 se3inv(const Matrix4& m)
+{
+    Matrix4 ret;
+    for (size_t r = 0; r < 3; r++)
+    {
+        for (size_t c = 0; c < 3; c++)
+        {
+            ret(r, c) = m(c, r);
+        }
+        ret(r, 3) = -(m(0, r) * m(0, 3) + m(1, r) * m(1, 3) + m(2, r) * m(2, 3));
+    }
+    ret(3, 3) = 1.0;
+    return ret;
 }
 
+}
+
+//------------------------------------------------------------------------------------------------------------------------------
+
+// The topology of the graph of the frames. It is rebuilt only when a
+// transform is added or removed, and then it is never modified.
+struct FrameTransformContainer::FrameTopology
+{
+    uint64_t generation = 0;
+    std::unordered_map<std::string, size_t> ids;  // frame name -> frame index
+    std::vector<std::string> names;               // frame index -> frame name
+    std::vector<size_t> parent;                   // no_frame for the roots
+    std::vector<size_t> edge;                     // index in m_transforms of the transform parent -> frame
+    std::vector<std::vector<size_t>> children;
+    std::vector<std::vector<size_t>> chains;      // the frame, its parent, ..., its root
+
+    // pose of chain[0] in chain[k]
+    template <typename PoseFn>
+    static bool chainedPose(const std::vector<size_t>& chain, size_t k, PoseFn& pose, Matrix4& ret)
+    {
+        Matrix4 p;
+        ret.eye();
+        for (size_t i = k; i-- > 0;)
+        {
+            if (!pose(chain[i], p)) {
+                return false;
+            }
+            ret = ret * p;
+        }
+        return true;
+    }
+
+    // pose(frame, m) sets m to the pose of the frame in its parent frame,
+    // and returns false if it is not available
+    template <typename PoseFn>
+    bool resolve(const std::string& target_frame_id, const std::string& source_frame_id, Matrix4* transform, PoseFn pose) const
+    {
+        if (target_frame_id == source_frame_id)
+        {
+            if (transform) { transform->eye(); }
+            return true;
+        }
+
+        auto t = ids.find(target_frame_id);
+        auto s = ids.find(source_frame_id);
+        if (t == ids.end() || s == ids.end())
+        {
+            return false;
+        }
+        const auto& tar2root = chains[t->second];
+        const auto& src2root = chains[s->second];
+
+        //the source frame is an ancestor of the target frame
+        for (size_t i = 1; i < tar2root.size(); i++)
+        {
+            if (tar2root[i] == s->second)
+            {
+                return !transform || chainedPose(tar2root, i, pose, *transform);
+            }
+        }
+
+        //the target frame is an ancestor of the source frame
+        for (size_t j = 1; j < src2root.size(); j++)
+        {
+            if (src2root[j] == t->second)
+            {
+                Matrix4 src2tar;
+                if (transform == nullptr) { return true; }
+                if (!chainedPose(src2root, j, pose, src2tar)) { return false; }
+                *transform = se3inv(src2tar);
+                return true;
+            }
+        }
+
+        //the frames have a common ancestor
+        for (size_t i = 1; i < tar2root.size(); i++)
+        {
+            for (size_t j = 1; j < src2root.size(); j++)
+            {
+                if (tar2root[i] == src2root[j])
+                {
+                    Matrix4 root2tar;
+                    Matrix4 root2src;
+                    if (transform == nullptr) { return true; }
+                    if (!chainedPose(tar2root, i, pose, root2tar) ||
+                        !chainedPose(src2root, j, pose, root2src)) { return false; }
+                    *transform = se3inv(root2src) * root2tar;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+};
+
+// A snapshot of the graph: the topology and the value of each transform
+struct FrameTransformContainer::FrameGraph
+{
+    std::shared_ptr<const FrameTopology> topology;
+    std::vector<Matrix4> poses;                   // pose of each frame in its parent frame
+
+    bool resolve(const std::string& target_frame_id, const std::string& source_frame_id, Matrix4* transform) const
+    {
+        return topology->resolve(target_frame_id, source_frame_id, transform,
+                                 [this](size_t frame, Matrix4& m) { m = poses[frame]; return true; });
+    }
+};
+
+// The last values of a non static transform, in a circular buffer sorted by
+// time (a value is stored only if it is more recent than the last one)
+struct FrameTransformContainer::TransformHistory
+{
+    struct Sample
+    {
+        double timestamp;
+        FrameTransform::Translation_t translation;
+        Quaternion rotation;
+    };
+
+    std::vector<Sample> samples;
+    size_t first = 0;
+    size_t count = 0;
+
+    const Sample& at(size_t i) const { return samples[(first + i) % samples.size()]; }
+
+    void clear()
+    {
+        first = 0;
+        count = 0;
+    }
+
+    void push(const FrameTransform& trf, size_t capacity)
+    {
+        if (capacity == 0) {
+            return;
+        }
+        if (samples.size() != capacity)
+        {
+            //keep the most recent values when the capacity changes
+            std::vector<Sample> tmp;
+            for (size_t i = (count > capacity ? count - capacity : 0); i < count; i++) {
+                tmp.push_back(at(i));
+            }
+            count = tmp.size();
+            first = 0;
+            tmp.resize(capacity);
+            samples = std::move(tmp);
+        }
+        Sample& s = samples[(first + count) % capacity];
+        s.timestamp = trf.timestamp;
+        s.translation = trf.translation;
+        s.rotation = trf.rotation;
+        if (count < capacity) {
+            count++;
+        } else {
+            first = (first + 1) % capacity;
+        }
+    }
+
+    // the value at the given time, interpolated between the two closest values
+    bool interpolate(double timestamp, Matrix4& m) const
+    {
+        if (count == 0 || timestamp < at(0).timestamp || timestamp > at(count - 1).timestamp) {
+            return false;
+        }
+
+        //the first value more recent than the requested time
+        size_t lo = 0;
+        size_t hi = count - 1;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (at(mid).timestamp < timestamp) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        const Sample& s1 = at(lo);
+        if (lo == 0 || s1.timestamp == timestamp)
+        {
+            s1.rotation.toRotationMatrix4x4(m);
+            m(0, 3) = s1.translation.tX;
+            m(1, 3) = s1.translation.tY;
+            m(2, 3) = s1.translation.tZ;
+            return true;
+        }
+        const Sample& s0 = at(lo - 1);
+        const double alpha = (timestamp - s0.timestamp) / (s1.timestamp - s0.timestamp);
+
+        slerp(s0.rotation, s1.rotation, alpha).toRotationMatrix4x4(m);
+        m(0, 3) = s0.translation.tX + alpha * (s1.translation.tX - s0.translation.tX);
+        m(1, 3) = s0.translation.tY + alpha * (s1.translation.tY - s0.translation.tY);
+        m(2, 3) = s0.translation.tZ + alpha * (s1.translation.tZ - s0.translation.tZ);
+        return true;
+    }
+
+    static Quaternion slerp(const Quaternion& q0, const Quaternion& q1, double alpha)
+    {
+        double d = q0.w() * q1.w() + q0.x() * q1.x() + q0.y() * q1.y() + q0.z() * q1.z();
+        //q and -q are the same rotation: take the shortest path
+        double sign = 1.0;
+        if (d < 0)
+        {
+            d = -d;
+            sign = -1.0;
+        }
+        double k0 = 1.0 - alpha;
+        double k1 = alpha;
+        //for close rotations the linear interpolation is used, to avoid dividing by sin(theta) ~ 0
+        if (d < 0.9995)
+        {
+            const double theta = std::acos(d);
+            const double sin_theta = std::sin(theta);
+            k0 = std::sin((1.0 - alpha) * theta) / sin_theta;
+            k1 = std::sin(alpha * theta) / sin_theta;
+        }
+        k1 *= sign;
+        Quaternion q(k0 * q0.x() + k1 * q1.x(),
+                     k0 * q0.y() + k1 * q1.y(),
+                     k0 * q0.z() + k1 * q1.z(),
+                     k0 * q0.w() + k1 * q1.w());
+        q.normalize();
+        return q;
+    }
+};
+
 //------------------------------------------------------------------------------------------------------------------------------
 
+FrameTransformContainer::FrameTransformContainer() = default;
+
+FrameTransformContainer::~FrameTransformContainer() = default;
+
 void FrameTransformContainer::invalidateTransform(yarp::math::FrameTransform& trf)
 {
     trf.timestamp = yarp::os::Time::now();
     trf.isStatic = false;
     trf.translation = { 0,0,0 };
     trf.rotation = { 0,0,0,0 };
+    m_topology_changed = true;
     if (m_verbose_debug)
     {
         yCIDebug(FRAMETRANSFORMCONTAINER, m_name) << "At time" << std::to_string(trf.timestamp)
@@ -44,10 +299,12 @@ ReturnValue FrameTransformContainer::getTransforms(std::vector<yarp::math::Frame
 
 ReturnValue FrameTransformContainer::setTransforms(const std::vector<yarp::math::FrameTransform>& transforms)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_trf_mutex);
     for (auto& it : transforms)
     {
-        setTransform(it);
+        priv_setTransform(it);
     }
+    priv_publishGraph();
     return ReturnValue_ok;
 }
 
@@ -56,37 +313,146 @@ ReturnValue FrameTransformContainer::setTransform(const yarp::math::FrameTransfo
     if (new_tr.isValid()==false) return ReturnValue_ok;
 
     std::lock_guard<std::recursive_mutex> lock(m_trf_mutex);
-    for (auto& it : m_transforms)
+    priv_setTransform(new_tr);
+    priv_publishGraph();
+    return ReturnValue_ok;
+}
+
+void FrameTransformContainer::priv_setTransform(const yarp::math::FrameTransform& new_tr)
+{
+    if (new_tr.isValid()==false) return;
+
+    yarp::math::FrameTransform* found = nullptr;
+
+    //if the topology is up to date, the transform is found without searching the vector
+    if (!m_topology_changed && m_topology)
+    {
+        auto dst = m_topology->ids.find(new_tr.dst_frame_id);
+        auto src = m_topology->ids.find(new_tr.src_frame_id);
+        if (dst != m_topology->ids.end() && src != m_topology->ids.end() &&
+            m_topology->parent[dst->second] == src->second)
+        {
+            found = &m_transforms[m_topology->edge[dst->second]];
+        }
+    }
+
+    if (found == nullptr)
     {
-        //this linear search may require some optimization
-        if (it.dst_frame_id == new_tr.dst_frame_id && it.src_frame_id == new_tr.src_frame_id)
+        for (auto& it : m_transforms)
         {
-            //if transform already exists and
-            //its timestamp is more recent than the currently stored transform
-            //than update it
-            if (it.isStatic == false)
+            if (it.dst_frame_id == new_tr.dst_frame_id && it.src_frame_id == new_tr.src_frame_id)
             {
-                if (new_tr.timestamp > it.timestamp)
-                {
-                    it = new_tr;
-                    return ReturnValue_ok;
-                }
-                else
-                {
-                    //yCDebug(FRAMETRANSFORMCONTAINER) << "Received old transform" << it.dst_frame_id << it.src_frame_id << std::to_string(it.timestamp) << it.isStatic;
-                    return ReturnValue_ok;
-                }
+                found = &it;
+                break;
             }
-            else
+        }
+    }
+
+    if (found)
+    {
+        //if transform already exists and
+        //its timestamp is more recent than the currently stored transform
+        //than update it
+        if (found->isStatic == false && new_tr.timestamp > found->timestamp)
+        {
+            auto& history = m_history[found - m_transforms.data()];
+            //a deleted transform is added again
+            if (found->isValid() == false)
             {
-                return ReturnValue_ok;
+                m_topology_changed = true;
+                history.clear();
+            }
+            *found = new_tr;
+            if (new_tr.isStatic == false)
+            {
+                history.push(new_tr, m_history_size);
             }
         }
+        //else yCDebug(FRAMETRANSFORMCONTAINER) << "Received old transform" << found->dst_frame_id << found->src_frame_id << std::to_string(found->timestamp) << found->isStatic;
+        return;
     }
 
     //add a new transform
     m_transforms.push_back(new_tr);
-    return ReturnValue_ok;
+    m_history.emplace_back();
+    if (new_tr.isStatic == false)
+    {
+        m_history.back().push(new_tr, m_history_size);
+    }
+    m_topology_changed = true;
+}
+
+void FrameTransformContainer::priv_publishGraph()
+{
+    if (m_topology_changed || !m_topology)
+    {
+        auto topology = std::make_shared<FrameTopology>();
+        topology->generation = ++m_generation;
+
+        auto intern = [&topology](const std::string& name)
+        {
+            auto res = topology->ids.emplace(name, topology->names.size());
+            if (res.second)
+            {
+                topology->names.push_back(name);
+                topology->parent.push_back(no_frame);
+                topology->edge.push_back(no_frame);
+                topology->children.emplace_back();
+            }
+            return res.first->second;
+        };
+
+        for (size_t i = 0; i < m_transforms.size(); i++)
+        {
+            const auto& trf = m_transforms[i];
+            if (!trf.isValid()) {
+                continue;
+            }
+            size_t src = intern(trf.src_frame_id);
+            size_t dst = intern(trf.dst_frame_id);
+            //if a frame has more than one parent, the first one is used
+            if (topology->parent[dst] == no_frame)
+            {
+                topology->parent[dst] = src;
+                topology->edge[dst] = i;
+                topology->children[src].push_back(dst);
+            }
+        }
+
+        const size_t frames = topology->names.size();
+        topology->chains.resize(frames);
+        for (size_t f = 0; f < frames; f++)
+        {
+            auto& chain = topology->chains[f];
+            chain.push_back(f);
+            //the length is bounded in order to stop on loops
+            for (size_t p = topology->parent[f]; p != no_frame && chain.size() <= frames; p = topology->parent[p])
+            {
+                chain.push_back(p);
+            }
+        }
+
+        m_topology = std::move(topology);
+        m_topology_changed = false;
+    }
+
+    auto graph = std::make_shared<FrameGraph>();
+    graph->topology = m_topology;
+    graph->poses.resize(m_topology->names.size());
+    for (size_t f = 0; f < graph->poses.size(); f++)
+    {
+        if (m_topology->edge[f] != no_frame) {
+            m_transforms[m_topology->edge[f]].toMatrix(graph->poses[f]);
+        } else {
+            graph->poses[f].eye();
+        }
+    }
+    m_graph.store(std::move(graph), std::memory_order_release);
+}
+
+std::shared_ptr<const FrameTransformContainer::FrameGraph> FrameTransformContainer::priv_loadGraph() const
+{
+    return m_graph.load(std::memory_order_acquire);
 }
 
 ReturnValue FrameTransformContainer::deleteTransform(std::string t1, std::string t2)
@@ -98,6 +464,7 @@ ReturnValue FrameTransformContainer::deleteTransform(std::string t1, std::string
         {
             invalidateTransform(m_transforms[i]);
         }
+        priv_publishGraph();
         return ReturnValue_ok;
     }
     else
@@ -112,6 +479,7 @@ ReturnValue FrameTransformContainer::deleteTransform(std::string t1, std::string
                     invalidateTransform(m_transforms[i]);
                 }
             }
+            priv_publishGraph();
             return ReturnValue_ok;
         }
         else
@@ -126,6 +494,7 @@ ReturnValue FrameTransformContainer::deleteTransform(std::string t1, std::string
                         invalidateTransform(m_transforms[i]);
                     }
                 }
+                priv_publishGraph();
                 return ReturnValue_ok;
             }
             else
@@ -136,6 +505,7 @@ ReturnValue FrameTransformContainer::deleteTransform(std::string t1, std::string
                         (m_transforms[i].dst_frame_id == t2 && m_transforms[i].src_frame_id == t1))
                     {
                         invalidateTransform(m_transforms[i]);
+                        priv_publishGraph();
                         return ReturnValue_ok;
                     }
                 }
@@ -154,6 +524,7 @@ ReturnValue FrameTransformContainer::clearAll()
     {
         invalidateTransform(m_transforms[i]);
     }
+    priv_publishGraph();
     return ReturnValue_ok;
 }
 
@@ -161,24 +532,42 @@ bool FrameTransformContainer::checkAndRemoveExpired()
 {
     std::lock_guard<std::recursive_mutex> lock(m_trf_mutex);
     double curr_t = yarp::os::Time::now();
-    check_vector:
-    for (auto it= m_transforms.begin(); it!= m_transforms.end(); it++)
+
+    //the transforms that are not expired are compacted at the beginning of the vector, in a single pass
+    size_t kept = 0;
+    for (size_t i = 0; i < m_transforms.size(); i++)
     {
-        if (curr_t - it->timestamp > m_timeout &&
-            it->isStatic == false)
+        auto& trf = m_transforms[i];
+        if (curr_t - trf.timestamp > m_timeout &&
+            trf.isStatic == false)
         {
             if (m_verbose_debug)
             {
-                if (it->isValid())
+                if (trf.isValid())
                 {yCIDebug(FRAMETRANSFORMCONTAINER, m_name) << "At time" << std::to_string(curr_t)
-                 <<"Transform expired:" << it->src_frame_id << "->" << it->dst_frame_id << "with timestamp" << std::to_string(it->timestamp);}
+                 <<"Transform expired:" << trf.src_frame_id << "->" << trf.dst_frame_id << "with timestamp" << std::to_string(trf.timestamp);}
                 else
                 {yCIDebug(FRAMETRANSFORMCONTAINER, m_name) << "At time" << std::to_string(curr_t)
-                 << "Invalid transform expired:" << it->src_frame_id << "->"<< it->dst_frame_id << "with timestamp" << std::to_string(it->timestamp);}
+                 << "Invalid transform expired:" << trf.src_frame_id << "->"<< trf.dst_frame_id << "with timestamp" << std::to_string(trf.timestamp);}
             }
-            m_transforms.erase(it);
-            goto check_vector;
+            continue;
+        }
+        if (kept != i)
+        {
+            m_transforms[kept] = std::move(trf);
+            m_history[kept] = std::move(m_history[i]);
         }
+        kept++;
+    }
+    if (kept != m_transforms.size())
+    {
+        m_transforms.resize(kept);
+        m_history.resize(kept);
+        m_topology_changed = true;
+    }
+    if (m_topology_changed)
+    {
+        priv_publishGraph();
     }
     return ReturnValue_ok;
 }
@@ -194,3 +583,88 @@ bool FrameTransformContainer::size(size_t& size) const
     size = m_transforms.size();
     return true;
 }
+
+bool FrameTransformContainer::getTransform(const std::string& target_frame_id, const std::string& source_frame_id, yarp::sig::Matrix& transform) const
+{
+    Matrix4 m;
+    if (target_frame_id == source_frame_id)
+    {
+        m.eye();
+    }
+    else
+    {
+        auto graph = priv_loadGraph();
+        if (!graph || !graph->resolve(target_frame_id, source_frame_id, &m))
+        {
+            return false;
+        }
+    }
+    m.toMatrix(transform);
+    return true;
+}
+
+bool FrameTransformContainer::getTransform(const std::string& target_frame_id, const std::string& source_frame_id, double timestamp, yarp::sig::Matrix& transform) const
+{
+    std::lock_guard<std::recursive_mutex> lock(m_trf_mutex);
+    Matrix4 m;
+    if (target_frame_id == source_frame_id)
+    {
+        m.eye();
+    }
+    else
+    {
+        if (!m_topology)
+        {
+            return false;
+        }
+        auto pose = [this, timestamp](size_t frame, Matrix4& p)
+        {
+            size_t e = m_topology->edge[frame];
+            if (m_transforms[e].isStatic)
+            {
+                m_transforms[e].toMatrix(p);
+                return true;
+            }
+            return m_history[e].interpolate(timestamp, p);
+        };
+        if (!m_topology->resolve(target_frame_id, source_frame_id, &m, pose))
+        {
+            return false;
+        }
+    }
+    m.toMatrix(transform);
+    return true;
+}
+
+bool FrameTransformContainer::canTransform(const std::string& target_frame_id, const std::string& source_frame_id) const
+{
+    if (target_frame_id == source_frame_id)
+    {
+        return true;
+    }
+    auto graph = priv_loadGraph();
+    return graph && graph->resolve(target_frame_id, source_frame_id, nullptr);
+}
+
+bool FrameTransformContainer::getParent(const std::string& frame_id, std::string& parent_frame_id) const
+{
+    auto graph = priv_loadGraph();
+    if (!graph)
+    {
+        return false;
+    }
+    const auto& topology = *graph->topology;
+    auto it = topology.ids.find(frame_id);
+    if (it == topology.ids.end() || topology.parent[it->second] == no_frame)
+    {
+        return false;
+    }
+    parent_frame_id = topology.names[topology.parent[it->second]];
+    return true;
+}
+
+uint64_t FrameTransformContainer::getGeneration() const
+{
+    auto graph = priv_loadGraph();
+    return graph ? graph->topology->generation : 0;
+}
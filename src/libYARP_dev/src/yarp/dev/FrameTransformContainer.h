@@ -10,11 +10,15 @@
 #include <yarp/os/Network.h>
 #include <yarp/dev/IFrameTransformStorage.h>
 #include <yarp/sig/Vector.h>
+#include <yarp/sig/Matrix.h>
 #include <yarp/os/PeriodicThread.h>
 #include <yarp/dev/api.h>
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/IMultipleWrapper.h>
 #include <yarp/dev/ReturnValue.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <map>
 
@@ -27,6 +31,20 @@ namespace yarp::dev {
  *  \ref yarp::dev::IFrameTransformStorageSet and \ref yarp::dev::IFrameTransformStorageGet
  *  interfaces in order to allow external access to it.
  *
+ *  Every time the content of the container changes, the container publishes
+ *  a snapshot of the graph of the frames, in which the names of the frames
+ *  are mapped to indices and the chain from each frame to its root is already
+ *  resolved. The methods getTransform(), canTransform() and getParent() use
+ *  this snapshot, therefore they do not lock m_trf_mutex and they do not
+ *  compare the names of the frames while walking the graph.
+ *  The snapshot is rebuilt only when the topology of the graph changes, i.e.
+ *  when a transform is added, deleted or removed because expired. When only
+ *  the values of the transforms are updated, the new values are published
+ *  with the same topology.
+ *
+ *  The container also keeps the last m_history_size values of each non
+ *  static transform, that are used by getTransform() to compute a transform
+ *  at a given time.
  */
 
 class YARP_dev_API FrameTransformContainer :
@@ -92,18 +110,38 @@ protected:
     ContainerType m_transforms;
     void invalidateTransform(yarp::math::FrameTransform& trf);
 
+private:
+    struct FrameTopology;
+    struct FrameGraph;
+    struct TransformHistory;
+
+    //the following members are protected by m_trf_mutex
+    std::vector<TransformHistory> m_history; // the history of m_transforms[i] is m_history[i]
+    std::shared_ptr<const FrameTopology> m_topology;
+    bool m_topology_changed = true;
+    uint64_t m_generation = 0;
+
+    //the snapshot read by the lookups, replaced atomically by priv_publishGraph()
+    std::atomic<std::shared_ptr<const FrameGraph>> m_graph;
+
+    void priv_setTransform(const yarp::math::FrameTransform& new_tr);
+    void priv_publishGraph();
+    std::shared_ptr<const FrameGraph> priv_loadGraph() const;
+
 public:
     mutable std::recursive_mutex  m_trf_mutex;
 
 public:
     //non-static transforms older than value (seconds) will be removed by method checkAndRemoveExpired()
     double m_timeout = 0.2;
+    //number of values of each non-static transform kept for the lookups at a given time
+    size_t m_history_size = 100;
     bool   m_verbose_debug = false;
     std::string m_name;
 
 public:
-    FrameTransformContainer() {}
-    ~FrameTransformContainer() {}
+    FrameTransformContainer();
+    ~FrameTransformContainer();
 
     //IFrameTransformStorageSet interface
     yarp::dev::ReturnValue setTransforms(const std::vector<yarp::math::FrameTransform>& transforms) override;
@@ -118,6 +156,53 @@ public:
 
     bool size(size_t& size) const;
 
+    /**
+     * Get the transform between two frames, chaining the stored transforms
+     * if needed (with the same meaning of yarp::dev::IFrameTransform::getTransform()).
+     * It does not lock m_trf_mutex.
+     * @param target_frame_id the name of target reference frame
+     * @param source_frame_id the name of source reference frame
+     * @param transform the 4x4 transform matrix
+     * @return true if the frames are connected
+     */
+    bool getTransform(const std::string& target_frame_id, const std::string& source_frame_id, yarp::sig::Matrix& transform) const;
+
+    /**
+     * Get the transform between two frames at a given time. The value of
+     * each non static transform of the chain is interpolated (linearly for
+     * the translation, with SLERP for the rotation) between the two stored
+     * values closer to the requested time.
+     * It locks m_trf_mutex.
+     * @param target_frame_id the name of target reference frame
+     * @param source_frame_id the name of source reference frame
+     * @param timestamp the time of the transform
+     * @param transform the 4x4 transform matrix
+     * @return true if the frames are connected and the time is in the range
+     *         of the stored values of all the transforms of the chain
+     */
+    bool getTransform(const std::string& target_frame_id, const std::string& source_frame_id, double timestamp, yarp::sig::Matrix& transform) const;
+
+    /**
+     * Check if the transform between two frames can be computed.
+     * It does not lock m_trf_mutex.
+     * @return true if the frames are connected
+     */
+    bool canTransform(const std::string& target_frame_id, const std::string& source_frame_id) const;
+
+    /**
+     * Get the parent of a frame.
+     * It does not lock m_trf_mutex.
+     * @return false if the frame does not exist or it has no parent
+     */
+    bool getParent(const std::string& frame_id, std::string& parent_frame_id) const;
+
+    /**
+     * @return a counter incremented every time the topology of the graph of
+     *         the frames changes (the lookups of the same frames give the
+     *         same chain of transforms while it does not change).
+     */
+    uint64_t getGeneration() const;
+
 public:
     //other
     bool checkAndRemoveExpired();
@@ -95,6 +95,17 @@ public:
     */
     virtual yarp::dev::ReturnValue     getTransform (const std::string &target_frame_id, const std::string &source_frame_id, yarp::sig::Matrix &transform) = 0;
 
+    /**
+     Get the transform between two frames, at a given time.
+     The value of each non static transform of the chain is interpolated between the two received values closer to the requested time.
+    * @param target_frame_id the name of target reference frame
+    * @param source_frame_id the name of source reference frame
+    * @param timestamp the time (e.g. the timestamp of a sensor reading)
+    * @param transform the transformation matrix from source_frame_id to target_frame_id
+    * @return a ReturnValue, convertible to true/false. It fails if the time is out of the range of the stored values.
+    */
+    virtual yarp::dev::ReturnValue     getTransform (const std::string &target_frame_id, const std::string &source_frame_id, double timestamp, yarp::sig::Matrix &transform) = 0;
+
     /**
      Register a transform between two frames.
      * @param target_frame_id the name of target reference frame
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/dev/FrameTransformContainer.h>
+#include <yarp/math/Math.h>
+#include <yarp/os/Time.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::dev;
+using namespace yarp::math;
+using namespace yarp::sig;
+
+static FrameTransform makeTransform(const std::string& parent, const std::string& child, double x, double r, double p, double y, double t)
+{
+    FrameTransform tf;
+    tf.src_frame_id = parent;
+    tf.dst_frame_id = child;
+    tf.transFromVec(x, 2 * x, -x);
+    tf.rotFromRPY(r, p, y);
+    tf.timestamp = t;
+    tf.isStatic = false;
+    return tf;
+}
+
+static bool equal(const Matrix& a, const Matrix& b)
+{
+    if (a.rows() != 4 || a.cols() != 4 || b.rows() != 4 || b.cols() != 4) {
+        return false;
+    }
+    for (size_t r = 0; r < 4; r++) {
+        for (size_t c = 0; c < 4; c++) {
+            if (std::abs(a(r, c) - b(r, c)) > 1e-9) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("dev::FrameTransformContainerTest", "[yarp::dev]")
+{
+    // base -> a -> b,  base -> c -> d
+    double now = yarp::os::Time::now();
+    FrameTransform ba = makeTransform("base", "a", 0.1, 0.1, 0.2, 0.3, now);
+    FrameTransform ab = makeTransform("a", "b", 0.2, -0.3, 0.1, 0.5, now);
+    FrameTransform bc = makeTransform("base", "c", 0.3, 0.7, -0.2, 0.1, now);
+    FrameTransform cd = makeTransform("c", "d", 0.4, 0.0, 0.4, -0.6, now);
+
+    FrameTransformContainer cont;
+    Matrix m;
+
+    SECTION("empty container")
+    {
+        CHECK_FALSE(cont.getTransform("a", "base", m));
+        CHECK_FALSE(cont.canTransform("a", "base"));
+        CHECK(cont.canTransform("a", "a"));
+        CHECK(cont.getTransform("a", "a", m));
+        CHECK(equal(m, eye(4)));
+        CHECK(cont.getGeneration() == 0);
+    }
+
+    SECTION("chained transforms")
+    {
+        REQUIRE(cont.setTransforms({ba, ab, bc, cd}));
+
+        // direct
+        CHECK(cont.getTransform("a", "base", m));
+        CHECK(equal(m, ba.toMatrix()));
+        CHECK(cont.getTransform("b", "base", m));
+        CHECK(equal(m, ba.toMatrix() * ab.toMatrix()));
+
+        // inverse
+        CHECK(cont.getTransform("base", "b", m));
+        CHECK(equal(m, SE3inv(ba.toMatrix() * ab.toMatrix())));
+
+        // through the common ancestor
+        CHECK(cont.getTransform("d", "b", m));
+        CHECK(equal(m, SE3inv(ba.toMatrix() * ab.toMatrix()) * bc.toMatrix() * cd.toMatrix()));
+
+        CHECK(cont.canTransform("b", "d"));
+        CHECK_FALSE(cont.canTransform("b", "unknown"));
+
+        std::string parent;
+        CHECK(cont.getParent("d", parent));
+        CHECK(parent == "c");
+        CHECK_FALSE(cont.getParent("base", parent));
+    }
+
+    SECTION("generation")
+    {
+        REQUIRE(cont.setTransforms({ba, ab, bc}));
+        uint64_t gen = cont.getGeneration();
+        CHECK(gen > 0);
+        CHECK_FALSE(cont.canTransform("d", "base"));
+
+        // an update of the values does not change the topology
+        FrameTransform ab2 = makeTransform("a", "b", 0.5, 0.1, 0.1, 0.1, now + 1);
+        REQUIRE(cont.setTransform(ab2));
+        CHECK(cont.getGeneration() == gen);
+        CHECK(cont.getTransform("b", "base", m));
+        CHECK(equal(m, ba.toMatrix() * ab2.toMatrix()));
+
+        // an older value is discarded
+        REQUIRE(cont.setTransform(ab));
+        CHECK(cont.getTransform("b", "a", m));
+        CHECK(equal(m, ab2.toMatrix()));
+
+        // a new transform changes the topology
+        REQUIRE(cont.setTransform(cd));
+        CHECK(cont.getGeneration() > gen);
+        CHECK(cont.canTransform("d", "base"));
+
+        // a deleted transform disconnects the frames
+        gen = cont.getGeneration();
+        REQUIRE(cont.deleteTransform("c", "d"));
+        CHECK(cont.getGeneration() > gen);
+        CHECK_FALSE(cont.canTransform("d", "base"));
+
+        // and it can be added again
+        FrameTransform cd2 = makeTransform("c", "d", 0.4, 0.0, 0.4, -0.6, yarp::os::Time::now() + 1);
+        REQUIRE(cont.setTransform(cd2));
+        CHECK(cont.getTransform("d", "c", m));
+        CHECK(equal(m, cd2.toMatrix()));
+    }
+
+    SECTION("expired transforms")
+    {
+        FrameTransform old = makeTransform("base", "a", 0.1, 0.1, 0.2, 0.3, now - 10);
+        FrameTransform stat = makeTransform("a", "b", 0.2, -0.3, 0.1, 0.5, now - 10);
+        stat.isStatic = true;
+        REQUIRE(cont.setTransforms({old, stat}));
+        CHECK(cont.canTransform("b", "base"));
+
+        uint64_t gen = cont.getGeneration();
+        cont.m_timeout = 1.0;
+        REQUIRE(cont.checkAndRemoveExpired());
+        CHECK(cont.getGeneration() > gen);
+        CHECK_FALSE(cont.canTransform("b", "base"));
+        CHECK(cont.canTransform("b", "a"));
+    }
+
+    SECTION("lookups at a given time")
+    {
+        FrameTransform stat = makeTransform("base", "a", 0.1, 0.1, 0.2, 0.3, now - 10);
+        stat.isStatic = true;
+        FrameTransform ab0 = makeTransform("a", "b", 0.0, 0.0, 0.0, 0.0, now);
+        FrameTransform ab1 = makeTransform("a", "b", 1.0, 0.0, 0.0, 1.0, now + 1);
+        FrameTransform ab2 = makeTransform("a", "b", 3.0, 0.0, 0.0, 1.5, now + 2);
+        REQUIRE(cont.setTransforms({stat, ab0}));
+        REQUIRE(cont.setTransform(ab1));
+        REQUIRE(cont.setTransform(ab2));
+
+        // the stored values
+        CHECK(cont.getTransform("b", "a", now, m));
+        CHECK(equal(m, ab0.toMatrix()));
+        CHECK(cont.getTransform("b", "a", now + 1, m));
+        CHECK(equal(m, ab1.toMatrix()));
+        CHECK(cont.getTransform("b", "base", now + 2, m));
+        CHECK(equal(m, stat.toMatrix() * ab2.toMatrix()));
+
+        // interpolated values
+        FrameTransform expected = makeTransform("a", "b", 0.25, 0.0, 0.0, 0.25, now + 0.25);
+        CHECK(cont.getTransform("b", "a", now + 0.25, m));
+        CHECK(equal(m, expected.toMatrix()));
+        expected = makeTransform("a", "b", 2.0, 0.0, 0.0, 1.25, now + 1.5);
+        CHECK(cont.getTransform("base", "b", now + 1.5, m));
+        CHECK(equal(m, SE3inv(stat.toMatrix() * expected.toMatrix())));
+
+        // out of the stored range
+        CHECK_FALSE(cont.getTransform("b", "a", now - 1, m));
+        CHECK_FALSE(cont.getTransform("b", "a", now + 3, m));
+
+        // only the last values are kept
+        cont.m_history_size = 2;
+        FrameTransform ab3 = makeTransform("a", "b", 4.0, 0.0, 0.0, 2.0, now + 3);
+        REQUIRE(cont.setTransform(ab3));
+        CHECK_FALSE(cont.getTransform("b", "a", now + 1.5, m));
+        CHECK(cont.getTransform("b", "a", now + 2.5, m));
+        CHECK(cont.getTransform("b", "a", now + 3, m));
+        CHECK(equal(m, ab3.toMatrix()));
+    }
+}
@@ -85,6 +85,14 @@ yarp::sig::Matrix yarp::math::FrameTransform::toMatrix() const
     return t_mat;
 }
 
+void yarp::math::FrameTransform::toMatrix(yarp::sig::MatrixN<double, 4, 4>& mat) const
+{
+    rotation.toRotationMatrix4x4(mat);
+    mat(0, 3) = translation.tX;
+    mat(1, 3) = translation.tY;
+    mat(2, 3) = translation.tZ;
+}
+
 bool yarp::math::FrameTransform::fromMatrix(const yarp::sig::Matrix& mat)
 {
     if (mat.cols() != 4 || mat.rows() != 4)
@@ -8,6 +8,7 @@
 
 #include <yarp/sig/Vector.h>
 #include <yarp/sig/Matrix.h>
+#include <yarp/sig/MatrixN.h>
 #include <yarp/math/api.h>
 #include <yarp/math/Quaternion.h>
 
@@ -58,6 +59,7 @@ public:
     yarp::sig::Vector getRPYRot() const;
 
     yarp::sig::Matrix toMatrix() const;
+    void toMatrix(yarp::sig::MatrixN<double, 4, 4>& mat) const;
     bool fromMatrix(const yarp::sig::Matrix& mat);
 
     enum display_transform_mode_t
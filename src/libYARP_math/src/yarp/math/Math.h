@@ -386,6 +386,65 @@ YARP_math_API yarp::sig::Matrix crossProductMatrix(const yarp::sig::Vector& v);
  */
 YARP_math_API bool crossProductMatrix(const yarp::sig::Vector& v, yarp::sig::Matrix& res);
 
+/**
+ * Compute the cross product between two vectors, without allocating memory
+ * if the result has already the right size (defined in Math.h).
+ * @param a first input vector
+ * @param b second input vector
+ * @param res axb, it can be a or b
+ */
+YARP_math_API void crossInto(const yarp::sig::Vector& a, const yarp::sig::Vector& b, yarp::sig::Vector& res);
+
+/**
+ * Matrix-matrix product, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * The products of 3x3, 4x4 and 6x6 matrices, like the homogeneous
+ * transformations, use kernels specialized for these sizes.
+ * @param a a matrix
+ * @param b a matrix
+ * @param res a*b, it can be a or b (in this case a temporary is allocated,
+ *            unless the matrices are 3x3, 4x4 or 6x6)
+ */
+YARP_math_API void multiplyInto(const yarp::sig::Matrix& a, const yarp::sig::Matrix& b, yarp::sig::Matrix& res);
+
+/**
+ * Matrix-vector product, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * @param m a matrix
+ * @param v a vector (interpreted as a column)
+ * @param res m*v, it can be v (in this case a temporary is allocated,
+ *            unless the matrix is 3x3, 4x4 or 6x6)
+ */
+YARP_math_API void multiplyInto(const yarp::sig::Matrix& m, const yarp::sig::Vector& v, yarp::sig::Vector& res);
+
+/**
+ * Addition between vectors, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * @param res a+b, it can be a or b
+ */
+YARP_math_API void addInto(const yarp::sig::Vector& a, const yarp::sig::Vector& b, yarp::sig::Vector& res);
+
+/**
+ * Addition between matrices, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * @param res a+b, it can be a or b
+ */
+YARP_math_API void addInto(const yarp::sig::Matrix& a, const yarp::sig::Matrix& b, yarp::sig::Matrix& res);
+
+/**
+ * Subtraction between vectors, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * @param res a-b, it can be a or b
+ */
+YARP_math_API void subtractInto(const yarp::sig::Vector& a, const yarp::sig::Vector& b, yarp::sig::Vector& res);
+
+/**
+ * Subtraction between matrices, without allocating memory if the result has
+ * already the right size (defined in Math.h).
+ * @param res a-b, it can be a or b
+ */
+YARP_math_API void subtractInto(const yarp::sig::Matrix& a, const yarp::sig::Matrix& b, yarp::sig::Matrix& res);
+
 /**
  * Returns the Euclidean norm of the vector (defined in Math.h).
  * @param v is the input vector.
@@ -238,6 +238,29 @@ yarp::sig::Matrix Quaternion::toRotationMatrix4x4() const
     return R;
 }
 
+void Quaternion::toRotationMatrix4x4(yarp::sig::MatrixN<double, 4, 4>& R) const
+{
+    const double n = sqrt(internal_data[0] * internal_data[0] +
+                          internal_data[1] * internal_data[1] +
+                          internal_data[2] * internal_data[2] +
+                          internal_data[3] * internal_data[3]);
+    const double qin[4] = { internal_data[0] / n,
+                            internal_data[1] / n,
+                            internal_data[2] / n,
+                            internal_data[3] / n };
+
+    R.eye();
+    R(0, 0) = qin[0] * qin[0] + qin[1] * qin[1] - qin[2] * qin[2] - qin[3] * qin[3];
+    R(1, 0) = 2.0*(qin[1] * qin[2] + qin[0] * qin[3]);
+    R(2, 0) = 2.0*(qin[1] * qin[3] - qin[0] * qin[2]);
+    R(0, 1) = 2.0*(qin[1] * qin[2] - qin[0] * qin[3]);
+    R(1, 1) = qin[0] * qin[0] - qin[1] * qin[1] + qin[2] * qin[2] - qin[3] * qin[3];
+    R(2, 1) = 2.0*(qin[2] * qin[3] + qin[0] * qin[1]);
+    R(0, 2) = 2.0*(qin[1] * qin[3] + qin[0] * qin[2]);
+    R(1, 2) = 2.0*(qin[2] * qin[3] - qin[0] * qin[1]);
+    R(2, 2) = qin[0] * qin[0] - qin[1] * qin[1] - qin[2] * qin[2] + qin[3] * qin[3];
+}
+
 yarp::sig::Matrix Quaternion::toRotationMatrix3x3() const
 {
     yarp::sig::Vector q = this->toVector();
@@ -9,6 +9,7 @@
 #include <yarp/math/api.h>
 #include <yarp/sig/Vector.h>
 #include <yarp/sig/Matrix.h>
+#include <yarp/sig/MatrixN.h>
 #include <yarp/os/Portable.h>
 
 // network stuff
@@ -132,6 +133,13 @@ public:
     */
     yarp::sig::Matrix toRotationMatrix4x4() const;
 
+    /**
+    * Converts a quaternion to a rotation matrix, like
+    * toRotationMatrix4x4(), without allocating memory.
+    * @param R the 4 by 4 homogeneous matrix where the result is stored.
+    */
+    void toRotationMatrix4x4(yarp::sig::MatrixN<double, 4, 4>& R) const;
+
     /**
     * Converts a quaternion to a rotation matrix.
     * @param q the quaternion
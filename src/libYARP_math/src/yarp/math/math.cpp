@@ -22,8 +22,36 @@ using namespace yarp::math;
 
 namespace {
 YARP_LOG_COMPONENT(MATH, "yarp.math")
+
+template <int N>
+using FixedMatrix = Eigen::Matrix<double, N, N, Eigen::RowMajor>;
+
+template <int N>
+using FixedVector = Eigen::Matrix<double, N, 1>;
+
+/*
+ * Kernels for the products of small square matrices, whose size is known at
+ * compile time, so that Eigen unrolls and vectorizes them.  The result is
+ * computed on the stack, therefore it can be stored in one of the operands.
+ */
+template <int N>
+void multiplyFixed(const Matrix& a, const Matrix& b, Matrix& res)
+{
+    const FixedMatrix<N> tmp = Eigen::Map<const FixedMatrix<N>>(a.data()) * Eigen::Map<const FixedMatrix<N>>(b.data());
+    res.resize(N, N);
+    Eigen::Map<FixedMatrix<N>>(res.data()) = tmp;
+}
+
+template <int N>
+void multiplyFixed(const Matrix& m, const Vector& v, Vector& res)
+{
+    const FixedVector<N> tmp = Eigen::Map<const FixedMatrix<N>>(m.data()) * Eigen::Map<const FixedVector<N>>(v.data());
+    res.resize(N);
+    Eigen::Map<FixedVector<N>>(res.data()) = tmp;
 }
 
+} // namespace
+
 Vector operator+(const Vector &a, const double &s)
 {
     Vector ret(a);
@@ -68,14 +96,7 @@ Matrix operator+(const Matrix &a, const Matrix &b)
 
 Matrix& operator+=(Matrix &a, const Matrix &b)
 {
-    size_t n=a.cols();
-    size_t m=a.rows();
-    yCAssert(MATH, m==b.rows() && n==b.cols());
-    for (size_t r = 0; r < m; r++) {
-        for (size_t c = 0; c < n; c++) {
-            a(r, c) += b(r, c);
-        }
-    }
+    yarp::math::addInto(a, b, a);
     return a;
 }
 
@@ -128,15 +149,7 @@ Matrix operator-(const Matrix &a, const Matrix &b)
 
 Matrix& operator-=(Matrix &a, const Matrix &b)
 {
-    size_t n=a.cols();
-    size_t m=a.rows();
-    yCAssert(MATH, m==b.rows());
-    yCAssert(MATH, n==b.cols());
-    for (size_t r = 0; r < m; r++) {
-        for (size_t c = 0; c < n; c++) {
-            a(r, c) -= b(r, c);
-        }
-    }
+    yarp::math::subtractInto(a, b, a);
     return a;
 }
 
@@ -165,7 +178,7 @@ Vector operator*(const Vector &a, const Matrix &m)
     yCAssert(MATH, a.size()==(size_t)m.rows());
     Vector ret((size_t)m.cols());
 
-    toEigen(ret) = toEigen(m).transpose()*toEigen(a);
+    toEigen(ret).noalias() = toEigen(m).transpose()*toEigen(a);
 
     return ret;
 }
@@ -176,39 +189,28 @@ Vector& operator*=(Vector &a, const Matrix &m)
     Vector a2(a);
     a.resize(m.cols());
 
-    toEigen(a) = toEigen(m).transpose()*toEigen(a2);
+    toEigen(a).noalias() = toEigen(m).transpose()*toEigen(a2);
 
     return a;
 }
 
 Vector operator*(const Matrix &m, const Vector &a)
 {
-    yCAssert(MATH, (size_t)m.cols()==a.size());
-    Vector ret((size_t)m.rows(),0.0);
-
-    toEigen(ret) = toEigen(m)*toEigen(a);
-
+    Vector ret;
+    yarp::math::multiplyInto(m, a, ret);
     return ret;
 }
 
 Matrix operator*(const Matrix &a, const Matrix &b)
 {
-    yCAssert(MATH, a.cols()==b.rows());
-    Matrix c(a.rows(), b.cols());
-
-    toEigen(c) = toEigen(a)*toEigen(b);
-
+    Matrix c;
+    yarp::math::multiplyInto(a, b, c);
     return c;
 }
 
 Matrix& operator*=(Matrix &a, const Matrix &b)
 {
-    yCAssert(MATH, a.cols()==b.rows());
-    Matrix a2(a);   // a copy of a
-    a.resize(a.rows(), b.cols());
-
-    toEigen(a) = toEigen(a2)*toEigen(b);
-
+    yarp::math::multiplyInto(a, b, a);
     return a;
 }
 
@@ -504,6 +506,131 @@ Vector yarp::math::cross(const Vector &a, const Vector &b)
     return v;
 }
 
+void yarp::math::crossInto(const Vector &a, const Vector &b, Vector &res)
+{
+    yCAssert(MATH, a.size()==3);
+    yCAssert(MATH, b.size()==3);
+    const double x = a[1]*b[2]-a[2]*b[1];
+    const double y = a[2]*b[0]-a[0]*b[2];
+    const double z = a[0]*b[1]-a[1]*b[0];
+    res.resize(3);
+    res[0] = x;
+    res[1] = y;
+    res[2] = z;
+}
+
+void yarp::math::multiplyInto(const Matrix &a, const Matrix &b, Matrix &res)
+{
+    yCAssert(MATH, a.cols()==b.rows());
+    const size_t n = a.rows();
+    if (n == a.cols() && n == b.cols()) {
+        switch (n) {
+        case 3:
+            multiplyFixed<3>(a, b, res);
+            return;
+        case 4:
+            multiplyFixed<4>(a, b, res);
+            return;
+        case 6:
+            multiplyFixed<6>(a, b, res);
+            return;
+        default:
+            break;
+        }
+    }
+
+    if (&res == &a || &res == &b) {
+        Matrix tmp(a.rows(), b.cols());
+        toEigen(tmp).noalias() = toEigen(a)*toEigen(b);
+        res = tmp;
+        return;
+    }
+    res.resize(a.rows(), b.cols());
+    toEigen(res).noalias() = toEigen(a)*toEigen(b);
+}
+
+void yarp::math::multiplyInto(const Matrix &m, const Vector &v, Vector &res)
+{
+    yCAssert(MATH, (size_t)m.cols()==v.size());
+    const size_t n = m.rows();
+    if (n == m.cols()) {
+        switch (n) {
+        case 3:
+            multiplyFixed<3>(m, v, res);
+            return;
+        case 4:
+            multiplyFixed<4>(m, v, res);
+            return;
+        case 6:
+            multiplyFixed<6>(m, v, res);
+            return;
+        default:
+            break;
+        }
+    }
+
+    if (&res == &v) {
+        Vector tmp(m.rows());
+        toEigen(tmp).noalias() = toEigen(m)*toEigen(v);
+        res = tmp;
+        return;
+    }
+    res.resize(m.rows());
+    toEigen(res).noalias() = toEigen(m)*toEigen(v);
+}
+
+void yarp::math::addInto(const Vector &a, const Vector &b, Vector &res)
+{
+    const size_t s = a.size();
+    yCAssert(MATH, s==b.size());
+    res.resize(s);
+    const double* pa = a.data();
+    const double* pb = b.data();
+    double* pr = res.data();
+    for (size_t k = 0; k < s; k++) {
+        pr[k] = pa[k] + pb[k];
+    }
+}
+
+void yarp::math::addInto(const Matrix &a, const Matrix &b, Matrix &res)
+{
+    yCAssert(MATH, a.rows()==b.rows() && a.cols()==b.cols());
+    res.resize(a.rows(), a.cols());
+    const size_t s = a.rows() * a.cols();
+    const double* pa = a.data();
+    const double* pb = b.data();
+    double* pr = res.data();
+    for (size_t k = 0; k < s; k++) {
+        pr[k] = pa[k] + pb[k];
+    }
+}
+
+void yarp::math::subtractInto(const Vector &a, const Vector &b, Vector &res)
+{
+    const size_t s = a.size();
+    yCAssert(MATH, s==b.size());
+    res.resize(s);
+    const double* pa = a.data();
+    const double* pb = b.data();
+    double* pr = res.data();
+    for (size_t k = 0; k < s; k++) {
+        pr[k] = pa[k] - pb[k];
+    }
+}
+
+void yarp::math::subtractInto(const Matrix &a, const Matrix &b, Matrix &res)
+{
+    yCAssert(MATH, a.rows()==b.rows() && a.cols()==b.cols());
+    res.resize(a.rows(), a.cols());
+    const size_t s = a.rows() * a.cols();
+    const double* pa = a.data();
+    const double* pb = b.data();
+    double* pr = res.data();
+    for (size_t k = 0; k < s; k++) {
+        pr[k] = pa[k] - pb[k];
+    }
+}
+
 Matrix yarp::math::crossProductMatrix(const Vector &v)
 {
     yCAssert(MATH, v.size()==3);
@@ -523,6 +523,144 @@ TEST_CASE("math::MathTest", "[yarp::math]")
         CHECK_EQUAL(cross(an, bn), -1.0*cross(bn, an));
     }
 
+    SECTION("check in-place operations.")
+    {
+        // The results are compared with naive implementations, independent
+        // from the kernels used also by the operators
+        auto naiveProduct = [](const Matrix& a, const Matrix& b) {
+            Matrix res(a.rows(), b.cols());
+            for (size_t r = 0; r < a.rows(); r++) {
+                for (size_t c = 0; c < b.cols(); c++) {
+                    double sum = 0.0;
+                    for (size_t k = 0; k < a.cols(); k++) {
+                        sum += a(r, k) * b(k, c);
+                    }
+                    res(r, c) = sum;
+                }
+            }
+            return res;
+        };
+        auto naiveProductVector = [](const Matrix& a, const Vector& v) {
+            Vector res(a.rows());
+            for (size_t r = 0; r < a.rows(); r++) {
+                double sum = 0.0;
+                for (size_t k = 0; k < a.cols(); k++) {
+                    sum += a(r, k) * v[k];
+                }
+                res[r] = sum;
+            }
+            return res;
+        };
+        auto naiveSum = [](const Matrix& a, const Matrix& b, double sign) {
+            Matrix res(a.rows(), a.cols());
+            for (size_t r = 0; r < a.rows(); r++) {
+                for (size_t c = 0; c < a.cols(); c++) {
+                    res(r, c) = a(r, c) + sign * b(r, c);
+                }
+            }
+            return res;
+        };
+        auto naiveSumVector = [](const Vector& a, const Vector& b, double sign) {
+            Vector res(a.size());
+            for (size_t i = 0; i < a.size(); i++) {
+                res[i] = a[i] + sign * b[i];
+            }
+            return res;
+        };
+
+        for (int n : {1, 2, 3, 4, 6, 7, 9}) {
+            Matrix A = Rand::matrix(n, n);
+            Matrix B = Rand::matrix(n, n);
+            Matrix Anm = Rand::matrix(n, n + 2);
+            Matrix Bmk = Rand::matrix(n + 2, n + 1);
+            Vector v = Rand::vector(n);
+            Vector w = Rand::vector(n);
+            Vector vm = Rand::vector(n + 2);
+
+            Matrix C(n, n);
+            const double* storage = C.data();
+            multiplyInto(A, B, C);
+            CHECK_EQUAL(C, naiveProduct(A, B));
+            // the result has already the right size, nothing is allocated
+            CHECK(C.data() == storage);
+
+            // non-square operands, the result is resized
+            multiplyInto(Anm, Bmk, C);
+            CHECK_EQUAL(C, naiveProduct(Anm, Bmk));
+            multiplyInto(A, Anm, C);
+            CHECK_EQUAL(C, naiveProduct(A, Anm));
+
+            // the result is one of the operands
+            C = A;
+            multiplyInto(C, B, C);
+            CHECK_EQUAL(C, naiveProduct(A, B));
+            C = B;
+            multiplyInto(A, C, C);
+            CHECK_EQUAL(C, naiveProduct(A, B));
+            C = Anm;
+            multiplyInto(A, C, C);
+            CHECK_EQUAL(C, naiveProduct(A, Anm));
+            C = Anm;
+            multiplyInto(C, Bmk, C);
+            CHECK_EQUAL(C, naiveProduct(Anm, Bmk));
+            C = A;
+            multiplyInto(C, C, C);
+            CHECK_EQUAL(C, naiveProduct(A, A));
+
+            Vector r;
+            multiplyInto(A, v, r);
+            CHECK_EQUAL(r, naiveProductVector(A, v));
+            multiplyInto(Anm, vm, r);
+            CHECK_EQUAL(r, naiveProductVector(Anm, vm));
+            r = v;
+            multiplyInto(A, r, r);
+            CHECK_EQUAL(r, naiveProductVector(A, v));
+
+            addInto(v, w, r);
+            CHECK_EQUAL(r, naiveSumVector(v, w, 1.0));
+            subtractInto(v, w, r);
+            CHECK_EQUAL(r, naiveSumVector(v, w, -1.0));
+            r = v;
+            addInto(r, w, r);
+            CHECK_EQUAL(r, naiveSumVector(v, w, 1.0));
+            r = w;
+            subtractInto(v, r, r);
+            CHECK_EQUAL(r, naiveSumVector(v, w, -1.0));
+            r = v;
+            addInto(r, r, r);
+            CHECK_EQUAL(r, naiveSumVector(v, v, 1.0));
+
+            addInto(A, B, C);
+            CHECK_EQUAL(C, naiveSum(A, B, 1.0));
+            subtractInto(A, B, C);
+            CHECK_EQUAL(C, naiveSum(A, B, -1.0));
+            addInto(Anm, Anm, C);
+            CHECK_EQUAL(C, naiveSum(Anm, Anm, 1.0));
+            C = A;
+            subtractInto(C, B, C);
+            CHECK_EQUAL(C, naiveSum(A, B, -1.0));
+            C = B;
+            addInto(A, C, C);
+            CHECK_EQUAL(C, naiveSum(A, B, 1.0));
+        }
+
+        Vector a = Rand::vector(3);
+        Vector b = Rand::vector(3);
+        Vector expected(3);
+        expected[0] = a[1] * b[2] - a[2] * b[1];
+        expected[1] = a[2] * b[0] - a[0] * b[2];
+        expected[2] = a[0] * b[1] - a[1] * b[0];
+        Vector r(3);
+        crossInto(a, b, r);
+        CHECK_EQUAL(r, expected);
+        r = a;
+        crossInto(r, b, r);
+        CHECK_EQUAL(r, expected);
+        r = b;
+        crossInto(a, r, r);
+        CHECK_EQUAL(r, expected);
+    }
+
     SECTION("check conversions from euler angles to matrix.")
     {
         Vector euler;
@@ -684,6 +822,10 @@ TEST_CASE("math::MathTest", "[yarp::math]")
         m = q2.toRotationMatrix4x4();
         CHECK_EQUAL(m, m_check); // check method toRotationMatrix4x4
 
+        MatrixN<double, 4, 4> mn;
+        q2.toRotationMatrix4x4(mn);
+        CHECK_EQUAL(mn.toMatrix(), m_check); // check method toRotationMatrix4x4 with a fixed size matrix
+
         Vector v = q2.toVector();
         CHECK_EQUAL(v, v_check); // check method toVector
 
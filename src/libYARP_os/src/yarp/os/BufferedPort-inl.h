@@ -294,6 +294,13 @@ void yarp::os::BufferedPort<T>::setTargetPeriod(double period)
     reader.setTargetPeriod(period);
 }
 
+template <typename T>
+void yarp::os::BufferedPort<T>::addReceiveBuffer(T& buffer)
+{
+    attachIfNeeded();
+    reader.addReceiveBuffer(buffer);
+}
+
 template <typename T>
 yarp::os::Type yarp::os::BufferedPort<T>::getType()
 {
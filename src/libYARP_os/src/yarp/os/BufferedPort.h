@@ -254,6 +254,27 @@ public:
     // documented in TypedReader
     void setTargetPeriod(double period) override;
 
+    /**
+     * Use an object owned by the caller to receive messages.
+     *
+     * See PortReaderBuffer::addReceiveBuffer().
+     * For example, to receive the frames of a camera without allocating
+     * memory and copying the pixels:
+     *
+     * \code
+     * std::vector<ImageOf<PixelRgb>> frames(4);
+     * for (auto& frame : frames) {
+     *     frame.resize(3840, 2160);
+     *     port.addReceiveBuffer(frame);
+     * }
+     * port.open("/camera:i");
+     * \endcode
+     *
+     * @param buffer the object to use for receiving, it must stay valid
+     *               until the port is closed
+     */
+    void addReceiveBuffer(T& buffer);
+
     // documented in Contactable
     Type getType() override;
 
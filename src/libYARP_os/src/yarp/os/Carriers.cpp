@@ -210,6 +210,7 @@ Carriers::Carriers() :
     mPriv->delegates.emplace_back(new TcpCarrier());
     mPriv->delegates.emplace_back(new TcpCarrier(false));
     mPriv->delegates.emplace_back(new McastCarrier());
+    mPriv->delegates.emplace_back(new McastCarrier(true));
     mPriv->delegates.emplace_back(new UdpCarrier());
     mPriv->delegates.emplace_back(new TextCarrier());
     mPriv->delegates.emplace_back(new TextCarrier(true));
@@ -49,6 +49,11 @@ bool InputStream::setReadTimeout(double timeout)
     return false;
 }
 
+int InputStream::getPollHandle() const
+{
+    return -1;
+}
+
 // slow implementation - only relevant for textmode operation
 
 std::string InputStream::readLine(const char terminal, bool* success)
@@ -102,6 +102,15 @@ public:
      */
     virtual bool setReadTimeout(double timeout);
 
+    /**
+     * Get a native handle that can be polled to know when some data is
+     * available on this stream.  Support for this is optional.
+     * Streams that buffer data internally should not expose a handle,
+     * since the handle would not be readable while data is still buffered.
+     * @return the handle (a file descriptor), or -1 if not supported.
+     */
+    virtual int getPollHandle() const;
+
     /**
      * Read a block of text terminated with a specific marker (or EOF).
      */
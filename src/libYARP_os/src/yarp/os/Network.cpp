@@ -1176,6 +1176,34 @@ bool NetworkBase::setConnectionQos(const std::string& src, const std::string& de
         }
     }
 
+    // ignore if left as default (batching applies only to the output of the source)
+    if (srcStyle.getBatchSize() >= 0) {
+        cmd.clear();
+        reply.clear();
+        cmd.addString("prop");
+        cmd.addString("set");
+        cmd.addString(dest.c_str());
+        Bottle& qos = cmd.addList();
+        qos.addString("qos");
+        Property& qos_prop = qos.addDict();
+        qos_prop.put("batch", srcStyle.getBatchSize());
+        qos_prop.put("batch_delay", srcStyle.getBatchDelay());
+        Contact srcCon = Contact::fromString(src);
+        bool ret = write(srcCon, cmd, reply, true, true, 2.0);
+        if (!ret) {
+            if (!quiet) {
+                yCError(NETWORK, "Cannot write to '%s'", src.c_str());
+            }
+            return false;
+        }
+        if (reply.get(0).asString() != "ok") {
+            if (!quiet) {
+                yCError(NETWORK, "Cannot set batching of '%s'. (%s)", src.c_str(), reply.toString().c_str());
+            }
+            return false;
+        }
+    }
+
     // ignore if everything left as default
     if (destStyle.getPacketPriorityAsTOS() != -1 || destStyle.getThreadPolicy() != -1) {
         // set the destination Qos
@@ -1244,6 +1272,9 @@ static bool getPortQos(const std::string& port, const std::string& unit, QosStyl
     Bottle& qos = reply.findGroup("qos");
     Bottle* qos_prop = qos.find("qos").asList();
     style.setPacketPrioritybyTOS(qos_prop->find("tos").asInt32());
+    if (qos_prop->check("batch")) {
+        style.setBatching(qos_prop->find("batch").asInt32(), qos_prop->find("batch_delay").asFloat64());
+    }
 
     return true;
 }
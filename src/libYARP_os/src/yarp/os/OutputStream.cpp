@@ -22,6 +22,13 @@ void yarp::os::OutputStream::write(const Bytes& b, int offset, int len)
     write(bytes);
 }
 
+void yarp::os::OutputStream::writev(const Bytes* blocks, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        write(blocks[i]);
+    }
+}
+
 void yarp::os::OutputStream::flush()
 {
 }
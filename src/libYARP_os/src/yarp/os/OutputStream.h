@@ -9,6 +9,8 @@
 
 #include <yarp/os/api.h>
 
+#include <cstddef>
+
 namespace yarp::os {
 
 class Bytes;
@@ -50,6 +52,18 @@ public:
      */
     virtual void write(const yarp::os::Bytes& b) = 0;
 
+    /**
+     * Write several blocks of bytes to the stream, in order.
+     *
+     * Streams that can do so (e.g. sockets) send all the blocks at once,
+     * with a single system call.  By default, this calls
+     * write(const Bytes& b) for each block.
+     *
+     * @param blocks the blocks to write
+     * @param count the number of blocks
+     */
+    virtual void writev(const yarp::os::Bytes* blocks, size_t count);
+
     /**
      * Terminate the stream.
      */
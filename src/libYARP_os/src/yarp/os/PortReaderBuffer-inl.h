@@ -206,5 +206,11 @@ void yarp::os::PortReaderBuffer<T>::setTargetPeriod(double period)
     implementation.setTargetPeriod(period);
 }
 
+template <typename T>
+void yarp::os::PortReaderBuffer<T>::addReceiveBuffer(T& buffer)
+{
+    implementation.addReceiveBuffer(buffer);
+}
+
 
 #endif // YARP_OS_PORTREADERBUFFER_INL_H
@@ -135,6 +135,29 @@ public:
     // documented in TypedReader
     void setTargetPeriod(double period) override;
 
+    /**
+     * Use an object owned by the caller to receive messages.
+     *
+     * Once at least one buffer is registered, the messages are read directly
+     * into the registered buffers, in turn, and no other buffer is created.
+     * If all of them are in use, in strict mode the port waits for one of
+     * them to be released.  Otherwise, the oldest pending message is
+     * replaced, or, if the user holds all the buffers (e.g. with acquire()),
+     * the new message is dropped, so a slow reader never stalls the sender.
+     * The object returned by read() is in use until the next call, therefore
+     * at least two buffers are needed.
+     * This is useful for big objects, such as images with a fixed size,
+     * whose memory can be allocated in advance (and aligned as needed by
+     * the application).
+     *
+     * Buffers should be registered before the port starts receiving data,
+     * and they must stay valid until the buffer is detached.  Detaching the
+     * buffer forgets them.
+     *
+     * @param buffer the object to use for receiving
+     */
+    void addReceiveBuffer(T& buffer);
+
 private:
     yarp::os::PortReaderBufferBase implementation;
     bool autoDiscard;
@@ -14,10 +14,9 @@
 #include <yarp/os/Thread.h>
 #include <yarp/os/Time.h>
 #include <yarp/os/impl/LogComponent.h>
-#include <yarp/os/impl/PortCorePacket.h>
+#include <yarp/os/impl/PacketList.h>
 #include <yarp/os/impl/StreamConnectionReader.h>
 
-#include <list>
 #include <mutex>
 
 using namespace yarp::os::impl;
@@ -32,9 +31,12 @@ class PortReaderPacket
 {
 public:
     PortReaderPacket *prev_, *next_;
+    const void* list_;
 
-    // if non-null, contains a buffer that the packet owns
+    // if non-null, contains a buffer, owned by the packet unless
+    // registered by the user with addReceiveBuffer
     PortReader* reader;
+    bool owned;
 
     std::string envelope;
 
@@ -46,7 +48,9 @@ public:
     PortReaderPacket()
     {
         prev_ = next_ = nullptr;
+        list_ = nullptr;
         reader = nullptr;
+        owned = true;
         external = nullptr;
         writer = nullptr;
         reset();
@@ -61,9 +65,12 @@ public:
     void reset()
     {
         if (reader != nullptr) {
-            delete reader;
+            if (owned) {
+                delete reader;
+            }
             reader = nullptr;
         }
+        owned = true;
         writer = nullptr;
         envelope = "";
     }
@@ -73,11 +80,12 @@ public:
         return reader;
     }
 
-    void setReader(PortReader* reader)
+    void setReader(PortReader* reader, bool owned = true)
     {
         resetExternal();
         reset();
         this->reader = reader;
+        this->owned = owned;
     }
 
     PortReader* getExternal()
@@ -112,10 +120,15 @@ public:
 class PortReaderPool
 {
 private:
-    std::list<PortReaderPacket*> inactive;
-    std::list<PortReaderPacket*> active;
+    PacketList<PortReaderPacket> inactive;
+    PacketList<PortReaderPacket> active;
 
 public:
+    // number of packets created
+    size_t allocated{0};
+    // number of times that a message had to wait for a free packet
+    size_t exhausted{0};
+
     size_t getCount()
     {
         return active.size();
@@ -132,22 +145,16 @@ public:
             PortReaderPacket* obj = nullptr;
             obj = new PortReaderPacket();
             inactive.push_back(obj);
+            allocated++;
         }
-        PortReaderPacket* next = inactive.front();
+        PortReaderPacket* next = inactive.pop_front();
         yCAssert(PORTREADERBUFFERBASE, next != nullptr);
-        inactive.remove(next);
         return next;
     }
 
     PortReaderPacket* getActivePacket()
     {
-        PortReaderPacket* next = nullptr;
-        if (getCount() >= 1) {
-            next = active.front();
-            yCAssert(PORTREADERBUFFERBASE, next != nullptr);
-            active.remove(next);
-        }
-        return next;
+        return active.pop_front();
     }
 
     void addActivePacket(PortReaderPacket* packet)
@@ -159,20 +166,32 @@ public:
 
     void addInactivePacket(PortReaderPacket* packet)
     {
-        if (packet != nullptr) {
+        if (packet != nullptr && !inactive.contains(packet)) {
             inactive.push_back(packet);
         }
     }
 
+    // drop the free packets that own their buffer
+    void removeOwnedInactivePackets()
+    {
+        size_t count = inactive.size();
+        for (size_t i = 0; i < count; i++) {
+            PortReaderPacket* packet = inactive.pop_front();
+            if (packet->reader != nullptr && !packet->owned) {
+                inactive.push_back(packet);
+            } else {
+                delete packet;
+            }
+        }
+    }
+
     void reset()
     {
         while (!active.empty()) {
-            delete active.back();
-            active.pop_back();
+            delete active.pop_front();
         }
         while (!inactive.empty()) {
-            delete inactive.back();
-            inactive.pop_back();
+            delete inactive.pop_front();
         }
     }
 };
@@ -191,6 +210,12 @@ public:
     yarp::os::PortReader* replier;
     double period;
     double last_recv;
+    // number of buffers registered with addReceiveBuffer
+    size_t receiveBuffers;
+    // returned by get() when the registered buffers are all held by the
+    // reader and the buffer is not strict: the message is dropped, and
+    // nothing is read in this packet
+    PortReaderPacket* discard;
 
     PortReaderPool pool;
 
@@ -209,6 +234,8 @@ public:
             replier(nullptr),
             period(-1),
             last_recv(-1),
+            receiveBuffers(0),
+            discard(nullptr),
             ct(0),
             port(nullptr),
             contentSema(0),
@@ -240,6 +267,9 @@ public:
             prev = nullptr;
         }
         pool.reset();
+        delete discard;
+        discard = nullptr;
+        receiveBuffers = 0;
         ct = 0;
     }
 
@@ -252,17 +282,40 @@ public:
         return {};
     }
 
-    PortReaderPacket* get()
+    // If reused is set, the result is the oldest pending packet, whose
+    // content is dropped in favor of the new message.
+    PortReaderPacket* get(bool& reused)
     {
         PortReaderPacket* result = nullptr;
         bool grab = true;
+        reused = false;
         if (pool.getFree() == 0) {
             grab = false;
-            if (maxBuffer == 0 || pool.getCount() < maxBuffer) {
+            if (receiveBuffers > 0) {
+                // only the buffers registered by the user are used
+                pool.exhausted++;
+                if (prune) {
+                    // do not wait for the reader, the oldest message is
+                    // replaced or, if the reader holds all the buffers, the
+                    // new message is dropped
+                    if (pool.getCount() >= 1) {
+                        result = pool.getActivePacket();
+                        result->resetExternal();
+                        ct--;
+                        reused = true;
+                    } else {
+                        if (discard == nullptr) {
+                            discard = new PortReaderPacket();
+                        }
+                        result = discard;
+                    }
+                }
+            } else if (maxBuffer == 0 || pool.getCount() < maxBuffer) {
                 grab = true;
             } else {
                 // ok, can't get free, clean space.
                 // here would be a good place to do buffer reuse.
+                pool.exhausted++;
             }
         }
         if (grab) {
@@ -452,10 +505,11 @@ bool PortReaderBufferBase::read(ConnectionReader& connection)
         }
     }
     PortReaderPacket* reader = nullptr;
+    bool reused = false;
     while (reader == nullptr) {
         mPriv->stateMutex.lock();
-        reader = mPriv->get();
-        if ((reader != nullptr) && reader->getReader() == nullptr) {
+        reader = mPriv->get(reused);
+        if ((reader != nullptr) && reader != mPriv->discard && reader->getReader() == nullptr) {
             PortReader* next = create();
             yCAssert(PORTREADERBUFFERBASE, next != nullptr);
             reader->setReader(next);
@@ -467,19 +521,34 @@ bool PortReaderBufferBase::read(ConnectionReader& connection)
         }
     }
     bool ok = false;
-    if (connection.isValid()) {
-        yCAssert(PORTREADERBUFFERBASE, reader->getReader() != nullptr);
-        ok = reader->getReader()->read(connection);
-        reader->setEnvelope(connection.readEnvelope());
-    } else {
+    if (!connection.isValid()) {
         // this is a disconnection
         // don't talk to this port ever again
         mPriv->port = nullptr;
+    } else if (reader == mPriv->discard) {
+        // The discard packet is shared by all the connections, therefore the
+        // bytes of the message are skipped instead of being read in it
+        ok = true;
+        size_t pending = connection.getSize();
+        while (ok && pending > 0) {
+            char buf[10000];
+            size_t next = (pending < sizeof(buf)) ? pending : sizeof(buf);
+            ok = connection.expectBlock(&buf[0], next);
+            pending -= next;
+        }
+    } else {
+        yCAssert(PORTREADERBUFFERBASE, reader->getReader() != nullptr);
+        ok = reader->getReader()->read(connection);
+        reader->setEnvelope(connection.readEnvelope());
+    }
+    if (reader == mPriv->discard) {
+        // the message is dropped
+        return ok;
     }
     if (ok) {
         mPriv->stateMutex.lock();
-        bool pruned = false;
-        if (mPriv->ct > 0 && mPriv->prune) {
+        bool pruned = reused;
+        if (!reused && mPriv->ct > 0 && mPriv->prune) {
             PortReaderPacket* readerPacket = mPriv->dropContent();
             pruned = (readerPacket != nullptr);
         }
@@ -535,6 +604,30 @@ unsigned int PortReaderBufferBase::getMaxBuffer()
     return mPriv->maxBuffer;
 }
 
+size_t PortReaderBufferBase::getAllocatedCount()
+{
+    std::lock_guard<std::mutex> lock(mPriv->stateMutex);
+    return mPriv->pool.allocated;
+}
+
+size_t PortReaderBufferBase::getExhaustedCount()
+{
+    std::lock_guard<std::mutex> lock(mPriv->stateMutex);
+    return mPriv->pool.exhausted;
+}
+
+void PortReaderBufferBase::addReceiveBuffer(PortReader& buffer)
+{
+    std::lock_guard<std::mutex> lock(mPriv->stateMutex);
+    if (mPriv->receiveBuffers == 0) {
+        mPriv->pool.removeOwnedInactivePackets();
+    }
+    auto* packet = new PortReaderPacket();
+    packet->setReader(&buffer, false);
+    mPriv->pool.addInactivePacket(packet);
+    mPriv->receiveBuffers++;
+}
+
 bool PortReaderBufferBase::isClosed()
 {
     return mPriv->port == nullptr;
@@ -559,20 +652,29 @@ bool PortReaderBufferBase::acceptObjectBase(PortReader* obj,
     // the object
 
     PortReaderPacket* reader = nullptr;
+    bool reused = false;
     while (reader == nullptr) {
         mPriv->stateMutex.lock();
-        reader = mPriv->get();
+        reader = mPriv->get(reused);
         mPriv->stateMutex.unlock();
         if (reader == nullptr) {
             mPriv->consumeSema.wait();
         }
     }
 
+    if (reader == mPriv->discard) {
+        // the reader holds all the buffers, the object is dropped
+        if (wrapper != nullptr) {
+            wrapper->onCompletion();
+        }
+        return true;
+    }
+
     reader->setExternal(obj, wrapper);
 
     mPriv->stateMutex.lock();
-    bool pruned = false;
-    if (mPriv->ct > 0 && mPriv->prune) {
+    bool pruned = reused;
+    if (!reused && mPriv->ct > 0 && mPriv->prune) {
         PortReaderPacket* readerPacket = mPriv->dropContent();
         pruned = (readerPacket != nullptr);
     }
@@ -36,6 +36,15 @@ public:
 
     unsigned int getMaxBuffer();
 
+    // number of buffers created so far
+    size_t getAllocatedCount();
+
+    // number of times a message had to wait for a free buffer
+    size_t getExhaustedCount();
+
+    // use an object owned by the caller as a receive buffer
+    void addReceiveBuffer(yarp::os::PortReader& buffer);
+
     bool isClosed();
 
     void clear();
@@ -13,7 +13,9 @@
 yarp::os::QosStyle::QosStyle() :
         threadPriority(-1),
         threadPolicy(-1),
-        packetPriority(-1)
+        packetPriority(-1),
+        batchSize(-1),
+        batchDelay(0.001)
 {
 }
 
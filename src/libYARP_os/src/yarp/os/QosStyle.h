@@ -140,6 +140,26 @@ public:
     }
 
 
+    /**
+     * @brief sets the coalescing of the messages written in background
+     * (e.g. with BufferedPort::write()) on the connection.
+     *
+     * Up to \p maxMessages messages are sent together in a single packet,
+     * and no message waits more than \p maxDelay seconds before being
+     * sent.  The receiver still reads each message on its own, with its
+     * envelope.  Messages that expect a reply are never batched.
+     *
+     * @param maxMessages the number of messages in a batch, 0 or 1 to
+     *        disable batching, -1 to leave the connection unchanged
+     * @param maxDelay the maximum time a message waits in a batch [s]
+     */
+    void setBatching(int maxMessages, double maxDelay = 0.001)
+    {
+        batchSize = maxMessages;
+        batchDelay = maxDelay;
+    }
+
+
     /**
      * @brief returns the packet TOS value
      * @return the TOS
@@ -184,6 +204,26 @@ public:
     }
 
 
+    /**
+     * @brief returns the maximum number of messages in a batch
+     * @return the batch size, 0 if batching is disabled, -1 if not set
+     */
+    int getBatchSize() const
+    {
+        return batchSize;
+    }
+
+
+    /**
+     * @brief returns the maximum time a message waits in a batch
+     * @return the delay [s]
+     */
+    double getBatchDelay() const
+    {
+        return batchDelay;
+    }
+
+
     /**
      * @brief returns the IPV4/6 DSCP value given as DSCP code
      * @param vocab a DSCP code (e.g., CS0)
@@ -204,6 +244,8 @@ private:
     int threadPriority;
     int threadPolicy;
     int packetPriority;
+    int batchSize;
+    double batchDelay;
 };
 
 } // namespace yarp::os
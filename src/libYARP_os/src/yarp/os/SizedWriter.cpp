@@ -10,15 +10,19 @@
 #include <yarp/os/ConnectionWriter.h>
 #include <yarp/os/OutputStream.h>
 
+#include <vector>
+
 
 yarp::os::SizedWriter::~SizedWriter() = default;
 
 void yarp::os::SizedWriter::write(OutputStream& os)
 {
+    std::vector<Bytes> blocks;
+    blocks.reserve(length());
     for (size_t i = 0; i < length(); i++) {
-        Bytes b((char*)data(i), length(i));
-        os.write(b);
+        blocks.emplace_back((char*)data(i), length(i));
     }
+    os.writev(blocks.data(), blocks.size());
 }
 
 bool yarp::os::SizedWriter::write(ConnectionWriter& connection) const
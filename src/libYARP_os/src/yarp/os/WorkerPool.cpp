@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/WorkerPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using yarp::os::WorkerPool;
+
+class WorkerPool::Private
+{
+public:
+    explicit Private(size_t threads) :
+            threadCount(threads)
+    {
+        // the thread calling run() is the thread 0
+        for (size_t t = 1; t < threadCount; t++) {
+            workers.emplace_back(&Private::threadMain, this, t);
+        }
+    }
+
+    Private(const Private&) = delete;
+    Private& operator=(const Private&) = delete;
+
+    ~Private()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closing = true;
+        }
+        newJob.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void run(size_t count, const std::function<void(size_t, size_t)>& task)
+    {
+        std::lock_guard<std::mutex> serialize(runMutex);
+        execute(count, task);
+    }
+
+    bool tryRun(size_t count, const std::function<void(size_t, size_t)>& task)
+    {
+        std::unique_lock<std::mutex> serialize(runMutex, std::try_to_lock);
+        if (!serialize.owns_lock()) {
+            return false;
+        }
+        execute(count, task);
+        return true;
+    }
+
+    const size_t threadCount;
+
+private:
+    // Execute a job, runMutex must be locked
+    void execute(size_t count, const std::function<void(size_t, size_t)>& task)
+    {
+        if (workers.empty() || count <= 1) {
+            for (size_t i = 0; i < count; i++) {
+                task(i, 0);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &task;
+            jobSize = count;
+            next = 0;
+            running = workers.size();
+            generation++;
+        }
+        newJob.notify_all();
+
+        executeTasks(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        jobDone.wait(lock, [this] { return running == 0; });
+        job = nullptr;
+    }
+
+    // Execute the tasks of the current job that are not taken yet
+    void executeTasks(size_t thread)
+    {
+        for (size_t i = next++; i < jobSize; i = next++) {
+            (*job)(i, thread);
+        }
+    }
+
+    void threadMain(size_t thread)
+    {
+        size_t done = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            newJob.wait(lock, [&] { return closing || generation != done; });
+            if (closing) {
+                return;
+            }
+            done = generation;
+            lock.unlock();
+            executeTasks(thread);
+            lock.lock();
+            if (--running == 0) {
+                jobDone.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers;
+
+    // Serializes the calls to run() and tryRun()
+    std::mutex runMutex;
+
+    // Protects the state of the current job
+    std::mutex mutex;
+    std::condition_variable newJob;
+    std::condition_variable jobDone;
+    const std::function<void(size_t, size_t)>* job {nullptr};
+    size_t jobSize {0};
+    std::atomic<size_t> next {0};
+    size_t running {0}; // the workers that did not complete the current job
+    size_t generation {0};
+    bool closing {false};
+};
+
+
+WorkerPool::WorkerPool(size_t threads) :
+        mPriv(new Private(threads == 0 ? std::max<size_t>(std::thread::hardware_concurrency(), 1) : threads))
+{
+}
+
+WorkerPool::~WorkerPool()
+{
+    delete mPriv;
+}
+
+size_t WorkerPool::getThreads() const
+{
+    return mPriv->threadCount;
+}
+
+void WorkerPool::run(size_t count, const std::function<void(size_t index, size_t thread)>& task)
+{
+    mPriv->run(count, task);
+}
+
+bool WorkerPool::tryRun(size_t count, const std::function<void(size_t index, size_t thread)>& task)
+{
+    return mPriv->tryRun(count, task);
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_WORKERPOOL_H
+#define YARP_OS_WORKERPOOL_H
+
+#include <yarp/os/api.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace yarp::os {
+
+/**
+ * A pool of threads that execute the tasks of a job in parallel.
+ *
+ * The threads are started by the constructor and wait for the next job
+ * until the pool is destroyed, therefore a job does not pay the cost of
+ * starting and joining threads.  The thread calling run() executes some
+ * of the tasks too.
+ */
+class YARP_os_API WorkerPool
+{
+public:
+    /**
+     * Constructor.  Starts the threads.
+     *
+     * @param threads the number of threads executing a job, including the
+     *                one calling run(), 0 for one per CPU core
+     */
+    explicit WorkerPool(size_t threads = 0);
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) noexcept = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool& operator=(WorkerPool&&) noexcept = delete;
+
+    /**
+     * Destructor.  Stops the threads.
+     */
+    ~WorkerPool();
+
+    /**
+     * @return the number of threads executing a job, including the one
+     *         calling run()
+     */
+    size_t getThreads() const;
+
+    /**
+     * Call task(index, thread) for each index from 0 to count-1, and
+     * return when all the calls are completed.
+     *
+     * Each thread takes the next index when it completes a task, the thread
+     * argument (from 0 to getThreads()-1) identifies the thread, so that a
+     * task can use data owned by the thread.
+     * Concurrent calls are executed one after the other.  The task must not
+     * throw, and must not call run() on the same pool.
+     */
+    void run(size_t count, const std::function<void(size_t index, size_t thread)>& task);
+
+    /**
+     * Like run(), but if the pool is executing a job for another thread,
+     * return immediately instead of waiting for it.
+     *
+     * The caller can then execute the tasks itself, so that concurrent
+     * callers never block on each other.
+     *
+     * @return true if the job was executed, false if the pool was busy and
+     *         the task was not called
+     */
+    bool tryRun(size_t count, const std::function<void(size_t index, size_t thread)>& task);
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+private:
+    class Private;
+    Private* mPriv;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+};
+
+} // namespace yarp::os
+
+#endif // YARP_OS_WORKERPOOL_H
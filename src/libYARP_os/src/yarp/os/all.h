@@ -62,6 +62,7 @@
 #include <yarp/os/Vocab.h>
 #include <yarp/os/Wire.h>
 #include <yarp/os/WireLink.h>
+#include <yarp/os/WorkerPool.h>
 
 
 /**
@@ -9,18 +9,32 @@
 
 #include <yarp/conf/numeric.h>
 
+#include <yarp/os/NetFloat32.h>
+#include <yarp/os/NetFloat64.h>
+#include <yarp/os/NetInt16.h>
+#include <yarp/os/NetInt32.h>
+#include <yarp/os/NetInt64.h>
+#include <yarp/os/NetInt8.h>
 #include <yarp/os/StringInputStream.h>
 #include <yarp/os/impl/BufferedConnectionWriter.h>
 #include <yarp/os/impl/LogComponent.h>
 #include <yarp/os/impl/MemoryOutputStream.h>
 #include <yarp/os/impl/StreamConnectionReader.h>
 
+#include <cstdint>
+#include <cstring>
 #include <limits>
 
 using yarp::os::Bottle;
 using yarp::os::Bytes;
 using yarp::os::ConnectionReader;
 using yarp::os::ConnectionWriter;
+using yarp::os::NetFloat32;
+using yarp::os::NetFloat64;
+using yarp::os::NetInt16;
+using yarp::os::NetInt32;
+using yarp::os::NetInt64;
+using yarp::os::NetInt8;
 using yarp::os::Searchable;
 using yarp::os::Value;
 using yarp::os::impl::BottleImpl;
@@ -28,12 +42,37 @@ using yarp::os::impl::Storable;
 
 namespace {
 YARP_OS_LOG_COMPONENT(BOTTLEIMPL, "yarp.os.impl.BottleImpl")
+
+// Size on the wire of the items with a fixed size, 0 for the others
+size_t fixedSize(std::int32_t code)
+{
+    switch (code) {
+    case BOTTLE_TAG_INT8:
+        return sizeof(NetInt8);
+    case BOTTLE_TAG_INT16:
+        return sizeof(NetInt16);
+    case BOTTLE_TAG_INT32:
+    case BOTTLE_TAG_VOCAB32:
+        return sizeof(NetInt32);
+    case BOTTLE_TAG_INT64:
+    case BOTTLE_TAG_VOCAB64:
+        return sizeof(NetInt64);
+    case BOTTLE_TAG_FLOAT32:
+        return sizeof(NetFloat32);
+    case BOTTLE_TAG_FLOAT64:
+        return sizeof(NetFloat64);
+    default:
+        return 0;
+    }
+}
 } // namespace
 
 BottleImpl::BottleImpl() :
         parent(nullptr),
         invalid(false),
         ro(false),
+        arenaChunk(0),
+        arenaUsed(0),
         speciality(0),
         nested(false),
         dirty(true)
@@ -44,6 +83,8 @@ BottleImpl::BottleImpl(Searchable* parent) :
         parent(parent),
         invalid(false),
         ro(false),
+        arenaChunk(0),
+        arenaUsed(0),
         speciality(0),
         nested(false),
         dirty(true)
@@ -67,12 +108,92 @@ void BottleImpl::add(Storable* s)
 void BottleImpl::clear()
 {
     for (auto& i : content) {
-        delete i;
+        destroy(i);
     }
     content.clear();
+    arenaChunk = 0;
+    arenaUsed = 0;
     dirty = true;
 }
 
+
+void* BottleImpl::allocateSlot()
+{
+    if (arenaChunk < arena.size() && arenaUsed == (firstChunkSlots << arenaChunk)) {
+        arenaChunk++;
+        arenaUsed = 0;
+    }
+    if (arenaChunk == arena.size()) {
+        arena.emplace_back(new Slot[firstChunkSlots << arenaChunk]);
+    }
+    return &arena[arenaChunk][arenaUsed++];
+}
+
+
+void BottleImpl::releaseSlot(const Storable* s)
+{
+    // Only the last slot allocated can be given back
+    auto address = reinterpret_cast<std::uintptr_t>(s);
+    auto last = arenaUsed > 0 ? reinterpret_cast<std::uintptr_t>(&arena[arenaChunk][arenaUsed - 1]) : 0;
+    if (arenaUsed > 0 && address >= last && address < last + sizeof(Slot)) {
+        arenaUsed--;
+        if (arenaUsed == 0 && arenaChunk > 0) {
+            arenaChunk--;
+            arenaUsed = firstChunkSlots << arenaChunk;
+        }
+    }
+}
+
+
+bool BottleImpl::ownsSlot(const Storable* s) const
+{
+    auto address = reinterpret_cast<std::uintptr_t>(s);
+    for (size_t i = 0; i < arena.size() && i <= arenaChunk; i++) {
+        auto begin = reinterpret_cast<std::uintptr_t>(arena[i].get());
+        if (address >= begin && address < begin + (firstChunkSlots << i) * sizeof(Slot)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void BottleImpl::destroy(Storable* s)
+{
+    if (ownsSlot(s)) {
+        s->~Storable();
+    } else {
+        delete s;
+    }
+}
+
+
+Storable* BottleImpl::createByCode(std::int32_t id)
+{
+    switch (id) {
+    case BOTTLE_TAG_INT8:
+        return emplace<StoreInt8>();
+    case BOTTLE_TAG_INT16:
+        return emplace<StoreInt16>();
+    case BOTTLE_TAG_INT32:
+        return emplace<StoreInt32>();
+    case BOTTLE_TAG_INT64:
+        return emplace<StoreInt64>();
+    case BOTTLE_TAG_VOCAB32:
+        return emplace<StoreVocab32>();
+    case BOTTLE_TAG_VOCAB64:
+        return emplace<StoreVocab64>();
+    case BOTTLE_TAG_FLOAT32:
+        return emplace<StoreFloat32>();
+    case BOTTLE_TAG_FLOAT64:
+        return emplace<StoreFloat64>();
+    case BOTTLE_TAG_STRING:
+        return emplace<StoreString>();
+    default:
+        return Storable::createByCode(id);
+    }
+}
+
 void BottleImpl::smartAdd(const std::string& str)
 {
     if (str.length() > 0) {
@@ -344,7 +465,7 @@ bool BottleImpl::fromBytes(ConnectionReader& reader)
     } else {
         yCTrace(BOTTLEIMPL, "READ skipped subcode %" PRId32, speciality);
     }
-    Storable* storable = Storable::createByCode(id);
+    Storable* storable = createByCode(id);
     if (storable == nullptr) {
         yCError(BOTTLEIMPL, "Reader failed, unrecognized object code %" PRId32, id);
         return false;
@@ -398,6 +519,9 @@ bool BottleImpl::fromBytes(const Bytes& data)
         return false;
     }
     yCTrace(BOTTLEIMPL, "READ bottle length %d", len);
+    if (fixedSize(speciality) != 0) {
+        return readFixedSize(reader, len);
+    }
     for (int i = 0; i < len; i++) {
         bool ok = fromBytes(reader);
         if (!ok) {
@@ -507,6 +631,9 @@ bool BottleImpl::read(ConnectionReader& reader)
             return false;
         }
         yCTrace(BOTTLEIMPL, "READ got length %d", len);
+        if (fixedSize(speciality) != 0) {
+            return readFixedSize(reader, len);
+        }
         for (int i = 0; i < len; i++) {
             bool ok = fromBytes(reader);
             if (!ok) {
@@ -527,7 +654,11 @@ void BottleImpl::synch()
     if (dirty) {
         if (!nested) {
             subCode();
-            yCTrace(BOTTLEIMPL, "bottle code %" PRId32, StoreList::code + subCode());
+            yCTrace(BOTTLEIMPL, "bottle code %" PRId32, StoreList::code + speciality);
+        }
+        if (synchFixedSize()) {
+            dirty = false;
+            return;
         }
         data.clear();
         BufferedConnectionWriter writer;
@@ -558,6 +689,114 @@ void BottleImpl::synch()
 }
 
 
+bool BottleImpl::synchFixedSize()
+{
+    size_t length = (nested ? 0 : sizeof(NetInt32)) + sizeof(NetInt32);
+    for (const auto* s : content) {
+        size_t n = fixedSize(s->getCode());
+        if (n == 0) {
+            return false;
+        }
+        length += n + (speciality == 0 ? sizeof(NetInt32) : 0);
+    }
+
+    data.resize(length);
+    char* cursor = data.data();
+    auto put = [&cursor](auto value) {
+        memcpy(cursor, &value, sizeof(value));
+        cursor += sizeof(value);
+    };
+    if (!nested) {
+        put(static_cast<NetInt32>(StoreList::code + speciality));
+    }
+    put(static_cast<NetInt32>(size()));
+    for (const auto* s : content) {
+        std::int32_t code = s->getCode();
+        if (speciality == 0) {
+            put(static_cast<NetInt32>(code));
+        } else {
+            yCAssert(BOTTLEIMPL, speciality == code);
+        }
+        switch (code) {
+        case BOTTLE_TAG_INT8:
+            put(static_cast<NetInt8>(s->asInt8()));
+            break;
+        case BOTTLE_TAG_INT16:
+            put(static_cast<NetInt16>(s->asInt16()));
+            break;
+        case BOTTLE_TAG_INT32:
+            put(static_cast<NetInt32>(s->asInt32()));
+            break;
+        case BOTTLE_TAG_VOCAB32:
+            put(static_cast<NetInt32>(s->asVocab32()));
+            break;
+        case BOTTLE_TAG_INT64:
+            put(static_cast<NetInt64>(s->asInt64()));
+            break;
+        case BOTTLE_TAG_VOCAB64:
+            put(static_cast<NetInt64>(s->asVocab64()));
+            break;
+        case BOTTLE_TAG_FLOAT32:
+            put(static_cast<NetFloat32>(s->asFloat32()));
+            break;
+        case BOTTLE_TAG_FLOAT64:
+            put(static_cast<NetFloat64>(s->asFloat64()));
+            break;
+        }
+    }
+    return true;
+}
+
+
+template <typename T, typename NetT>
+bool BottleImpl::readItems(ConnectionReader& reader, std::int32_t len)
+{
+    // The length comes from the wire, it must fit in the bytes left
+    if (len < 0 || static_cast<size_t>(len) > reader.getSize() / sizeof(NetT)) {
+        yCError(BOTTLEIMPL, "Invalid length %" PRId32 " of a list of fixed size items", len);
+        return false;
+    }
+    constexpr std::int32_t blockItems = 64;
+    NetT items[blockItems];
+    content.reserve(content.size() + len);
+    for (std::int32_t i = 0; i < len; i += blockItems) {
+        std::int32_t n = std::min(blockItems, len - i);
+        if (!reader.expectBlock(reinterpret_cast<char*>(items), n * sizeof(NetT))) {
+            return false;
+        }
+        for (std::int32_t j = 0; j < n; j++) {
+            add(emplace<T>(items[j]));
+        }
+    }
+    return true;
+}
+
+
+bool BottleImpl::readFixedSize(ConnectionReader& reader, std::int32_t len)
+{
+    switch (speciality) {
+    case BOTTLE_TAG_INT8:
+        return readItems<StoreInt8, NetInt8>(reader, len);
+    case BOTTLE_TAG_INT16:
+        return readItems<StoreInt16, NetInt16>(reader, len);
+    case BOTTLE_TAG_INT32:
+        return readItems<StoreInt32, NetInt32>(reader, len);
+    case BOTTLE_TAG_VOCAB32:
+        return readItems<StoreVocab32, NetInt32>(reader, len);
+    case BOTTLE_TAG_INT64:
+        return readItems<StoreInt64, NetInt64>(reader, len);
+    case BOTTLE_TAG_VOCAB64:
+        return readItems<StoreVocab64, NetInt64>(reader, len);
+    case BOTTLE_TAG_FLOAT32:
+        return readItems<StoreFloat32, NetFloat32>(reader, len);
+    case BOTTLE_TAG_FLOAT64:
+        return readItems<StoreFloat64, NetFloat64>(reader, len);
+    default:
+        return false;
+    }
+}
+
+
 void BottleImpl::specialize(std::int32_t subCode)
 {
     speciality = subCode;
@@ -633,6 +872,17 @@ Storable* BottleImpl::pop()
     } else {
         stb = content[size() - 1];
         content.pop_back();
+        if (ownsSlot(stb)) {
+            // the caller takes the ownership of the item
+            Storable* item = stb->cloneStorable();
+            stb->~Storable();
+            releaseSlot(stb);
+            stb = item;
+        }
+        if (content.empty()) {
+            arenaChunk = 0;
+            arenaUsed = 0;
+        }
         dirty = true;
     }
     yCAssert(BOTTLEIMPL, stb != nullptr);
@@ -11,6 +11,10 @@
 #include <yarp/os/Bytes.h>
 #include <yarp/os/impl/Storable.h>
 
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
 #include <vector>
 
 namespace yarp::os {
@@ -57,47 +61,47 @@ public:
 
     void addInt8(std::int8_t x)
     {
-        add(new StoreInt8(x));
+        add(emplace<StoreInt8>(x));
     }
 
     void addInt16(std::int16_t x)
     {
-        add(new StoreInt16(x));
+        add(emplace<StoreInt16>(x));
     }
 
     void addInt32(std::int32_t x)
     {
-        add(new StoreInt32(x));
+        add(emplace<StoreInt32>(x));
     }
 
     void addInt64(std::int64_t x)
     {
-        add(new StoreInt64(x));
+        add(emplace<StoreInt64>(x));
     }
 
     void addFloat32(yarp::conf::float32_t x)
     {
-        add(new StoreFloat32(x));
+        add(emplace<StoreFloat32>(x));
     }
 
     void addFloat64(yarp::conf::float64_t x)
     {
-        add(new StoreFloat64(x));
+        add(emplace<StoreFloat64>(x));
     }
 
     void addVocab32(yarp::conf::vocab32_t x)
     {
-        add(new StoreVocab32(x));
+        add(emplace<StoreVocab32>(x));
     }
 
     void addVocab64(yarp::conf::vocab64_t x)
     {
-        add(new StoreVocab64(x));
+        add(emplace<StoreVocab64>(x));
     }
 
     void addString(const std::string& text)
     {
-        add(new StoreString(text));
+        add(emplace<StoreString>(text));
     }
 
     yarp::os::Bottle& addList();
@@ -183,12 +187,68 @@ public:
     Value& findBit(const std::string& key) const;
 
 private:
+    /*
+     * Numbers, vocabs and strings are not allocated one by one on the heap,
+     * but constructed in place in the slots of an arena owned by the bottle.
+     * The arena is made of chunks of growing size, and it is rewound when the
+     * bottle is cleared, therefore a bottle that is cleared and filled again
+     * for each message stops allocating memory after the first one.  The
+     * slot of a popped item is given back if it is the last one allocated.
+     * Lists, dicts, blobs and the items added by the user (addBit()) are
+     * still allocated on the heap.
+     */
+    static constexpr size_t slotSize = std::max({sizeof(StoreInt8),
+                                                 sizeof(StoreInt16),
+                                                 sizeof(StoreInt32),
+                                                 sizeof(StoreInt64),
+                                                 sizeof(StoreFloat32),
+                                                 sizeof(StoreFloat64),
+                                                 sizeof(StoreVocab32),
+                                                 sizeof(StoreVocab64),
+                                                 sizeof(StoreString)});
+    static constexpr size_t slotAlign = std::max({alignof(StoreInt64),
+                                                  alignof(StoreFloat64),
+                                                  alignof(StoreVocab64),
+                                                  alignof(StoreString)});
+    static constexpr size_t firstChunkSlots = 8;
+
+    struct alignas(slotAlign) Slot
+    {
+        unsigned char bytes[slotSize];
+    };
+
     YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::vector<Storable*>) content;
     YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::vector<char>) data;
+    YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::vector<std::unique_ptr<Slot[]>>) arena; ///< chunk i has firstChunkSlots << i slots
+    size_t arenaChunk;                                                                  ///< chunk in use
+    size_t arenaUsed;                                                                   ///< slots used in the chunk in use
     int speciality;
     bool nested;
     bool dirty;
 
+    template <typename T, typename... Args>
+    T* emplace(Args&&... args)
+    {
+        static_assert(sizeof(T) <= slotSize && alignof(T) <= slotAlign, "T does not fit in a slot");
+        return new (allocateSlot()) T(std::forward<Args>(args)...);
+    }
+
+    void* allocateSlot();
+    void releaseSlot(const Storable* s);
+    bool ownsSlot(const Storable* s) const;
+    void destroy(Storable* s);
+    Storable* createByCode(std::int32_t id);
+
+    /*
+     * Bottles containing only numbers and vocabs are serialized directly in
+     * the data buffer, and the content of specialized bottles of this kind
+     * (e.g. BOTTLE_TAG_LIST | BOTTLE_TAG_FLOAT64) is read in blocks.
+     */
+    bool synchFixedSize();
+    bool readFixedSize(ConnectionReader& reader, std::int32_t len);
+    template <typename T, typename NetT>
+    bool readItems(ConnectionReader& reader, std::int32_t len);
+
     void add(Storable* s);
     void smartAdd(const std::string& str);
 
@@ -356,14 +356,18 @@ bool BufferedConnectionWriter::write(ConnectionWriter& connection) const
 void BufferedConnectionWriter::write(OutputStream& os)
 {
     stopWrite();
+    // Send everything at once, streams that support it will use a single
+    // system call for the whole message
+    blocks.clear();
     for (size_t i = 0; i < header_used; i++) {
         yarp::os::ManagedBytes& b = *(header[i]);
-        os.write(b.usedBytes());
+        blocks.push_back(b.usedBytes());
     }
     for (size_t i = 0; i < lst_used; i++) {
         yarp::os::ManagedBytes& b = *(lst[i]);
-        os.write(b.usedBytes());
+        blocks.push_back(b.usedBytes());
     }
+    os.writev(blocks.data(), blocks.size());
     os.flush();
 }
 
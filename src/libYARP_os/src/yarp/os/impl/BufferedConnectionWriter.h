@@ -7,6 +7,7 @@
 #ifndef YARP_OS_IMPL_BUFFEREDCONNECTIONWRITER_H
 #define YARP_OS_IMPL_BUFFEREDCONNECTIONWRITER_H
 
+#include <yarp/os/Bytes.h>
 #include <yarp/os/ConnectionWriter.h>
 #include <yarp/os/SizedWriter.h>
 
@@ -16,7 +17,6 @@
 
 namespace yarp::os {
 
-class Bytes;
 class ManagedBytes;
 
 } // namespace yarp::os
@@ -266,6 +266,7 @@ private:
     size_t header_used;           ///< how many header buffers are in use for the current message
     size_t* target_used;          ///< points to lst_used of header_used
     size_t initialPoolSize;       ///< size of new pool buffers
+    YARP_SUPPRESS_DLL_INTERFACE_WARNING_ARG(std::vector<yarp::os::Bytes>) blocks; ///< header and payload, as passed to OutputStream::writev()
 };
 
 
@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/DgramReliable.h>
+
+#include <yarp/os/NetType.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace yarp::os;
+using namespace yarp::os::impl::DgramReliable;
+
+namespace {
+
+// Sanity limits, against garbage and senders that restarted
+constexpr std::uint32_t maxFragments = 1 << 20;
+constexpr std::uint64_t maxAhead = 1024;
+// Messages for which the NACKs are sent in a single poll
+constexpr size_t maxNacked = 16;
+// The last fragment, in a NACK requesting all the remaining ones
+constexpr std::uint32_t allFragments = std::numeric_limits<std::uint32_t>::max();
+
+void put16(char* buf, std::uint16_t x)
+{
+    buf[0] = static_cast<char>(x >> 8);
+    buf[1] = static_cast<char>(x);
+}
+
+void put32(char* buf, std::uint32_t x)
+{
+    buf[0] = static_cast<char>(x >> 24);
+    buf[1] = static_cast<char>(x >> 16);
+    buf[2] = static_cast<char>(x >> 8);
+    buf[3] = static_cast<char>(x);
+}
+
+std::uint16_t get16(const char* buf)
+{
+    const auto* b = reinterpret_cast<const unsigned char*>(buf);
+    return static_cast<std::uint16_t>((b[0] << 8) | b[1]);
+}
+
+std::uint32_t get32(const char* buf)
+{
+    const auto* b = reinterpret_cast<const unsigned char*>(buf);
+    return (static_cast<std::uint32_t>(b[0]) << 24) | (static_cast<std::uint32_t>(b[1]) << 16) | (static_cast<std::uint32_t>(b[2]) << 8) | static_cast<std::uint32_t>(b[3]);
+}
+
+std::uint32_t crc(const char* buf, size_t len)
+{
+    return static_cast<std::uint32_t>(NetType::getCrc(const_cast<char*>(buf), len));
+}
+
+} // namespace
+
+
+Sender::Sender(size_t datagramSize, size_t window, SendFunction send) :
+        send(std::move(send)),
+        datagramSize(std::max(datagramSize, headerSize + 1)),
+        window(std::max<size_t>(window, 1)),
+        session(std::random_device{}())
+{
+    fragment.reserve(this->datagramSize);
+    fragment.assign(headerSize, '\0');
+    current.seq = seq;
+}
+
+
+void Sender::setRepairPort(int port)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    repairPort = static_cast<std::uint16_t>(port);
+}
+
+
+void Sender::write(const char* data, size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    while (len > 0) {
+        // A full fragment is closed only when more data follows, so that the
+        // last one is never empty
+        if (fragment.size() == datagramSize) {
+            closeFragment();
+        }
+        size_t take = std::min(len, datagramSize - fragment.size());
+        fragment.append(data, take);
+        data += take;
+        len -= take;
+    }
+}
+
+
+void Sender::endMessage()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    closeFragment();
+    auto count = static_cast<std::uint32_t>(current.datagrams.size());
+    for (auto& datagram : current.datagrams) {
+        put32(datagram.data() + 16, count);
+        send(datagram.data(), datagram.size());
+    }
+    sent.push_back(std::move(current));
+    while (sent.size() > window) {
+        sent.pop_front();
+    }
+    seq++;
+    current = Message{seq, {}};
+}
+
+
+void Sender::closeFragment()
+{
+    // The number of fragments is written by endMessage()
+    char* header = fragment.data();
+    header[0] = dataType;
+    header[1] = 0;
+    put16(header + 2, repairPort);
+    put32(header + 4, session);
+    put32(header + 8, seq);
+    put32(header + 12, static_cast<std::uint32_t>(current.datagrams.size()));
+    put32(header + 20, crc(header + headerSize, fragment.size() - headerSize));
+    current.datagrams.push_back(fragment);
+    fragment.resize(headerSize);
+}
+
+
+bool Sender::handleNack(const char* data, size_t len)
+{
+    if (len < headerSize || data[0] != nackType) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (get32(data + 4) != session) {
+        return false;
+    }
+    std::uint32_t nackSeq = get32(data + 8);
+    std::uint32_t first = get32(data + 12);
+    std::uint32_t last = get32(data + 16);
+    auto it = std::find_if(sent.begin(), sent.end(), [nackSeq](const Message& m) { return m.seq == nackSeq; });
+    if (it == sent.end()) {
+        // Too old, the receiver will give up at the deadline
+        return false;
+    }
+    const auto& datagrams = it->datagrams;
+    for (size_t i = first; i < datagrams.size() && i <= last; i++) {
+        send(datagrams[i].data(), datagrams[i].size());
+    }
+    return true;
+}
+
+
+Receiver::Receiver(double deadline, NackFunction nack) :
+        nack(std::move(nack)),
+        deadline(deadline),
+        nackInterval(std::clamp(deadline / 4, 0.001, 0.01))
+{
+}
+
+
+void Receiver::reset(std::uint32_t session, std::uint64_t seq)
+{
+    started = true;
+    this->session = session;
+    pending.clear();
+    // Offset the sequence numbers, so that the extended ones never wrap
+    next = (std::uint64_t{1} << 32) + seq;
+}
+
+
+Receiver::Pending& Receiver::getPending(std::uint64_t seq, double now)
+{
+    auto it = pending.find(seq);
+    if (it != pending.end()) {
+        return it->second;
+    }
+    // The messages in between are missing altogether
+    std::uint64_t from = pending.empty() ? next : std::max(next, pending.rbegin()->first + 1);
+    for (std::uint64_t s = from; s <= seq; s++) {
+        Pending& p = pending[s];
+        p.first = now;
+        p.lastArrival = now;
+    }
+    return pending[seq];
+}
+
+
+bool Receiver::handleDatagram(const char* data, size_t len, std::uint32_t ip, double now)
+{
+    if (len < headerSize || data[0] != dataType) {
+        return false;
+    }
+    int port = get16(data + 2);
+    std::uint32_t dataSession = get32(data + 4);
+    std::uint32_t seq = get32(data + 8);
+    std::uint32_t index = get32(data + 12);
+    std::uint32_t fragmentCount = get32(data + 16);
+    if (crc(data + headerSize, len - headerSize) != get32(data + 20) ||
+        fragmentCount > maxFragments || index >= fragmentCount) {
+        return false;
+    }
+
+    if (!started || dataSession != session) {
+        reset(dataSession, seq);
+    }
+    // Extend the sequence number, relative to the next one to deliver
+    auto delta = static_cast<std::int32_t>(seq - static_cast<std::uint32_t>(next));
+    if (delta < 0) {
+        // Already delivered, or dropped
+        return true;
+    }
+    if (static_cast<std::uint64_t>(delta) > maxAhead) {
+        // Lost track of the sender, start again from here
+        reset(dataSession, seq);
+        delta = 0;
+    }
+
+    Pending& p = getPending(next + static_cast<std::uint64_t>(delta), now);
+    if (p.last < 0) {
+        p.fragments.resize(fragmentCount);
+        p.received.resize(fragmentCount, false);
+        p.last = static_cast<std::int64_t>(fragmentCount) - 1;
+    } else if (fragmentCount != p.fragments.size()) {
+        // Not consistent with the fragments already received
+        return false;
+    }
+    senderIp = ip;
+    senderPort = port;
+    p.lastArrival = now;
+    if (!p.received[index]) {
+        p.fragments[index].assign(data + headerSize, len - headerSize);
+        p.received[index] = true;
+        p.count++;
+    }
+    return true;
+}
+
+
+bool Receiver::popMessage(std::string& message)
+{
+    auto it = pending.find(next);
+    if (it == pending.end()) {
+        return false;
+    }
+    Pending& p = it->second;
+    if (p.last < 0 || p.count != static_cast<size_t>(p.last + 1)) {
+        return false;
+    }
+    message.clear();
+    for (std::int64_t i = 0; i <= p.last; i++) {
+        message += p.fragments[i];
+    }
+    pending.erase(it);
+    next++;
+    return true;
+}
+
+
+void Receiver::sendNack(std::uint64_t seq, std::uint32_t first, std::uint32_t last)
+{
+    if (senderPort == 0) {
+        return;
+    }
+    char buf[headerSize] = {};
+    buf[0] = nackType;
+    put32(buf + 4, session);
+    put32(buf + 8, static_cast<std::uint32_t>(seq));
+    put32(buf + 12, first);
+    put32(buf + 16, last);
+    nack(senderIp, senderPort, buf, sizeof(buf));
+}
+
+
+double Receiver::poll(double now)
+{
+    // Give up on the oldest messages, unless they can be delivered
+    while (!pending.empty()) {
+        auto it = pending.begin();
+        const Pending& p = it->second;
+        bool complete = p.last >= 0 && p.count == static_cast<size_t>(p.last + 1);
+        if (complete || now - p.first < deadline) {
+            break;
+        }
+        pending.erase(it);
+        next++;
+        dropped++;
+    }
+
+    double wait = 0.1;
+    size_t nacked = 0;
+    for (auto& [seq, p] : pending) {
+        if (nacked++ >= maxNacked) {
+            break;
+        }
+        bool complete = p.last >= 0 && p.count == static_cast<size_t>(p.last + 1);
+        if (complete) {
+            continue;
+        }
+        wait = std::min(wait, p.first + deadline - now);
+        if (now - p.lastNack < nackInterval) {
+            wait = std::min(wait, p.lastNack + nackInterval - now);
+            continue;
+        }
+        bool sent = false;
+        size_t known = p.received.size();
+        for (size_t i = 0; i < known;) {
+            if (p.received[i]) {
+                i++;
+                continue;
+            }
+            size_t j = i;
+            while (j < known && !p.received[j]) {
+                j++;
+            }
+            sendNack(seq, static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j - 1));
+            sent = true;
+            i = j;
+        }
+        // Nothing arrived of the message: it is missing for sure if a later
+        // message arrived, and probably if nothing arrived for a while
+        if (p.last < 0) {
+            bool later = seq != pending.rbegin()->first;
+            if (later || now - p.lastArrival >= nackInterval) {
+                sendNack(seq, static_cast<std::uint32_t>(known), allFragments);
+                sent = true;
+            } else {
+                wait = std::min(wait, p.lastArrival + nackInterval - now);
+            }
+        }
+        if (sent) {
+            p.lastNack = now;
+            wait = std::min(wait, nackInterval);
+        }
+    }
+    return std::max(wait, 0.0);
+}
+
+
+size_t Receiver::takeDropped()
+{
+    size_t result = dropped;
+    dropped = 0;
+    return result;
+}
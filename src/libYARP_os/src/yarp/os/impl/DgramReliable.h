@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_DGRAMRELIABLE_H
+#define YARP_OS_IMPL_DGRAMRELIABLE_H
+
+#include <yarp/os/api.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace yarp::os::impl {
+
+/**
+ * Fragmentation and NACK based repair of messages sent over datagrams.
+ *
+ * Each message is split in fragments that fit in a datagram.  Every
+ * fragment carries a header with the sequence number of the message, the
+ * index of the fragment, the number of fragments of the message, and the
+ * port on which the sender listens for repair requests (NACKs).  The receivers reassemble the messages, deliver
+ * them in order and, when a fragment is missing, ask the sender to send it
+ * again.  The sender keeps the last few messages for this purpose.
+ *
+ * Real time data is not worth waiting for forever: a message that cannot
+ * be completed within a deadline is dropped, and the following ones are
+ * delivered.
+ *
+ * These classes only deal with the protocol, the sockets are handled by
+ * DgramTwoWayStream.
+ */
+namespace DgramReliable {
+
+constexpr size_t headerSize = 24;
+constexpr char dataType = 'D';
+constexpr char nackType = 'N';
+
+/**
+ * The sending side of the protocol.
+ *
+ * All the methods can be called from different threads.
+ */
+class YARP_os_impl_API Sender
+{
+public:
+    using SendFunction = std::function<void(const char* data, size_t len)>;
+
+    /**
+     * @param datagramSize the maximum size of a datagram, header included
+     * @param window the number of messages kept for retransmission
+     * @param send the function sending one datagram
+     */
+    Sender(size_t datagramSize, size_t window, SendFunction send);
+
+    /**
+     * Set the port where the NACKs should be sent.
+     */
+    void setRepairPort(int port);
+
+    /**
+     * Append some data to the current message.
+     */
+    void write(const char* data, size_t len);
+
+    /**
+     * Send the fragments of the current message, now that their number is
+     * known.
+     */
+    void endMessage();
+
+    /**
+     * Send again the fragments requested by a NACK.
+     *
+     * @return false if the NACK cannot be served
+     */
+    bool handleNack(const char* data, size_t len);
+
+private:
+    struct Message
+    {
+        std::uint32_t seq;
+        std::vector<std::string> datagrams;
+    };
+
+    void closeFragment();
+
+    std::mutex mutex;
+    SendFunction send;
+    size_t datagramSize;
+    size_t window;
+    std::uint16_t repairPort{0};
+    std::uint32_t session;
+    std::uint32_t seq{0};
+    std::string fragment;
+    Message current;
+    std::deque<Message> sent;
+};
+
+
+/**
+ * The receiving side of the protocol.
+ */
+class YARP_os_impl_API Receiver
+{
+public:
+    using NackFunction = std::function<void(std::uint32_t ip, int port, const char* data, size_t len)>;
+
+    /**
+     * @param deadline the time [s] after which an incomplete message is dropped
+     * @param nack the function sending a NACK to a sender
+     */
+    Receiver(double deadline, NackFunction nack);
+
+    /**
+     * Process a datagram.
+     *
+     * @param ip the address of the sender, in host byte order
+     * @param now the current time [s]
+     * @return false if the datagram is not valid
+     */
+    bool handleDatagram(const char* data, size_t len, std::uint32_t ip, double now);
+
+    /**
+     * Get the next message, if it is complete.
+     */
+    bool popMessage(std::string& message);
+
+    /**
+     * Send the NACKs that are due, and drop the messages older than the
+     * deadline.
+     *
+     * @param now the current time [s]
+     * @return the time [s] until something needs to be done again
+     */
+    double poll(double now);
+
+    /**
+     * @return the number of messages dropped, since the last call
+     */
+    size_t takeDropped();
+
+private:
+    struct Pending
+    {
+        std::vector<std::string> fragments;
+        std::vector<bool> received;
+        size_t count{0};
+        std::int64_t last{-1};
+        double first{0.0};
+        double lastArrival{0.0};
+        double lastNack{-std::numeric_limits<double>::infinity()};
+    };
+
+    void reset(std::uint32_t session, std::uint64_t seq);
+    Pending& getPending(std::uint64_t seq, double now);
+    void sendNack(std::uint64_t seq, std::uint32_t first, std::uint32_t last);
+
+    NackFunction nack;
+    double deadline;
+    double nackInterval;
+    bool started{false};
+    std::uint32_t session{0};
+    std::uint64_t next{0};
+    std::map<std::uint64_t, Pending> pending;
+    std::uint32_t senderIp{0};
+    int senderPort{0};
+    size_t dropped{0};
+};
+
+} // namespace DgramReliable
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_DGRAMRELIABLE_H
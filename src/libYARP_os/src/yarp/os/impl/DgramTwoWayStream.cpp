@@ -30,12 +30,15 @@
 #else
 #    include <arpa/inet.h>
 #    include <netinet/in.h>
+#    include <poll.h>
 #    include <sys/socket.h>
 #    include <sys/types.h>
 #    include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <cerrno>
+#include <cmath>
 #include <cstring>
 
 using namespace yarp::os::impl;
@@ -44,6 +47,10 @@ using namespace yarp::os;
 #define CRC_SIZE 8
 #define UDP_MAX_DATAGRAM_SIZE (65507 - CRC_SIZE)
 
+// Default datagram size in reliable mode.  Smaller datagrams are split in
+// less IP fragments, and are cheaper to send again when they get lost.
+#define RELIABLE_DATAGRAM_SIZE 8192
+
 
 namespace {
 YARP_OS_LOG_COMPONENT(DGRAMTWOWAYSTREAM, "yarp.os.impl.DgramTwoWayStream")
@@ -86,6 +93,14 @@ static void addCrc(char* buf, yarp::conf::ssize_t length, yarp::conf::ssize_t cr
 }
 
 
+void DgramTwoWayStream::setReliable(double deadline, size_t window)
+{
+    reliable = true;
+    reliableDeadline = deadline;
+    reliableWindow = window;
+}
+
+
 bool DgramTwoWayStream::open(const Contact& remote)
 {
 #if defined(YARP_HAS_ACE)
@@ -212,6 +227,10 @@ void DgramTwoWayStream::allocate(int readSize, int writeSize)
         yCInfo(DGRAMTWOWAYSTREAM, "Datagram write size reset to %d", _write_size);
     }
 
+    if (reliable && _write_size < 0) {
+        _write_size = RELIABLE_DATAGRAM_SIZE;
+    }
+
     // force the size of the write buffer to be under the max size of a udp datagram.
     if (_write_size > UDP_MAX_DATAGRAM_SIZE || _write_size < 0) {
         _write_size = UDP_MAX_DATAGRAM_SIZE;
@@ -661,6 +680,12 @@ void DgramTwoWayStream::interrupt()
 
 void DgramTwoWayStream::closeMain()
 {
+    if (repairThread.joinable()) {
+        repairRunning = false;
+        repairThread.join();
+    }
+    closeRepair();
+
     if (dgram != nullptr) {
         //printf("Dgram closing, interrupt state %d\n", interrupting);
         interrupt();
@@ -696,6 +721,9 @@ void DgramTwoWayStream::closeMain()
 yarp::conf::ssize_t DgramTwoWayStream::read(Bytes& b)
 {
     reader = true;
+    if (reliable) {
+        return readReliable(b);
+    }
     bool done = false;
 
     while (!done) {
@@ -821,6 +849,26 @@ void DgramTwoWayStream::write(const Bytes& b)
         return;
     }
 
+    if (reliable) {
+        if (!reliableSender) {
+            reliableSender = std::make_unique<DgramReliable::Sender>(writeBuffer.length(), reliableWindow, [this](const char* data, size_t len) {
+                if (sendDatagram(data, len) < 0) {
+                    happy = false;
+                    yCDebug(DGRAMTWOWAYSTREAM, "DGRAM failed to send message with error: %s", strerror(errno));
+                }
+            });
+            int port = (dgram != nullptr) ? openRepair() : -1;
+            if (port > 0) {
+                reliableSender->setRepairPort(port);
+                repairRunning = true;
+                repairThread = std::thread(&DgramTwoWayStream::serveRepairs, this);
+            }
+        }
+        // The message is sent in fragments, and completed by endPacket()
+        reliableSender->write(b.get(), b.length());
+        return;
+    }
+
     Bytes local = b;
     while (local.length() > 0) {
         yCTrace(DGRAMTWOWAYSTREAM, "DGRAM prep writing");
@@ -843,7 +891,7 @@ void DgramTwoWayStream::write(const Bytes& b)
 
 void DgramTwoWayStream::flush()
 {
-    if (writeBuffer.get() == nullptr) {
+    if (writeBuffer.get() == nullptr || reliable) {
         return;
     }
 
@@ -856,29 +904,7 @@ void DgramTwoWayStream::flush()
 
     if (writeAvail > 0) {
         //yCAssert(DGRAMTWOWAYSTREAM, dgram != nullptr);
-        yarp::conf::ssize_t len = 0;
-
-#if defined(YARP_HAS_ACE)
-        if (mgram != nullptr) {
-            len = mgram->send(writeBuffer.get(), writeAvail);
-            yCDebug(DGRAMTWOWAYSTREAM, "MCAST - wrote %zd bytes", len);
-        } else
-#endif
-            if (dgram != nullptr) {
-#if defined(YARP_HAS_ACE)
-            len = dgram->send(writeBuffer.get(), writeAvail, remoteHandle);
-#else
-            len = send(dgram_sockfd, writeBuffer.get(), writeAvail, 0);
-#endif
-            yCDebug(DGRAMTWOWAYSTREAM, "DGRAM - wrote %zd bytes to %s", len, remoteAddress.toString().c_str());
-        } else {
-            Bytes b(writeBuffer.get(), writeAvail);
-            monitor = ManagedBytes(b, false);
-            monitor.copy();
-            //printf("Monitored output of %d bytes\n", monitor.length());
-            len = monitor.length();
-            onMonitorOutput();
-        }
+        yarp::conf::ssize_t len = sendDatagram(writeBuffer.get(), writeAvail);
         if (len > writeBuffer.length() * 0.75) {
             yCDebug(DGRAMTWOWAYSTREAM, "long dgrams might need a little time");
 
@@ -920,6 +946,227 @@ void DgramTwoWayStream::flush()
 }
 
 
+yarp::conf::ssize_t DgramTwoWayStream::sendDatagram(const char* data, size_t size)
+{
+    yarp::conf::ssize_t len = 0;
+
+#if defined(YARP_HAS_ACE)
+    if (mgram != nullptr) {
+        len = mgram->send(data, size);
+        yCDebug(DGRAMTWOWAYSTREAM, "MCAST - wrote %zd bytes", len);
+    } else
+#endif
+        if (dgram != nullptr) {
+#if defined(YARP_HAS_ACE)
+        len = dgram->send(data, size, remoteHandle);
+#else
+        len = send(dgram_sockfd, data, size, 0);
+#endif
+        yCDebug(DGRAMTWOWAYSTREAM, "DGRAM - wrote %zd bytes to %s", len, remoteAddress.toString().c_str());
+    } else {
+        Bytes b(const_cast<char*>(data), size);
+        monitor = ManagedBytes(b, false);
+        monitor.copy();
+        //printf("Monitored output of %d bytes\n", monitor.length());
+        len = monitor.length();
+        onMonitorOutput();
+    }
+    return len;
+}
+
+
+yarp::conf::ssize_t DgramTwoWayStream::receiveDatagram(char* data, size_t len, double timeout, std::uint32_t& ip)
+{
+    ip = 0;
+    if (dgram != nullptr) {
+#if defined(YARP_HAS_ACE)
+        ACE_INET_Addr from;
+        ACE_Time_Value tv;
+        tv.set(timeout);
+        yarp::conf::ssize_t result = dgram->recv(data, len, from, 0, &tv);
+        if (result < 0 && errno == ETIME) {
+            return 0;
+        }
+        ip = from.get_ip_address();
+#else
+        struct pollfd pfd;
+        pfd.fd = dgram_sockfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        int ready = ::poll(&pfd, 1, static_cast<int>(std::ceil(timeout * 1000)));
+        if (ready <= 0) {
+            return (ready == 0 || errno == EINTR) ? 0 : -1;
+        }
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        yarp::conf::ssize_t result = recvfrom(dgram_sockfd, data, len, 0, (struct sockaddr*)&from, &fromLen);
+        ip = ntohl(from.sin_addr.s_addr);
+#endif
+        yCTrace(DGRAMTWOWAYSTREAM, "DGRAM Got %zd bytes", result);
+        return result;
+    }
+
+    onMonitorInput();
+    if (monitor.length() > len) {
+        return -1;
+    }
+    memcpy(data, monitor.get(), monitor.length());
+    return monitor.length();
+}
+
+
+yarp::conf::ssize_t DgramTwoWayStream::readReliable(Bytes& b)
+{
+    if (!reliableReceiver) {
+        reliableReceiver = std::make_unique<DgramReliable::Receiver>(reliableDeadline, [this](std::uint32_t ip, int port, const char* data, size_t len) {
+            sendRepairRequest(ip, port, data, len);
+        });
+        if (dgram != nullptr) {
+            openRepair();
+        }
+    }
+
+    while (reliableAt >= reliableMessage.size()) {
+        if (closed) {
+            happy = false;
+            return -1;
+        }
+
+        double timeout = reliableReceiver->poll(SystemClock::nowSystem());
+        size_t dropped = reliableReceiver->takeDropped();
+        if (dropped > 0) {
+            errCount += static_cast<int>(dropped);
+            double now = SystemClock::nowSystem();
+            if (now - lastReportTime > 1) {
+                yCError(DGRAMTWOWAYSTREAM, "*** %d message(s) dropped - not repaired within %g s ***", errCount, reliableDeadline);
+                lastReportTime = now;
+                errCount = 0;
+            }
+        }
+        if (reliableReceiver->popMessage(reliableMessage)) {
+            reliableAt = 0;
+            continue;
+        }
+
+        std::uint32_t ip = 0;
+        yarp::conf::ssize_t result = receiveDatagram(readBuffer.get(), readBuffer.length(), timeout, ip);
+        if (closed || (result < 0)) {
+            happy = false;
+            return -1;
+        }
+        if (result > 0) {
+            reliableReceiver->handleDatagram(readBuffer.get(), result, ip, SystemClock::nowSystem());
+        }
+    }
+
+    size_t take = std::min(b.length(), reliableMessage.size() - reliableAt);
+    memcpy(b.get(), reliableMessage.data() + reliableAt, take);
+    reliableAt += take;
+    return take;
+}
+
+
+int DgramTwoWayStream::openRepair()
+{
+    int port = -1;
+#if defined(YARP_HAS_ACE)
+    repair = new ACE_SOCK_Dgram;
+    ACE_INET_Addr anywhere((u_short)0, (ACE_UINT32)INADDR_ANY);
+    if (repair->open(anywhere, ACE_PROTOCOL_FAMILY_INET, 0, 1) != 0) {
+        yCError(DGRAMTWOWAYSTREAM, "could not open the repair socket");
+        delete repair;
+        repair = nullptr;
+        return -1;
+    }
+    ACE_INET_Addr addr;
+    repair->get_local_addr(addr);
+    port = addr.get_port_number();
+#else
+    int s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s < 0) {
+        yCError(DGRAMTWOWAYSTREAM, "could not create the repair socket");
+        return -1;
+    }
+    struct sockaddr_in sin;
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = htonl(INADDR_ANY);
+    sin.sin_port = 0;
+    socklen_t len = sizeof(sin);
+    if (bind(s, (struct sockaddr*)&sin, sizeof(sin)) < 0 || getsockname(s, (struct sockaddr*)&sin, &len) < 0) {
+        yCError(DGRAMTWOWAYSTREAM, "could not bind the repair socket");
+        ::close(s);
+        return -1;
+    }
+    repair_sockfd = s;
+    port = ntohs(sin.sin_port);
+#endif
+    yCDebug(DGRAMTWOWAYSTREAM, "repair requests on port %d", port);
+    return port;
+}
+
+
+void DgramTwoWayStream::closeRepair()
+{
+#if defined(YARP_HAS_ACE)
+    if (repair != nullptr) {
+        repair->close();
+        delete repair;
+        repair = nullptr;
+    }
+#else
+    if (repair_sockfd >= 0) {
+        ::close(repair_sockfd);
+        repair_sockfd = -1;
+    }
+#endif
+}
+
+
+void DgramTwoWayStream::serveRepairs()
+{
+    char buf[64];
+    while (repairRunning) {
+#if defined(YARP_HAS_ACE)
+        ACE_INET_Addr from;
+        ACE_Time_Value tv(0, 100000);
+        yarp::conf::ssize_t result = repair->recv(buf, sizeof(buf), from, 0, &tv);
+#else
+        struct pollfd pfd;
+        pfd.fd = repair_sockfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (::poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+        yarp::conf::ssize_t result = recv(repair_sockfd, buf, sizeof(buf), 0);
+#endif
+        if (result > 0) {
+            reliableSender->handleNack(buf, result);
+        }
+    }
+}
+
+
+void DgramTwoWayStream::sendRepairRequest(std::uint32_t ip, int port, const char* data, size_t len)
+{
+#if defined(YARP_HAS_ACE)
+    if (repair != nullptr) {
+        repair->send(data, len, ACE_INET_Addr((u_short)port, (ACE_UINT32)ip));
+    }
+#else
+    if (repair_sockfd >= 0) {
+        struct sockaddr_in to;
+        memset(&to, 0, sizeof(to));
+        to.sin_family = AF_INET;
+        to.sin_port = htons(port);
+        to.sin_addr.s_addr = htonl(ip);
+        sendto(repair_sockfd, data, len, 0, (struct sockaddr*)&to, sizeof(to));
+    }
+#endif
+}
+
+
 bool DgramTwoWayStream::isOk() const
 {
     return happy;
@@ -939,6 +1186,10 @@ void DgramTwoWayStream::beginPacket()
 {
 //     yCError(DGRAMTWOWAYSTREAM, "Packet begins: %s", (reader ? "reader" : "writer"));
     pct = 0;
+    if (reliable && reader) {
+        // skip what is left of the previous message
+        reliableAt = reliableMessage.size();
+    }
 }
 
 void DgramTwoWayStream::endPacket()
@@ -946,6 +1197,9 @@ void DgramTwoWayStream::endPacket()
 //     yCError(DGRAMTWOWAYSTREAM, "Packet ends: %s", (reader ? "reader" : "writer"));
     if (!reader) {
         pct = 0;
+        if (reliableSender) {
+            reliableSender->endMessage();
+        }
     }
 }
 
@@ -9,9 +9,14 @@
 
 #include <yarp/os/ManagedBytes.h>
 #include <yarp/os/TwoWayStream.h>
+#include <yarp/os/impl/DgramReliable.h>
 
+#include <atomic>
 #include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 
 #ifdef YARP_HAS_ACE
 #    include <ace/SOCK_Dgram.h>
@@ -26,7 +31,8 @@ namespace yarp::os::impl {
 
 /**
  * A stream abstraction for datagram communication.  It supports UDP and
- * MCAST.  This class is not concerned with making the stream reliable.
+ * MCAST.  By default this class is not concerned with making the stream
+ * reliable, see setReliable().
  */
 class YARP_os_impl_API DgramTwoWayStream :
         public TwoWayStream,
@@ -58,6 +64,23 @@ public:
     {
     }
 
+    /**
+     * Split the messages in fragments, and repair the lost ones (see
+     * DgramReliable).  The writer listens for repair requests on a separate
+     * UDP socket.  It must be called before opening the stream, and the
+     * messages must be delimited by beginPacket() and endPacket().
+     *
+     * @param deadline the time [s] after which the reader gives up on an
+     *                 incomplete message
+     * @param window the number of messages that the writer can send again
+     */
+    void setReliable(double deadline, size_t window);
+
+    bool isReliable() const
+    {
+        return reliable;
+    }
+
     virtual bool openMonitor(int readSize = 0, int writeSize = 0)
     {
         allocate(readSize, writeSize);
@@ -172,16 +195,41 @@ private:
     std::mutex mutex;
     yarp::conf::ssize_t readAt, readAvail, writeAvail;
     int pct;
-    bool happy;
+    // also cleared by the repair thread of a reliable stream
+    std::atomic<bool> happy;
     bool bufferAlertNeeded;
     bool bufferAlerted;
     bool multiMode;
     int errCount;
     double lastReportTime;
 
+    bool reliable{false};
+    double reliableDeadline{0.0};
+    size_t reliableWindow{0};
+    std::unique_ptr<DgramReliable::Sender> reliableSender;
+    std::unique_ptr<DgramReliable::Receiver> reliableReceiver;
+    std::string reliableMessage;
+    size_t reliableAt{0};
+#ifdef YARP_HAS_ACE
+    ACE_SOCK_Dgram* repair{nullptr};
+#else
+    int repair_sockfd{-1};
+#endif
+    std::thread repairThread;
+    std::atomic<bool> repairRunning{false};
+
     void allocate(int readSize = 0, int writeSize = 0);
 
     void configureSystemBuffers();
+
+    yarp::conf::ssize_t sendDatagram(const char* data, size_t len);
+    yarp::conf::ssize_t receiveDatagram(char* data, size_t len, double timeout, std::uint32_t& ip);
+    yarp::conf::ssize_t readReliable(yarp::os::Bytes& b);
+
+    int openRepair();
+    void closeRepair();
+    void serveRepairs();
+    void sendRepairRequest(std::uint32_t ip, int port, const char* data, size_t len);
 };
 
 } // namespace yarp::os::impl
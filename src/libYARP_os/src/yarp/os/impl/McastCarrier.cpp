@@ -11,6 +11,8 @@
 #include <yarp/conf/numeric.h>
 
 #include <yarp/os/ConnectionState.h>
+#include <yarp/os/Name.h>
+#include <yarp/os/NetInt32.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/Route.h>
 #include <yarp/os/impl/LogComponent.h>
@@ -22,6 +24,13 @@ using namespace yarp::os;
 
 namespace {
 YARP_OS_LOG_COMPONENT(MCASTCARRIER, "yarp.os.impl.McastCarrier")
+
+// Specifier flag of the reliable variant
+constexpr int reliableFlag = 64;
+constexpr double defaultDeadline = 0.1;
+constexpr int defaultWindow = 32;
+constexpr double maxDeadline = 10.0;
+constexpr int maxWindow = 1024;
 } // namespace
 
 ElectionOf<PeerRecord<McastCarrier>>* McastCarrier::caster = nullptr;
@@ -43,7 +52,10 @@ ElectionOf<PeerRecord<McastCarrier>>& McastCarrier::getCaster()
 }
 
 
-yarp::os::impl::McastCarrier::McastCarrier()
+yarp::os::impl::McastCarrier::McastCarrier(bool reliable) :
+        reliable(reliable),
+        deadline(defaultDeadline),
+        window(defaultWindow)
 {
     stream = nullptr;
     key = "";
@@ -70,12 +82,12 @@ yarp::os::impl::McastCarrier::~McastCarrier()
 
 Carrier* yarp::os::impl::McastCarrier::create() const
 {
-    return new McastCarrier();
+    return new McastCarrier(reliable);
 }
 
 std::string yarp::os::impl::McastCarrier::getName() const
 {
-    return "mcast";
+    return reliable ? "reliable_mcast" : "mcast";
 }
 
 int yarp::os::impl::McastCarrier::getSpecifierCode() const
@@ -83,6 +95,22 @@ int yarp::os::impl::McastCarrier::getSpecifierCode() const
     return 1;
 }
 
+bool yarp::os::impl::McastCarrier::checkHeader(const Bytes& header)
+{
+    int spec = getSpecifier(header);
+    if (spec % 16 == getSpecifierCode()) {
+        if (((spec & reliableFlag) != 0) == reliable) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void yarp::os::impl::McastCarrier::getHeader(Bytes& header) const
+{
+    createStandardHeader(getSpecifierCode() + (reliable ? reliableFlag : 0), header);
+}
+
 
 bool yarp::os::impl::McastCarrier::sendHeader(ConnectionState& proto)
 {
@@ -98,6 +126,9 @@ bool yarp::os::impl::McastCarrier::sendHeader(ConnectionState& proto)
 
     Contact alt = proto.getStreams().getLocalAddress();
     std::string altKey = proto.getRoute().getFromName() + "/net=" + alt.getHost();
+    if (reliable) {
+        altKey += "/reliable";
+    }
     McastCarrier* elect = getCaster().getElect(altKey);
     if (elect != nullptr) {
         yCDebug(MCASTCARRIER, "picking up peer mcast name");
@@ -147,6 +178,29 @@ bool yarp::os::impl::McastCarrier::sendHeader(ConnectionState& proto)
     block.get()[4] = (char)(port / 256);
     proto.os().write(block.bytes());
     mcastAddress = addr;
+
+    if (reliable) {
+        // The receivers need to know how long they should wait for repairs
+        Name name(proto.getRoute().getCarrierName() + "://test");
+        std::string mod = name.getCarrierModifier("deadline");
+        if (!mod.empty()) {
+            deadline = yarp::conf::numeric::from_string<double>(mod, defaultDeadline);
+        }
+        mod = name.getCarrierModifier("window");
+        if (!mod.empty()) {
+            window = yarp::conf::numeric::from_string<int>(mod, defaultWindow);
+        }
+        if (!(deadline > 0.0 && deadline <= maxDeadline)) {
+            yCError(MCASTCARRIER, "Invalid deadline %g, it must be greater than 0 and at most %g seconds", deadline, maxDeadline);
+            return false;
+        }
+        if (window <= 0 || window > maxWindow) {
+            yCError(MCASTCARRIER, "Invalid window %d, it must be between 1 and %d messages", window, maxWindow);
+            return false;
+        }
+        NetInt32 ms = static_cast<NetInt32>(deadline * 1000);
+        proto.os().write(Bytes(reinterpret_cast<char*>(&ms), sizeof(ms)));
+    }
     return true;
 }
 
@@ -180,6 +234,20 @@ bool yarp::os::impl::McastCarrier::expectExtraHeader(ConnectionState& proto)
     yCDebug(MCASTCARRIER, "got mcast header %s", addr.toURI().c_str());
     mcastAddress = addr;
 
+    if (reliable) {
+        NetInt32 ms = 0;
+        Bytes b(reinterpret_cast<char*>(&ms), sizeof(ms));
+        if (proto.is().readFull(b) != static_cast<yarp::conf::ssize_t>(sizeof(ms))) {
+            yCError(MCASTCARRIER, "problem with reliable MCAST header");
+            return false;
+        }
+        deadline = ms / 1000.0;
+        if (!(deadline > 0.0 && deadline <= maxDeadline)) {
+            yCError(MCASTCARRIER, "Invalid deadline %g in reliable MCAST header", deadline);
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -205,11 +273,18 @@ bool yarp::os::impl::McastCarrier::becomeMcast(ConnectionState& proto, bool send
         key = proto.getRoute().getFromName();
         key += "/net=";
         key += local.getHost();
+        if (reliable) {
+            key += "/reliable";
+        }
 
         yCDebug(MCASTCARRIER, "multicast key: %s", key.c_str());
         addSender(key);
     }
 
+    if (reliable) {
+        stream->setReliable(deadline, static_cast<size_t>(window));
+    }
+
     bool ok = true;
     if (isElect() || !sender) {
         ok = stream->join(mcastAddress, sender, local);
@@ -18,6 +18,14 @@ namespace yarp::os::impl {
 
 /**
  * Communicating between two ports via MCAST.
+ *
+ * The "reliable_mcast" variant splits the messages in fragments, and the
+ * receivers ask the sender to repeat the ones they lost (see
+ * DgramReliable).  The modifiers "+deadline.SECONDS" (default 0.1) and
+ * "+window.MESSAGES" (default 32) set how long the receivers wait for the
+ * missing fragments before dropping a message, and how many messages the
+ * sender keeps for this purpose.  The deadline must be in (0, 10] seconds
+ * and the window in [1, 1024] messages, otherwise the connection fails.
  */
 class McastCarrier :
         public UdpCarrier
@@ -28,13 +36,16 @@ protected:
     std::string key;
     DgramTwoWayStream* stream;
     Contact local;
+    bool reliable;
+    double deadline;
+    int window;
 
     static ElectionOf<PeerRecord<McastCarrier>>* caster;
 
     static ElectionOf<PeerRecord<McastCarrier>>& getCaster();
 
 public:
-    McastCarrier();
+    McastCarrier(bool reliable = false);
 
     virtual ~McastCarrier();
 
@@ -42,6 +53,8 @@ public:
     std::string getName() const override;
 
     int getSpecifierCode() const override;
+    bool checkHeader(const Bytes& header) override;
+    void getHeader(Bytes& header) const override;
 
     bool sendHeader(ConnectionState& proto) override;
     bool expectExtraHeader(ConnectionState& proto) override;
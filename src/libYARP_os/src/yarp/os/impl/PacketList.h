@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_PACKETLIST_H
+#define YARP_OS_IMPL_PACKETLIST_H
+
+#include <cstddef>
+
+namespace yarp::os::impl {
+
+/**
+ * An intrusive doubly linked list of packets.
+ *
+ * The links are stored in the `prev_`, `next_` and `list_` members of the
+ * packets, therefore all the operations are O(1) and never allocate memory.
+ * A packet can be in at most one list at any time.  The list does not own
+ * the packets, and it is not thread safe.
+ */
+template <typename T>
+class PacketList
+{
+public:
+    PacketList() = default;
+    PacketList(const PacketList&) = delete;
+    PacketList& operator=(const PacketList&) = delete;
+
+    bool empty() const
+    {
+        return m_head == nullptr;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    T* front() const
+    {
+        return m_head;
+    }
+
+    bool contains(const T* packet) const
+    {
+        return packet->list_ == this;
+    }
+
+    void push_back(T* packet)
+    {
+        packet->list_ = this;
+        packet->prev_ = m_tail;
+        packet->next_ = nullptr;
+        if (m_tail != nullptr) {
+            m_tail->next_ = packet;
+        } else {
+            m_head = packet;
+        }
+        m_tail = packet;
+        m_size++;
+    }
+
+    T* pop_front()
+    {
+        T* packet = m_head;
+        if (packet != nullptr) {
+            remove(packet);
+        }
+        return packet;
+    }
+
+    /**
+     * Remove a packet from the list.
+     *
+     * @return false if the packet was not in this list.
+     */
+    bool remove(T* packet)
+    {
+        if (!contains(packet)) {
+            return false;
+        }
+        if (packet->prev_ != nullptr) {
+            packet->prev_->next_ = packet->next_;
+        } else {
+            m_head = packet->next_;
+        }
+        if (packet->next_ != nullptr) {
+            packet->next_->prev_ = packet->prev_;
+        } else {
+            m_tail = packet->prev_;
+        }
+        packet->list_ = nullptr;
+        packet->prev_ = nullptr;
+        packet->next_ = nullptr;
+        m_size--;
+        return true;
+    }
+
+private:
+    T* m_head {nullptr};
+    T* m_tail {nullptr};
+    size_t m_size {0};
+};
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_PACKETLIST_H
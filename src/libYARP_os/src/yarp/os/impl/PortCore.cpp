@@ -1281,6 +1281,7 @@ bool PortCore::sendHelper(const PortWriter& writer,
     bool gotReply = false;
     int logCount = 0;
     std::string envelopeString = m_envelope;
+    std::int64_t traceTime = m_tracing ? PortCoreTracer::now() : 0;
 
     // Pass a message to all output units for sending on.  We could
     // be doing more here to cache the serialization of the message
@@ -1345,7 +1346,8 @@ bool PortCore::sendHelper(const PortWriter& writer,
                                    envelopeString,
                                    waiter,
                                    m_waitBeforeSend,
-                                   &gotReplyOne);
+                                   &gotReplyOne,
+                                   traceTime);
             gotReply = gotReply || gotReplyOne;
             yCITrace(PORTCORE, getName(), "------- -- send");
             if (out != nullptr) {
@@ -1538,6 +1540,7 @@ enum class PortCoreCommand : yarp::conf::vocab32_t
     Set = yarp::os::createVocab32('s', 'e', 't'),
     Get = yarp::os::createVocab32('g', 'e', 't'),
     Prop = yarp::os::createVocab32('p', 'r', 'o', 'p'),
+    Trac = yarp::os::createVocab32('t', 'r', 'a', 'c'),
 };
 
 enum class PortCoreConnectionDirection : yarp::conf::vocab32_t
@@ -1569,6 +1572,7 @@ PortCoreCommand parseCommand(const yarp::os::Value& v)
     case PortCoreCommand::Set:
     case PortCoreCommand::Get:
     case PortCoreCommand::Prop:
+    case PortCoreCommand::Trac:
         return cmd;
     default:
         return PortCoreCommand::Unknown;
@@ -1667,6 +1671,11 @@ bool PortCore::adminBlock(ConnectionReader& reader,
         result.addString("[atch] [in]  $prop      # attach a portmonitor plug-in to the port's input");
         result.addString("[dtch] [out]            # detach portmonitor plug-in from the port's output");
         result.addString("[dtch] [in]             # detach portmonitor plug-in from the port's input");
+        result.addString("[trac] [on]             # send timestamps with the messages written to the port");
+        result.addString("[trac] [off]            # stop sending timestamps with the messages");
+        result.addString("[trac] [get]            # get the latency of the traced messages received [us]");
+        result.addString("[trac] [json]           # get the latest traced messages received, in Chrome trace format");
+        result.addString("[trac] [clr]            # forget the traced messages received");
         //result.addString("[atch] $portname $prop  # attach a portmonitor plug-in to the connection to/from $portname");
         //result.addString("[dtch] $portname        # detach any portmonitor plug-in from the connection to/from $portname");
         return result;
@@ -2187,6 +2196,16 @@ bool PortCore::adminBlock(ConnectionReader& reader,
                         port_prop.put("is_output", is_output);
                         port_prop.put("is_rpc", is_rpc);
                         port_prop.put("type", getType().getName());
+
+                        Bottle& packets = result.addList();
+                        packets.addString("packets");
+                        Property& packets_prop = packets.addDict();
+                        m_packetMutex.lock();
+                        packets_prop.put("active", static_cast<int>(m_packets.getCount()));
+                        packets_prop.put("free", static_cast<int>(m_packets.getFree()));
+                        packets_prop.put("allocated", static_cast<int>(m_packets.getAllocatedCount()));
+                        packets_prop.put("exhausted", static_cast<int>(m_packets.getExhaustedCount()));
+                        m_packetMutex.unlock();
                     } else {
                         for (auto* unit : m_units) {
                             if ((unit != nullptr) && !unit->isFinished()) {
@@ -2208,6 +2227,11 @@ bool PortCore::adminBlock(ConnectionReader& reader,
                                     qos.addString("qos");
                                     Property& qos_prop = qos.addDict();
                                     qos_prop.put("tos", tos);
+                                    int batchSize = 0;
+                                    double batchDelay = 0.0;
+                                    unit->getBatching(batchSize, batchDelay);
+                                    qos_prop.put("batch", batchSize);
+                                    qos_prop.put("batch_delay", batchDelay);
                                 }
                             } // end isFinished()
                         }     // end for loop
@@ -2302,6 +2326,7 @@ bool PortCore::adminBlock(ConnectionReader& reader,
             // e.g., "prop set /portname (qos ((priority HIGH)))"
             // e.g., "prop set /portname (qos ((dscp AF12)))"
             // e.g., "prop set /portname (qos ((tos 12)))"
+            // e.g., "prop set /portname (qos ((batch 16) (batch_delay 0.001)))"
             if (!qos.isNull()) {
                 if ((!key.empty()) && (key[0] == '/')) {
                     bOk = false;
@@ -2360,8 +2385,14 @@ bool PortCore::adminBlock(ConnectionReader& reader,
                                             tos = tos_val.asInt32();
                                         }
                                     }
+                                    bool batchOk = true;
+                                    if (qos_prop->check("batch")) {
+                                        batchOk = unit->setBatching(qos_prop->find("batch").asInt32(),
+                                                                    qos_prop->check("batch_delay", Value(0.001)).asFloat64());
+                                        bOk = batchOk;
+                                    }
                                     if (tos >= 0) {
-                                        bOk = setTypeOfService(unit, tos);
+                                        bOk = batchOk && setTypeOfService(unit, tos);
                                     }
                                 } else {
                                     bOk = false;
@@ -2378,6 +2409,34 @@ bool PortCore::adminBlock(ConnectionReader& reader,
         return result;
     };
 
+    auto handleAdminTracCmd = [this](yarp::conf::vocab32_t action) {
+        Bottle result;
+        switch (action) {
+        case yarp::os::createVocab32('o', 'n'):
+            m_tracing = true;
+            result.addVocab32("ok");
+            break;
+        case yarp::os::createVocab32('o', 'f', 'f'):
+            m_tracing = false;
+            result.addVocab32("ok");
+            break;
+        case yarp::os::createVocab32('g', 'e', 't'):
+            result = m_tracer.getStatistics();
+            break;
+        case yarp::os::createVocab32('j', 's', 'o', 'n'):
+            result.addString(m_tracer.getChromeTrace(getName()));
+            break;
+        case yarp::os::createVocab32('c', 'l', 'r'):
+            m_tracer.clear();
+            result.addVocab32("ok");
+            break;
+        default:
+            result.addVocab32("fail");
+            result.addString("trace command must be followed by [on], [off], [get], [json] or [clr]");
+        }
+        return result;
+    };
+
     auto handleAdminUnknownCmd = [this](const Bottle& cmd) {
         Bottle result;
         bool ok = false;
@@ -2485,6 +2544,9 @@ bool PortCore::adminBlock(ConnectionReader& reader,
             break;
         }
     } break;
+    case PortCoreCommand::Trac:
+        result = handleAdminTracCmd(cmd.get(1).asVocab32());
+        break;
     case PortCoreCommand::Unknown:
         result = handleAdminUnknownCmd(cmd);
         break;
@@ -20,6 +20,7 @@
 #include <yarp/os/Vocab.h>
 #include <yarp/os/impl/BufferedConnectionWriter.h>
 #include <yarp/os/impl/PortCorePackets.h>
+#include <yarp/os/impl/PortCoreTracer.h>
 #include <yarp/os/impl/ThreadImpl.h>
 
 #include <atomic>
@@ -232,6 +233,16 @@ public:
     bool adminBlock(ConnectionReader& reader,
                     void* id);
 
+    /**
+     * Add the timestamps of a traced message received from a port.
+     * @param from the name of the sending port
+     * @param stamps the timestamps of the message
+     */
+    void recordTrace(const std::string& from, const PortCoreTracer::Stamps& stamps)
+    {
+        m_tracer.record(from, stamps);
+    }
+
     /**
      * Set the name of this port.
      * @param name the name of this port
@@ -534,6 +545,8 @@ private:
     bool m_logNeeded {false}; ///< port needs to monitor message content
     PortCorePackets m_packets {}; ///< a pool for tracking messages currently being sent
     std::string m_envelope;///< user-defined wrapping data
+    std::atomic<bool> m_tracing {PortCoreTracer::isEnabled()}; ///< should outgoing messages carry timestamps?
+    PortCoreTracer m_tracer; ///< latency of the traced messages received
     float m_timeout {-1};  ///< a timeout to apply to all network operations
     int m_counter {1};    ///< port-unique ids for connections
     yarp::os::Property *m_prop {nullptr};  ///< optional unstructured properties associated with port
@@ -6,6 +6,7 @@
 
 #include <yarp/os/impl/PortCoreInputUnit.h>
 
+#include <yarp/os/InputStream.h>
 #include <yarp/os/Name.h>
 #include <yarp/os/Os.h>
 #include <yarp/os/PortInfo.h>
@@ -15,6 +16,9 @@
 #include <yarp/os/impl/LogComponent.h>
 #include <yarp/os/impl/PlatformSignal.h>
 #include <yarp/os/impl/PortCommand.h>
+#include <yarp/os/impl/PortCoreReactor.h>
+#include <yarp/os/impl/PortCoreTracer.h>
+#include <yarp/os/impl/StreamConnectionReader.h>
 
 #include <cstdio>
 
@@ -24,6 +28,55 @@ using namespace yarp::os;
 
 namespace {
 YARP_OS_LOG_COMPONENT(PORTCOREINPUTUNIT, "yarp.os.impl.PortCoreInputUnit")
+
+// Reads a message of a batch directly from the connection, without going
+// past its end
+class BatchMessageInputStream : public InputStream
+{
+public:
+    explicit BatchMessageInputStream(ConnectionReader& reader) :
+            reader(reader)
+    {
+    }
+
+    void reset(size_t length)
+    {
+        remaining = length;
+    }
+
+    size_t getRemaining() const
+    {
+        return remaining;
+    }
+
+    using InputStream::read;
+
+    yarp::conf::ssize_t read(Bytes& b) override
+    {
+        size_t len = (b.length() < remaining) ? b.length() : remaining;
+        if (len == 0) {
+            return (b.length() == 0) ? 0 : -1;
+        }
+        if (!reader.expectBlock(b.get(), len)) {
+            return -1;
+        }
+        remaining -= len;
+        return static_cast<yarp::conf::ssize_t>(len);
+    }
+
+    void close() override
+    {
+    }
+
+    bool isOk() const override
+    {
+        return !reader.isError();
+    }
+
+private:
+    ConnectionReader& reader;
+    size_t remaining {0};
+};
 } // namespace
 
 PortCoreInputUnit::PortCoreInputUnit(PortCore& owner,
@@ -39,7 +92,11 @@ PortCoreInputUnit::PortCoreInputUnit(PortCore& owner,
         running(false),
         name(owner.getName()),
         localReader(nullptr),
-        reversed(reversed)
+        reversed(reversed),
+        reactive(false),
+        wasNoticed(false),
+        posted(false),
+        stopped(0)
 {
     yCIAssert(PORTCOREINPUTUNIT, getName(), ip != nullptr);
 
@@ -63,6 +120,18 @@ bool PortCoreInputUnit::start()
 {
     yCIDebug(PORTCOREINPUTUNIT, getName(), "new input connection to %s starting", getOwner().getName().c_str());
 
+    if (PortCoreReactor::isEnabled()) {
+        // The handshake is performed on one of the threads of the reactor,
+        // that will then decide if the connection can be polled.
+        reactive = true;
+        running = true;
+        PortCoreReactor::getInstance().post([this]() {
+            runPrologue();
+            startServing();
+        });
+        return true;
+    }
+
     phase.wait();
 
     bool result = PortCoreUnit::start();
@@ -81,18 +150,24 @@ bool PortCoreInputUnit::start()
 
 void PortCoreInputUnit::run()
 {
-    running = true;
-    phase.post();
+    if (!reactive) {
+        running = true;
+        phase.post();
+        runPrologue();
+    }
 
-    Route route;
-    bool wasNoticed = false;
-    bool posted = false;
+    // When the reactor is enabled, the prologue was already run by one of
+    // its threads, that decided that this connection needs its own thread.
+    while (runStep()) {
+    }
 
-    bool done = false;
+    runEpilogue();
+}
 
-    yCIAssert(PORTCOREINPUTUNIT, getName(), ip != nullptr);
 
-    PortCommand cmd;
+void PortCoreInputUnit::runPrologue()
+{
+    yCIAssert(PORTCOREINPUTUNIT, getName(), ip != nullptr);
 
     bool ok = true;
     if (!reversed) {
@@ -100,9 +175,8 @@ void PortCoreInputUnit::run()
     }
     if (!ok) {
         yCIDebug(PORTCOREINPUTUNIT, getName(), "new input connection to %s is broken", getOwner().getName().c_str());
-        done = true;
     } else {
-        route = ip->getRoute();
+        Route route = ip->getRoute();
 
         // just before going official, tag any lurking inputs from
         // the same source as undesired
@@ -156,235 +230,251 @@ void PortCoreInputUnit::run()
 
             getOwner().addOutput(op);
             ip = nullptr;
-            done = true;
         }
     }
 
-    if (closing) {
-        done = true;
-    }
-
-    auto* id = reinterpret_cast<void*>(this);
-
     if (ip != nullptr && !ip->getConnection().canEscape()) {
         InputStream* is = &ip->getInputStream();
         is->setReadEnvelopeCallback(envelopeReadCallback, this);
     }
+}
 
-    while (!done) {
-        if (ip == nullptr) {
-            break;
-        }
-        ConnectionReader& br = ip->beginRead();
-
-        if (br.getReference() != nullptr) {
-            //printf("HAVE A REFERENCE\n");
-            if (localReader != nullptr) {
-                bool ok = localReader->read(br);
-                if (!br.isActive()) {
-                    break;
-                }
-                if (!ok) {
-                    continue;
-                }
-            } else {
-                PortCore& man = getOwner();
-                bool ok = man.readBlock(br, id, nullptr);
-                if (!br.isActive()) {
-                    break;
-                }
-                if (!ok) {
-                    continue;
-                }
-            }
-            //printf("DONE WITH A REFERENCE\n");
-            if (ip != nullptr) {
-                ip->endRead();
-            }
-            continue;
-        }
 
-        if (ip->getConnection().canEscape()) {
-            bool ok = cmd.read(br);
+bool PortCoreInputUnit::runStep()
+{
+    if (ip == nullptr || closing) {
+        return false;
+    }
+
+    auto* id = reinterpret_cast<void*>(this);
+    PortCommand cmd;
+    bool done = false;
+
+    ConnectionReader& br = ip->beginRead();
+
+    if (br.getReference() != nullptr) {
+        //printf("HAVE A REFERENCE\n");
+        if (localReader != nullptr) {
+            bool ok = localReader->read(br);
             if (!br.isActive()) {
-                break;
+                return false;
             }
             if (!ok) {
-                continue;
+                return true;
             }
         } else {
-            cmd = PortCommand('d', "");
-            if (!ip->isOk()) {
-                break;
+            PortCore& man = getOwner();
+            bool ok = man.readBlock(br, id, nullptr);
+            if (!br.isActive()) {
+                return false;
+            }
+            if (!ok) {
+                return true;
             }
         }
+        //printf("DONE WITH A REFERENCE\n");
+        if (ip != nullptr) {
+            ip->endRead();
+        }
+        return true;
+    }
 
-        if (closing || isDoomed()) {
-            break;
+    if (ip->getConnection().canEscape()) {
+        bool ok = cmd.read(br);
+        if (!br.isActive()) {
+            return false;
+        }
+        if (!ok) {
+            return true;
+        }
+    } else {
+        cmd = PortCommand('d', "");
+        if (!ip->isOk()) {
+            return false;
         }
-        char key = cmd.getKey();
-        //printf("Port command is [%c:%d/%s]\n",
-        //         (key>=32)?key:'?', key, cmd.getText().c_str());
+    }
 
-        PortCore& man = getOwner();
-        OutputStream* os = nullptr;
-        if (br.isTextMode()) {
-            os = &(ip->getOutputStream());
-        }
-
-        switch (key) {
-        case '/':
-            yCIDebug(PORTCOREINPUTUNIT,
-                     getName(),
-                    "Port command (%s): %s should add connection: %s",
-                    route.toString().c_str(),
-                    getOwner().getName().c_str(),
-                    cmd.getText().c_str());
-            man.addOutput(cmd.getText(), id, os);
-            break;
-        case '!':
-            yCIDebug(PORTCOREINPUTUNIT,
-                     getName(),
-                    "Port command (%s): %s should remove output: %s",
-                    route.toString().c_str(),
-                    getOwner().getName().c_str(),
-                    cmd.getText().c_str());
-            man.removeOutput(cmd.getText().substr(1, std::string::npos), id, os);
-            break;
-        case '~':
-            yCIDebug(PORTCOREINPUTUNIT,
-                     getName(),
-                    "Port command (%s): %s should remove input: %s",
-                    route.toString().c_str(),
-                    getOwner().getName().c_str(),
-                    cmd.getText().c_str());
-            man.removeInput(cmd.getText().substr(1, std::string::npos), id, os);
-            break;
-        case '*':
-            man.describe(id, os);
-            break;
-        case 'D':
-        case 'd': {
-            if (key == 'D') {
-                ip->suppressReply();
-            }
+    if (closing || isDoomed()) {
+        return false;
+    }
+    char key = cmd.getKey();
+
+    // A traced message: its timestamps, followed by the message itself
+    PortCoreTracer::Stamps trace;
+    if (key == 't' && !br.isTextMode()) {
+        trace.received = PortCoreTracer::now();
+        trace.write = br.expectInt64();
+        trace.send = br.expectInt64();
+        trace.serialized = br.expectInt64();
+        if (br.isError() || !cmd.read(br)) {
+            return false;
+        }
+        key = cmd.getKey();
+    }
 
-            std::string env = cmd.getText();
-            if (env.length() > 2) {
-                yCITrace(PORTCOREINPUTUNIT, getName(), "***** received an envelope! [%s]", env.c_str());
-                std::string env2 = env.substr(2, env.length());
-                man.setEnvelope(env2);
-                ip->setEnvelope(env2);
-            }
-            if (localReader != nullptr) {
-                localReader->read(br);
-                if (!br.isActive()) {
-                    done = true;
-                    break;
-                }
-            } else {
-                if (ip->getReceiver().acceptIncomingData(br)) {
-                    ConnectionReader* cr = &(ip->getReceiver().modifyIncomingData(br));
-                    yarp::os::impl::PortDataModifier& modifier = getOwner().getPortModifier();
-                    modifier.inputMutex.lock();
-                    if (modifier.inputModifier != nullptr) {
-                        if (modifier.inputModifier->acceptIncomingData(*cr)) {
-                            cr = &(modifier.inputModifier->modifyIncomingData(*cr));
-                            modifier.inputMutex.unlock();
-                            man.readBlock(*cr, id, os);
-                        } else {
-                            modifier.inputMutex.unlock();
-                            skipIncomingData(*cr);
-                        }
-                    } else {
-                        modifier.inputMutex.unlock();
-                        man.readBlock(*cr, id, os);
-                    }
-                } else {
-                    skipIncomingData(br);
-                }
-                if (!br.isActive()) {
-                    done = true;
-                    break;
-                }
+    //printf("Port command is [%c:%d/%s]\n",
+    //         (key>=32)?key:'?', key, cmd.getText().c_str());
+
+    PortCore& man = getOwner();
+    OutputStream* os = nullptr;
+    if (br.isTextMode()) {
+        os = &(ip->getOutputStream());
+    }
+
+    switch (key) {
+    case '/':
+        yCIDebug(PORTCOREINPUTUNIT,
+                 getName(),
+                "Port command (%s): %s should add connection: %s",
+                officialRoute.toString().c_str(),
+                getOwner().getName().c_str(),
+                cmd.getText().c_str());
+        man.addOutput(cmd.getText(), id, os);
+        break;
+    case '!':
+        yCIDebug(PORTCOREINPUTUNIT,
+                 getName(),
+                "Port command (%s): %s should remove output: %s",
+                officialRoute.toString().c_str(),
+                getOwner().getName().c_str(),
+                cmd.getText().c_str());
+        man.removeOutput(cmd.getText().substr(1, std::string::npos), id, os);
+        break;
+    case '~':
+        yCIDebug(PORTCOREINPUTUNIT,
+                 getName(),
+                "Port command (%s): %s should remove input: %s",
+                officialRoute.toString().c_str(),
+                getOwner().getName().c_str(),
+                cmd.getText().c_str());
+        man.removeInput(cmd.getText().substr(1, std::string::npos), id, os);
+        break;
+    case '*':
+        man.describe(id, os);
+        break;
+    case 'D':
+    case 'd': {
+        if (key == 'D') {
+            ip->suppressReply();
+        }
+
+        std::string env = cmd.getText();
+        if (env.length() > 2) {
+            yCITrace(PORTCOREINPUTUNIT, getName(), "***** received an envelope! [%s]", env.c_str());
+            std::string env2 = env.substr(2, env.length());
+            man.setEnvelope(env2);
+            ip->setEnvelope(env2);
+        }
+        if (localReader != nullptr) {
+            localReader->read(br);
+            if (!br.isActive()) {
+                done = true;
+                break;
             }
-        } break;
-        case 'a': {
-            man.adminBlock(br, id);
-        } break;
-        case 'r':
-            /*
-              In YARP implementation, OP=IP.
-              (This information is used rarely, and when used
-              is tagged with OP=IP keyword)
-              If it were not true, memory alloc would need to
-              reorganized here
-            */
-            {
-                OutputProtocol* op = &(ip->getOutput());
-                ip->endRead();
-                Route r = op->getRoute();
-                // reverse route
-                r.swapNames();
-                op->rename(r);
-
-                getOwner().addOutput(op);
-                ip = nullptr;
+        } else {
+            readData(br, id, os);
+            if (!br.isActive()) {
                 done = true;
+                break;
             }
+        }
+        if (trace.received != 0) {
+            trace.delivered = PortCoreTracer::now();
+            man.recordTrace(officialRoute.getFromName(), trace);
+        }
+    } break;
+    case 'b':
+        // a batch of messages, sent without replies
+        if (br.isTextMode()) {
             break;
-        case 'q':
+        }
+        ip->suppressReply();
+        if (!readBatch(br, id, os) || !br.isActive()) {
             done = true;
-            break;
+        }
+        break;
+    case 'a': {
+        man.adminBlock(br, id);
+    } break;
+    case 'r':
+        /*
+          In YARP implementation, OP=IP.
+          (This information is used rarely, and when used
+          is tagged with OP=IP keyword)
+          If it were not true, memory alloc would need to
+          reorganized here
+        */
+        {
+            OutputProtocol* op = &(ip->getOutput());
+            ip->endRead();
+            Route r = op->getRoute();
+            // reverse route
+            r.swapNames();
+            op->rename(r);
+
+            getOwner().addOutput(op);
+            ip = nullptr;
+            done = true;
+        }
+        break;
+    case 'q':
+        done = true;
+        break;
 #if !defined(NDEBUG)
-        case 'i':
-            printf("Interrupt requested\n");
-            //yarp::os::impl::kill(0, 2); // SIGINT
-            //yarp::os::impl::kill(yarp::os::getpid(), 2); // SIGINT
-            yarp::os::impl::kill(yarp::os::getpid(), 15); // SIGTERM
-            break;
+    case 'i':
+        printf("Interrupt requested\n");
+        //yarp::os::impl::kill(0, 2); // SIGINT
+        //yarp::os::impl::kill(yarp::os::getpid(), 2); // SIGINT
+        yarp::os::impl::kill(yarp::os::getpid(), 15); // SIGTERM
+        break;
 #endif
-        case '?':
-        case 'h':
-            if (os != nullptr) {
-                BufferedConnectionWriter bw(true);
-                bw.appendLine("This is a YARP port.  Here are the commands it responds to:");
-                bw.appendLine("*       Gives a description of this port");
-                bw.appendLine("d       Signals the beginning of input for the port's owner");
-                bw.appendLine(R"(do      The same as "d" except replies should be suppressed ("data-only"))");
-                bw.appendLine("q       Disconnects");
+    case '?':
+    case 'h':
+        if (os != nullptr) {
+            BufferedConnectionWriter bw(true);
+            bw.appendLine("This is a YARP port.  Here are the commands it responds to:");
+            bw.appendLine("*       Gives a description of this port");
+            bw.appendLine("d       Signals the beginning of input for the port's owner");
+            bw.appendLine(R"(do      The same as "d" except replies should be suppressed ("data-only"))");
+            bw.appendLine("q       Disconnects");
 #if !defined(NDEBUG)
-                bw.appendLine("i       Interrupt parent process (unix only)");
+            bw.appendLine("i       Interrupt parent process (unix only)");
 #endif
-                bw.appendLine("r       Reverse connection type to be a reader");
-                bw.appendLine("/port   Requests to send output to /port");
-                bw.appendLine("!/port  Requests to stop sending output to /port");
-                bw.appendLine("~/port  Requests to stop receiving input from /port");
-                bw.appendLine("a       Signals the beginning of an administrative message");
-                bw.appendLine("?       Gives this help");
-                bw.write(*os);
-            }
-            break;
-        default:
-            if (os != nullptr) {
-                BufferedConnectionWriter bw(true);
-                bw.appendLine("Port command not understood.");
-                bw.appendLine("Type d to send data to the port's owner.");
-                bw.appendLine("Type ? for help.");
-                bw.write(*os);
-            }
-            break;
+            bw.appendLine("r       Reverse connection type to be a reader");
+            bw.appendLine("/port   Requests to send output to /port");
+            bw.appendLine("!/port  Requests to stop sending output to /port");
+            bw.appendLine("~/port  Requests to stop receiving input from /port");
+            bw.appendLine("a       Signals the beginning of an administrative message");
+            bw.appendLine("?       Gives this help");
+            bw.write(*os);
         }
-        if (ip != nullptr) {
-            ip->endRead();
-        }
-        if (ip == nullptr) {
-            break;
-        }
-        if (closing || isDoomed() || (!ip->isOk())) {
-            break;
+        break;
+    default:
+        if (os != nullptr) {
+            BufferedConnectionWriter bw(true);
+            bw.appendLine("Port command not understood.");
+            bw.appendLine("Type d to send data to the port's owner.");
+            bw.appendLine("Type ? for help.");
+            bw.write(*os);
         }
+        break;
     }
+    if (ip != nullptr) {
+        ip->endRead();
+    }
+    if (ip == nullptr) {
+        return false;
+    }
+    if (closing || isDoomed() || (!ip->isOk())) {
+        return false;
+    }
+    return !done;
+}
+
+
+void PortCoreInputUnit::runEpilogue()
+{
+    Route route = officialRoute;
 
     setDoomed();
 
@@ -438,6 +528,67 @@ void PortCoreInputUnit::run()
     // thread within and from themselves
 }
 
+
+void PortCoreInputUnit::startServing()
+{
+    PortCoreReactor& reactor = PortCoreReactor::getInstance();
+
+    access.wait();
+    if (ip != nullptr && !closing) {
+        int handle = ip->getInputStream().getPollHandle();
+        if (handle >= 0) {
+            // Keep access locked until the watch is stored, since serve()
+            // may be called as soon as it is created.
+            watch = reactor.watch(handle, [this]() { serve(); });
+        }
+    }
+    bool watched = (watch != nullptr);
+    bool alive = (ip != nullptr && !closing && ip->isOk());
+    access.post();
+
+    if (watched) {
+        yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] served by the reactor", officialRoute.toString().c_str());
+        return;
+    }
+
+    if (alive) {
+        // The stream cannot be polled (or the carrier buffers data
+        // internally), therefore this connection needs its own thread.
+        yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] cannot be polled, starting a thread", officialRoute.toString().c_str());
+        if (PortCoreUnit::start()) {
+            // From now on closeMain() can just join the thread
+            stopped.post();
+            return;
+        }
+    }
+
+    runEpilogue();
+    stopped.post();
+}
+
+
+void PortCoreInputUnit::serve()
+{
+    PortCoreReactor& reactor = PortCoreReactor::getInstance();
+
+    access.wait();
+    PortCoreReactor::WatchPtr w = watch;
+    access.post();
+
+    if (runStep() && reactor.rearm(w)) {
+        return;
+    }
+
+    access.wait();
+    watch = nullptr;
+    access.post();
+    reactor.unwatch(w);
+
+    runEpilogue();
+    stopped.post();
+}
+
+
 bool PortCoreInputUnit::isInput()
 {
     return true;
@@ -500,7 +651,21 @@ void PortCoreInputUnit::closeMain()
 
     yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] closing", r.toString().c_str());
 
-    if (running) {
+    if (reactive) {
+        yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] waiting for the reactor", r.toString().c_str());
+        interrupt();
+        access.wait();
+        PortCoreReactor::WatchPtr w = watch;
+        access.post();
+        if (w != nullptr) {
+            PortCoreReactor::getInstance().wake(w);
+        }
+        stopped.wait();
+        reactive = false;
+        // The connection might have been moved to a thread
+        join();
+        yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] stopped", r.toString().c_str());
+    } else if (running) {
         yCIDebug(PORTCOREINPUTUNIT, getName(), "[%s] joining", r.toString().c_str());
         interrupt();
         join();
@@ -523,6 +688,85 @@ Route PortCoreInputUnit::getRoute()
 }
 
 
+void PortCoreInputUnit::readData(ConnectionReader& reader, void* id, OutputStream* os)
+{
+    PortCore& man = getOwner();
+    if (ip->getReceiver().acceptIncomingData(reader)) {
+        ConnectionReader* cr = &(ip->getReceiver().modifyIncomingData(reader));
+        yarp::os::impl::PortDataModifier& modifier = getOwner().getPortModifier();
+        modifier.inputMutex.lock();
+        if (modifier.inputModifier != nullptr) {
+            if (modifier.inputModifier->acceptIncomingData(*cr)) {
+                cr = &(modifier.inputModifier->modifyIncomingData(*cr));
+                modifier.inputMutex.unlock();
+                man.readBlock(*cr, id, os);
+            } else {
+                modifier.inputMutex.unlock();
+                skipIncomingData(*cr);
+            }
+        } else {
+            modifier.inputMutex.unlock();
+            man.readBlock(*cr, id, os);
+        }
+    } else {
+        skipIncomingData(reader);
+    }
+}
+
+
+bool PortCoreInputUnit::readBatch(ConnectionReader& reader, void* id, OutputStream* os)
+{
+    PortCore& man = getOwner();
+    std::int32_t count = reader.expectInt32();
+    std::string envelope;
+    BatchMessageInputStream in(reader);
+    StreamConnectionReader message;
+    for (std::int32_t i = 0; i < count; i++) {
+        // The lengths are checked against the data left in the batch before
+        // allocating anything
+        std::int32_t envelopeLength = reader.expectInt32();
+        if (reader.isError() || envelopeLength < 0 || static_cast<size_t>(envelopeLength) > reader.getSize()) {
+            return false;
+        }
+        envelope.resize(static_cast<size_t>(envelopeLength));
+        if (!reader.expectBlock(envelope.data(), envelope.length())) {
+            return false;
+        }
+        std::int32_t length = reader.expectInt32();
+        if (reader.isError() || length < 0 || static_cast<size_t>(length) > reader.getSize()) {
+            return false;
+        }
+
+        if (!envelope.empty()) {
+            man.setEnvelope(envelope);
+            ip->setEnvelope(envelope);
+        }
+
+        // Each message is read on its own, as if it was sent alone, directly
+        // from the connection
+        in.reset(static_cast<size_t>(length));
+        message.reset(in, nullptr, officialRoute, static_cast<size_t>(length), false);
+        message.setParentConnectionReader(&reader);
+        if (localReader != nullptr) {
+            localReader->read(message);
+        } else {
+            readData(message, id, os);
+        }
+
+        // Skip what the reader left of the message
+        while (in.getRemaining() > 0) {
+            char buf[10000];
+            size_t next = (in.getRemaining() < sizeof(buf)) ? in.getRemaining() : sizeof(buf);
+            Bytes b(buf, next);
+            if (in.read(b) < 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
 bool PortCoreInputUnit::skipIncomingData(yarp::os::ConnectionReader& reader)
 {
     size_t pending = reader.getSize();
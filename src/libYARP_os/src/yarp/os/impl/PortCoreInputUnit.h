@@ -10,6 +10,7 @@
 #include <yarp/os/InputProtocol.h>
 #include <yarp/os/Semaphore.h>
 #include <yarp/os/impl/PortCore.h>
+#include <yarp/os/impl/PortCoreReactor.h>
 #include <yarp/os/impl/PortCoreUnit.h>
 
 namespace yarp::os::impl {
@@ -87,9 +88,54 @@ private:
     yarp::os::PortReader* localReader;
     Route officialRoute;
     bool reversed;
+    bool reactive;   ///< served by the PortCoreReactor instead of a thread
+    bool wasNoticed; ///< the new connection was reported
+    bool posted;     ///< the new connection was logged
+    PortCoreReactor::WatchPtr watch;
+    yarp::os::Semaphore stopped; ///< posted when a reactive unit is done
 
     void closeMain();
 
+    /**
+     * Perform the handshake and report the new connection.
+     */
+    void runPrologue();
+
+    /**
+     * Read and process a single message.
+     *
+     * @return true if the connection should keep being served.
+     */
+    bool runStep();
+
+    /**
+     * Close the connection and report it.
+     */
+    void runEpilogue();
+
+    /**
+     * After the handshake, register the connection to the reactor, or
+     * start a thread for it if it cannot be polled.
+     */
+    void startServing();
+
+    /**
+     * Called by the reactor when some data is available.
+     */
+    void serve();
+
+    /**
+     * Pass a message to the port's owner.
+     */
+    void readData(yarp::os::ConnectionReader& reader, void* id, yarp::os::OutputStream* os);
+
+    /**
+     * Unpack a batch of messages, and pass each one to the port's owner.
+     *
+     * @return false if the batch could not be read.
+     */
+    bool readBatch(yarp::os::ConnectionReader& reader, void* id, yarp::os::OutputStream* os);
+
     bool skipIncomingData(yarp::os::ConnectionReader& reader);
 
     static void envelopeReadCallback(void* data, const Bytes& envelope);
@@ -7,6 +7,7 @@
 #include <yarp/os/impl/PortCoreOutputUnit.h>
 
 #include <yarp/os/Name.h>
+#include <yarp/os/NetInt32.h>
 #include <yarp/os/PortInfo.h>
 #include <yarp/os/PortReport.h>
 #include <yarp/os/Portable.h>
@@ -14,6 +15,8 @@
 #include <yarp/os/impl/BufferedConnectionWriter.h>
 #include <yarp/os/impl/LogComponent.h>
 #include <yarp/os/impl/PortCommand.h>
+#include <yarp/os/impl/PortCoreReactor.h>
+#include <yarp/os/impl/PortCoreTracer.h>
 
 namespace {
 YARP_OS_LOG_COMPONENT(PORTCOREOUTPUTUNIT, "yarp.os.impl.PortCoreOutputUnit")
@@ -37,7 +40,14 @@ PortCoreOutputUnit::PortCoreOutputUnit(PortCore& owner, int index, OutputProtoco
         cachedWriter(nullptr),
         cachedReader(nullptr),
         cachedCallback(nullptr),
-        cachedTracker(nullptr)
+        cachedTracker(nullptr),
+        cachedTraceTime(0),
+        reactive(false),
+        idle(1),
+        batchSize(0),
+        batchDelay(0.0),
+        batchCount(0),
+        batchStart(0.0)
 {
     yCIAssert(PORTCOREOUTPUTUNIT, getName(), op != nullptr);
 }
@@ -87,25 +97,18 @@ void PortCoreOutputUnit::run()
         Route r = getRoute();
         while (!closing) {
             yCIDebug(PORTCOREOUTPUTUNIT, getName(), "waiting");
-            activate.wait();
-            yCIDebug(PORTCOREOUTPUTUNIT, getName(), "woken");
-            if (!closing) {
-                if (sending) {
-                    yCIDebug(PORTCOREOUTPUTUNIT, getName(), "write something in background");
-                    sendHelper();
-                    yCIDebug(PORTCOREOUTPUTUNIT, getName(), "wrote something in background");
-                    trackerMutex.lock();
-                    if (cachedTracker != nullptr) {
-                        void* t = cachedTracker;
-                        cachedTracker = nullptr;
-                        sending = false;
-                        getOwner().notifyCompletion(t);
-                    } else {
-                        sending = false;
-                    }
-                    trackerMutex.unlock();
+            if (batchCount > 0) {
+                // wake up in time to send the batch
+                double timeout = batchStart + batchDelay - yarp::os::Time::now();
+                if (timeout <= 0 || !activate.waitWithTimeout(timeout)) {
+                    flushBatchInBackground();
+                    continue;
                 }
+            } else {
+                activate.wait();
             }
+            yCIDebug(PORTCOREOUTPUTUNIT, getName(), "woken");
+            sendInBackground();
             yCIDebug(PORTCOREOUTPUTUNIT, getName(), "wrote something in background");
         }
         yCIDebug(PORTCOREOUTPUTUNIT, getName(), "thread closing");
@@ -114,6 +117,79 @@ void PortCoreOutputUnit::run()
 }
 
 
+void PortCoreOutputUnit::appendToBatch(const BufferedConnectionWriter& buf)
+{
+    auto appendLength = [this](size_t length) {
+        NetInt32 n = static_cast<NetInt32>(length);
+        batchData.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    };
+    std::string payload = buf.toString();
+    appendLength(cachedEnvelope.length());
+    batchData += cachedEnvelope;
+    appendLength(payload.length());
+    batchData += payload;
+    if (batchCount == 0) {
+        batchStart = yarp::os::Time::now();
+    }
+    batchCount++;
+}
+
+
+bool PortCoreOutputUnit::writeBatch()
+{
+    if (batchCount == 0) {
+        return true;
+    }
+    // 'b' <count> (<envelope length> <envelope> <length> <message>)*
+    BufferedConnectionWriter buf(false, false);
+    buf.appendInt32(batchCount);
+    buf.appendExternalBlock(batchData.data(), batchData.length());
+    buf.addToHeader();
+    PortCommand pc('b', "");
+    pc.write(buf);
+    if (op->getConnection().isActive()) {
+        op->write(buf);
+    }
+    batchData.clear();
+    batchCount = 0;
+    return op->isOk();
+}
+
+
+void PortCoreOutputUnit::flushBatchInBackground()
+{
+    std::lock_guard<std::mutex> lock(batchMutex);
+    if (!closing && op != nullptr && !writeBatch()) {
+        closeBasic();
+        closing = true;
+        finished = true;
+        setDoomed();
+    }
+}
+
+
+void PortCoreOutputUnit::sendInBackground()
+{
+    if (!closing) {
+        if (sending) {
+            yCIDebug(PORTCOREOUTPUTUNIT, getName(), "write something in background");
+            sendHelper(batchSize > 1);
+            yCIDebug(PORTCOREOUTPUTUNIT, getName(), "wrote something in background");
+            trackerMutex.lock();
+            if (cachedTracker != nullptr) {
+                void* t = cachedTracker;
+                cachedTracker = nullptr;
+                sending = false;
+                getOwner().notifyCompletion(t);
+            } else {
+                sending = false;
+            }
+            trackerMutex.unlock();
+        }
+    }
+}
+
+
 void PortCoreOutputUnit::runSingleThreaded()
 {
     if (op != nullptr) {
@@ -211,11 +287,27 @@ void PortCoreOutputUnit::closeBasic()
 void PortCoreOutputUnit::closeMain()
 {
     if (finished) {
+        if (reactive) {
+            // the background send that found the connection broken might
+            // still be running
+            idle.wait();
+            idle.post();
+            reactive = false;
+        }
         return;
     }
 
     yCIDebug(PORTCOREOUTPUTUNIT, getName(), "closing");
 
+    if (running && batchCount > 0 && batchMutex.try_lock()) {
+        // do not lose the messages still waiting in the batch, unless a
+        // write is blocked
+        if (op != nullptr) {
+            writeBatch();
+        }
+        batchMutex.unlock();
+    }
+
     if (running) {
         // give a kick (unfortunately unavoidable)
 
@@ -224,9 +316,17 @@ void PortCoreOutputUnit::closeMain()
         }
 
         closing = true;
-        phase.post();
-        activate.post();
-        join();
+        if (reactive) {
+            // wait for the background send in progress, if any
+            idle.wait();
+            idle.post();
+            reactive = false;
+            sending = false;
+        } else {
+            phase.post();
+            activate.post();
+            join();
+        }
     }
 
     yCIDebug(PORTCOREOUTPUTUNIT, getName(), "internal join");
@@ -250,8 +350,9 @@ Route PortCoreOutputUnit::getRoute()
     return PortCoreUnit::getRoute();
 }
 
-bool PortCoreOutputUnit::sendHelper()
+bool PortCoreOutputUnit::sendHelper(bool batchable)
 {
+    std::lock_guard<std::mutex> lock(batchMutex);
     bool replied = false;
     if (op != nullptr) {
         bool done = false;
@@ -269,6 +370,12 @@ bool PortCoreOutputUnit::sendHelper()
             }
         }
 
+        PortCoreTracer::Stamps trace;
+        if (cachedTraceTime != 0) {
+            trace.write = cachedTraceTime;
+            trace.send = PortCoreTracer::now();
+        }
+
         if (op->getConnection().isLocal()) {
             // WARNING Cast away const qualifier.
             //         This may actually cause bugs when using the local carrier
@@ -287,9 +394,31 @@ bool PortCoreOutputUnit::sendHelper()
             if (!ok) {
                 done = true;
             }
+            if (trace.write != 0) {
+                trace.serialized = PortCoreTracer::now();
+            }
 
             bool suppressReply = (buf.getReplyHandler() == nullptr);
 
+            // Only data messages that do not expect a reply can wait
+            batchable = batchable && suppressReply && cachedEnvelope != "__ADMIN" &&
+                        op->getConnection().canEscape() &&
+                        !op->getConnection().isTextMode() &&
+                        !op->getConnection().isBareMode();
+            if (!done && batchable) {
+                appendToBatch(buf);
+                if (batchCount >= batchSize || yarp::os::Time::now() - batchStart >= batchDelay) {
+                    done = !writeBatch();
+                }
+                if (done) {
+                    closeBasic();
+                    closing = true;
+                    finished = true;
+                    setDoomed();
+                }
+                return false;
+            }
+
             if (!done) {
                 if (!op->getConnection().canEscape()) {
                     if (!cachedEnvelope.empty()) {
@@ -298,6 +427,17 @@ bool PortCoreOutputUnit::sendHelper()
                 } else {
                     buf.addToHeader();
 
+                    // Traced messages are preceded by their timestamps
+                    if (trace.write != 0 && cachedEnvelope != "__ADMIN" &&
+                        !op->getConnection().isTextMode() &&
+                        !op->getConnection().isBareMode()) {
+                        PortCommand tc('t', "");
+                        tc.write(buf);
+                        buf.appendInt64(trace.write);
+                        buf.appendInt64(trace.send);
+                        buf.appendInt64(trace.serialized);
+                    }
+
                     if (!cachedEnvelope.empty()) {
                         if (cachedEnvelope == "__ADMIN") {
                             PortCommand pc('a', "");
@@ -314,6 +454,11 @@ bool PortCoreOutputUnit::sendHelper()
             }
         }
 
+        if (!done) {
+            // Keep the order of the messages
+            done = !writeBatch();
+        }
+
         if (!done) {
             if (op->getConnection().isActive()) {
                 replied = op->write(buf);
@@ -348,7 +493,8 @@ void* PortCoreOutputUnit::send(const yarp::os::PortWriter& writer,
                                const std::string& envelopeString,
                                bool waitAfter,
                                bool waitBefore,
-                               bool* gotReply)
+                               bool* gotReply,
+                               std::int64_t traceTime)
 {
     bool replied = false;
 
@@ -359,7 +505,12 @@ void* PortCoreOutputUnit::send(const yarp::os::PortWriter& writer,
     }
 
     if (!waitBefore || !waitAfter) {
-        if (!running) {
+        if (!running && PortCoreReactor::isEnabled() && batchSize <= 1) {
+            // background writes are performed by the reactor threads
+            reactive = true;
+            running = true;
+            yCIDebug(PORTCOREOUTPUTUNIT, getName(), "using the reactor for output");
+        } else if (!running) {
             // we must have a thread if we're going to be skipping waits
             threaded = true;
             yCIDebug(PORTCOREOUTPUTUNIT, getName(), "starting a thread for output");
@@ -376,6 +527,7 @@ void* PortCoreOutputUnit::send(const yarp::os::PortWriter& writer,
         cachedReader = reader;
         cachedCallback = callback;
         cachedEnvelope = envelopeString;
+        cachedTraceTime = traceTime;
 
         sending = true;
         if (waitAfter) {
@@ -386,7 +538,15 @@ void* PortCoreOutputUnit::send(const yarp::os::PortWriter& writer,
             void* nextTracker = tracker;
             tracker = cachedTracker;
             cachedTracker = nextTracker;
-            activate.post();
+            if (reactive) {
+                idle.wait();
+                PortCoreReactor::getInstance().post([this]() {
+                    sendInBackground();
+                    idle.post();
+                });
+            } else {
+                activate.post();
+            }
             trackerMutex.unlock();
         }
     } else {
@@ -435,6 +595,24 @@ void PortCoreOutputUnit::getCarrierParams(yarp::os::Property& params)
     }
 }
 
+bool PortCoreOutputUnit::setBatching(int maxMessages, double maxDelay)
+{
+    if (reactive && maxMessages > 1) {
+        // the reactor has no timer to send a pending batch
+        yCIWarning(PORTCOREOUTPUTUNIT, getName(), "batching is not supported when using the reactor");
+        return false;
+    }
+    batchSize = maxMessages;
+    batchDelay = maxDelay;
+    return true;
+}
+
+void PortCoreOutputUnit::getBatching(int& maxMessages, double& maxDelay)
+{
+    maxMessages = batchSize;
+    maxDelay = batchDelay;
+}
+
 OutputProtocol* PortCoreOutputUnit::getOutPutProtocol()
 {
     return op;
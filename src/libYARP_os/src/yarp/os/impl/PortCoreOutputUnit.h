@@ -12,10 +12,14 @@
 #include <yarp/os/impl/PortCore.h>
 #include <yarp/os/impl/PortCoreUnit.h>
 
+#include <cstdint>
 #include <mutex>
+#include <string>
 
 namespace yarp::os::impl {
 
+class BufferedConnectionWriter;
+
 /**
  * Manager for a single output from a port.  Associated
  * with a PortCore object.
@@ -89,7 +93,8 @@ public:
                const std::string& envelopeString,
                bool waitAfter,
                bool waitBefore,
-               bool* gotReply) override;
+               bool* gotReply,
+               std::int64_t traceTime) override;
 
     // documented in PortCoreUnit
     void* takeTracker() override;
@@ -103,6 +108,12 @@ public:
     // documented in PortCoreUnit
     void getCarrierParams(yarp::os::Property& params) override;
 
+    // documented in PortCoreUnit
+    bool setBatching(int maxMessages, double maxDelay) override;
+
+    // documented in PortCoreUnit
+    void getBatching(int& maxMessages, double& maxDelay) override;
+
     // return the protocol object
     OutputProtocol* getOutPutProtocol();
 
@@ -123,11 +134,45 @@ private:
                                           ///< completion events
     void *cachedTracker;        ///< memory tracker for current message
     std::string cachedEnvelope;      ///< some text to pass along with the message
+    std::int64_t cachedTraceTime;    ///< when the message was written, if traced
+    bool reactive;                   ///< background writes are performed by the PortCoreReactor
+    yarp::os::Semaphore idle;        ///< taken while the reactor is sending
+    int batchSize;                   ///< maximum number of messages in a batch
+    double batchDelay;               ///< maximum time a message waits in a batch
+    std::string batchData;           ///< messages waiting to be sent in a batch
+    int batchCount;                  ///< number of messages in batchData
+    double batchStart;               ///< when the first message entered the batch
+    std::mutex batchMutex;           ///< serialize the batch flush and the other writes
 
     /**
      * The core logic for sending a message.
+     *
+     * @param batchable true if the message can be delayed and sent
+     *        together with the following ones
+     */
+    bool sendHelper(bool batchable = false);
+
+    /**
+     * Add the message to the batch.
+     */
+    void appendToBatch(const BufferedConnectionWriter& buf);
+
+    /**
+     * Send the messages waiting in the batch, if any.
+     *
+     * @return false if the connection failed
+     */
+    bool writeBatch();
+
+    /**
+     * Send the batch when its delay expired.
+     */
+    void flushBatchInBackground();
+
+    /**
+     * Complete a send operation started by send() with waitAfter = false.
      */
-    bool sendHelper();
+    void sendInBackground();
 
     /**
      * Try to close the connection, but not very hard.
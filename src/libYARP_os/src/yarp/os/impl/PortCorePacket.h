@@ -21,6 +21,7 @@ class PortCorePacket
 public:
     PortCorePacket* prev_;                ///< this packet will be in a list of active packets
     PortCorePacket* next_;                ///< this packet will be in a list of active packets
+    const void* list_;                    ///< the list containing this packet
     const yarp::os::PortWriter* content;  ///< the object being sent
     const yarp::os::PortWriter* callback; ///< where to send event notifications
     int ct;                               ///< number of uses of the messagae
@@ -34,6 +35,7 @@ public:
     PortCorePacket() :
             prev_(nullptr),
             next_(nullptr),
+            list_(nullptr),
             content(nullptr),
             callback(nullptr),
             ct(0),
@@ -15,15 +15,24 @@ namespace {
 YARP_OS_LOG_COMPONENT(PORTCOREPACKETS, "yarp.os.impl.PortCorePackets")
 } // namespace
 
+PortCorePackets::PortCorePackets(size_t capacity) :
+        capacity(capacity),
+        allocated(0),
+        exhausted(0)
+{
+    for (size_t i = 0; i < capacity; ++i) {
+        inactive.push_back(new PortCorePacket());
+        allocated++;
+    }
+}
+
 PortCorePackets::~PortCorePackets()
 {
     while (!inactive.empty()) {
-        delete inactive.back();
-        inactive.pop_back();
+        delete inactive.pop_front();
     }
     while (!active.empty()) {
-        delete active.back();
-        active.pop_back();
+        delete active.pop_front();
     }
 }
 
@@ -32,6 +41,21 @@ size_t PortCorePackets::getCount()
     return active.size();
 }
 
+size_t PortCorePackets::getFree()
+{
+    return inactive.size();
+}
+
+size_t PortCorePackets::getAllocatedCount()
+{
+    return allocated;
+}
+
+size_t PortCorePackets::getExhaustedCount()
+{
+    return exhausted;
+}
+
 PortCorePacket* PortCorePackets::getFreePacket()
 {
     if (inactive.empty()) {
@@ -39,6 +63,10 @@ PortCorePacket* PortCorePackets::getFreePacket()
         obj = new PortCorePacket();
         yCAssert(PORTCOREPACKETS, obj != nullptr);
         inactive.push_back(obj);
+        allocated++;
+        if (allocated > capacity) {
+            exhausted++;
+        }
     }
     PortCorePacket* next = inactive.front();
     if (next == nullptr) {
@@ -60,8 +88,10 @@ void PortCorePackets::freePacket(PortCorePacket* packet, bool clear)
             packet->reset();
         }
         packet->completed = true;
-        active.remove(packet);
-        inactive.push_back(packet);
+        if (!inactive.contains(packet)) {
+            active.remove(packet);
+            inactive.push_back(packet);
+        }
     }
 }
 
@@ -7,25 +7,38 @@
 #ifndef YARP_OS_IMPL_PORTCOREPACKETS_H
 #define YARP_OS_IMPL_PORTCOREPACKETS_H
 
+#include <yarp/os/impl/PacketList.h>
 #include <yarp/os/impl/PortCorePacket.h>
 
 #include <yarp/os/Log.h>
 
-#include <list>
-
 namespace yarp::os::impl {
 
 /**
  * A collection of messages being transmitted over connections.
  * This tracks uses of the messages for memory management purposes.
  * We call messages "packets" for no particular reason.
+ *
+ * Packets are never deleted until the collection is destroyed, they are
+ * recycled instead, so no memory is allocated once enough packets exist
+ * for the messages in flight.
  */
 class PortCorePackets
 {
 private:
-    std::list<PortCorePacket*> inactive; // unused packets we may reuse
-    std::list<PortCorePacket*> active;   // a list of packets being sent
+    PacketList<PortCorePacket> inactive; // unused packets we may reuse
+    PacketList<PortCorePacket> active;   // a list of packets being sent
+    size_t capacity;                     // number of packets preallocated
+    size_t allocated;                    // number of packets created
+    size_t exhausted;                    // packets created beyond capacity
 public:
+    /**
+     * Constructor.
+     *
+     * @param capacity the number of packets to create in advance
+     */
+    explicit PortCorePackets(size_t capacity = 4);
+
     virtual ~PortCorePackets();
 
     /**
@@ -33,6 +46,22 @@ public:
      */
     size_t getCount();
 
+    /**
+     * @return the number of packets ready to be reused.
+     */
+    size_t getFree();
+
+    /**
+     * @return the total number of packets created.
+     */
+    size_t getAllocatedCount();
+
+    /**
+     * @return the number of times that no packet was available, and a
+     * new one had to be created beyond the initial capacity.
+     */
+    size_t getExhaustedCount();
+
     /**
      * Get a packet that we can prepare for sending.  If a previously sent
      * packet that is not being used is available, we take that.  Otherwise
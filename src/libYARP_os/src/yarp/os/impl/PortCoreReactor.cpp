@@ -0,0 +1,338 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/PortCoreReactor.h>
+
+#include <yarp/conf/environment.h>
+
+#include <yarp/os/impl/LogComponent.h>
+#include <yarp/os/impl/PlatformSignal.h>
+
+#include <algorithm>
+#include <thread>
+
+#if defined(__linux__)
+#    include <sys/epoll.h>
+#    include <sys/eventfd.h>
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+using namespace yarp::os::impl;
+
+namespace {
+YARP_OS_LOG_COMPONENT(PORTCOREREACTOR, "yarp.os.impl.PortCoreReactor")
+
+// Key used in the epoll set for the eventfd that signals new tasks
+constexpr uint64_t wakeupKey = 0;
+} // namespace
+
+
+class PortCoreReactor::Watch
+{
+public:
+    uint64_t key{0};
+    int handle{-1};
+    std::function<void()> handler;
+    std::mutex mutex;
+    bool armed{false};
+    bool closed{false};
+};
+
+
+bool PortCoreReactor::isEnabled()
+{
+#if defined(__linux__)
+    // Checked for every new connection, each connection keeps using the
+    // mode that was active when it was created.
+    return yarp::conf::environment::get_bool("YARP_PORT_REACTOR", false);
+#else
+    return false;
+#endif
+}
+
+
+PortCoreReactor& PortCoreReactor::getInstance()
+{
+    // The reactor is never destroyed: its threads might still be serving the
+    // connections of some port that was not closed before exiting.
+    static auto* instance = new PortCoreReactor;
+    return *instance;
+}
+
+
+#if defined(__linux__)
+
+PortCoreReactor::PortCoreReactor()
+{
+    m_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+    m_wakeup = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE);
+    if (m_epoll < 0 || m_wakeup < 0) {
+        yCError(PORTCOREREACTOR, "Cannot create the epoll set, the reactor will not work");
+        return;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = wakeupKey;
+    ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wakeup, &ev);
+
+    auto hw = static_cast<int>(std::thread::hardware_concurrency());
+    auto count = yarp::conf::environment::get_numeric<int>("YARP_PORT_REACTOR_THREADS", std::clamp(hw, 2, 8));
+    m_minThreads = static_cast<size_t>(std::max(count, 1));
+
+    yCDebug(PORTCOREREACTOR, "Starting reactor with %zu threads", m_minThreads);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < m_minThreads; ++i) {
+        spawn();
+    }
+}
+
+
+void PortCoreReactor::spawn()
+{
+    // Called with m_mutex locked
+    m_threads++;
+    m_idle++;
+    std::thread([this]() { run(); }).detach();
+}
+
+
+void PortCoreReactor::run()
+{
+    // just for now -- rather deal with broken pipes through normal procedures
+    yarp::os::impl::signal(SIGPIPE, SIG_IGN);
+
+    while (true) {
+        epoll_event ev{};
+        int n = ::epoll_wait(m_epoll, &ev, 1, -1);
+        if (n < 0 && errno != EINTR) {
+            yCError(PORTCOREREACTOR, "epoll_wait failed, reactor thread exiting");
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle--;
+            m_threads--;
+            return;
+        }
+        if (n <= 0) {
+            continue;
+        }
+
+        {
+            // The handler might block for a long time, make sure that there
+            // is always somebody waiting for the other connections.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle--;
+            if (m_idle == 0) {
+                spawn();
+            }
+        }
+
+        if (ev.data.u64 == wakeupKey) {
+            uint64_t value;
+            if (::read(m_wakeup, &value, sizeof(value)) == sizeof(value)) {
+                runNextTask();
+            }
+        } else {
+            dispatch(ev.data.u64);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_threads > m_minThreads && m_idle > 0) {
+            // Extra thread, no longer needed
+            m_threads--;
+            return;
+        }
+        m_idle++;
+    }
+}
+
+
+void PortCoreReactor::runNextTask()
+{
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty()) {
+            return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+    }
+    task();
+}
+
+
+void PortCoreReactor::dispatch(uint64_t key)
+{
+    WatchPtr w;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_watches.find(key);
+        if (it == m_watches.end()) {
+            return;
+        }
+        w = it->second;
+    }
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        if (!w->armed || w->closed) {
+            return;
+        }
+        w->armed = false;
+    }
+    w->handler();
+}
+
+
+void PortCoreReactor::post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    uint64_t one = 1;
+    [[maybe_unused]] auto r = ::write(m_wakeup, &one, sizeof(one));
+}
+
+
+PortCoreReactor::WatchPtr PortCoreReactor::watch(int handle, std::function<void()> handler)
+{
+    if (handle < 0 || m_epoll < 0) {
+        return nullptr;
+    }
+
+    auto w = std::make_shared<Watch>();
+    w->handle = ::fcntl(handle, F_DUPFD_CLOEXEC, 0);
+    if (w->handle < 0) {
+        return nullptr;
+    }
+    w->handler = std::move(handler);
+    w->armed = true;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        w->key = m_nextKey++;
+        m_watches[w->key] = w;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    ev.data.u64 = w->key;
+    if (::epoll_ctl(m_epoll, EPOLL_CTL_ADD, w->handle, &ev) != 0) {
+        yCWarning(PORTCOREREACTOR, "Cannot watch handle %d", handle);
+        unwatch(w);
+        return nullptr;
+    }
+    return w;
+}
+
+
+bool PortCoreReactor::rearm(const WatchPtr& w)
+{
+    std::lock_guard<std::mutex> lock(w->mutex);
+    if (w->closed) {
+        return false;
+    }
+    w->armed = true;
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    ev.data.u64 = w->key;
+    if (::epoll_ctl(m_epoll, EPOLL_CTL_MOD, w->handle, &ev) != 0) {
+        w->armed = false;
+        return false;
+    }
+    return true;
+}
+
+
+void PortCoreReactor::wake(const WatchPtr& w)
+{
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        if (!w->armed || w->closed) {
+            return;
+        }
+        w->armed = false;
+    }
+    post([w]() { w->handler(); });
+}
+
+
+void PortCoreReactor::unwatch(const WatchPtr& w)
+{
+    {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        if (w->closed) {
+            return;
+        }
+        w->closed = true;
+        w->armed = false;
+        ::epoll_ctl(m_epoll, EPOLL_CTL_DEL, w->handle, nullptr);
+        ::close(w->handle);
+        w->handle = -1;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_watches.erase(w->key);
+}
+
+#else // !__linux__
+
+PortCoreReactor::PortCoreReactor() = default;
+
+void PortCoreReactor::spawn()
+{
+}
+
+void PortCoreReactor::run()
+{
+}
+
+void PortCoreReactor::runNextTask()
+{
+}
+
+void PortCoreReactor::dispatch(uint64_t key)
+{
+    YARP_UNUSED(key);
+}
+
+void PortCoreReactor::post(std::function<void()> task)
+{
+    // Never used when the reactor is disabled
+    task();
+}
+
+PortCoreReactor::WatchPtr PortCoreReactor::watch(int handle, std::function<void()> handler)
+{
+    YARP_UNUSED(handle);
+    YARP_UNUSED(handler);
+    return nullptr;
+}
+
+bool PortCoreReactor::rearm(const WatchPtr& w)
+{
+    YARP_UNUSED(w);
+    return false;
+}
+
+void PortCoreReactor::wake(const WatchPtr& w)
+{
+    YARP_UNUSED(w);
+}
+
+void PortCoreReactor::unwatch(const WatchPtr& w)
+{
+    YARP_UNUSED(w);
+}
+
+#endif // __linux__
+
+
+size_t PortCoreReactor::getThreadCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_threads;
+}
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_PORTCOREREACTOR_H
+#define YARP_OS_IMPL_PORTCOREREACTOR_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace yarp::os::impl {
+
+/**
+ * A small pool of I/O threads shared by all the ports of a process.
+ *
+ * When the reactor is enabled (by setting the `YARP_PORT_REACTOR`
+ * environment variable), connections that can be polled do not get a
+ * thread of their own.  They register a handler instead, that is called
+ * on one of the pool threads every time some data is available.  Outputs
+ * with background writes post their sends to the same pool.
+ *
+ * The number of threads is read from `YARP_PORT_REACTOR_THREADS` and
+ * defaults to the number of cores, clamped between 2 and 8.  Handlers are
+ * allowed to block (for example while a reader is waiting for the user to
+ * call Port::read()): when no thread is left waiting for events a new one
+ * is started, and it exits as soon as it becomes idle again.
+ *
+ * This is currently implemented only on Linux (using epoll). On other
+ * platforms isEnabled() always returns false.
+ */
+class PortCoreReactor
+{
+public:
+    class Watch;
+    using WatchPtr = std::shared_ptr<Watch>;
+
+    /**
+     * @return true if the ports should use the reactor.
+     */
+    static bool isEnabled();
+
+    /**
+     * @return the reactor of the process, starting it if needed.
+     */
+    static PortCoreReactor& getInstance();
+
+    /**
+     * Run a task on one of the pool threads.
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * Call a handler when a native handle becomes readable.
+     *
+     * The watch is one-shot: after the handler is called, rearm() must be
+     * called to be notified again.  The handle is duplicated internally,
+     * therefore the caller is free to close its own copy at any time.
+     *
+     * @param handle the native handle (a file descriptor)
+     * @param handler the function to call when the handle is readable
+     * @return the new watch, or nullptr if the handle cannot be watched
+     */
+    WatchPtr watch(int handle, std::function<void()> handler);
+
+    /**
+     * Wait again for the handle to become readable.
+     *
+     * @return false if the watch could not be armed.
+     */
+    bool rearm(const WatchPtr& w);
+
+    /**
+     * Call the handler as soon as possible, if it is waiting for data.
+     * This is meant to be used to shut down a connection: the handler
+     * is not supposed to read from the handle when it is woken up.
+     */
+    void wake(const WatchPtr& w);
+
+    /**
+     * Stop watching a handle.  The handler will not be called anymore.
+     */
+    void unwatch(const WatchPtr& w);
+
+    /**
+     * @return the number of threads in the pool.
+     */
+    size_t getThreadCount() const;
+
+private:
+    PortCoreReactor();
+    PortCoreReactor(const PortCoreReactor&) = delete;
+    PortCoreReactor& operator=(const PortCoreReactor&) = delete;
+
+    void spawn();
+    void run();
+    void dispatch(uint64_t key);
+    void runNextTask();
+
+    int m_epoll{-1};
+    int m_wakeup{-1};
+    mutable std::mutex m_mutex;
+    std::deque<std::function<void()>> m_tasks;
+    std::unordered_map<uint64_t, WatchPtr> m_watches;
+    uint64_t m_nextKey{1};
+    size_t m_minThreads{0};
+    size_t m_threads{0};
+    size_t m_idle{0};
+};
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_PORTCOREREACTOR_H
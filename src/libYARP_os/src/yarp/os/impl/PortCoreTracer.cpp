@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/PortCoreTracer.h>
+
+#include <yarp/conf/environment.h>
+
+#include <yarp/os/impl/PlatformUnistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+
+using namespace yarp::os;
+using namespace yarp::os::impl;
+
+namespace {
+
+const char* const hopNames[] = {"queue", "serialize", "transport", "read", "total"};
+
+void appendEvent(std::string& json, bool& first, const char* name, int tid, std::int64_t begin, std::int64_t end)
+{
+    if (begin == 0 || end == 0 || end < begin) {
+        return;
+    }
+    char buf[160];
+    std::snprintf(buf,
+                  sizeof(buf),
+                  R"(%s{"name":"%s","ph":"X","pid":%d,"tid":%d,"ts":%.3f,"dur":%.3f})",
+                  first ? "\n" : ",\n",
+                  name,
+                  static_cast<int>(yarp::os::impl::getpid()),
+                  tid,
+                  static_cast<double>(begin) / 1000.0,
+                  static_cast<double>(end - begin) / 1000.0);
+    json += buf;
+    first = false;
+}
+
+void appendMetadata(std::string& json, bool& first, const char* type, int tid, const std::string& name)
+{
+    std::string escaped;
+    for (char c : name) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            escaped += c;
+        }
+    }
+    char buf[64];
+    std::snprintf(buf,
+                  sizeof(buf),
+                  R"(%s{"name":"%s","ph":"M","pid":%d,"tid":%d,)",
+                  first ? "\n" : ",\n",
+                  type,
+                  static_cast<int>(yarp::os::impl::getpid()),
+                  tid);
+    json += buf;
+    json += R"("args":{"name":")" + escaped + "\"}}";
+    first = false;
+}
+
+} // namespace
+
+
+std::int64_t PortCoreTracer::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+bool PortCoreTracer::isEnabled()
+{
+    return yarp::conf::environment::get_bool("YARP_PORT_TRACING", false);
+}
+
+
+void PortCoreTracer::Histogram::add(std::int64_t ns)
+{
+    ns = std::max<std::int64_t>(ns, 0);
+    auto us = static_cast<std::uint64_t>(ns / 1000);
+    size_t bucket = std::min<size_t>(std::bit_width(us), buckets - 1);
+    counts[bucket]++;
+    if (count == 0 || ns < min) {
+        min = ns;
+    }
+    if (count == 0 || ns > max) {
+        max = ns;
+    }
+    count++;
+    sum += static_cast<double>(ns);
+}
+
+
+double PortCoreTracer::Histogram::percentile(double p) const
+{
+    if (count == 0) {
+        return 0.0;
+    }
+    // The upper bound of the bucket that contains the percentile
+    auto rank = static_cast<std::uint64_t>(p * static_cast<double>(count - 1));
+    std::uint64_t seen = 0;
+    size_t bucket = 0;
+    for (; bucket < buckets - 1; bucket++) {
+        seen += counts[bucket];
+        if (seen > rank) {
+            break;
+        }
+    }
+    double bound = static_cast<double>(std::uint64_t{1} << bucket);
+    return std::clamp(bound, static_cast<double>(min) / 1000.0, static_cast<double>(max) / 1000.0);
+}
+
+
+void PortCoreTracer::Histogram::write(Bottle& b) const
+{
+    Bottle& mean = b.addList();
+    mean.addString("mean");
+    mean.addFloat64(count > 0 ? sum / static_cast<double>(count) / 1000.0 : 0.0);
+    Bottle& bmin = b.addList();
+    bmin.addString("min");
+    bmin.addFloat64(static_cast<double>(min) / 1000.0);
+    for (auto [name, p] : {std::pair{"p50", 0.5}, std::pair{"p90", 0.9}, std::pair{"p99", 0.99}}) {
+        Bottle& bp = b.addList();
+        bp.addString(name);
+        bp.addFloat64(percentile(p));
+    }
+    Bottle& bmax = b.addList();
+    bmax.addString("max");
+    bmax.addFloat64(static_cast<double>(max) / 1000.0);
+    // Bucket i counts the delays below 2^i us, and above the previous one
+    Bottle& histogram = b.addList();
+    histogram.addString("histogram");
+    Bottle& values = histogram.addList();
+    for (auto c : counts) {
+        values.addInt64(static_cast<std::int64_t>(c));
+    }
+}
+
+
+void PortCoreTracer::record(const std::string& from, const Stamps& stamps)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Connection& connection = connections[from];
+    auto& hops = connection.hops;
+    hops[Queue].add(stamps.send - stamps.write);
+    hops[Serialize].add(stamps.serialized - stamps.send);
+    hops[Transport].add(stamps.received - stamps.serialized);
+    hops[Read].add(stamps.delivered - stamps.received);
+    hops[Total].add(stamps.delivered - stamps.write);
+    if (connection.recent.size() < recentCount) {
+        connection.recent.push_back(stamps);
+    } else {
+        connection.recent[connection.messages % recentCount] = stamps;
+    }
+    connection.messages++;
+}
+
+
+void PortCoreTracer::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    connections.clear();
+}
+
+
+Bottle PortCoreTracer::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Bottle result;
+    for (const auto& [from, connection] : connections) {
+        Bottle& c = result.addList();
+        Bottle& bfrom = c.addList();
+        bfrom.addString("from");
+        bfrom.addString(from);
+        Bottle& bmessages = c.addList();
+        bmessages.addString("messages");
+        bmessages.addInt64(static_cast<std::int64_t>(connection.messages));
+        for (size_t i = 0; i < HopCount; i++) {
+            Bottle& hop = c.addList();
+            hop.addString(hopNames[i]);
+            connection.hops[i].write(hop.addList());
+        }
+    }
+    return result;
+}
+
+
+std::string PortCoreTracer::getChromeTrace(const std::string& portName) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string json = R"({"displayTimeUnit":"ns","traceEvents":[)";
+    bool first = true;
+    appendMetadata(json, first, "process_name", 0, portName);
+    int tid = 0;
+    for (const auto& [from, connection] : connections) {
+        tid++;
+        appendMetadata(json, first, "thread_name", tid, from + " -> " + portName);
+        const auto& recent = connection.recent;
+        // Oldest message first
+        size_t start = (recent.size() < recentCount) ? 0 : connection.messages % recentCount;
+        for (size_t i = 0; i < recent.size(); i++) {
+            const Stamps& s = recent[(start + i) % recent.size()];
+            appendEvent(json, first, hopNames[Queue], tid, s.write, s.send);
+            appendEvent(json, first, hopNames[Serialize], tid, s.send, s.serialized);
+            appendEvent(json, first, hopNames[Transport], tid, s.serialized, s.received);
+            appendEvent(json, first, hopNames[Read], tid, s.received, s.delivered);
+        }
+    }
+    json += "\n]}\n";
+    return json;
+}
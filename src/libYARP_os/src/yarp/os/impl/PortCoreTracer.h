@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_OS_IMPL_PORTCORETRACER_H
+#define YARP_OS_IMPL_PORTCORETRACER_H
+
+#include <yarp/os/Bottle.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace yarp::os::impl {
+
+/**
+ * Latency tracing of the messages received by a port.
+ *
+ * When tracing is enabled on the sending port (by setting the
+ * `YARP_PORT_TRACING` environment variable, or with the `[trac] [on]`
+ * administrative command), each message is preceded on the wire by a 't'
+ * port command, carrying the times at which the message was written by the
+ * user, picked up by the connection and serialized.  The receiving port
+ * adds the times at which the message was received and delivered to its
+ * reader, and collects the delays of each hop in a histogram for each
+ * input connection.
+ *
+ * The times are read from a monotonic clock (std::chrono::steady_clock),
+ * therefore the transport hop is meaningful only when the two ports are on
+ * the same host.
+ */
+class PortCoreTracer
+{
+public:
+    /**
+     * The times of a message [ns], 0 when unknown.
+     */
+    struct Stamps
+    {
+        std::int64_t write{0};      ///< the user wrote the message
+        std::int64_t send{0};       ///< the connection started sending it
+        std::int64_t serialized{0}; ///< the message was serialized
+        std::int64_t received{0};   ///< the message reached the input
+        std::int64_t delivered{0};  ///< the reader returned
+    };
+
+    /**
+     * @return the current time of the monotonic clock [ns].
+     */
+    static std::int64_t now();
+
+    /**
+     * @return true if the ports should trace their output by default.
+     */
+    static bool isEnabled();
+
+    /**
+     * Add a message received from a port.
+     */
+    void record(const std::string& from, const Stamps& stamps);
+
+    /**
+     * Forget all the messages recorded.
+     */
+    void clear();
+
+    /**
+     * The statistics of each connection, in microseconds.
+     *
+     * Each connection is reported as
+     * `(from $port) (messages $n) ($hop ((mean $t) (min $t) (p50 $t) ...))...`
+     */
+    yarp::os::Bottle getStatistics() const;
+
+    /**
+     * The latest messages of each connection, in the Chrome trace event
+     * format, that can be loaded in Perfetto or in chrome://tracing.
+     *
+     * @param portName the name of the receiving port
+     */
+    std::string getChromeTrace(const std::string& portName) const;
+
+private:
+    // Histogram of the delays, with power of 2 buckets of 1 us to 16 s
+    class Histogram
+    {
+    public:
+        static constexpr size_t buckets = 26;
+
+        void add(std::int64_t ns);
+        double percentile(double p) const;
+        void write(yarp::os::Bottle& b) const;
+
+    private:
+        std::array<std::uint64_t, buckets> counts{};
+        std::uint64_t count{0};
+        double sum{0.0};
+        std::int64_t min{0};
+        std::int64_t max{0};
+    };
+
+    enum Hop
+    {
+        Queue,     // write -> send
+        Serialize, // send -> serialized
+        Transport, // serialized -> received
+        Read,      // received -> delivered
+        Total,     // write -> delivered
+        HopCount
+    };
+
+    static constexpr size_t recentCount = 256;
+
+    struct Connection
+    {
+        std::uint64_t messages{0};
+        std::array<Histogram, HopCount> hops;
+        std::vector<Stamps> recent; // ring buffer of the latest messages
+    };
+
+    mutable std::mutex mutex;
+    std::map<std::string, Connection> connections;
+};
+
+} // namespace yarp::os::impl
+
+#endif // YARP_OS_IMPL_PORTCORETRACER_H
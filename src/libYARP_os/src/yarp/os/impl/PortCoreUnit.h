@@ -11,6 +11,7 @@
 #include <yarp/os/impl/PortCore.h>
 #include <yarp/os/impl/ThreadImpl.h>
 
+#include <cstdint>
 #include <string>
 
 namespace yarp::os::impl {
@@ -115,6 +116,8 @@ public:
      * to complete before stating this one
      * @parm gotReply if non-nullptr, this variable will be set to true if
      * a reply was received
+     * @param traceTime if not 0, the time at which the message was
+     * written (see PortCoreTracer), to be sent along with the message
      *
      * @return nullptr, or a tracker for a previous send operation that
      * is no longer in progress. The tracker is an opaque pointer passed
@@ -129,7 +132,8 @@ public:
                        const std::string& envelope,
                        bool waitAfter = true,
                        bool waitBefore = true,
-                       bool* gotReply = nullptr)
+                       bool* gotReply = nullptr,
+                       std::int64_t traceTime = 0)
     {
         // do nothing
         YARP_UNUSED(writer);
@@ -139,6 +143,7 @@ public:
         YARP_UNUSED(waitAfter);
         YARP_UNUSED(waitBefore);
         YARP_UNUSED(gotReply);
+        YARP_UNUSED(traceTime);
         return tracker;
     }
 
@@ -266,6 +271,31 @@ public:
         YARP_UNUSED(params);
     }
 
+    /**
+     * Coalesce the messages sent in background on this connection.
+     *
+     * @param maxMessages the number of messages in a batch (0 or 1 to
+     *        disable batching)
+     * @param maxDelay the maximum time a message waits in a batch [s]
+     * @return true if the connection supports batching
+     */
+    virtual bool setBatching(int maxMessages, double maxDelay)
+    {
+        YARP_UNUSED(maxMessages);
+        YARP_UNUSED(maxDelay);
+        return false;
+    }
+
+    /**
+     * @param [out]maxMessages the number of messages in a batch
+     * @param [out]maxDelay the maximum time a message waits in a batch [s]
+     */
+    virtual void getBatching(int& maxMessages, double& maxDelay)
+    {
+        maxMessages = 0;
+        maxDelay = 0.0;
+    }
+
 
 protected:
     /**
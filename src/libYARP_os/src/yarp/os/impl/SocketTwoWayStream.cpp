@@ -13,6 +13,8 @@
 #include <yarp/os/impl/TcpConnector.h>
 #include <yarp/os/impl/TcpStream.h>
 
+#include <yarp/conf/environment.h>
+
 #ifdef YARP_HAS_ACE
 #    include <ace/INET_Addr.h>
 #    include <ace/os_include/netinet/os_tcp.h>
@@ -29,6 +31,20 @@ using namespace yarp::os::impl;
 
 YARP_OS_LOG_COMPONENT(SOCKETTWOWAYSTREAM, "yarp.os.impl.SocketTwoWayStream")
 
+namespace {
+// Writes up to this size are copied and sent together with the next block
+constexpr size_t small_write_size = 512;
+} // namespace
+
+SocketTwoWayStream::SocketTwoWayStream() :
+        haveWriteTimeout(false),
+        haveReadTimeout(false),
+        happy(false),
+        gather(yarp::conf::environment::get_bool("YARP_TCP_WRITEV", true)),
+        inPacket(false)
+{
+}
+
 int SocketTwoWayStream::open(const Contact& address)
 {
     if (address.getPort() == -1) {
@@ -155,3 +171,78 @@ int SocketTwoWayStream::getTypeOfService()
     stream.get_option(IPPROTO_IP, IP_TOS, &tos, &optlen);
     return tos;
 }
+
+void SocketTwoWayStream::write(const Bytes& b)
+{
+    if (!isOk()) {
+        return;
+    }
+    if (gather && inPacket && b.length() <= small_write_size) {
+        pending.insert(pending.end(), b.get(), b.get() + b.length());
+        return;
+    }
+    if (!pending.empty()) {
+        writev(&b, 1);
+        return;
+    }
+    sendBlock(b);
+}
+
+void SocketTwoWayStream::writev(const Bytes* blocks, size_t count)
+{
+    if (!isOk()) {
+        pending.clear();
+        return;
+    }
+    if (!gather) {
+        for (size_t i = 0; i < count; i++) {
+            sendBlock(blocks[i]);
+        }
+        return;
+    }
+
+    iov.clear();
+    iov.reserve(count + 1);
+    if (!pending.empty()) {
+        iov.push_back({pending.data(), pending.size()});
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (blocks[i].length() > 0) {
+            iov.push_back({const_cast<char*>(blocks[i].get()), blocks[i].length()});
+        }
+    }
+    pending.clear();
+    if (iov.empty()) {
+        return;
+    }
+
+    yarp::conf::ssize_t result;
+    if (haveWriteTimeout) {
+        result = stream.sendv_n(iov.data(), static_cast<int>(iov.size()), &writeTimeout);
+    } else {
+        result = stream.sendv_n(iov.data(), static_cast<int>(iov.size()));
+    }
+    if (result < 0) {
+        happy = false;
+        yCDebug(SOCKETTWOWAYSTREAM, "bad socket write");
+    }
+}
+
+void SocketTwoWayStream::sendBlock(const Bytes& b)
+{
+    yarp::conf::ssize_t result;
+    if (haveWriteTimeout) {
+        result = stream.send_n(b.get(), b.length(), &writeTimeout);
+    } else {
+        result = stream.send_n(b.get(), b.length());
+    }
+    if (result < 0) {
+        happy = false;
+        yCDebug(SOCKETTWOWAYSTREAM, "bad socket write");
+    }
+}
+
+void SocketTwoWayStream::sendPending()
+{
+    writev(nullptr, 0);
+}
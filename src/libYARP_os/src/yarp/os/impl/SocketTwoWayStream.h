@@ -16,6 +16,8 @@
 #include <yarp/os/impl/TcpAcceptor.h>
 #include <yarp/os/impl/TcpStream.h>
 
+#include <vector>
+
 #ifdef YARP_HAS_ACE // For TCP_CORK definition
 #    include <ace/os_include/netinet/os_tcp.h>
 // In one the ACE headers there is a definition of "main" for WIN32
@@ -39,12 +41,7 @@ class YARP_os_impl_API SocketTwoWayStream :
         public OutputStream
 {
 public:
-    SocketTwoWayStream() :
-            haveWriteTimeout(false),
-            haveReadTimeout(false),
-            happy(false)
-    {
-    }
+    SocketTwoWayStream();
 
     int open(const Contact& address);
 
@@ -93,6 +90,7 @@ public:
     {
         stream.close();
         happy = false;
+        pending.clear();
     }
 
     using yarp::os::InputStream::read;
@@ -101,6 +99,9 @@ public:
         if (!isOk()) {
             return -1;
         }
+        if (!pending.empty()) {
+            sendPending();
+        }
         yarp::conf::ssize_t result;
         if (haveReadTimeout) {
             result = stream.recv_n(b.get(), b.length(), &readTimeout);
@@ -122,6 +123,9 @@ public:
         if (!isOk()) {
             return -1;
         }
+        if (!pending.empty()) {
+            sendPending();
+        }
         yarp::conf::ssize_t result;
         if (haveReadTimeout) {
             result = stream.recv(b.get(), b.length(), &readTimeout);
@@ -139,25 +143,18 @@ public:
     }
 
     using yarp::os::OutputStream::write;
-    void write(const Bytes& b) override
-    {
-        if (!isOk()) {
-            return;
-        }
-        yarp::conf::ssize_t result;
-        if (haveWriteTimeout) {
-            result = stream.send_n(b.get(), b.length(), &writeTimeout);
-        } else {
-            result = stream.send_n(b.get(), b.length());
-        }
-        if (result < 0) {
-            happy = false;
-            yCDebug(SOCKETTWOWAYSTREAM, "bad socket write");
-        }
-    }
+    void write(const Bytes& b) override;
+
+    void writev(const Bytes* blocks, size_t count) override;
 
     void flush() override
     {
+        if (gather) {
+            if (!pending.empty()) {
+                sendPending();
+            }
+            return;
+        }
 #ifdef TCP_CORK
         int status = 0;
         int sizeInt = sizeof(int);
@@ -184,6 +181,12 @@ public:
 
     void beginPacket() override
     {
+        if (gather) {
+            // Small writes are kept until the next large write (usually the
+            // payload), or until the end of the packet.
+            inPacket = true;
+            return;
+        }
 #ifdef TCP_CORK
         // Set CORK
         int one = 1;
@@ -193,6 +196,13 @@ public:
 
     void endPacket() override
     {
+        if (gather) {
+            inPacket = false;
+            if (!pending.empty()) {
+                sendPending();
+            }
+            return;
+        }
 #ifdef TCP_CORK
         // Remove CORK
         int zero = 0;
@@ -222,6 +232,15 @@ public:
         return true;
     }
 
+    int getPollHandle() const override
+    {
+#if defined(_WIN32)
+        return -1;
+#else
+        return happy ? stream.get_handle() : -1;
+#endif
+    }
+
     bool setTypeOfService(int tos) override;
     int getTypeOfService() override;
 
@@ -233,7 +252,13 @@ private:
     YARP_timeval readTimeout;
     Contact localAddress, remoteAddress;
     bool happy;
+    bool gather;                     ///< send packets with a single writev
+    bool inPacket;                   ///< between beginPacket() and endPacket()
+    std::vector<char> pending;       ///< small writes not sent yet
+    std::vector<iovec> iov;          ///< blocks for the next sendv_n()
     void updateAddresses();
+    void sendBlock(const Bytes& b);
+    void sendPending();
 };
 
 } // namespace yarp::os::impl
@@ -10,7 +10,11 @@
 
 // General files
 #include <sys/socket.h>
+#include <algorithm>
+#include <climits>
+#include <cerrno>
 #include <cstdio>
+#include <vector>
 
 #include <yarp/os/impl/TcpStream.h>
 #include <yarp/os/impl/LogComponent.h>
@@ -39,6 +43,49 @@ int TcpStream::open()
     return 0;
 }
 
+ssize_t TcpStream::sendv_n(const iovec* iov, int iovcnt)
+{
+#if defined(IOV_MAX)
+    constexpr int maxIov = IOV_MAX;
+#else
+    constexpr int maxIov = 1024;
+#endif
+
+    // The array is copied only if a partial write forces to adjust it
+    std::vector<iovec> rest;
+    ssize_t total = 0;
+    while (iovcnt > 0) {
+        msghdr msg{};
+        msg.msg_iov = const_cast<iovec*>(iov);
+        msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(std::min(iovcnt, maxIov));
+        ssize_t n = ::sendmsg(sd, &msg, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        total += n;
+
+        // Skip what was sent
+        while (iovcnt > 0 && static_cast<size_t>(n) >= iov->iov_len) {
+            n -= static_cast<ssize_t>(iov->iov_len);
+            ++iov;
+            --iovcnt;
+        }
+        if (n > 0) {
+            if (rest.empty()) {
+                rest.assign(iov, iov + iovcnt);
+                iov = rest.data();
+            }
+            auto* first = const_cast<iovec*>(iov);
+            first->iov_base = static_cast<char*>(first->iov_base) + n;
+            first->iov_len -= static_cast<size_t>(n);
+        }
+    }
+    return total;
+}
+
 int TcpStream::get_local_addr(sockaddr & sa)
 {
     int len = sizeof(sa);
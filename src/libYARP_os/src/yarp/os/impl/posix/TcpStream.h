@@ -10,6 +10,7 @@
 // General files
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
@@ -73,6 +74,20 @@ public:
         return ::send(sd, buf, n, 0);
     }
 
+    /**
+     * Send several buffers with as few sendmsg() calls as possible.
+     * Unlike send_n, this keeps sending after a partial write.
+     *
+     * @return the number of bytes sent, or -1 on error
+     */
+    ssize_t sendv_n(const iovec* iov, int iovcnt);
+
+    inline ssize_t sendv_n(const iovec* iov, int iovcnt, struct timeval *tv)
+    {
+        setsockopt(sd, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<char *>(tv), sizeof (*tv));
+        return sendv_n(iov, iovcnt);
+    }
+
     // No idea what this should do...
     void flush() { }
 
@@ -105,7 +120,7 @@ public:
     int get_remote_addr(sockaddr&);
 
     // get stream descriptor
-    int get_handle() { return sd; }
+    int get_handle() const { return sd; }
 
     // set stream descriptor
     void set_handle(int h) { sd = h; }
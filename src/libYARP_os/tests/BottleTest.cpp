@@ -8,6 +8,8 @@
 #include <yarp/os/Bottle.h>
 
 #include <yarp/os/DummyConnector.h>
+#include <yarp/os/NetFloat64.h>
+#include <yarp/os/NetInt32.h>
 #include <yarp/os/Stamp.h>
 #include <yarp/os/Vocab32.h>
 #include <yarp/os/Vocab64.h>
@@ -603,4 +605,93 @@ TEST_CASE("os::BottleTest", "[yarp::os]")
 
 
     }
+
+    SECTION("test reuse and serialization of fixed size items")
+    {
+        Bottle bot;
+        Bottle bot2;
+        for (int round = 0; round < 3; round++) {
+            // refill the same bottle, more items than a block of the reader
+            bot.clear();
+            for (int i = 0; i < 100 + round; i++) {
+                bot.addFloat64(i * 0.5 + round);
+            }
+            size_t size = 0;
+            const char* bytes = bot.toBinary(&size);
+            CHECK(size == 2 * sizeof(NetInt32) + (100 + round) * sizeof(NetFloat64));
+            bot2.fromBinary(bytes, size);
+            REQUIRE(bot2.size() == bot.size());
+            CHECK(bot2.getSpecialization() == BOTTLE_TAG_FLOAT64);
+            CHECK(bot2.get(99).asFloat64() == 49.5 + round);
+            CHECK(bot.toString() == bot2.toString());
+
+            // popped items stay valid after the bottle is cleared
+            Value popped = bot.pop();
+            bot.clear();
+            CHECK(popped.asFloat64() == (99 + round) * 0.5 + round);
+
+            // specialized lists of each type, and unspecialized items
+            bot.addInt8(-8);
+            bot.addInt16(-16);
+            bot.addInt32(-32);
+            bot.addInt64(-64);
+            bot.addFloat32(0.5);
+            bot.addVocab32('a', 'b', 'c', 'd');
+            bot.addVocab64(yarp::os::createVocab64('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'));
+            bot.addString("foo");
+            Bottle& ints = bot.addList();
+            for (int i = 0; i < 70; i++) {
+                ints.addInt16(static_cast<std::int16_t>(i));
+            }
+            Bottle& vocabs = bot.addList();
+            vocabs.addVocab32('e', 'f', 'g', 'h');
+            vocabs.addVocab32('i', 'j', 'k', 'l');
+            bytes = bot.toBinary(&size);
+            bot2.fromBinary(bytes, size);
+            REQUIRE(bot2.size() == bot.size());
+            CHECK(bot2.get(0).isInt8());
+            CHECK(bot2.get(3).asInt64() == -64);
+            CHECK(bot2.get(4).isFloat32());
+            CHECK(bot2.get(6).asVocab64() == yarp::os::createVocab64('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'));
+            CHECK(bot2.get(8).asList()->getSpecialization() == BOTTLE_TAG_INT16);
+            CHECK(bot2.get(8).asList()->get(69).asInt16() == 69);
+            CHECK(bot2.get(9).asList()->get(1).asVocab32() == yarp::os::createVocab32('i', 'j', 'k', 'l'));
+            CHECK(bot.toString() == bot2.toString());
+        }
+    }
+
+    SECTION("test push and pop of arena items")
+    {
+        // the slot of the popped item is reused by the next one
+        Bottle bot;
+        bot.addInt32(1);
+        bot.addFloat64(2.5);
+        const Value* last = &bot.get(1);
+        for (int i = 0; i < 100; i++) {
+            CHECK(bot.pop().asFloat64() == 2.5 + i);
+            bot.addFloat64(3.5 + i);
+            CHECK(&bot.get(1) == last);
+        }
+        bot.addList().addInt32(4);
+        bot.addString("foo");
+        CHECK(bot.pop().asString() == "foo");
+        CHECK(bot.pop().isList());
+        CHECK(bot.pop().asFloat64() == 102.5);
+        bot.addInt8(5);
+        CHECK(&bot.get(1) == last);
+        CHECK(bot.toString() == "1 5");
+    }
+
+    SECTION("test invalid length of fixed size items")
+    {
+        Bottle bot;
+        for (std::int32_t len : {-1, 3, 0x7fffffff}) {
+            NetInt32 message[4] = {BOTTLE_TAG_LIST | BOTTLE_TAG_INT32, len, 1, 2};
+            bot.fromBinary(reinterpret_cast<const char*>(message), sizeof(message));
+            CHECK(bot.size() == 0);
+        }
+        NetInt32 message[4] = {BOTTLE_TAG_LIST | BOTTLE_TAG_INT32, 2, 1, 2};
+        bot.fromBinary(reinterpret_cast<const char*>(message), sizeof(message));
+        CHECK(bot.toString() == "1 2");
+    }
 }
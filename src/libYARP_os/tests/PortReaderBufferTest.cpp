@@ -10,6 +10,9 @@
 #include <yarp/os/Network.h>
 #include <yarp/os/Time.h>
 
+#include <atomic>
+#include <thread>
+
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
@@ -144,6 +147,113 @@ TEST_CASE("os::PortReaderBufferTest", "[yarp::os]")
         CHECK(in.count == 5); // got message #3
     }
 
+    SECTION("checking receive buffers")
+    {
+        Port out;
+        BufferedPort<Bottle> in;
+        Bottle buffers[2];
+        in.addReceiveBuffer(buffers[0]);
+        in.addReceiveBuffer(buffers[1]);
+        in.setStrict();
+        out.open("/out");
+        in.open("/in");
+        Network::connect("/out", "/in", "tcp");
+        Network::sync("/out");
+        Network::sync("/in");
+
+        for (int i = 0; i < 6; i++) {
+            Bottle data;
+            data.addInt32(i);
+            out.write(data);
+            Bottle* bot = in.read();
+            REQUIRE(bot != nullptr);
+            CHECK(bot == &buffers[i % 2]); // buffers are used in turn
+            CHECK(bot->get(0).asInt32() == i);
+        }
+
+        in.close();
+        out.close();
+        CHECK(buffers[1].get(0).asInt32() == 5); // buffers are not deleted
+    }
+
+    SECTION("checking receive buffers without strict mode")
+    {
+        Port out;
+        Port out2;
+        BufferedPort<Bottle> in;
+        Bottle buffers[2];
+        in.addReceiveBuffer(buffers[0]);
+        in.addReceiveBuffer(buffers[1]);
+        out.open("/out");
+        out2.open("/out2");
+        in.open("/in");
+        Network::connect("/out", "/in", "tcp");
+        Network::connect("/out2", "/in", "tcp");
+        Network::sync("/out");
+        Network::sync("/out2");
+        Network::sync("/in");
+
+        auto sendFrom = [](Port& port, int first, int count) {
+            for (int i = first; i < first + count; i++) {
+                Bottle data;
+                data.addInt32(i);
+                port.write(data);
+            }
+        };
+        auto send = [&](int first, int count) {
+            sendFrom(out, first, count);
+        };
+
+        // the reader holds a buffer, the pending message is replaced
+        send(0, 5);
+        Time::delay(0.2);
+        Bottle* bot = in.read();
+        REQUIRE(bot != nullptr);
+        CHECK(bot->get(0).asInt32() == 4);
+        void* key0 = in.acquire();
+        REQUIRE(key0 != nullptr);
+
+        // the reader holds all the buffers, the writer is not blocked
+        send(5, 1);
+        Time::delay(0.2);
+        bot = in.read();
+        REQUIRE(bot != nullptr);
+        CHECK(bot->get(0).asInt32() == 5);
+        void* key1 = in.acquire();
+        REQUIRE(key1 != nullptr);
+
+        // two connections drop their messages at the same time
+        std::atomic<int> sent{0};
+        std::thread writer([&]() {
+            send(6, 10);
+            sent++;
+        });
+        std::thread writer2([&]() {
+            sendFrom(out2, 100, 10);
+            sent++;
+        });
+        for (int i = 0; i < 50 && sent < 2; i++) {
+            Time::delay(0.1);
+        }
+        CHECK(sent == 2);
+        CHECK(in.getPendingReads() == 0); // messages dropped
+
+        in.release(key0);
+        in.release(key1);
+        writer.join();
+        writer2.join();
+
+        send(16, 1);
+        bot = in.read();
+        REQUIRE(bot != nullptr);
+        CHECK(bot->get(0).asInt32() == 16);
+        CHECK((bot == &buffers[0] || bot == &buffers[1]));
+
+        in.close();
+        out.close();
+        out2.close();
+    }
+
     SECTION("checking callback part without open")
     {
         {
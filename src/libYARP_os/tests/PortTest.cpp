@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <yarp/conf/environment.h>
+
 #include <yarp/os/Port.h>
 
 #include <yarp/os/Time.h>
@@ -24,6 +26,7 @@
 #include <yarp/os/RpcServer.h>
 #include <yarp/os/PortInfo.h>
 #include <yarp/os/Log.h>
+#include <yarp/os/Stamp.h>
 
 #include <yarp/dev/PolyDriver.h>
 #include <yarp/dev/Drivers.h>
@@ -34,6 +37,9 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include <vector>
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
@@ -474,6 +480,33 @@ public:
     }
 };
 
+// A PortReader that reads only the header of the bottles, leaving the items
+// unread
+class BottleHeaderReader :
+        public yarp::os::PortReader
+{
+public:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::int32_t> counts;
+
+    bool read(yarp::os::ConnectionReader& reader) override
+    {
+        reader.expectInt32(); // tag
+        std::int32_t count = reader.expectInt32();
+        std::lock_guard<std::mutex> lk(mtx);
+        counts.push_back(count);
+        cv.notify_all();
+        return true;
+    }
+
+    bool waitFor(size_t n)
+    {
+        std::unique_lock<std::mutex> lk(mtx);
+        return cv.wait_for(lk, std::chrono::seconds(10), [&]{ return counts.size() >= n; });
+    }
+};
+
 // A minimal PortWriter to be used when using Port::enableBackgroundWrite(), to
 // block until the write operation is over
 class cvNotifier :
@@ -1682,6 +1715,217 @@ TEST_CASE("os::PortTest", "[yarp::os]")
         pout.close();
     }
 
+#if defined(__linux__)
+    SECTION("checking the port reactor")
+    {
+        yarp::conf::environment::set_string("YARP_PORT_REACTOR", "1");
+
+        DataPort pin;
+        pin.useCallback();
+        BufferedPort<Bottle> pout;
+        Port pin2;
+        Bottle data2;
+        pin2.setReader(data2);
+        Port prpc;
+        ServiceProvider server;
+        prpc.setReader(server);
+
+        CHECK(pin.open("/in"));
+        CHECK(pin2.open("/in2"));
+        CHECK(prpc.open("/rpc"));
+        CHECK(pout.open("/out"));
+        CHECK(Network::connect("/out", "/in", "tcp"));
+        CHECK(Network::connect("/out", "/in2", "fast_tcp"));
+        Network::sync("/out");
+        Network::sync("/in");
+        Network::sync("/in2");
+
+        constexpr int count = 20;
+        for (int i = 0; i < count; i++) {
+            Bottle& msg = pout.prepare();
+            msg.clear();
+            msg.addInt32(i);
+            pout.writeStrict();
+        }
+        pout.waitForWrite();
+        for (int i = 0; i < 50 && pin.ct < count; i++) {
+            Time::delay(duration_100ms);
+        }
+        CHECK(pin.ct == count); // all the callbacks happened
+        CHECK(data2.get(0).asInt32() == count - 1); // last message arrived
+
+        Port pclient;
+        CHECK(pclient.open("/client"));
+        CHECK(Network::connect("/client", "/rpc"));
+        Bottle cmd("hello");
+        Bottle reply;
+        CHECK(pclient.write(cmd, reply));
+        CHECK(reply.get(1).asInt32() == 5); // reply sent from the reactor
+
+        pclient.close();
+        pout.close();
+        pin.close();
+        pin2.close();
+        prpc.close();
+
+        yarp::conf::environment::unset("YARP_PORT_REACTOR");
+    }
+#endif // __linux__
+
+    SECTION("checking batching of small messages")
+    {
+        BufferedPort<Bottle> pin;
+        pin.setStrict();
+        BufferedPort<Bottle> pout;
+        CHECK(pin.open("/in"));
+        CHECK(pout.open("/out"));
+        CHECK(Network::connect("/out", "/in", "tcp"));
+        Network::sync("/out");
+        Network::sync("/in");
+
+        QosStyle style;
+        style.setBatching(8, 0.5);
+        CHECK(NetworkBase::setConnectionQos("/out", "/in", style, QosStyle()));
+        QosStyle srcStyle;
+        QosStyle destStyle;
+        CHECK(NetworkBase::getConnectionQos("/out", "/in", srcStyle, destStyle));
+        CHECK(srcStyle.getBatchSize() == 8);
+        CHECK(srcStyle.getBatchDelay() == 0.5);
+
+        constexpr int count = 20;
+        for (int i = 0; i < count; i++) {
+            Bottle& msg = pout.prepare();
+            msg.clear();
+            msg.addInt32(i);
+            Stamp stamp(i, 100.0 + i);
+            pout.setEnvelope(stamp);
+            pout.writeStrict();
+        }
+
+        // the last messages are sent when the delay expires
+        for (int i = 0; i < count; i++) {
+            Bottle* msg = pin.read();
+            REQUIRE(msg != nullptr);
+            CHECK(msg->get(0).asInt32() == i);
+            Stamp stamp;
+            CHECK(pin.getEnvelope(stamp));
+            CHECK(stamp.getCount() == i);
+            CHECK(stamp.getTime() == 100.0 + i);
+        }
+
+        pout.close();
+        pin.close();
+    }
+
+    SECTION("checking batching of partially read messages")
+    {
+        BottleHeaderReader reader;
+        Port pin;
+        pin.setReader(reader);
+        BufferedPort<Bottle> pout;
+        CHECK(pin.open("/in"));
+        CHECK(pout.open("/out"));
+        CHECK(Network::connect("/out", "/in", "tcp"));
+        Network::sync("/out");
+        Network::sync("/in");
+
+        QosStyle style;
+        style.setBatching(8, 0.5);
+        CHECK(NetworkBase::setConnectionQos("/out", "/in", style, QosStyle()));
+
+        // the items that are not read are skipped, the next message is read
+        // from its start
+        constexpr int count = 20;
+        for (int i = 0; i < count; i++) {
+            Bottle& msg = pout.prepare();
+            msg.clear();
+            for (int j = 0; j <= i % 5; j++) {
+                msg.addInt32(j);
+            }
+            pout.writeStrict();
+        }
+
+        REQUIRE(reader.waitFor(count));
+        for (int i = 0; i < count; i++) {
+            CHECK(reader.counts[i] == i % 5 + 1);
+        }
+
+        pout.close();
+        pin.close();
+    }
+
+    SECTION("checking latency tracing")
+    {
+        BufferedPort<Bottle> pin;
+        pin.setStrict();
+        BufferedPort<Bottle> pout;
+        CHECK(pin.open("/in"));
+        CHECK(pout.open("/out"));
+        CHECK(Network::connect("/out", "/in", "tcp"));
+        Network::sync("/out");
+        Network::sync("/in");
+
+        Bottle cmd;
+        Bottle reply;
+        cmd.fromString("[trac] [on]");
+        CHECK(NetworkBase::write(pout.getName(), cmd, reply, true));
+        CHECK(reply.get(0).asVocab32() == yarp::os::createVocab32('o', 'k'));
+
+        constexpr int count = 10;
+        for (int i = 0; i < count; i++) {
+            Bottle& msg = pout.prepare();
+            msg.clear();
+            msg.addInt32(i);
+            Stamp stamp(i, 100.0 + i);
+            pout.setEnvelope(stamp);
+            pout.writeStrict();
+        }
+
+        // the timestamps do not change the messages
+        for (int i = 0; i < count; i++) {
+            Bottle* msg = pin.read();
+            REQUIRE(msg != nullptr);
+            CHECK(msg->get(0).asInt32() == i);
+            Stamp stamp;
+            CHECK(pin.getEnvelope(stamp));
+            CHECK(stamp.getCount() == i);
+        }
+
+        cmd.fromString("[trac] [get]");
+        CHECK(NetworkBase::write(pin.getName(), cmd, reply, true));
+        REQUIRE(reply.size() == 1);
+        Bottle* connection = reply.get(0).asList();
+        REQUIRE(connection != nullptr);
+        CHECK(connection->find("from").asString() == "/out");
+        CHECK(connection->find("messages").asInt64() == count);
+        Bottle* total = connection->find("total").asList();
+        REQUIRE(total != nullptr);
+        CHECK(total->find("min").asFloat64() <= total->find("p50").asFloat64());
+        CHECK(total->find("p50").asFloat64() <= total->find("max").asFloat64());
+        Bottle* histogram = total->find("histogram").asList();
+        REQUIRE(histogram != nullptr);
+        int64_t messages = 0;
+        for (size_t i = 0; i < histogram->size(); i++) {
+            messages += histogram->get(i).asInt64();
+        }
+        CHECK(messages == count);
+
+        cmd.fromString("[trac] [json]");
+        CHECK(NetworkBase::write(pin.getName(), cmd, reply, true));
+        std::string json = reply.get(0).asString();
+        CHECK(json.find("\"traceEvents\"") != std::string::npos);
+        CHECK(json.find("\"transport\"") != std::string::npos);
+
+        cmd.fromString("[trac] [clr]");
+        CHECK(NetworkBase::write(pin.getName(), cmd, reply, true));
+        cmd.fromString("[trac] [get]");
+        CHECK(NetworkBase::write(pin.getName(), cmd, reply, true));
+        CHECK(reply.size() == 0);
+
+        pout.close();
+        pin.close();
+    }
+
 #if defined(ENABLE_BROKEN_TESTS)
     SECTION("checking tcp")
     {
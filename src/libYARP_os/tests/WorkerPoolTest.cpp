@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/WorkerPool.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+
+TEST_CASE("os::WorkerPoolTest", "[yarp::os]")
+{
+    SECTION("checking that every task is executed once")
+    {
+        WorkerPool pool(4);
+        CHECK(pool.getThreads() == 4);
+        for (size_t count : {0, 1, 3, 4, 100}) {
+            std::vector<std::atomic<int>> calls(count);
+            std::atomic<bool> threadInRange{true};
+            pool.run(count, [&](size_t index, size_t thread) {
+                calls[index]++;
+                if (thread >= pool.getThreads()) {
+                    threadInRange = false;
+                }
+            });
+            CHECK(threadInRange);
+            int total = 0;
+            for (const auto& c : calls) {
+                CHECK(c == 1);
+                total += c;
+            }
+            CHECK(total == static_cast<int>(count));
+        }
+    }
+
+    SECTION("checking the default number of threads")
+    {
+        WorkerPool pool;
+        CHECK(pool.getThreads() >= 1);
+    }
+
+    SECTION("checking a pool with a single thread")
+    {
+        WorkerPool pool(1);
+        std::thread::id caller = std::this_thread::get_id();
+        bool sameThread = true;
+        int calls = 0;
+        pool.run(10, [&](size_t, size_t thread) {
+            sameThread = sameThread && thread == 0 && std::this_thread::get_id() == caller;
+            calls++;
+        });
+        CHECK(sameThread);
+        CHECK(calls == 10);
+    }
+
+    SECTION("checking concurrent calls")
+    {
+        WorkerPool pool(3);
+        // a task of each thread of the pool is executed by one thread at a time
+        std::vector<std::atomic<int>> busy(pool.getThreads());
+        std::atomic<bool> overlap{false};
+        std::atomic<int> total{0};
+        auto job = [&]() {
+            for (int i = 0; i < 50; i++) {
+                pool.run(8, [&](size_t, size_t thread) {
+                    if (busy[thread]++ != 0) {
+                        overlap = true;
+                    }
+                    total++;
+                    busy[thread]--;
+                });
+            }
+        };
+        std::thread other(job);
+        job();
+        other.join();
+        CHECK_FALSE(overlap);
+        CHECK(total == 2 * 50 * 8);
+    }
+
+    SECTION("checking tryRun while the pool is busy")
+    {
+        WorkerPool pool(2);
+        std::atomic<bool> started{false};
+        std::atomic<bool> release{false};
+        std::thread other([&]() {
+            pool.run(2, [&](size_t index, size_t) {
+                if (index == 0) {
+                    started = true;
+                    while (!release) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        });
+        while (!started) {
+            std::this_thread::yield();
+        }
+
+        int calls = 0;
+        CHECK_FALSE(pool.tryRun(4, [&](size_t, size_t) { calls++; }));
+        CHECK(calls == 0);
+
+        release = true;
+        other.join();
+
+        std::atomic<int> done{0};
+        CHECK(pool.tryRun(4, [&](size_t, size_t) { done++; }));
+        CHECK(done == 4);
+    }
+}
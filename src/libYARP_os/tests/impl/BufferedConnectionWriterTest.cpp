@@ -18,7 +18,30 @@ using namespace yarp::os;
 using namespace yarp::os::impl;
 using namespace yarp::sig;
 
+namespace {
+// Records how the blocks are passed to the stream
+class GatherOutputStream : public StringOutputStream
+{
+public:
+    using StringOutputStream::write;
+    void write(const Bytes& b) override
+    {
+        writeCalls++;
+        StringOutputStream::write(b);
+    }
+
+    void writev(const Bytes* blocks, size_t count) override
+    {
+        writevCalls++;
+        blockCount += count;
+        OutputStream::writev(blocks, count);
+    }
 
+    int writeCalls {0};
+    int writevCalls {0};
+    size_t blockCount {0};
+};
+} // namespace
 
 TEST_CASE("os::impl::BufferedConnectionWriterTest", "[yarp::os][yarp::os::impl]")
 {
@@ -123,4 +146,20 @@ TEST_CASE("os::impl::BufferedConnectionWriterTest", "[yarp::os][yarp::os::impl]"
             INFO("pool size of " << Bottle::toString(pool_sizes[i]) << " had " << Bottle::toString(bbr.bufferCount()) << " buffers");
         }
     }
+
+    SECTION("test writing all the blocks with a single writev")
+    {
+        GatherOutputStream gos;
+        BufferedConnectionWriter bbr;
+        bbr.reset(false);
+        bbr.appendLine("Hello");
+        std::string test(2048, 'x');
+        bbr.appendExternalBlock(test.c_str(), test.length());
+        bbr.appendLine("Greetings");
+        bbr.write(gos);
+        CHECK(gos.writevCalls == 1);
+        CHECK(gos.blockCount == 3); // before, external, after
+        CHECK(gos.writeCalls == static_cast<int>(gos.blockCount)); // default writev
+        CHECK(gos.toString() == "Hello\r\n" + test + "Greetings\r\n");
+    }
 }
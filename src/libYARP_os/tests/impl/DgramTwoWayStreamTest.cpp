@@ -4,10 +4,13 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <yarp/os/impl/DgramReliable.h>
 #include <yarp/os/impl/DgramTwoWayStream.h>
 
 #include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
@@ -248,4 +251,133 @@ TEST_CASE("os::impl::DgramTwoWayStreamTest", "[yarp::os][yarp::os::impl]")
             }
         }
     }
+
+    SECTION("Test reliable Dgram")
+    {
+        INFO("checking that messages are split in fragments");
+        out.setReliable(0.05, 4);
+        out.openMonitor(sz, sz);
+        for (int k = 0; k < 3; k++) {
+            for (size_t i = 0; i < msg.length(); i++) {
+                msg.get()[i] = (i + k) % 128;
+            }
+            out.beginPacket();
+            out.write(msg.bytes());
+            out.flush();
+            out.endPacket();
+        }
+        // 80 bytes of payload per datagram, after the header
+        CHECK(9 == out.size());
+
+        INFO("checking reassembly, with fragments out of order and lost");
+        in.setReliable(0.05, 4);
+        in.openMonitor(sz, sz);
+        in.copyMonitor(out);
+        in.corruptSwap(0, 1);
+        in.corruptDrop(4);
+        for (int k : {0, 2}) {
+            for (size_t i = 0; i < msg.length(); i++) {
+                msg.get()[i] = (i + k) % 128;
+                recv.get()[i] = 0;
+            }
+            // The second message is given up after the deadline
+            in.beginPacket();
+            auto len = in.readFull(recv.bytes());
+            in.endPacket();
+            CHECK((size_t)len == recv.length());
+            CHECK(memcmp(recv.get(), msg.get(), msg.length()) == 0);
+        }
+    }
+
+    SECTION("Test reliable Dgram repairs")
+    {
+        std::vector<std::string> wire;
+        std::vector<std::string> nacks;
+        DgramReliable::Sender sender(sz, 4, [&](const char* data, size_t len) {
+            wire.emplace_back(data, len);
+        });
+        sender.setRepairPort(1234);
+        DgramReliable::Receiver receiver(0.05, [&](std::uint32_t ip, int port, const char* data, size_t len) {
+            CHECK(ip == 0x7f000001);
+            CHECK(port == 1234);
+            nacks.emplace_back(data, len);
+        });
+        std::string message(msg.get(), msg.length());
+        std::string result;
+
+        INFO("checking that a lost fragment is requested and sent again");
+        sender.write(message.data(), message.size());
+        sender.endMessage();
+        REQUIRE(wire.size() == 3);
+        receiver.handleDatagram(wire[0].data(), wire[0].size(), 0x7f000001, 0.0);
+        receiver.handleDatagram(wire[2].data(), wire[2].size(), 0x7f000001, 0.0);
+        CHECK_FALSE(receiver.popMessage(result));
+        receiver.poll(0.0);
+        REQUIRE(nacks.size() == 1);
+        wire.clear();
+        CHECK(sender.handleNack(nacks[0].data(), nacks[0].size()));
+        REQUIRE(wire.size() == 1);
+        receiver.handleDatagram(wire[0].data(), wire[0].size(), 0x7f000001, 0.001);
+        CHECK(receiver.popMessage(result));
+        CHECK(result == message);
+
+        INFO("checking that a lost tail is requested, since the number of fragments is known");
+        wire.clear();
+        nacks.clear();
+        sender.write(message.data(), message.size());
+        sender.endMessage();
+        receiver.handleDatagram(wire[0].data(), wire[0].size(), 0x7f000001, 0.1);
+        receiver.handleDatagram(wire[1].data(), wire[1].size(), 0x7f000001, 0.1);
+        receiver.poll(0.12);
+        REQUIRE(nacks.size() == 1);
+        wire.clear();
+        CHECK(sender.handleNack(nacks[0].data(), nacks[0].size()));
+        REQUIRE(wire.size() == 1);
+        receiver.handleDatagram(wire[0].data(), wire[0].size(), 0x7f000001, 0.12);
+        CHECK(receiver.popMessage(result));
+        CHECK(result == message);
+
+        INFO("checking that a message is dropped after the deadline");
+        wire.clear();
+        for (int k = 0; k < 2; k++) {
+            sender.write(message.data(), message.size());
+            sender.endMessage();
+        }
+        for (size_t i = 1; i < wire.size(); i++) {
+            receiver.handleDatagram(wire[i].data(), wire[i].size(), 0x7f000001, 0.2);
+        }
+        CHECK_FALSE(receiver.popMessage(result));
+        receiver.poll(0.3);
+        CHECK(receiver.takeDropped() == 1);
+        CHECK(receiver.popMessage(result));
+        CHECK(result == message);
+
+        INFO("checking that the fragment index is bounded by the number of fragments");
+        wire.clear();
+        sender.write(message.data(), message.size());
+        sender.endMessage();
+        REQUIRE(wire.size() == 3);
+        std::string bad = wire[0];
+        bad[12] = bad[13] = bad[14] = 0;
+        bad[15] = 3; // index == number of fragments
+        CHECK_FALSE(receiver.handleDatagram(bad.data(), bad.size(), 0x7f000001, 0.4));
+        bad = wire[0];
+        bad[16] = 0x7f; // too many fragments
+        CHECK_FALSE(receiver.handleDatagram(bad.data(), bad.size(), 0x7f000001, 0.4));
+        bad = wire[0];
+        bad[19] = 4; // not the number of fragments of the other ones
+        CHECK(receiver.handleDatagram(wire[1].data(), wire[1].size(), 0x7f000001, 0.4));
+        CHECK_FALSE(receiver.handleDatagram(bad.data(), bad.size(), 0x7f000001, 0.4));
+        CHECK(receiver.handleDatagram(wire[0].data(), wire[0].size(), 0x7f000001, 0.4));
+        CHECK(receiver.handleDatagram(wire[2].data(), wire[2].size(), 0x7f000001, 0.4));
+        CHECK(receiver.popMessage(result));
+        CHECK(result == message);
+
+        INFO("checking that old messages cannot be repaired");
+        for (int k = 0; k < 5; k++) {
+            sender.write(message.data(), message.size());
+            sender.endMessage();
+        }
+        CHECK_FALSE(sender.handleNack(nacks[0].data(), nacks[0].size()));
+    }
 }
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/impl/PortCorePackets.h>
+
+#include <yarp/os/Bottle.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <vector>
+
+using namespace yarp::os;
+using namespace yarp::os::impl;
+
+TEST_CASE("os::impl::PortCorePacketsTest", "[yarp::os][yarp::os::impl]")
+{
+    SECTION("packets are recycled")
+    {
+        PortCorePackets packets(2);
+        CHECK(packets.getAllocatedCount() == 2);
+        CHECK(packets.getFree() == 2);
+
+        Bottle b("10 20 30");
+        for (int i = 0; i < 100; i++) {
+            PortCorePacket* packet = packets.getFreePacket();
+            REQUIRE(packet != nullptr);
+            packet->setContent(&b);
+            CHECK(packets.getCount() == 1);
+            packet->dec();
+            CHECK(packets.checkPacket(packet));
+            CHECK(packets.getCount() == 0);
+        }
+        CHECK(packets.getAllocatedCount() == 2); // no new packets
+        CHECK(packets.getExhaustedCount() == 0);
+    }
+
+    SECTION("the pool grows when exhausted")
+    {
+        PortCorePackets packets(2);
+        std::vector<PortCorePacket*> inFlight;
+        for (int i = 0; i < 5; i++) {
+            inFlight.push_back(packets.getFreePacket());
+        }
+        CHECK(packets.getCount() == 5);
+        CHECK(packets.getAllocatedCount() == 5);
+        CHECK(packets.getExhaustedCount() == 3);
+
+        // release them in a different order
+        packets.freePacket(inFlight[2]);
+        packets.freePacket(inFlight[0]);
+        packets.freePacket(inFlight[4]);
+        CHECK(packets.getCount() == 2);
+        CHECK(packets.getFree() == 3);
+
+        // freeing twice is harmless
+        packets.freePacket(inFlight[4]);
+        CHECK(packets.getFree() == 3);
+
+        packets.freePacket(inFlight[1]);
+        packets.freePacket(inFlight[3]);
+        CHECK(packets.getCount() == 0);
+        CHECK(packets.getFree() == 5);
+
+        // all the packets can be reused without allocating
+        for (int i = 0; i < 5; i++) {
+            inFlight[i] = packets.getFreePacket();
+        }
+        CHECK(packets.getAllocatedCount() == 5);
+        CHECK(packets.getExhaustedCount() == 3);
+    }
+}
@@ -7,6 +7,7 @@
 #include <yarp/os/Log.h>
 #include <yarp/os/Vocab.h>
 #include <yarp/sig/Image.h>
+#include <yarp/sig/impl/PixelConversion.h>
 
 #include <cstring>
 #include <cstdio>
@@ -1260,6 +1261,18 @@ void Image::copyPixels(const unsigned char *src, size_t id1,
         return;
     }
 
+    // The conversions among the most common pixel types are vectorized
+    if (auto convert = impl::getPixelRowConversion(static_cast<int>(id1), static_cast<int>(id2))) {
+        const size_t len1 = w * pixelCode2Size.at(static_cast<YarpVocabPixelTypesEnum>(id1));
+        const size_t len2 = w * pixelCode2Size.at(static_cast<YarpVocabPixelTypesEnum>(id2));
+        const size_t step1 = len1 + PAD_BYTES(len1, quantum1);
+        const size_t step2 = len2 + PAD_BYTES(len2, quantum2);
+        for (size_t i = 0; i < h; i++) {
+            convert(src + i * step1, dest + i * step2, w);
+        }
+        return;
+    }
+
 
     switch(HASH(id1,id2)) {
         // Macros rely on len, x1, x2 variable names
@@ -304,6 +304,9 @@ void ImageStorage::_alloc_complete_extern(const void *buf, size_t x, size_t y, i
     _alloc_extern (buf);
     _alloc_data ();
     is_owner = 0;
+    // resizing to the same geometry keeps using the external buffer
+    extern_type_id = pixel_type;
+    extern_type_quantum = quantum;
 }
 
 
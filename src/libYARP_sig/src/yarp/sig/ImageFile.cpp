@@ -7,12 +7,17 @@
 #include <yarp/sig/ImageFile.h>
 #include <yarp/os/LogComponent.h>
 #include <yarp/os/LogStream.h>
+#include <yarp/os/WorkerPool.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <memory>
 
 #if defined (YARP_HAS_JPEG)
+#include <csetjmp>
 #include "jpeglib.h"
 #endif
 
@@ -31,14 +36,6 @@ namespace
 {
     YARP_LOG_COMPONENT(IMAGEFILE, "yarp.sig.ImageFile")
 
-    bool ImageReadRGB_JPG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageReadBGR_JPG(ImageOf<PixelBgr>& img, const char* filename);
-    bool ImageReadMono_JPG(ImageOf<PixelMono>& img, const char* filename);
-
-    bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageReadBGR_PNG(ImageOf<PixelBgr>& img, const char* filename);
-    bool ImageReadMono_PNG(ImageOf<PixelMono>& img, const char* filename);
-
     bool ReadHeader_PxM(FILE* fp, int* height, int* width, int* color);
     bool ImageReadMono_PxM(ImageOf<PixelMono>& img, const char* filename);
     bool ImageReadRGB_PxM(ImageOf<PixelRgb>& img, const char* filename);
@@ -49,247 +46,19 @@ namespace
     bool ImageReadFloat_CompressedHeaderless(ImageOf<PixelFloat>& dest, const std::string& filename);
 #endif
 
-    bool SaveJPG(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
     bool SavePGM(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
     bool SavePPM(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
-#if defined (YARP_HAS_PNG)
-    bool SavePNG(char* src, const char* filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth);
-#endif
     bool SaveFloatRaw(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
 #if defined (YARP_HAS_ZLIB)
     bool SaveFloatCompressed(char* src, const char* filename, size_t h, size_t w, size_t rowSize);
 #endif
 
-    bool ImageWriteJPG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageWritePNG(ImageOf<PixelRgb>& img, const char* filename);
-    bool ImageWritePNG(ImageOf<PixelMono>& img, const char* filename);
     bool ImageWriteRGB(ImageOf<PixelRgb>& img, const char* filename);
     bool ImageWriteMono(ImageOf<PixelMono>& img, const char* filename);
 
     bool ImageWriteFloat_PlainHeaderless(ImageOf<PixelFloat>& img, const char* filename);
     bool ImageWriteFloat_CompressedHeaderless(ImageOf<PixelFloat>& img, const char* filename);
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// private read methods for JPG Files
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool ImageReadRGB_JPG(ImageOf<PixelRgb>& img, const char* filename)
-{
-#if defined (YARP_HAS_JPEG)
-
-    struct jpeg_decompress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    jpeg_create_decompress(&cinfo);
-    cinfo.err = jpeg_std_error(&jerr);
-
-    FILE* fp = fopen(filename, "rb");
-    if (!fp)
-    {
-        yCError(IMAGEFILE) << "Error: failed to open" << filename;
-        return false;
-    }
-
-    jpeg_stdio_src(&cinfo, fp);
-    jpeg_read_header(&cinfo, TRUE);
-    jpeg_start_decompress(&cinfo);
-
-    uint32_t j_width = cinfo.image_width;
-    uint32_t j_height = cinfo.image_height;
-    uint32_t j_ch = cinfo.num_components;
-
-    uint8_t* j_data = NULL;
-    j_data = (uint8_t*)malloc(sizeof(uint8_t) * j_width * j_height * j_ch);
-
-    //read line by line
-    uint8_t* j_row = j_data;
-    const uint32_t j_stride = j_width * j_ch;
-    for (size_t y = 0; y < j_height; y++)
-    {
-        jpeg_read_scanlines(&cinfo, &j_row, 1);
-        j_row += j_stride;
-    }
-
-    jpeg_finish_decompress(&cinfo);
-    jpeg_destroy_decompress(&cinfo);
-    fclose(fp);
-
-    img.resize(j_width, j_height);
-    for (size_t y = 0; y < j_height; y++)
-    {
-        for (size_t x = 0; x < j_width; x++)
-        {
-            unsigned char* address = img.getPixelAddress(x, y);
-            address[0] = j_data[y * j_width * j_ch + x * j_ch + 0];
-            address[1] = j_data[y * j_width * j_ch + x * j_ch + 1];
-            address[2] = j_data[y * j_width * j_ch + x * j_ch + 2];
-        }
-    }
-
-    free(j_data);
-    j_data = nullptr;
-
-    return true;
-#else
-    yCError(IMAGEFILE) << "JPG library not available/not found";
-    return false;
-#endif
-}
-
-bool ImageReadBGR_JPG(ImageOf<PixelBgr>& img, const char* filename)
-{
-#if defined (YARP_HAS_JPEG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
-#else
-    yCError(IMAGEFILE) << "JPG library not available/not found";
-    return false;
-#endif
-}
-
-bool ImageReadMono_JPG(ImageOf<PixelMono>& img, const char* filename)
-{
-#if defined (YARP_HAS_JPEG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
-#else
-    yCError(IMAGEFILE) << "JPG library not available/not found";
-    return false;
-#endif
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// private read methods for PNG Files
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool ImageReadRGB_PNG(ImageOf<PixelRgb>& img, const char* filename)
-{
-#if defined (YARP_HAS_PNG)
-    FILE* fp = fopen(filename, "rb");
-    if (!fp)
-    {
-        yCError(IMAGEFILE) << "Error: failed to open" << filename;
-        return false;
-    }
-
-    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png)
-    {
-        fclose(fp);
-        yCError(IMAGEFILE) << "PNG internal error";
-        return false;
-    }
-
-    png_infop info = png_create_info_struct(png);
-    if (!info)
-    {
-        fclose(fp);
-        yCError(IMAGEFILE) << "PNG internal error";
-        return false;
-    }
-
-    if (setjmp(png_jmpbuf(png)))
-    {
-        fclose(fp);
-        yCError(IMAGEFILE) << "PNG internal error";
-        return false;
-    }
-
-    png_init_io(png, fp);
-
-    png_read_info(png, info);
-
-    int width = png_get_image_width(png, info);
-    int height = png_get_image_height(png, info);
-    png_byte color_type = png_get_color_type(png, info);
-    png_byte bit_depth = png_get_bit_depth(png, info);
-
-    // Read any color_type into 8bit depth, RGBA format.
-    // See http://www.libpng.org/pub/png/libpng-manual.txt
-
-    if (bit_depth == 16) {
-        png_set_strip_16(png);
-    }
-
-    if (color_type == PNG_COLOR_TYPE_PALETTE) {
-        png_set_palette_to_rgb(png);
-    }
-
-    // PNG_COLOR_TYPE_GRAY_ALPHA is always 8 or 16bit depth.
-    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8) {
-        png_set_expand_gray_1_2_4_to_8(png);
-    }
-
-    if (png_get_valid(png, info, PNG_INFO_tRNS)) {
-        png_set_tRNS_to_alpha(png);
-    }
-
-    // These color_type don't have an alpha channel then fill it with 0xff.
-    if (color_type == PNG_COLOR_TYPE_RGB || color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_PALETTE) {
-        png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
-    }
-
-    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA) {
-        png_set_gray_to_rgb(png);
-    }
-
-    png_read_update_info(png, info);
-
-    png_bytep* row_pointers = (png_bytep*)malloc(sizeof(png_bytep) * height);
-    for (int y = 0; y < height; y++)
-    {
-        row_pointers[y] = (png_byte*)malloc(png_get_rowbytes(png, info));
-    }
-
-    png_read_image(png, row_pointers);
-    fclose(fp);
-
-    img.resize(width,height);
-    for (int y = 0; y < height; y++)
-    {
-        png_bytep row = row_pointers[y];
-        for (int x = 0; x < width; x++)
-            {
-                png_bytep px = &(row[x * 4]);
-                unsigned char* address = img.getPixelAddress(x,y);
-                address[0] = px[0];
-                address[1] = px[1];
-                address[2] = px[2];
-            }
-    }
-
-    png_destroy_read_struct(&png, &info, NULL);
-    for (int y = 0; y < height; y++)
-    {
-        free(row_pointers[y]);
-    }
-    free(row_pointers);
-    return true;
-#else
-    yCError(IMAGEFILE) << "PNG library not available/not found";
-    return false;
-#endif
-}
-
-bool ImageReadBGR_PNG(ImageOf<PixelBgr>& img, const char* filename)
-{
-#if defined (YARP_HAS_PNG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
-#else
-    yCError(IMAGEFILE) << "PNG library not available/not found";
-    return false;
-#endif
-}
-
-bool ImageReadMono_PNG(ImageOf<PixelMono>& img, const char* filename)
-{
-#if defined (YARP_HAS_PNG)
-    yCError(IMAGEFILE) << "Not yet implemented";
-    return false;
-#else
-    yCError(IMAGEFILE) << "PNG library not available/not found";
-    return false;
-#endif
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // private read methods for PGM/PPM Files
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -601,155 +370,6 @@ bool ImageReadMono_PxM(ImageOf<PixelMono> &img, const char *filename)
 // private write methods
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#if defined (YARP_HAS_PNG)
-bool SavePNG(char *src, const char *filename, size_t h, size_t w, size_t rowSize, png_byte color_type, png_byte bit_depth)
-{
-    // create file
-    if (src == nullptr)
-    {
-        yCError(IMAGEFILE, "[write_png_file] Cannot write to file a nullptr image");
-        return false;
-    }
-
-    if (filename == nullptr)
-    {
-        yCError(IMAGEFILE, "[write_png_file] Filename is nullptr");
-        return false;
-    }
-
-    FILE *fp = fopen(filename, "wb");
-    if (!fp)
-    {
-        yCError(IMAGEFILE, "[write_png_file] File %s could not be opened for writing", filename);
-        return false;
-    }
-
-    // initialize stuff
-    png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png_ptr)
-    {
-        yCError(IMAGEFILE, "[write_png_file] png_create_write_struct failed");
-        fclose(fp);
-        return false;
-    }
-
-    png_infop info_ptr = png_create_info_struct(png_ptr);
-    if (!info_ptr)
-    {
-        yCError(IMAGEFILE, "[write_png_file] png_create_info_struct failed");
-        fclose(fp);
-        return false;
-    }
-
-    //init io
-    if (setjmp(png_jmpbuf(png_ptr)))
-    {
-        yCError(IMAGEFILE, "[write_png_file] Error during init_io");
-        fclose(fp);
-        return false;
-    }
-    png_init_io(png_ptr, fp);
-
-    // write header
-    if (setjmp(png_jmpbuf(png_ptr)))
-    {
-        yCError(IMAGEFILE, "[write_png_file] Error during writing header");
-        fclose(fp);
-        return false;
-    }
-    png_set_IHDR(png_ptr, info_ptr, w, h,
-        bit_depth, color_type, PNG_INTERLACE_NONE,
-        PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-
-    //write info
-    png_write_info(png_ptr, info_ptr);
-
-    //allocate data space
-    png_bytep* row_pointers = new png_bytep[h];
-
-    for (size_t y = 0; y < h; y++)
-    {
-        //this is an array of pointers. Each element points to a row of the image
-        row_pointers[y] = (png_bytep)(src) + (y * rowSize);
-    }
-
-    // write bytes
-    if (setjmp(png_jmpbuf(png_ptr)))
-    {
-        yCError(IMAGEFILE, "[write_png_file] Error during writing bytes");
-        delete [] row_pointers;
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        fclose(fp);
-        return false;
-    }
-    png_write_image(png_ptr, row_pointers);
-
-    // end write
-    if (setjmp(png_jmpbuf(png_ptr)))
-    {
-        yCError(IMAGEFILE, "[write_png_file] Error during end of write");
-        delete [] row_pointers;
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        fclose(fp);
-        return false;
-    }
-    png_write_end(png_ptr, info_ptr);
-
-    // finished. cleanup  allocation
-    delete[] row_pointers;
-    png_destroy_write_struct(&png_ptr, &info_ptr);
-    fclose(fp);
-    return true;
-}
-#endif
-
-bool SaveJPG(char *src, const char *filename, size_t h, size_t w, size_t rowSize)
-{
-#if defined (YARP_HAS_JPEG)
-    int quality = 100;
-    struct jpeg_compress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE * outfile = nullptr;
-    JSAMPROW row_pointer[1];
-    int row_stride;
-
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_compress(&cinfo);
-
-    if ((outfile = fopen(filename, "wb")) == nullptr)
-    {
-        yCError(IMAGEFILE, "can't write file: %s\n", filename);
-        return false;
-    }
-    jpeg_stdio_dest(&cinfo, outfile);
-
-    cinfo.image_width = w;
-    cinfo.image_height = h;
-    cinfo.input_components = 3;
-    cinfo.in_color_space = JCS_RGB;
-    jpeg_set_defaults(&cinfo);
-    jpeg_set_quality(&cinfo, quality, TRUE);
-
-    jpeg_start_compress(&cinfo, TRUE);
-
-    row_stride = w * 3;
-
-    while (cinfo.next_scanline < cinfo.image_height)
-    {
-        row_pointer[0] = (JSAMPROW)&src[cinfo.next_scanline * row_stride];
-        (void)jpeg_write_scanlines(&cinfo, row_pointer, 1);
-    }
-
-    jpeg_finish_compress(&cinfo);
-    fclose(outfile);
-    jpeg_destroy_compress(&cinfo);
-    return true;
-#else
-    yCError(IMAGEFILE) << "libjpeg not installed";
-    return false;
-#endif
-}
-
 bool SavePGM(char *src, const char *filename, size_t h, size_t w, size_t rowSize)
 {
     FILE *fp = fopen(filename, "wb");
@@ -868,31 +488,6 @@ bool SaveFloatRaw(char* src, const char* filename, size_t h, size_t w, size_t ro
     return (bw > 0);
 }
 
-bool ImageWriteJPG(ImageOf<PixelRgb>& img, const char *filename)
-{
-    return SaveJPG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize());
-}
-
-bool ImageWritePNG(ImageOf<PixelRgb>& img, const char *filename)
-{
-#if defined (YARP_HAS_PNG)
-    return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_RGB, 8);
-#else
-    yCError(IMAGEFILE) << "YARP was not built with png support";
-    return false;
-#endif
-}
-
-bool ImageWritePNG(ImageOf<PixelMono>& img, const char *filename)
-{
-#if defined (YARP_HAS_PNG)
-    return SavePNG((char*)img.getRawImage(), filename, img.height(), img.width(), img.getRowSize(), PNG_COLOR_TYPE_GRAY, 8);
-#else
-    yCError(IMAGEFILE) << "YARP was not built with png support";
-    return false;
-#endif
-}
-
 bool ImageWriteRGB(ImageOf<PixelRgb>& img, const char *filename)
 {
     return SavePPM((char*)img.getRawImage(),filename,img.height(),img.width(),img.getRowSize());
@@ -920,21 +515,692 @@ bool ImageWriteFloat_CompressedHeaderless(ImageOf<PixelFloat>& img, const char*
 } // namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// public read methods
+// in memory JPG/PNG codec
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool file::read(ImageOf<PixelRgb> & dest, const std::string& src, image_fileformat format)
+namespace {
+
+#if defined (YARP_HAS_JPEG)
+// libjpeg calls exit() on errors by default
+struct JpegErrorManager
 {
-    const char* file_ext = strrchr(src.c_str(), '.');
-    if (file_ext==nullptr)
-    {
-        yCError(IMAGEFILE) << "cannot find file extension in file name";
-        return false;
-    }
+    jpeg_error_mgr pub;
+    std::jmp_buf jump;
+};
 
-    if (strcmp(file_ext, ".pgm")==0 ||
-        strcmp(file_ext, ".ppm")==0 ||
-        format == FORMAT_PGM ||
+void jpegErrorExit(j_common_ptr cinfo)
+{
+    char message[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, message);
+    yCError(IMAGEFILE, "JPG error: %s", message);
+    std::longjmp(reinterpret_cast<JpegErrorManager*>(cinfo->err)->jump, 1);
+}
+
+void jpegOutputMessage(j_common_ptr cinfo)
+{
+    char message[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, message);
+    yCWarning(IMAGEFILE, "JPG warning: %s", message);
+}
+
+// Compress into a std::vector, keeping its memory between the images
+struct JpegDestination
+{
+    jpeg_destination_mgr pub;
+    std::vector<unsigned char>* out;
+};
+
+void jpegInitDestination(j_compress_ptr cinfo)
+{
+    auto* dest = reinterpret_cast<JpegDestination*>(cinfo->dest);
+    dest->out->resize(std::max<size_t>(dest->out->capacity(), 65536));
+    dest->pub.next_output_byte = dest->out->data();
+    dest->pub.free_in_buffer = dest->out->size();
+}
+
+boolean jpegEmptyOutputBuffer(j_compress_ptr cinfo)
+{
+    auto* dest = reinterpret_cast<JpegDestination*>(cinfo->dest);
+    size_t used = dest->out->size();
+    dest->out->resize(used * 2);
+    dest->pub.next_output_byte = dest->out->data() + used;
+    dest->pub.free_in_buffer = dest->out->size() - used;
+    return TRUE;
+}
+
+void jpegTermDestination(j_compress_ptr cinfo)
+{
+    auto* dest = reinterpret_cast<JpegDestination*>(cinfo->dest);
+    dest->out->resize(dest->out->size() - dest->pub.free_in_buffer);
+}
+
+void jpegInitSource(j_decompress_ptr /*cinfo*/)
+{
+}
+
+boolean jpegFillInputBuffer(j_decompress_ptr cinfo)
+{
+    // Truncated data: insert an EOI marker, as jpeg_mem_src() does
+    static const JOCTET eoi[2] = {0xFF, JPEG_EOI};
+    cinfo->src->next_input_byte = eoi;
+    cinfo->src->bytes_in_buffer = 2;
+    return TRUE;
+}
+
+void jpegSkipInputData(j_decompress_ptr cinfo, long num_bytes)
+{
+    if (num_bytes <= 0) {
+        return;
+    }
+    auto skip = std::min(static_cast<size_t>(num_bytes), cinfo->src->bytes_in_buffer);
+    cinfo->src->next_input_byte += skip;
+    cinfo->src->bytes_in_buffer -= skip;
+}
+
+void jpegTermSource(j_decompress_ptr /*cinfo*/)
+{
+}
+#endif
+
+#if defined (YARP_HAS_PNG)
+struct PngSource
+{
+    const unsigned char* data;
+    size_t size;
+    size_t pos;
+};
+
+void pngRead(png_structp png, png_bytep data, png_size_t len)
+{
+    auto* src = static_cast<PngSource*>(png_get_io_ptr(png));
+    if (src->size - src->pos < len) {
+        png_error(png, "truncated data");
+    }
+    memcpy(data, src->data + src->pos, len);
+    src->pos += len;
+}
+
+void pngWrite(png_structp png, png_bytep data, png_size_t len)
+{
+    auto* out = static_cast<std::vector<unsigned char>*>(png_get_io_ptr(png));
+    out->insert(out->end(), data, data + len);
+}
+
+void pngFlush(png_structp /*png*/)
+{
+}
+#endif
+
+bool isJpeg(const unsigned char* data, size_t size)
+{
+    return size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+}
+
+bool isPng(const unsigned char* data, size_t size)
+{
+    return size >= 8 && memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0;
+}
+
+} // namespace
+
+
+class file::ImageCodec::Private
+{
+public:
+    int jpegQuality{100};
+    int pngLevel{-1};
+    std::vector<unsigned char> file;
+    std::vector<unsigned char*> rows;
+    FlexImage converted;
+
+#if defined (YARP_HAS_JPEG)
+    jpeg_compress_struct compress;
+    jpeg_decompress_struct decompress;
+    JpegErrorManager compressError;
+    JpegErrorManager decompressError;
+    JpegDestination destination;
+    jpeg_source_mgr source;
+#endif
+
+    Private()
+    {
+#if defined (YARP_HAS_JPEG)
+        compress.err = jpeg_std_error(&compressError.pub);
+        compressError.pub.error_exit = jpegErrorExit;
+        compressError.pub.output_message = jpegOutputMessage;
+        jpeg_create_compress(&compress);
+
+        decompress.err = jpeg_std_error(&decompressError.pub);
+        decompressError.pub.error_exit = jpegErrorExit;
+        decompressError.pub.output_message = jpegOutputMessage;
+        jpeg_create_decompress(&decompress);
+
+        destination.pub.init_destination = jpegInitDestination;
+        destination.pub.empty_output_buffer = jpegEmptyOutputBuffer;
+        destination.pub.term_destination = jpegTermDestination;
+        destination.out = nullptr;
+
+        source.init_source = jpegInitSource;
+        source.fill_input_buffer = jpegFillInputBuffer;
+        source.skip_input_data = jpegSkipInputData;
+        source.resync_to_restart = jpeg_resync_to_restart;
+        source.term_source = jpegTermSource;
+#endif
+    }
+
+    ~Private()
+    {
+#if defined (YARP_HAS_JPEG)
+        jpeg_destroy_compress(&compress);
+        jpeg_destroy_decompress(&decompress);
+#endif
+    }
+
+    Private(const Private&) = delete;
+    Private& operator=(const Private&) = delete;
+
+    // Point the rows to the ones of an image
+    void setRows(const Image& img)
+    {
+        rows.resize(img.height());
+        for (size_t y = 0; y < img.height(); y++) {
+            rows[y] = const_cast<unsigned char*>(img.getRow(y));
+        }
+    }
+
+    // The image converted to RGB, if it cannot be encoded directly
+    const Image& toRgb(const Image& src)
+    {
+        converted.setPixelCode(VOCAB_PIXEL_RGB);
+        converted.copy(src);
+        return converted;
+    }
+
+    bool encodeJpeg(const Image& src, std::vector<unsigned char>& dest);
+    bool decodeJpeg(const unsigned char* data, size_t size, Image& dest);
+    bool encodePng(const Image& src, std::vector<unsigned char>& dest);
+    bool decodePng(const unsigned char* data, size_t size, Image& dest);
+};
+
+
+bool file::ImageCodec::Private::encodeJpeg(const Image& src, std::vector<unsigned char>& dest)
+{
+#if defined (YARP_HAS_JPEG)
+    const Image* img = &src;
+    switch (src.getPixelCode()) {
+    case VOCAB_PIXEL_RGB:
+        compress.in_color_space = JCS_RGB;
+        compress.input_components = 3;
+        break;
+#if defined (JCS_EXTENSIONS)
+    case VOCAB_PIXEL_BGR:
+        compress.in_color_space = JCS_EXT_BGR;
+        compress.input_components = 3;
+        break;
+    case VOCAB_PIXEL_RGBA:
+        compress.in_color_space = JCS_EXT_RGBA;
+        compress.input_components = 4;
+        break;
+    case VOCAB_PIXEL_BGRA:
+        compress.in_color_space = JCS_EXT_BGRA;
+        compress.input_components = 4;
+        break;
+#endif
+    case VOCAB_PIXEL_MONO:
+        compress.in_color_space = JCS_GRAYSCALE;
+        compress.input_components = 1;
+        break;
+    default:
+        img = &toRgb(src);
+        compress.in_color_space = JCS_RGB;
+        compress.input_components = 3;
+        break;
+    }
+    setRows(*img);
+
+    if (setjmp(compressError.jump)) {
+        jpeg_abort_compress(&compress);
+        return false;
+    }
+
+    compress.image_width = static_cast<JDIMENSION>(img->width());
+    compress.image_height = static_cast<JDIMENSION>(img->height());
+    jpeg_set_defaults(&compress);
+    jpeg_set_quality(&compress, jpegQuality, TRUE);
+    destination.out = &dest;
+    compress.dest = &destination.pub;
+
+    jpeg_start_compress(&compress, TRUE);
+    while (compress.next_scanline < compress.image_height) {
+        jpeg_write_scanlines(&compress, rows.data() + compress.next_scanline, compress.image_height - compress.next_scanline);
+    }
+    jpeg_finish_compress(&compress);
+    return true;
+#else
+    yCError(IMAGEFILE) << "JPG library not available/not found";
+    return false;
+#endif
+}
+
+
+bool file::ImageCodec::Private::decodeJpeg(const unsigned char* data, size_t size, Image& dest)
+{
+#if defined (YARP_HAS_JPEG)
+    if (setjmp(decompressError.jump)) {
+        jpeg_abort_decompress(&decompress);
+        return false;
+    }
+
+    source.next_input_byte = data;
+    source.bytes_in_buffer = size;
+    decompress.src = &source;
+    jpeg_read_header(&decompress, TRUE);
+
+    // The color images are converted to MONO as Image::copy() does
+    int code = dest.getPixelCode();
+    if (code == VOCAB_PIXEL_MONO && decompress.jpeg_color_space != JCS_GRAYSCALE) {
+        code = VOCAB_PIXEL_INVALID;
+    }
+
+    Image* img = &dest;
+    switch (code) {
+    case VOCAB_PIXEL_RGB:
+        decompress.out_color_space = JCS_RGB;
+        break;
+#if defined (JCS_EXTENSIONS)
+    case VOCAB_PIXEL_BGR:
+        decompress.out_color_space = JCS_EXT_BGR;
+        break;
+    case VOCAB_PIXEL_RGBA:
+        decompress.out_color_space = JCS_EXT_RGBA;
+        break;
+    case VOCAB_PIXEL_BGRA:
+        decompress.out_color_space = JCS_EXT_BGRA;
+        break;
+#endif
+    case VOCAB_PIXEL_MONO:
+        decompress.out_color_space = JCS_GRAYSCALE;
+        break;
+    default:
+        converted.setPixelCode(VOCAB_PIXEL_RGB);
+        img = &converted;
+        decompress.out_color_space = JCS_RGB;
+        break;
+    }
+
+    jpeg_start_decompress(&decompress);
+    img->resize(decompress.output_width, decompress.output_height);
+    setRows(*img);
+    while (decompress.output_scanline < decompress.output_height) {
+        jpeg_read_scanlines(&decompress, rows.data() + decompress.output_scanline, decompress.output_height - decompress.output_scanline);
+    }
+    jpeg_finish_decompress(&decompress);
+
+    if (img != &dest) {
+        dest.copy(*img);
+    }
+    return true;
+#else
+    yCError(IMAGEFILE) << "JPG library not available/not found";
+    return false;
+#endif
+}
+
+
+bool file::ImageCodec::Private::encodePng(const Image& src, std::vector<unsigned char>& dest)
+{
+#if defined (YARP_HAS_PNG)
+    const Image* img = &src;
+    int colorType = PNG_COLOR_TYPE_RGB;
+    bool bgr = false;
+    bool filler = false;
+    switch (src.getPixelCode()) {
+    case VOCAB_PIXEL_RGB:
+        break;
+    case VOCAB_PIXEL_BGR:
+        bgr = true;
+        break;
+    case VOCAB_PIXEL_RGBA:
+        filler = true;
+        break;
+    case VOCAB_PIXEL_BGRA:
+        bgr = true;
+        filler = true;
+        break;
+    case VOCAB_PIXEL_MONO:
+        colorType = PNG_COLOR_TYPE_GRAY;
+        break;
+    default:
+        img = &toRgb(src);
+        break;
+    }
+    setRows(*img);
+    dest.clear();
+
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    png_infop info = png ? png_create_info_struct(png) : nullptr;
+    if (!info)
+    {
+        png_destroy_write_struct(&png, nullptr);
+        yCError(IMAGEFILE) << "PNG internal error";
+        return false;
+    }
+
+    if (setjmp(png_jmpbuf(png)))
+    {
+        png_destroy_write_struct(&png, &info);
+        yCError(IMAGEFILE) << "PNG error while encoding";
+        return false;
+    }
+
+    png_set_write_fn(png, &dest, pngWrite, pngFlush);
+    if (pngLevel >= 0) {
+        png_set_compression_level(png, pngLevel);
+    }
+    png_set_IHDR(png, info, static_cast<png_uint_32>(img->width()), static_cast<png_uint_32>(img->height()),
+        8, colorType, PNG_INTERLACE_NONE,
+        PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    if (bgr) {
+        png_set_bgr(png);
+    }
+    if (filler) {
+        // The alpha channel is dropped
+        png_set_filler(png, 0, PNG_FILLER_AFTER);
+    }
+    png_write_image(png, rows.data());
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    return true;
+#else
+    yCError(IMAGEFILE) << "PNG library not available/not found";
+    return false;
+#endif
+}
+
+
+bool file::ImageCodec::Private::decodePng(const unsigned char* data, size_t size, Image& dest)
+{
+#if defined (YARP_HAS_PNG)
+    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    png_infop info = png ? png_create_info_struct(png) : nullptr;
+    if (!info)
+    {
+        png_destroy_read_struct(&png, nullptr, nullptr);
+        yCError(IMAGEFILE) << "PNG internal error";
+        return false;
+    }
+
+    if (setjmp(png_jmpbuf(png)))
+    {
+        png_destroy_read_struct(&png, &info, nullptr);
+        yCError(IMAGEFILE) << "PNG error while decoding";
+        return false;
+    }
+
+    PngSource src{data, size, 0};
+    png_set_read_fn(png, &src, pngRead);
+    png_read_info(png, info);
+
+    png_uint_32 width = png_get_image_width(png, info);
+    png_uint_32 height = png_get_image_height(png, info);
+    png_byte colorType = png_get_color_type(png, info);
+    png_byte bitDepth = png_get_bit_depth(png, info);
+    bool color = (colorType & PNG_COLOR_MASK_COLOR) != 0;
+    bool alpha = (colorType & PNG_COLOR_MASK_ALPHA) != 0 || png_get_valid(png, info, PNG_INFO_tRNS);
+
+    // The color images are converted to MONO as Image::copy() does
+    Image* img = &dest;
+    int code = dest.getPixelCode();
+    if ((code != VOCAB_PIXEL_RGB && code != VOCAB_PIXEL_BGR &&
+         code != VOCAB_PIXEL_RGBA && code != VOCAB_PIXEL_BGRA &&
+         code != VOCAB_PIXEL_MONO) ||
+        (code == VOCAB_PIXEL_MONO && color))
+    {
+        converted.setPixelCode(VOCAB_PIXEL_RGB);
+        img = &converted;
+        code = VOCAB_PIXEL_RGB;
+    }
+
+    // Read any color_type into 8bit depth, in the format of the image.
+    // See http://www.libpng.org/pub/png/libpng-manual.txt
+    if (bitDepth == 16) {
+        png_set_strip_16(png);
+    }
+    if (colorType == PNG_COLOR_TYPE_PALETTE) {
+        png_set_palette_to_rgb(png);
+    }
+    if (!color && bitDepth < 8) {
+        png_set_expand_gray_1_2_4_to_8(png);
+    }
+    if (png_get_valid(png, info, PNG_INFO_tRNS)) {
+        png_set_tRNS_to_alpha(png);
+    }
+    if (code != VOCAB_PIXEL_MONO && !color) {
+        png_set_gray_to_rgb(png);
+    }
+    if (code == VOCAB_PIXEL_RGBA || code == VOCAB_PIXEL_BGRA) {
+        if (!alpha) {
+            png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+        }
+    } else if (alpha) {
+        png_set_strip_alpha(png);
+    }
+    if (code == VOCAB_PIXEL_BGR || code == VOCAB_PIXEL_BGRA) {
+        png_set_bgr(png);
+    }
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    img->resize(width, height);
+    if (png_get_rowbytes(png, info) != img->width() * img->getPixelSize())
+    {
+        png_destroy_read_struct(&png, &info, nullptr);
+        yCError(IMAGEFILE) << "PNG format not supported";
+        return false;
+    }
+    setRows(*img);
+    png_read_image(png, rows.data());
+    png_read_end(png, nullptr);
+    png_destroy_read_struct(&png, &info, nullptr);
+
+    if (img != &dest) {
+        dest.copy(*img);
+    }
+    return true;
+#else
+    yCError(IMAGEFILE) << "PNG library not available/not found";
+    return false;
+#endif
+}
+
+
+file::ImageCodec::ImageCodec() :
+        mPriv(new Private)
+{
+}
+
+file::ImageCodec::~ImageCodec()
+{
+    delete mPriv;
+}
+
+void file::ImageCodec::setJpegQuality(int quality)
+{
+    mPriv->jpegQuality = std::clamp(quality, 1, 100);
+}
+
+int file::ImageCodec::getJpegQuality() const
+{
+    return mPriv->jpegQuality;
+}
+
+void file::ImageCodec::setPngCompressionLevel(int level)
+{
+    mPriv->pngLevel = std::clamp(level, -1, 9);
+}
+
+int file::ImageCodec::getPngCompressionLevel() const
+{
+    return mPriv->pngLevel;
+}
+
+bool file::ImageCodec::encode(const Image& src, std::vector<unsigned char>& dest, image_fileformat format)
+{
+    if (src.width() == 0 || src.height() == 0)
+    {
+        yCError(IMAGEFILE) << "Cannot encode an empty image";
+        return false;
+    }
+    if (format == FORMAT_JPG)
+    {
+        return mPriv->encodeJpeg(src, dest);
+    }
+    else if (format == FORMAT_PNG)
+    {
+        return mPriv->encodePng(src, dest);
+    }
+    yCError(IMAGEFILE) << "Invalid format, operation not supported";
+    return false;
+}
+
+bool file::ImageCodec::decode(const unsigned char* data, size_t size, Image& dest)
+{
+    if (dest.getPixelCode() == VOCAB_PIXEL_INVALID)
+    {
+        yCError(IMAGEFILE) << "The pixel type of the destination image is not set";
+        return false;
+    }
+    if (isJpeg(data, size))
+    {
+        return mPriv->decodeJpeg(data, size, dest);
+    }
+    else if (isPng(data, size))
+    {
+        return mPriv->decodePng(data, size, dest);
+    }
+    yCError(IMAGEFILE) << "Unknown image format";
+    return false;
+}
+
+bool file::ImageCodec::write(const Image& src, const std::string& dest, image_fileformat format)
+{
+    if (!encode(src, mPriv->file, format))
+    {
+        return false;
+    }
+    FILE* fp = fopen(dest.c_str(), "wb");
+    if (!fp)
+    {
+        yCError(IMAGEFILE) << "Cannot open file" << dest << "for writing";
+        return false;
+    }
+    size_t written = fwrite(mPriv->file.data(), 1, mPriv->file.size(), fp);
+    bool ok = fclose(fp) == 0 && written == mPriv->file.size();
+    if (!ok)
+    {
+        yCError(IMAGEFILE) << "Error while writing" << dest;
+    }
+    return ok;
+}
+
+bool file::ImageCodec::read(Image& dest, const std::string& src)
+{
+    FILE* fp = fopen(src.c_str(), "rb");
+    if (!fp)
+    {
+        yCError(IMAGEFILE) << "Error: failed to open" << src;
+        return false;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    mPriv->file.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    size_t got = fread(mPriv->file.data(), 1, mPriv->file.size(), fp);
+    fclose(fp);
+    if (size <= 0 || got != mPriv->file.size())
+    {
+        yCError(IMAGEFILE) << "Error: failed to read" << src;
+        return false;
+    }
+    return decode(mPriv->file.data(), mPriv->file.size(), dest);
+}
+
+
+class file::ImageEncoderPool::Private
+{
+public:
+    explicit Private(size_t threads) :
+            workers(threads)
+    {
+        // a codec for each thread of the pool
+        for (size_t i = 0; i < workers.getThreads(); i++) {
+            codecs.push_back(std::make_unique<ImageCodec>());
+        }
+    }
+
+    yarp::os::WorkerPool workers;
+    std::vector<std::unique_ptr<ImageCodec>> codecs;
+};
+
+file::ImageEncoderPool::ImageEncoderPool(size_t threads) :
+        mPriv(new Private(threads))
+{
+}
+
+file::ImageEncoderPool::~ImageEncoderPool()
+{
+    delete mPriv;
+}
+
+size_t file::ImageEncoderPool::getThreads() const
+{
+    return mPriv->codecs.size();
+}
+
+void file::ImageEncoderPool::setJpegQuality(int quality)
+{
+    for (auto& codec : mPriv->codecs) {
+        codec->setJpegQuality(quality);
+    }
+}
+
+void file::ImageEncoderPool::setPngCompressionLevel(int level)
+{
+    for (auto& codec : mPriv->codecs) {
+        codec->setPngCompressionLevel(level);
+    }
+}
+
+bool file::ImageEncoderPool::encode(const std::vector<const Image*>& src, std::vector<std::vector<unsigned char>>& dest, image_fileformat format)
+{
+    dest.resize(src.size());
+    std::atomic<bool> ok{true};
+    mPriv->workers.run(src.size(), [&](size_t i, size_t thread) {
+        if (src[i] == nullptr || !mPriv->codecs[thread]->encode(*src[i], dest[i], format)) {
+            dest[i].clear();
+            ok = false;
+        }
+    });
+    return ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// public read methods
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool file::read(ImageOf<PixelRgb> & dest, const std::string& src, image_fileformat format)
+{
+    const char* file_ext = strrchr(src.c_str(), '.');
+    if (file_ext==nullptr)
+    {
+        yCError(IMAGEFILE) << "cannot find file extension in file name";
+        return false;
+    }
+
+    if (strcmp(file_ext, ".pgm")==0 ||
+        strcmp(file_ext, ".ppm")==0 ||
+        format == FORMAT_PGM ||
         format == FORMAT_PPM)
     {
         return ImageReadRGB_PxM(dest,src.c_str());
@@ -942,13 +1208,13 @@ bool file::read(ImageOf<PixelRgb> & dest, const std::string& src, image_fileform
     else if(strcmp(file_ext, ".png")==0 ||
             format == FORMAT_PNG)
     {
-        return ImageReadRGB_PNG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     else if(strcmp(file_ext, ".jpg") == 0 ||
             strcmp(file_ext, ".jpeg") == 0 ||
             format == FORMAT_JPG)
     {
-        return ImageReadRGB_JPG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     yCError(IMAGEFILE) << "unsupported file format";
     return false;
@@ -974,13 +1240,13 @@ bool file::read(ImageOf<PixelBgr> & dest, const std::string& src, image_fileform
     else if (strcmp(file_ext, ".png") == 0 ||
         format == FORMAT_PNG)
     {
-        return ImageReadBGR_PNG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     else if (strcmp(file_ext, ".jpg") == 0 ||
         strcmp(file_ext, ".jpeg") == 0 ||
         format == FORMAT_JPG)
     {
-        return ImageReadBGR_JPG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     yCError(IMAGEFILE) << "unsupported file format";
     return false;
@@ -1012,25 +1278,13 @@ bool file::read(ImageOf<PixelRgba> & dest, const std::string& src, image_filefor
     else if (strcmp(file_ext, ".png") == 0 ||
              format == FORMAT_PNG)
     {
-        ImageOf<PixelRgb> img2;
-        bool ok = ImageReadRGB_PNG(img2, src.c_str());
-        if (ok)
-        {
-            dest.copy(img2);
-        }
-        return ok;
+        return file::ImageCodec().read(dest, src);
     }
     else if (strcmp(file_ext, ".jpg") == 0 ||
         strcmp(file_ext, ".jpeg") == 0 ||
         format == FORMAT_JPG)
     {
-        ImageOf<PixelRgb> img2;
-        bool ok = ImageReadRGB_JPG(img2, src.c_str());
-        if (ok)
-        {
-            dest.copy(img2);
-        }
-        return ok;
+        return file::ImageCodec().read(dest, src);
     }
     yCError(IMAGEFILE) << "unsupported file format";
     return false;
@@ -1055,13 +1309,13 @@ bool file::read(ImageOf<PixelMono> & dest, const std::string& src, image_filefor
     else if (strcmp(file_ext, ".png") == 0 ||
              format == FORMAT_PNG)
     {
-        return ImageReadMono_PNG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     else if (strcmp(file_ext, ".jpg") == 0 ||
         strcmp(file_ext, ".jpeg") == 0 ||
         format == FORMAT_JPG)
     {
-        return ImageReadMono_JPG(dest, src.c_str());
+        return file::ImageCodec().read(dest, src);
     }
     yCError(IMAGEFILE) << "unsupported file format";
     return false;
@@ -1105,13 +1359,9 @@ bool file::write(const ImageOf<PixelRgb> & src, const std::string& dest, image_f
     {
         return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
     }
-    else  if (format == FORMAT_JPG)
+    else  if (format == FORMAT_JPG || format == FORMAT_PNG)
     {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
-    {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(src), dest.c_str());
+        return file::ImageCodec().write(src, dest, format);
     }
     else
     {
@@ -1122,19 +1372,15 @@ bool file::write(const ImageOf<PixelRgb> & src, const std::string& dest, image_f
 
 bool file::write(const ImageOf<PixelBgr> & src, const std::string& dest, image_fileformat format)
 {
-    ImageOf<PixelRgb> imgRGB;
-    imgRGB.copy(src);
     if (format == FORMAT_PPM)
     {
-        return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_JPG)
-    {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
+        ImageOf<PixelRgb> imgRGB;
+        imgRGB.copy(src);
+        return ImageWriteRGB(imgRGB, dest.c_str());
     }
-    else  if (format == FORMAT_PNG)
+    else  if (format == FORMAT_JPG || format == FORMAT_PNG)
     {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
+        return file::ImageCodec().write(src, dest, format);
     }
     else
     {
@@ -1146,19 +1392,15 @@ bool file::write(const ImageOf<PixelBgr> & src, const std::string& dest, image_f
 
 bool file::write(const ImageOf<PixelRgba> & src, const std::string& dest, image_fileformat format)
 {
-    ImageOf<PixelRgb> imgRGB;
-    imgRGB.copy(src);
     if (format == FORMAT_PPM)
     {
-        return ImageWriteRGB(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
+        ImageOf<PixelRgb> imgRGB;
+        imgRGB.copy(src);
+        return ImageWriteRGB(imgRGB, dest.c_str());
     }
-    else  if (format == FORMAT_JPG)
-    {
-        return ImageWriteJPG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
-    }
-    else  if (format == FORMAT_PNG)
+    else  if (format == FORMAT_JPG || format == FORMAT_PNG)
     {
-        return ImageWritePNG(const_cast<ImageOf<PixelRgb> &>(imgRGB), dest.c_str());
+        return file::ImageCodec().write(src, dest, format);
     }
     else
     {
@@ -1176,7 +1418,7 @@ bool file::write(const ImageOf<PixelMono> & src, const std::string& dest, image_
     }
     else  if (format == FORMAT_PNG)
     {
-        return ImageWritePNG(const_cast<ImageOf<PixelMono> &>(src), dest.c_str());
+        return file::ImageCodec().write(src, dest, format);
     }
     else
     {
@@ -1229,7 +1471,7 @@ bool file::write(const Image& src, const std::string& dest, image_fileformat for
     {
         ImageOf<PixelRgb> img;
         img.copy(src);
-        return write(img,dest);
+        return write(img, dest, format);
     }
 }
 
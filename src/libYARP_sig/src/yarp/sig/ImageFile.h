@@ -8,6 +8,7 @@
 #define YARP_SIG_IMAGEFILE_H
 
 #include <string>
+#include <vector>
 #include <yarp/sig/Image.h>
 
 namespace yarp::sig::file {
@@ -37,6 +38,126 @@ bool YARP_sig_API write(const ImageOf<PixelRgba>& src,  const std::string& dest,
 bool YARP_sig_API write(const ImageOf<PixelMono>& src,  const std::string& dest, image_fileformat format = FORMAT_PGM);
 bool YARP_sig_API write(const ImageOf<PixelFloat>& src, const std::string& dest, image_fileformat format = FORMAT_NUMERIC);
 bool YARP_sig_API write(const Image& src,               const std::string& dest, image_fileformat format = FORMAT_PPM);
+
+/**
+ * Encoder and decoder of JPG and PNG images in memory.
+ *
+ * The codec keeps its state between the calls, i.e. the JPG compressor
+ * and decompressor, and the buffers for the rows and for the files, so that
+ * a stream of images can be encoded or decoded without allocations.
+ * A codec must be used by one thread at a time.
+ *
+ * The RGB, BGR, RGBA, BGRA and MONO images are encoded and decoded
+ * directly, the other ones are converted from/to RGB.  The alpha channel is
+ * not stored when encoding.  When decoding to RGBA or BGRA, the alpha channel
+ * of a PNG image is kept, and it is set to 255 if the image has none.
+ */
+class YARP_sig_API ImageCodec
+{
+public:
+    ImageCodec();
+    ImageCodec(const ImageCodec&) = delete;
+    ImageCodec(ImageCodec&&) noexcept = delete;
+    ImageCodec& operator=(const ImageCodec&) = delete;
+    ImageCodec& operator=(ImageCodec&&) noexcept = delete;
+    ~ImageCodec();
+
+    /**
+     * Set the quality of the JPG images, between 1 and 100 (default: 100).
+     */
+    void setJpegQuality(int quality);
+    int getJpegQuality() const;
+
+    /**
+     * Set the zlib compression level of the PNG images, between 0 (faster)
+     * and 9 (smaller), or -1 for the default of libpng.
+     */
+    void setPngCompressionLevel(int level);
+    int getPngCompressionLevel() const;
+
+    /**
+     * Encode an image.
+     *
+     * @param src the image
+     * @param dest the encoded image; its memory is reused
+     * @param format FORMAT_JPG or FORMAT_PNG
+     * @return true on success
+     */
+    bool encode(const Image& src, std::vector<unsigned char>& dest, image_fileformat format);
+
+    /**
+     * Decode an image, whose format is detected from its content.
+     *
+     * @param data the encoded image
+     * @param size the size of the encoded image
+     * @param dest the decoded image; its pixel type must be set, and it is
+     *             resized to the size of the image
+     * @return true on success
+     */
+    bool decode(const unsigned char* data, size_t size, Image& dest);
+
+    /**
+     * Encode an image and write it to a file.
+     */
+    bool write(const Image& src, const std::string& dest, image_fileformat format);
+
+    /**
+     * Read a file and decode it.
+     */
+    bool read(Image& dest, const std::string& src);
+
+private:
+    class Private;
+    Private* mPriv;
+};
+
+/**
+ * Encode batches of images on several threads.
+ *
+ * The threads, and the ImageCodec used by each of them, are kept between the
+ * batches.
+ */
+class YARP_sig_API ImageEncoderPool
+{
+public:
+    /**
+     * @param threads the number of threads, 0 for one per core
+     */
+    explicit ImageEncoderPool(size_t threads = 0);
+    ImageEncoderPool(const ImageEncoderPool&) = delete;
+    ImageEncoderPool(ImageEncoderPool&&) noexcept = delete;
+    ImageEncoderPool& operator=(const ImageEncoderPool&) = delete;
+    ImageEncoderPool& operator=(ImageEncoderPool&&) noexcept = delete;
+    ~ImageEncoderPool();
+
+    size_t getThreads() const;
+
+    /**
+     * @see ImageCodec::setJpegQuality()
+     */
+    void setJpegQuality(int quality);
+
+    /**
+     * @see ImageCodec::setPngCompressionLevel()
+     */
+    void setPngCompressionLevel(int level);
+
+    /**
+     * Encode some images.
+     *
+     * @param src the images
+     * @param dest the encoded images, resized to the number of images; the
+     *             ones that cannot be encoded are left empty
+     * @param format FORMAT_JPG or FORMAT_PNG
+     * @return true if all the images were encoded
+     */
+    bool encode(const std::vector<const Image*>& src, std::vector<std::vector<unsigned char>>& dest, image_fileformat format);
+
+private:
+    class Private;
+    Private* mPriv;
+};
+
 } // namespace yarp::sig::file
 
 #endif // YARP_SIG_IMAGEFILE_H
@@ -0,0 +1,284 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SIG_MATRIXN_H
+#define YARP_SIG_MATRIXN_H
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/ConnectionReader.h>
+#include <yarp/os/ConnectionWriter.h>
+#include <yarp/os/Portable.h>
+#include <yarp/os/Log.h>
+
+#include <yarp/sig/Matrix.h>
+#include <yarp/sig/VectorN.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+namespace yarp::sig {
+
+/**
+ * \ingroup sig_class
+ *
+ * A matrix of fixed size, known at compile time, whose elements are stored
+ * (row by row) in the object itself instead of on the heap.
+ *
+ * It is meant for the small quantities (rotations, homogeneous
+ * transformations, ...) that are handled in the hot loops, where the
+ * allocations of a yarp::sig::Matrix are not acceptable.
+ *
+ * The format on the network is the same of yarp::sig::Matrix, therefore a
+ * MatrixN can be sent to a port that reads a Matrix and vice versa.
+ * Reading a matrix of a different size fails.
+ */
+template <class T, size_t R, size_t C>
+class MatrixN : public yarp::os::Portable
+{
+private:
+    std::array<T, R * C> m_data {};
+
+public:
+    using value_type = T;
+
+    /**
+     * Build a matrix with all the elements set to zero.
+     */
+    MatrixN() = default;
+
+    /**
+     * Build a matrix from a list of values, row by row.  The elements that
+     * are not in the list are set to zero, the values in excess are ignored.
+     */
+    MatrixN(std::initializer_list<T> values)
+    {
+        std::copy_n(values.begin(), std::min(values.size(), R * C), m_data.begin());
+    }
+
+    /**
+     * Build a matrix from a yarp::sig::Matrix of the same size.
+     */
+    explicit MatrixN(const Matrix& m)
+    {
+        *this = m;
+    }
+
+    MatrixN(const MatrixN& r) = default;
+    MatrixN& operator=(const MatrixN& r) = default;
+    MatrixN(MatrixN&& other) noexcept = default;
+    MatrixN& operator=(MatrixN&& other) noexcept = default;
+    ~MatrixN() override = default;
+
+    /**
+     * Copy the elements of a yarp::sig::Matrix of the same size.
+     */
+    MatrixN& operator=(const Matrix& m)
+    {
+        yAssert(m.rows() == R && m.cols() == C);
+        std::transform(m.data(), m.data() + R * C, m_data.begin(), [](double v) { return static_cast<T>(v); });
+        return *this;
+    }
+
+    /**
+     * Set all elements of the matrix to a scalar.
+     */
+    MatrixN& operator=(T v)
+    {
+        m_data.fill(v);
+        return *this;
+    }
+
+    /**
+     * Copy the elements to a yarp::sig::Matrix, resizing it if needed (i.e.
+     * without allocating memory if it has already the right size).
+     */
+    void toMatrix(Matrix& m) const
+    {
+        m.resize(R, C);
+        std::transform(m_data.begin(), m_data.end(), m.data(), [](T v) { return static_cast<double>(v); });
+    }
+
+    /**
+     * @return a yarp::sig::Matrix with the same elements.
+     */
+    Matrix toMatrix() const
+    {
+        Matrix m;
+        toMatrix(m);
+        return m;
+    }
+
+    static constexpr size_t rows() { return R; }
+    static constexpr size_t cols() { return C; }
+
+    inline T* data() { return m_data.data(); }
+    inline const T* data() const { return m_data.data(); }
+
+    /**
+     * Single element access, no range check.
+     * @return a pointer to the first element of the r-th row.
+     */
+    inline T* operator[](size_t r) { return m_data.data() + r * C; }
+    inline const T* operator[](size_t r) const { return m_data.data() + r * C; }
+
+    inline T& operator()(size_t r, size_t c) { return m_data[r * C + c]; }
+    inline const T& operator()(size_t r, size_t c) const { return m_data[r * C + c]; }
+
+    /**
+     * Zero the elements of the matrix.
+     */
+    void zero()
+    {
+        m_data.fill(T(0));
+    }
+
+    /**
+     * Build an identity matrix (the elements out of the diagonal are zero).
+     */
+    const MatrixN& eye()
+    {
+        zero();
+        for (size_t i = 0; i < std::min(R, C); ++i) {
+            (*this)(i, i) = T(1);
+        }
+        return *this;
+    }
+
+    /**
+     * @return the r-th row.
+     */
+    VectorN<T, C> getRow(size_t r) const
+    {
+        VectorN<T, C> ret;
+        std::copy_n(m_data.data() + r * C, C, ret.data());
+        return ret;
+    }
+
+    /**
+     * @return the c-th column.
+     */
+    VectorN<T, R> getCol(size_t c) const
+    {
+        VectorN<T, R> ret;
+        for (size_t r = 0; r < R; ++r) {
+            ret[r] = (*this)(r, c);
+        }
+        return ret;
+    }
+
+    /**
+     * @return the transposed matrix.
+     */
+    MatrixN<T, C, R> transposed() const
+    {
+        MatrixN<T, C, R> ret;
+        for (size_t r = 0; r < R; ++r) {
+            for (size_t c = 0; c < C; ++c) {
+                ret(c, r) = (*this)(r, c);
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * Creates a string object containing a text representation of the
+     * object, in the same format of Matrix::toString().
+     */
+    std::string toString(int precision = -1, int width = -1, const char* endRowStr = "\n") const
+    {
+        return toMatrix().toString(precision, width, endRowStr);
+    }
+
+    bool operator==(const MatrixN& r) const
+    {
+        return m_data == r.m_data;
+    }
+
+    bool read(yarp::os::ConnectionReader& connection) override
+    {
+        // auto-convert text mode interaction
+        connection.convertTextMode();
+        connection.expectInt32(); // outer list tag
+        connection.expectInt32(); // outer list length
+        connection.expectInt32(); // rows tag
+        const std::int32_t rows = connection.expectInt32();
+        connection.expectInt32(); // cols tag
+        const std::int32_t cols = connection.expectInt32();
+        connection.expectInt32(); // list tag
+        const std::int32_t listLen = connection.expectInt32();
+        if (connection.isError() ||
+            rows != static_cast<std::int32_t>(R) ||
+            cols != static_cast<std::int32_t>(C) ||
+            listLen != static_cast<std::int32_t>(R * C)) {
+            return false;
+        }
+        for (auto& v : m_data) {
+            v = static_cast<T>(connection.expectFloat64());
+        }
+        return !connection.isError();
+    }
+
+    bool write(yarp::os::ConnectionWriter& connection) const override
+    {
+        connection.appendInt32(BOTTLE_TAG_LIST);
+        connection.appendInt32(3);
+        connection.appendInt32(BOTTLE_TAG_INT32);
+        connection.appendInt32(static_cast<std::int32_t>(R));
+        connection.appendInt32(BOTTLE_TAG_INT32);
+        connection.appendInt32(static_cast<std::int32_t>(C));
+        connection.appendInt32(BOTTLE_TAG_LIST | BOTTLE_TAG_FLOAT64);
+        connection.appendInt32(static_cast<std::int32_t>(R * C));
+        for (const auto& v : m_data) {
+            connection.appendFloat64(static_cast<double>(v));
+        }
+
+        // if someone is foolish enough to connect in text mode,
+        // let them see something readable.
+        connection.convertTextMode();
+
+        return !connection.isError();
+    }
+};
+
+/**
+ * Matrix-matrix product of fixed size matrices.
+ */
+template <class T, size_t R, size_t K, size_t C>
+MatrixN<T, R, C> operator*(const MatrixN<T, R, K>& a, const MatrixN<T, K, C>& b)
+{
+    MatrixN<T, R, C> ret;
+    for (size_t r = 0; r < R; ++r) {
+        for (size_t k = 0; k < K; ++k) {
+            const T v = a(r, k);
+            for (size_t c = 0; c < C; ++c) {
+                ret(r, c) += v * b(k, c);
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * Matrix-vector product of a fixed size matrix and vector.
+ */
+template <class T, size_t R, size_t C>
+VectorN<T, R> operator*(const MatrixN<T, R, C>& m, const VectorN<T, C>& v)
+{
+    VectorN<T, R> ret;
+    for (size_t r = 0; r < R; ++r) {
+        T sum = T(0);
+        for (size_t c = 0; c < C; ++c) {
+            sum += m(r, c) * v[c];
+        }
+        ret[r] = sum;
+    }
+    return ret;
+}
+
+} // namespace yarp::sig
+
+#endif // YARP_SIG_MATRIXN_H
@@ -6,6 +6,7 @@
 #ifndef YARP_SIG_POINTCLOUDUTILS_INL_H
 #define YARP_SIG_POINTCLOUDUTILS_INL_H
 
+#include <algorithm>
 #include <type_traits>
 
 namespace {
@@ -69,62 +70,59 @@ yarp::sig::PointCloud<T1> yarp::sig::utils::depthRgbToPC(const yarp::sig::ImageO
 {
     yAssert(depth.width()  != 0);
     yAssert(depth.height() != 0);
+    yarp::sig::PointCloud<T1> pointCloud;
+    yarp::sig::utils::PointCloudProjector(intrinsic).depthRgbToPC(depth, color, pointCloud, organizationType, step_x, step_y, output_order);
+    return pointCloud;
+}
+
+template<typename T1, typename T2>
+void yarp::sig::utils::PointCloudProjector::depthRgbToPC(const yarp::sig::ImageOf<yarp::sig::PixelFloat>& depth,
+                                                        const yarp::sig::ImageOf<T2>& color,
+                                                        yarp::sig::PointCloud<T1>& pointCloud,
+                                                        const yarp::sig::utils::OrganizationType organizationType,
+                                                        size_t step_x,
+                                                        size_t step_y,
+                                                        const std::string& output_order)
+{
     yAssert(depth.width()  == color.width());
     yAssert(depth.height() == color.height());
     size_t w = depth.width();
     size_t h = depth.height();
-    yarp::sig::PointCloud<T1> pointCloud;
-    if (organizationType == yarp::sig::utils::OrganizationType::Organized)
-    {
-        pointCloud.resize(w/step_x, h/step_y);
+    step_x = std::max<size_t>(step_x, 1);
+    step_y = std::max<size_t>(step_y, 1);
+
+    // The organized point cloud has only the complete steps, while the
+    // unorganized one has all the pixels sampled, stored column by column
+    bool organized = (organizationType == yarp::sig::utils::OrganizationType::Organized);
+    size_t size_x = organized ? w / step_x : (w + step_x - 1) / step_x;
+    size_t size_y = organized ? h / step_y : (h + step_y - 1) / step_y;
+    if (organized) {
+        pointCloud.resize(size_x, size_y);
+    } else {
+        pointCloud.resize(size_x * size_y);
+    }
+    if (size_x == 0 || size_y == 0) {
+        return;
     }
 
-    const char* mapping = output_order.c_str();
-    double values_xyz[3];
-    char axes[3] = {mapping[1], mapping[3], mapping[5]};
-    for (size_t u = 0, cu = 0; u < w; u+=step_x, cu++)
-    {
-        for (size_t v = 0, cv = 0; v < h; v+=step_y, cv++)
-        {
-            double dp = depth.pixel(u, v);
-            if (organizationType == yarp::sig::utils::OrganizationType::Organized)
-            {
-                // Depth
-                // De-projection equation (pinhole model):
-                //                          x = (u - ppx)/ fx * z
-                //                          y = (v - ppy)/ fy * z
-                //                          z = z
-                values_xyz[0] = (u - intrinsic.principalPointX)/intrinsic.focalLengthX*depth.pixel(u,v);
-                values_xyz[1] = (v - intrinsic.principalPointY)/intrinsic.focalLengthY*depth.pixel(u,v);
-                values_xyz[2] = dp;
-                pointCloud(cu, cv).x = (mapping[0] == '-') ? (-values_xyz[axes[0] - 'X']) : (values_xyz[axes[0] - 'X']);
-                pointCloud(cu, cv).y = (mapping[2] == '-') ? (-values_xyz[axes[1] - 'X']) : (values_xyz[axes[1] - 'X']);
-                pointCloud(cu, cv).z = (mapping[4] == '-') ? (-values_xyz[axes[2] - 'X']) : (values_xyz[axes[2] - 'X']);
-                //copyColorData(pointCloud, color, u, v);
-                pointCloud(cu,cv).r = color.pixel(u,v).r;
-                pointCloud(cu,cv).g = color.pixel(u,v).g;
-                pointCloud(cu,cv).b = color.pixel(u,v).b;
-            }
-            else if (organizationType == yarp::sig::utils::OrganizationType::Unorganized)
-            {
-                //if ( dp > 0) //why?
-                {
-                    T1 point;
-                    values_xyz[0] = (u - intrinsic.principalPointX)/intrinsic.focalLengthX*depth.pixel(u,v);
-                    values_xyz[1] = (v - intrinsic.principalPointY)/intrinsic.focalLengthY*depth.pixel(u,v);
-                    values_xyz[2] = dp;
-                    point.x = (mapping[0] == '-') ? (-values_xyz[axes[0] - 'X']) : (values_xyz[axes[0] - 'X']);
-                    point.y = (mapping[2] == '-') ? (-values_xyz[axes[1] - 'X']) : (values_xyz[axes[1] - 'X']);
-                    point.z = (mapping[4] == '-') ? (-values_xyz[axes[2] - 'X']) : (values_xyz[axes[2] - 'X']);
-                    point.r = color.pixel(u,v).r;
-                    point.g = color.pixel(u,v).g;
-                    point.b = color.pixel(u,v).b;
-                    pointCloud.push_back(point);
-                }
+    updateRays(w, h);
+    const Axes axes = parseAxes(output_order);
+
+    forEachRows(size_y, [&](size_t begin, size_t end) {
+        for (size_t cv = begin; cv < end; cv++) {
+            size_t v = cv * step_y;
+            const float* row = reinterpret_cast<const float*>(depth.getRow(v));
+            const T2* colorRow = reinterpret_cast<const T2*>(color.getRow(v));
+            const float rayY = m_rayY[v];
+            for (size_t cu = 0, u = 0; cu < size_x; cu++, u += step_x) {
+                T1& point = organized ? pointCloud(cu, cv) : pointCloud(cu * size_y + cv);
+                setPoint(point, m_rayX[u], rayY, row[u], axes);
+                point.r = colorRow[u].r;
+                point.g = colorRow[u].g;
+                point.b = colorRow[u].b;
             }
         }
-    }
-    return pointCloud;
+    });
 }
 
 #endif // YARP_SIG_POINTCLOUDUTILS_INL_H
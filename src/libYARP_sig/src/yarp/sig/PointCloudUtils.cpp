@@ -4,8 +4,10 @@
  */
 
 #include <yarp/sig/PointCloudUtils.h>
+#include <yarp/os/WorkerPool.h>
 #include <algorithm>
 #include <cstring>
+#include <thread>
 
 using namespace yarp::sig;
 
@@ -18,22 +20,8 @@ PointCloud<DataXYZ> utils::depthToPC(const yarp::sig::ImageOf<PixelFloat> &depth
 {
     yCAssert(POINTCLOUDUTILS, depth.width()  != 0);
     yCAssert(POINTCLOUDUTILS, depth.height() != 0);
-    size_t w = depth.width();
-    size_t h = depth.height();
     PointCloud<DataXYZ> pointCloud;
-    pointCloud.resize(w, h);
-
-    for (size_t u = 0; u < w; ++u) {
-        for (size_t v = 0; v < h; ++v) {
-            // De-projection equation (pinhole model):
-            //                          x = (u - ppx)/ fx * z
-            //                          y = (v - ppy)/ fy * z
-            //                          z = z
-            double x = (u - intrinsic.principalPointX)/intrinsic.focalLengthX*depth.pixel(u,v);
-            double y = (v - intrinsic.principalPointY)/intrinsic.focalLengthY*depth.pixel(u,v);
-            double z = depth.pixel(u,v);
-        }
-    }
+    PointCloudProjector(intrinsic).depthToPC(depth, pointCloud);
     return pointCloud;
 }
 
@@ -46,7 +34,95 @@ PointCloud<DataXYZ> utils::depthToPC(const yarp::sig::ImageOf<PixelFloat>& depth
 {
     yCAssert(POINTCLOUDUTILS, depth.width() != 0);
     yCAssert(POINTCLOUDUTILS, depth.height() != 0);
+    PointCloud<DataXYZ> pointCloud;
+    PointCloudProjector(intrinsic).depthToPC(depth, pointCloud, roi, step_x, step_y, output_order);
+    return pointCloud;
+}
+
+
+utils::PointCloudProjector::PointCloudProjector(const IntrinsicParams& intrinsic, size_t threads)
+{
+    setIntrinsic(intrinsic);
+    setThreads(threads);
+}
+
+void utils::PointCloudProjector::setIntrinsic(const IntrinsicParams& intrinsic)
+{
+    m_focalLengthX = intrinsic.focalLengthX;
+    m_focalLengthY = intrinsic.focalLengthY;
+    m_principalPointX = intrinsic.principalPointX;
+    m_principalPointY = intrinsic.principalPointY;
+    // Computed again for the next image
+    m_rayX.clear();
+    m_rayY.clear();
+}
+
+void utils::PointCloudProjector::setThreads(size_t threads)
+{
+    m_threads = (threads == 0) ? std::max<size_t>(std::thread::hardware_concurrency(), 1) : threads;
+    if (m_threads > 1) {
+        m_workers = std::make_shared<yarp::os::WorkerPool>(m_threads);
+    } else {
+        m_workers.reset();
+    }
+}
+
+void utils::PointCloudProjector::updateRays(size_t width, size_t height)
+{
+    // De-projection equation (pinhole model):
+    //                          x = (u - ppx)/ fx * z
+    //                          y = (v - ppy)/ fy * z
+    //                          z = z
+    if (m_rayX.size() != width) {
+        m_rayX.resize(width);
+        for (size_t u = 0; u < width; u++) {
+            m_rayX[u] = static_cast<float>((u - m_principalPointX) / m_focalLengthX);
+        }
+    }
+    if (m_rayY.size() != height) {
+        m_rayY.resize(height);
+        for (size_t v = 0; v < height; v++) {
+            m_rayY[v] = static_cast<float>((v - m_principalPointY) / m_focalLengthY);
+        }
+    }
+}
+
+utils::PointCloudProjector::Axes utils::PointCloudProjector::parseAxes(const std::string& output_order)
+{
+    Axes axes;
+    if (output_order == "+X+Y+Z") {
+        return axes;
+    }
+    yCAssert(POINTCLOUDUTILS, output_order.size() >= 6);
+    axes.identity = false;
+    for (size_t i = 0; i < 3; i++) {
+        axes.sign[i] = (output_order[2 * i] == '-') ? -1.0f : 1.0f;
+        char axis = output_order[2 * i + 1];
+        yCAssert(POINTCLOUDUTILS, axis >= 'X' && axis <= 'Z');
+        axes.index[i] = static_cast<size_t>(axis - 'X');
+    }
+    return axes;
+}
 
+void utils::PointCloudProjector::forEachRows(size_t rows, const std::function<void(size_t begin, size_t end)>& job) const
+{
+    size_t count = std::min(m_threads, rows);
+    if (count <= 1) {
+        job(0, rows);
+        return;
+    }
+    m_workers->run(count, [&](size_t i, size_t) {
+        job(rows * i / count, rows * (i + 1) / count);
+    });
+}
+
+void utils::PointCloudProjector::depthToPC(const ImageOf<PixelFloat>& depth,
+                                           PointCloud<DataXYZ>& pointCloud,
+                                           const PCL_ROI& roi,
+                                           size_t step_x,
+                                           size_t step_y,
+                                           const std::string& output_order)
+{
     size_t max_x = roi.max_x == 0 ? depth.width()  : std::min(roi.max_x, depth.width());
     size_t max_y = roi.max_y == 0 ? depth.height() : std::min(roi.max_y, depth.height());
     size_t min_x = std::min(roi.min_x, max_x);
@@ -55,30 +131,36 @@ PointCloud<DataXYZ> utils::depthToPC(const yarp::sig::ImageOf<PixelFloat>& depth
     step_x = std::max<size_t>(std::min(step_x, max_x - min_x), 1);
     step_y = std::max<size_t>(std::min(step_y, max_y - min_y), 1);
 
-    PointCloud<DataXYZ> pointCloud;
     size_t size_x = (max_x - min_x) / step_x;
     size_t size_y = (max_y - min_y) / step_y;
     pointCloud.resize(size_x, size_y);
+    if (size_x == 0 || size_y == 0) {
+        return;
+    }
+
+    updateRays(depth.width(), depth.height());
+    const Axes axes = parseAxes(output_order);
 
-    const char* mapping = output_order.c_str();
-    double values_xyz[3];
-    char axes[3] = {mapping[1], mapping[3], mapping[5]};
-    for (size_t i = 0, u = min_x; u < max_x; i++, u += step_x)
-    {
-        for (size_t j = 0, v = min_y; v < max_y; j++, v += step_y)
-        {
-            // De-projection equation (pinhole model):
-            //                          x = (u - ppx)/ fx * z
-            //                          y = (v - ppy)/ fy * z
-            //                          z = z
-            values_xyz[0] = (u - intrinsic.principalPointX) / intrinsic.focalLengthX * depth.pixel(u, v);
-            values_xyz[1] = (v - intrinsic.principalPointY) / intrinsic.focalLengthY * depth.pixel(u, v);
-            values_xyz[2] = depth.pixel(u, v);
-
-            pointCloud(i,j).x = (mapping[0] == '-') ? (-values_xyz[axes[0] - 'X']) : (values_xyz[axes[0] - 'X']);
-            pointCloud(i,j).y = (mapping[2] == '-') ? (-values_xyz[axes[1] - 'X']) : (values_xyz[axes[1] - 'X']);
-            pointCloud(i,j).z = (mapping[4] == '-') ? (-values_xyz[axes[2] - 'X']) : (values_xyz[axes[2] - 'X']);
+    forEachRows(size_y, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; j++) {
+            size_t v = min_y + j * step_y;
+            const auto* row = reinterpret_cast<const float*>(depth.getRow(v));
+            const float rayY = m_rayY[v];
+            DataXYZ* points = &pointCloud(0, j);
+            if (axes.identity && step_x == 1) {
+                // The common case, in a loop that the compiler can vectorize
+                const float* rayX = m_rayX.data() + min_x;
+                const float* z = row + min_x;
+                for (size_t i = 0; i < size_x; i++) {
+                    points[i].x = rayX[i] * z[i];
+                    points[i].y = rayY * z[i];
+                    points[i].z = z[i];
+                }
+            } else {
+                for (size_t i = 0, u = min_x; i < size_x; i++, u += step_x) {
+                    setPoint(points[i], m_rayX[u], rayY, row[u], axes);
+                }
+            }
         }
-    }
-    return pointCloud;
+    });
 }
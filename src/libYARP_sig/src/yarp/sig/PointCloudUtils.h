@@ -10,6 +10,15 @@
 #include <yarp/sig/IntrinsicParams.h>
 #include <yarp/sig/PointCloud.h>
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yarp::os {
+class WorkerPool;
+}
+
 namespace yarp::sig::utils {
 
 enum class OrganizationType{
@@ -80,6 +89,121 @@ yarp::sig::PointCloud<T1> depthRgbToPC(const yarp::sig::ImageOf<yarp::sig::Pixel
                                        size_t step_x=1,
                                        size_t step_y=1,
                                        const std::string& output_order = "+X+Y+Z");
+
+/**
+ * @brief The PointCloudProjector class converts the depth images of a camera
+ * to point clouds, as depthToPC() and depthRgbToPC() do, for a stream of images.
+ *
+ * The rays of the columns and of the rows of the image, (u - ppx) / fx and
+ * (v - ppy) / fy, are computed once for the intrinsic parameters and the
+ * size of the images, so that each point costs just two multiplications.
+ * The images are traversed row by row, and the rows can be split among a
+ * few threads.  The point clouds given by the caller are reused, therefore
+ * converting images of the same size does not allocate memory.
+ *
+ * The points are computed in single precision, and can differ from the ones
+ * computed by the functions in the last bit.
+ *
+ * @note the methods of an instance must not be called concurrently.
+ */
+class YARP_sig_API PointCloudProjector
+{
+public:
+    /**
+     * @param[in] intrinsic, intrinsic parameters of the camera.
+     * @param[in] threads, the number of threads converting the images, 0 for
+     * one per CPU core.
+     */
+    explicit PointCloudProjector(const yarp::sig::IntrinsicParams& intrinsic = {}, size_t threads = 1);
+
+    /**
+     * @brief Set the intrinsic parameters of the camera.
+     */
+    void setIntrinsic(const yarp::sig::IntrinsicParams& intrinsic);
+
+    /**
+     * @brief Set the number of threads converting the images, 0 for one per
+     * CPU core.
+     */
+    void setThreads(size_t threads);
+
+    /**
+     * @brief Compute the point cloud of a depth image, see depthToPC().
+     * @param[in] depth, the input depth image.
+     * @param[out] pointCloud, the point cloud, resized to the ROI decimated by
+     * step_x and step_y.
+     * @param[in] roi, the Region Of Interest of the depth image, the whole
+     * image by default.
+     * @param[in] step_x, the decimation of the columns.
+     * @param[in] step_y, the decimation of the rows.
+     * @param[in] output_order, the rearrangement of the axes, e.g. "+Z-Y+X".
+     */
+    void depthToPC(const yarp::sig::ImageOf<yarp::sig::PixelFloat>& depth,
+                   yarp::sig::PointCloud<yarp::sig::DataXYZ>& pointCloud,
+                   const yarp::sig::utils::PCL_ROI& roi = {},
+                   size_t step_x = 1,
+                   size_t step_y = 1,
+                   const std::string& output_order = "+X+Y+Z");
+
+    /**
+     * @brief Compute the colored point cloud of a depth image, see depthRgbToPC().
+     * @param[in] depth, the input depth image.
+     * @param[in] color, the input color image.
+     * @param[out] pointCloud, the point cloud.
+     * @param[in] organizationType, if unorganized the points are stored
+     * column-wise in a point cloud of height 1.
+     * @param[in] step_x, the decimation of the columns.
+     * @param[in] step_y, the decimation of the rows.
+     * @param[in] output_order, the rearrangement of the axes, e.g. "+Z-Y+X".
+     */
+    template <typename T1, typename T2>
+    void depthRgbToPC(const yarp::sig::ImageOf<yarp::sig::PixelFloat>& depth,
+                      const yarp::sig::ImageOf<T2>& color,
+                      yarp::sig::PointCloud<T1>& pointCloud,
+                      const yarp::sig::utils::OrganizationType organizationType = yarp::sig::utils::OrganizationType::Organized,
+                      size_t step_x = 1,
+                      size_t step_y = 1,
+                      const std::string& output_order = "+X+Y+Z");
+
+private:
+    // The source axis and the sign of each output axis
+    struct Axes
+    {
+        size_t index[3]{0, 1, 2};
+        float sign[3]{1.0f, 1.0f, 1.0f};
+        bool identity{true};
+    };
+
+    static Axes parseAxes(const std::string& output_order);
+
+    template <typename T>
+    static void setPoint(T& point, float rayX, float rayY, float z, const Axes& axes)
+    {
+        if (axes.identity) {
+            point.x = rayX * z;
+            point.y = rayY * z;
+            point.z = z;
+        } else {
+            const float values[3] = {rayX * z, rayY * z, z};
+            point.x = axes.sign[0] * values[axes.index[0]];
+            point.y = axes.sign[1] * values[axes.index[1]];
+            point.z = axes.sign[2] * values[axes.index[2]];
+        }
+    }
+
+    void updateRays(size_t width, size_t height);
+    void forEachRows(size_t rows, const std::function<void(size_t begin, size_t end)>& job) const;
+
+    double m_focalLengthX;
+    double m_focalLengthY;
+    double m_principalPointX;
+    double m_principalPointY;
+    size_t m_threads;
+    std::shared_ptr<yarp::os::WorkerPool> m_workers; // shared by the copies
+    std::vector<float> m_rayX;
+    std::vector<float> m_rayY;
+};
+
 } // namespace yarp::sig::utils
 
 #include <yarp/sig/PointCloudUtils-inl.h>
@@ -15,6 +15,7 @@
 #include <yarp/os/ConnectionReader.h>
 #include <yarp/os/ConnectionWriter.h>
 
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <vector>
@@ -200,14 +201,11 @@ Sound Sound::subSound(size_t first_sample, size_t len)
     s.resize(out_len, this->m_channels);
     s.setFrequency(this->m_frequency);
 
-    //safe implementation
-    size_t j=0;
-    for (size_t i=first_sample; i<last_sample; i++)
+    for (size_t c = 0; c < this->m_channels; c++)
     {
-        for (size_t c = 0; c < this->m_channels; c++) {
-            s.set(this->get(i, c), j, c);
-        }
-        j++;
+        const unsigned char* src = getRawData() + (c * m_samples + first_sample) * m_bytesPerSample;
+        unsigned char* dst = s.getRawData() + c * out_len * m_bytesPerSample;
+        memcpy(dst, src, out_len * m_bytesPerSample);
     }
     return s;
 }
@@ -325,13 +323,10 @@ void Sound::zero()
 
 bool Sound::zeroChannel(size_t chan)
 {
-    if (chan > this->m_channels) {
+    if (chan >= this->m_channels) {
         return false;
     }
-    for (size_t i = 0; i < this->m_samples; i++)
-    {
-        set(0, i, chan);
-    }
+    memset(getRawData() + chan * m_samples * m_bytesPerSample, 0, m_samples * m_bytesPerSample);
 
     //invalidate all the markers
     m_markers.clear();
@@ -554,18 +549,7 @@ bool Sound::operator==(const Sound& alt) const
         return false;
     }
 
-    for (size_t ch = 0; ch < this->m_channels; ch++)
-    {
-        for (size_t s = 0; s < this->m_samples; s++)
-        {
-            if (this->getSafe(s, ch) != alt.getSafe(s, ch))
-            {
-                return false;
-            }
-        }
-    }
-
-    return true;
+    return getRawDataSize() == 0 || memcmp(getRawData(), alt.getRawData(), getRawDataSize()) == 0;
 }
 
 bool Sound::replaceChannel(size_t id, Sound schannel)
@@ -576,10 +560,10 @@ bool Sound::replaceChannel(size_t id, Sound schannel)
     if (this->m_samples != schannel.getSamples()) {
         return false;
     }
-    for (size_t s = 0; s < this->m_samples; s++)
-    {
-        this->setSafe(schannel.getSafe(s, 0), s, id);
+    if (id >= this->m_channels || schannel.getBytesPerSample() != m_bytesPerSample) {
+        return false;
     }
+    memcpy(getRawData() + id * m_samples * m_bytesPerSample, schannel.getRawData(), m_samples * m_bytesPerSample);
 
     //invalidate all the markers
     m_markers.clear();
@@ -589,51 +573,154 @@ bool Sound::replaceChannel(size_t id, Sound schannel)
 
 std::vector<std::reference_wrapper<Sound::audio_sample>> Sound::getChannel(size_t channel_id)
 {
-    auto* pp = ((std::vector<NetUint16>*)(implementation))->data() + channel_id*m_samples;
-
-    std::vector<std::reference_wrapper<audio_sample>> vec;
-    vec.reserve(this->m_samples);
-    for (size_t t = 0; t < this->m_samples; t++)
-    {
-        unsigned char *addr = (unsigned char* )(pp);
-        audio_sample*  addr2 = reinterpret_cast<audio_sample*>(addr);
-        vec.push_back(std::ref(*addr2));
-    }
-    return vec;
+    auto data = getChannelData(channel_id);
+    return std::vector<std::reference_wrapper<audio_sample>>(data.begin(), data.end());
 }
 
 std::vector<std::reference_wrapper<Sound::audio_sample>> Sound::getInterleavedAudioRawData() const
 {
-    auto* pp = ((std::vector<NetUint16>*)(implementation))->data();
+    auto view = InterleavedView<audio_sample>(getSamplesData(), this->m_samples, this->m_channels);
 
     std::vector<std::reference_wrapper<audio_sample>> vec;
-    vec.reserve(this->m_samples*this->m_channels);
-    for (size_t t = 0; t < this->m_samples; t++)
+    vec.reserve(view.size());
+    for (size_t i = 0; i < view.size(); i++)
     {
-        for (size_t c = 0; c < this->m_channels; c++)
-        {
-            audio_sample*  addr  = (audio_sample*)(pp) + t + c*m_samples;
-            vec.push_back(std::ref(*addr));
-        }
+        vec.push_back(std::ref(view[i]));
     }
     return vec;
 }
 
 std::vector<std::reference_wrapper<Sound::audio_sample>> Sound::getNonInterleavedAudioRawData() const
 {
-    auto* pp = ((std::vector<NetUint16>*)(implementation))->data();
+    audio_sample* data = getSamplesData();
+    if (data == nullptr) {
+        return {};
+    }
+    return std::vector<std::reference_wrapper<audio_sample>>(data, data + this->m_samples * this->m_channels);
+}
 
-    std::vector<std::reference_wrapper<audio_sample>> vec;
-    vec.reserve(this->m_samples*this->m_channels);
-    for (size_t c = 0; c < this->m_channels; c++)
-    {
-        for (size_t t = 0; t < this->m_samples; t++)
-        {
-            audio_sample* addr = (audio_sample*)(pp)+ t + c * m_samples;
-            vec.push_back(std::ref(*addr));
+Sound::audio_sample* Sound::getSamplesData() const
+{
+    if (m_bytesPerSample != sizeof(audio_sample)) {
+        return nullptr;
+    }
+    return reinterpret_cast<audio_sample*>(((std::vector<NetUint16>*)(implementation))->data());
+}
+
+std::span<Sound::audio_sample> Sound::getChannelData(size_t channel_id)
+{
+    audio_sample* data = getSamplesData();
+    if (data == nullptr || channel_id >= m_channels) {
+        return {};
+    }
+    return {data + channel_id * m_samples, m_samples};
+}
+
+std::span<const Sound::audio_sample> Sound::getChannelData(size_t channel_id) const
+{
+    return const_cast<Sound*>(this)->getChannelData(channel_id);
+}
+
+std::span<Sound::audio_sample> Sound::getNonInterleavedData()
+{
+    audio_sample* data = getSamplesData();
+    if (data == nullptr) {
+        return {};
+    }
+    return {data, m_samples * m_channels};
+}
+
+std::span<const Sound::audio_sample> Sound::getNonInterleavedData() const
+{
+    return const_cast<Sound*>(this)->getNonInterleavedData();
+}
+
+Sound::InterleavedView<Sound::audio_sample> Sound::getInterleavedView()
+{
+    audio_sample* data = getSamplesData();
+    if (data == nullptr) {
+        return {};
+    }
+    return {data, m_samples, m_channels};
+}
+
+Sound::InterleavedView<const Sound::audio_sample> Sound::getInterleavedView() const
+{
+    audio_sample* data = getSamplesData();
+    if (data == nullptr) {
+        return {};
+    }
+    return {data, m_samples, m_channels};
+}
+
+namespace {
+
+// The number of channels is a template parameter for the common cases, so
+// that the inner loop is unrolled
+template <size_t N>
+void interleave(const Sound::audio_sample* planar, size_t stride, Sound::audio_sample* dest, size_t len, size_t channels = N)
+{
+    for (size_t i = 0; i < len; i++) {
+        for (size_t c = 0; c < channels; c++) {
+            dest[i * channels + c] = planar[c * stride + i];
         }
     }
-    return vec;
+}
+
+template <size_t N>
+void deinterleave(const Sound::audio_sample* src, Sound::audio_sample* planar, size_t stride, size_t len, size_t channels = N)
+{
+    for (size_t i = 0; i < len; i++) {
+        for (size_t c = 0; c < channels; c++) {
+            planar[c * stride + i] = src[i * channels + c];
+        }
+    }
+}
+
+} // namespace
+
+size_t Sound::copyToInterleaved(audio_sample* dest, size_t first_sample, size_t len) const
+{
+    const audio_sample* data = getSamplesData();
+    if (data == nullptr || first_sample >= m_samples) {
+        return 0;
+    }
+    len = std::min(len, m_samples - first_sample);
+    data += first_sample;
+    switch (m_channels) {
+    case 1:
+        std::copy(data, data + len, dest);
+        break;
+    case 2:
+        interleave<2>(data, m_samples, dest, len);
+        break;
+    default:
+        interleave<0>(data, m_samples, dest, len, m_channels);
+        break;
+    }
+    return len;
+}
+
+size_t Sound::copyFromInterleaved(const audio_sample* src, size_t first_sample, size_t len)
+{
+    audio_sample* data = getSamplesData();
+    if (data == nullptr || first_sample >= m_samples) {
+        return 0;
+    }
+    len = std::min(len, m_samples - first_sample);
+    data += first_sample;
+    switch (m_channels) {
+    case 1:
+        std::copy(src, src + len, data);
+        break;
+    case 2:
+        deinterleave<2>(src, data, m_samples, len);
+        break;
+    default:
+        deinterleave<0>(src, data, m_samples, len, m_channels);
+        break;
+    }
+    return len;
 }
 
 std::string Sound::toString() const
@@ -10,6 +10,7 @@
 #include <yarp/os/Portable.h>
 #include <yarp/conf/numeric.h>
 #include <yarp/sig/api.h>
+#include <span>
 #include <vector>
 #include <string>
 
@@ -37,12 +38,67 @@ public:
  *
  * Class for storing sounds
  * See \ref AudioDoc for additional documentation on YARP audio.
+ *
+ * The samples are stored in planar (non-interleaved) order, i.e. the
+ * samples of each channel are contiguous, and the channels follow each
+ * other.  getChannelData() and getNonInterleavedData() give direct access to
+ * them, and getInterleavedView() presents them in interleaved order, without
+ * copies.
 */
 class YARP_sig_API Sound : public yarp::os::Portable
 {
 public:
     typedef short int audio_sample;
 
+    /**
+     * A view of the samples of a sound in interleaved order, e.g. for a
+     * sound composed by 3 channels: 1 11 21, 2 12 22, 3 13 23 etc.
+     * The samples are not copied, so the view is valid as long as the sound
+     * is not resized or destroyed.
+     */
+    template <typename T>
+    class InterleavedView
+    {
+    public:
+        InterleavedView() = default;
+
+        InterleavedView(T* data, size_t samples, size_t channels) :
+                m_data(data),
+                m_samples(samples),
+                m_channels(channels)
+        {
+        }
+
+        /**
+         * @return the element i of the interleaved sequence, i.e. the sample
+         *         i / channels of the channel i % channels.
+         */
+        T& operator[](size_t i) const
+        {
+            return m_data[(i % m_channels) * m_samples + i / m_channels];
+        }
+
+        T& operator()(size_t sample, size_t channel) const
+        {
+            return m_data[channel * m_samples + sample];
+        }
+
+        size_t size() const { return m_samples * m_channels; }
+        bool empty() const { return size() == 0; }
+        size_t getSamples() const { return m_samples; }
+        size_t getChannels() const { return m_channels; }
+
+        std::span<T> getChannel(size_t channel) const
+        {
+            return std::span<T>(m_data + channel * m_samples, m_samples);
+        }
+
+    private:
+        T* m_data = nullptr;
+        size_t m_samples = 0;
+        size_t m_channels = 0;
+    };
+
     Sound(size_t bytesPerSample = 2);
 
     /**
@@ -233,6 +289,52 @@ public:
 
     std::vector<std::reference_wrapper<audio_sample>> getChannel(size_t channel_id);
 
+    /**
+     * Get the samples of a channel, without copying them.
+     * The span is valid as long as the sound is not resized or destroyed.
+     * @param channel_id the channel
+     * @return the samples of the channel, or an empty span if the channel
+     *         does not exist
+     */
+    std::span<audio_sample> getChannelData(size_t channel_id);
+    std::span<const audio_sample> getChannelData(size_t channel_id) const;
+
+    /**
+     * Get all the samples of the sound in non-interleaved order, without
+     * copying them.
+     */
+    std::span<audio_sample> getNonInterleavedData();
+    std::span<const audio_sample> getNonInterleavedData() const;
+
+    /**
+     * Get all the samples of the sound in interleaved order, without copying
+     * them.
+     */
+    InterleavedView<audio_sample> getInterleavedView();
+    InterleavedView<const audio_sample> getInterleavedView() const;
+
+    /**
+     * Copy some samples to an interleaved buffer, e.g. the one of an audio
+     * device.
+     * @param dest the buffer, with space for len * getChannels() samples
+     * @param first_sample the first sample to copy
+     * @param len the number of samples (per channel) to copy
+     * @return the number of samples copied, which is less than len if the
+     *         sound is shorter
+     */
+    size_t copyToInterleaved(audio_sample* dest, size_t first_sample, size_t len) const;
+
+    /**
+     * Copy some samples from an interleaved buffer, e.g. the one of an audio
+     * device.
+     * @param src the buffer, with len * getChannels() samples
+     * @param first_sample the first sample to overwrite
+     * @param len the number of samples (per channel) to copy
+     * @return the number of samples copied, which is less than len if the
+     *         sound is shorter
+     */
+    size_t copyFromInterleaved(const audio_sample* src, size_t first_sample, size_t len);
+
     /**
      * Replace a single channel of our current sound with a given sound constituted by a single channel
      * The two sounds must have the same number of samples
@@ -245,6 +347,8 @@ public:
      * Returns a serialized version of the sound, in interleaved format,
      * e.g. for a sound composed by 3 channels, x samples:
      * 1 11 21, 2 12 22, 3 13 23, 4 14 24 etc
+     * This allocates a reference for each sample, getInterleavedView() does
+     * not.
      * @param vec the vector representing the serialized sound
      */
     std::vector<std::reference_wrapper<audio_sample>> getInterleavedAudioRawData() const;
@@ -253,6 +357,8 @@ public:
      * Returns a serialized version of the sound, in non-interleaved format,
      * e.g. for a sound composed by 3 channels, x samples:
      * 1 2 3 4 5.....etc, 11 12 13 14 15.....etc, 21 22 23 24 25.....etc
+     * This allocates a reference for each sample, getNonInterleavedData()
+     * does not.
      * @param vec the vector representing the serialized sound
      */
     std::vector<std::reference_wrapper<audio_sample>> getNonInterleavedAudioRawData() const;
@@ -339,6 +445,11 @@ private:
 
     void delete_implementation();
 
+    /**
+     * @return the samples, or nullptr if they are not 16 bit samples
+     */
+    audio_sample* getSamplesData() const;
+
 public:
     bool read(yarp::os::ConnectionReader& connection) override;
 
@@ -8,6 +8,15 @@
 #include <yarp/os/Log.h>
 #include <yarp/os/LogStream.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 using namespace yarp::os;
 using namespace yarp::sig;
 using namespace yarp::sig::soundfilters;
@@ -17,11 +26,253 @@ namespace
     YARP_LOG_COMPONENT(SOUNDFILTERS, "yarp.sig.SoundFilters")
 }
 
-#if defined (YARP_HAS_SOXR)
-#include <soxr.h>
-#endif
+namespace {
+
+// The Kaiser window parameter, for about 80 dB of stop band attenuation
+constexpr double kaiserBeta = 8.0;
+// The pass band, as a fraction of the lower Nyquist frequency
+constexpr double rolloff = 0.92;
+// Ratios of the frequencies needing more phases are approximated
+constexpr size_t maxPhases = 1024;
+
+double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50; k++) {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+double sinc(double x)
+{
+    if (std::abs(x) < 1e-9) {
+        return 1.0;
+    }
+    return std::sin(M_PI * x) / (M_PI * x);
+}
+
+// The filters compute one output frame from the taps input frames starting
+// at x.  The inner loops run over the channels, or over independent partial
+// sums, so that the compiler can vectorize them.
+void filterMono(const float* x, const float* h, size_t taps, size_t /*channels*/, float* out)
+{
+    float acc[8] = {};
+    for (size_t j = 0; j < taps; j += 8) {
+        for (size_t k = 0; k < 8; k++) {
+            acc[k] += h[j + k] * x[j + k];
+        }
+    }
+    *out = ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+}
+
+template <size_t C>
+void filterFrames(const float* x, const float* h, size_t taps, size_t /*channels*/, float* out)
+{
+    float acc[C] = {};
+    for (size_t j = 0; j < taps; j++) {
+        const float hj = h[j];
+        for (size_t c = 0; c < C; c++) {
+            acc[c] += hj * x[j * C + c];
+        }
+    }
+    for (size_t c = 0; c < C; c++) {
+        out[c] = acc[c];
+    }
+}
+
+void filterGeneric(const float* x, const float* h, size_t taps, size_t channels, float* out)
+{
+    for (size_t c0 = 0; c0 < channels; c0 += 8) {
+        const size_t n = std::min<size_t>(8, channels - c0);
+        float acc[8] = {};
+        for (size_t j = 0; j < taps; j++) {
+            const float hj = h[j];
+            const float* frame = x + j * channels + c0;
+            for (size_t c = 0; c < n; c++) {
+                acc[c] += hj * frame[c];
+            }
+        }
+        std::copy(acc, acc + n, out + c0);
+    }
+}
+
+Sound::audio_sample toSample(float value)
+{
+    float rounded = std::nearbyint(value);
+    rounded = std::clamp(rounded,
+                         static_cast<float>(std::numeric_limits<Sound::audio_sample>::min()),
+                         static_cast<float>(std::numeric_limits<Sound::audio_sample>::max()));
+    return static_cast<Sound::audio_sample>(rounded);
+}
+
+void toInterleaved(const Sound& snd, std::vector<float>& frames)
+{
+    const size_t samples = snd.getSamples();
+    const size_t channels = snd.getChannels();
+    frames.resize(samples * channels);
+    for (size_t c = 0; c < channels; c++) {
+        for (size_t t = 0; t < samples; t++) {
+            frames[t * channels + c] = snd.get(t, c);
+        }
+    }
+}
+
+void fromInterleaved(const std::vector<float>& frames, size_t samples, size_t channels, Sound& snd)
+{
+    snd.resize(samples, channels);
+    for (size_t c = 0; c < channels; c++) {
+        for (size_t t = 0; t < samples; t++) {
+            snd.set(toSample(frames[t * channels + c]), t, c);
+        }
+    }
+}
+
+} // namespace
+
+//#######################################################################################################
+
+Resampler::Resampler(size_t inputFrequency, size_t outputFrequency, size_t channels, size_t zeroCrossings) :
+        m_inputFrequency(inputFrequency),
+        m_outputFrequency(outputFrequency),
+        m_channels(channels)
+{
+    yCAssert(SOUNDFILTERS, inputFrequency > 0 && outputFrequency > 0 && channels > 0 && zeroCrossings > 0);
+
+    size_t gcd = std::gcd(inputFrequency, outputFrequency);
+    m_up = outputFrequency / gcd;
+    m_down = inputFrequency / gcd;
+    m_phases = std::min(m_up, maxPhases);
 
-//#define MULTICHANS_TESTED
+    // The filter, in units of input samples, removes the frequencies above
+    // the Nyquist frequency of the output when downsampling
+    const double cutoff = rolloff * std::min(1.0, static_cast<double>(outputFrequency) / static_cast<double>(inputFrequency));
+    const double halfWidth = static_cast<double>(zeroCrossings) / cutoff;
+    // A multiple of 8, for the vectorized loops
+    m_taps = static_cast<size_t>(std::ceil(2 * halfWidth / 8)) * 8;
+
+    m_bank.resize(m_phases * m_taps);
+    const double i0Beta = besselI0(kaiserBeta);
+    for (size_t p = 0; p < m_phases; p++) {
+        float* row = m_bank.data() + p * m_taps;
+        const double fraction = static_cast<double>(p) / static_cast<double>(m_phases);
+        double sum = 0.0;
+        for (size_t j = 0; j < m_taps; j++) {
+            // The distance between the output sample and the input sample j
+            const double t = fraction + static_cast<double>(m_taps / 2) - 1.0 - static_cast<double>(j);
+            const double r = t / halfWidth;
+            double value = 0.0;
+            if (std::abs(r) < 1.0) {
+                value = cutoff * sinc(cutoff * t) * besselI0(kaiserBeta * std::sqrt(1.0 - r * r)) / i0Beta;
+            }
+            row[j] = static_cast<float>(value);
+            sum += value;
+        }
+        // Unit gain at DC for every phase
+        for (size_t j = 0; j < m_taps; j++) {
+            row[j] = static_cast<float>(row[j] / sum);
+        }
+    }
+
+    switch (channels) {
+    case 1:
+        m_filter = filterMono;
+        break;
+    case 2:
+        m_filter = filterFrames<2>;
+        break;
+    case 4:
+        m_filter = filterFrames<4>;
+        break;
+    case 8:
+        m_filter = filterFrames<8>;
+        break;
+    default:
+        m_filter = filterGeneric;
+        break;
+    }
+
+    reset();
+}
+
+void Resampler::reset()
+{
+    // The stream is preceded by silence
+    const size_t padding = m_taps / 2 - 1;
+    m_history.assign(padding * m_channels, 0.0f);
+    m_historyStart = -static_cast<std::int64_t>(padding);
+    m_base = 0;
+    m_phase = 0;
+    m_received = 0;
+}
+
+size_t Resampler::produce(std::vector<float>& output, std::int64_t end)
+{
+    const auto half = static_cast<std::int64_t>(m_taps / 2);
+    const std::int64_t available = m_historyStart + static_cast<std::int64_t>(m_history.size() / m_channels);
+    const std::int64_t last = std::min(available - half, end);
+
+    size_t count = 0;
+    while (m_base < last) {
+        // Output sample at the input time m_base + m_phase / m_up
+        const auto first = static_cast<size_t>(m_base - half + 1 - m_historyStart);
+        const size_t row = (m_phases == m_up) ? m_phase : m_phase * m_phases / m_up;
+        output.resize(output.size() + m_channels);
+        m_filter(m_history.data() + first * m_channels,
+                 m_bank.data() + row * m_taps,
+                 m_taps,
+                 m_channels,
+                 output.data() + output.size() - m_channels);
+        count++;
+        m_phase += m_down;
+        m_base += static_cast<std::int64_t>(m_phase / m_up);
+        m_phase %= m_up;
+    }
+
+    // Keep only the frames needed by the next output samples
+    const std::int64_t keep = m_base - half + 1;
+    if (keep > m_historyStart) {
+        auto drop = std::min<size_t>(static_cast<size_t>(keep - m_historyStart), m_history.size() / m_channels);
+        m_history.erase(m_history.begin(), m_history.begin() + drop * m_channels);
+        m_historyStart += static_cast<std::int64_t>(drop);
+    }
+    return count;
+}
+
+size_t Resampler::process(const float* input, size_t frames, std::vector<float>& output)
+{
+    m_history.insert(m_history.end(), input, input + frames * m_channels);
+    m_received += static_cast<std::int64_t>(frames);
+    return produce(output, std::numeric_limits<std::int64_t>::max());
+}
+
+size_t Resampler::flush(std::vector<float>& output)
+{
+    // The output samples until the end of the input need the silence after it
+    m_history.resize(m_history.size() + m_taps / 2 * m_channels, 0.0f);
+    size_t count = produce(output, m_received);
+    reset();
+    return count;
+}
+
+bool Resampler::process(const yarp::sig::Sound& input, yarp::sig::Sound& output)
+{
+    if (static_cast<size_t>(input.getFrequency()) != m_inputFrequency || input.getChannels() != m_channels) {
+        yCError(SOUNDFILTERS) << "the sound does not match the resampler";
+        return false;
+    }
+    toInterleaved(input, m_input);
+    m_output.clear();
+    size_t frames = process(m_input.data(), input.getSamples(), m_output);
+    output.setFrequency(static_cast<int>(m_outputFrequency));
+    fromInterleaved(m_output, frames, m_channels, output);
+    return true;
+}
 
 //#######################################################################################################
 
@@ -33,14 +284,6 @@ bool yarp::sig::soundfilters::resample(yarp::sig::Sound& snd, size_t frequency)
         snd.clear();
         return false;
     }
-#ifndef MULTICHANS_TESTED
-    if (snd.getChannels() != 1)
-    {
-        yCError(SOUNDFILTERS) << "only 1 channel is currently supported";
-        snd.clear();
-        return false;
-    }
-#endif
     if (snd.getSamples() == 0)
     {
         yCError(SOUNDFILTERS) << "empty sound received?!";
@@ -52,70 +295,25 @@ bool yarp::sig::soundfilters::resample(yarp::sig::Sound& snd, size_t frequency)
         yCWarning(SOUNDFILTERS) << "no resampling needed";
         return true;
     }
-
-#if !defined (YARP_HAS_SOXR)
-    yCError(SOUNDFILTERS) << "libsoxr not available";
-    snd.clear();
-    return false;
-#else
-    //configuration
-    soxr_io_spec_t tit = soxr_io_spec(SOXR_INT16_I, SOXR_INT16_I);
-    tit.scale = 1.0;
-
-    double irate = snd.getFrequency();
-    double orate = double(frequency);
-    size_t ismp = snd.getSamples();
-#ifdef MULTICHANS_TESTED
-    size_t ichans = snd.getChannels();
-#else
-    size_t ichans = 1;
-#endif
-    size_t ilen = ismp*ichans;
-    yarp::sig::Sound::audio_sample* arri = new yarp::sig::Sound::audio_sample[ilen];
-
-    //copy from sound to buffer
-    for (size_t t = 0; t < ismp; t++)
-    {
-        for (size_t c = 0; c < ichans; c++)
-        {
-            arri[t] = snd.getSafe(t, c);
-        }
-    }
-
-    size_t osmp = (size_t)(ilen * orate / irate + .5);
-    size_t ochans = ichans;
-    size_t olen = osmp*ochans;
-    yarp::sig::Sound::audio_sample* arro = new yarp::sig::Sound::audio_sample[olen];
-
-    //resample
-    size_t odone;
-    soxr_error_t error = soxr_oneshot(irate, orate, ichans,            // Rates and # of channels
-        arri, ilen, NULL,           // Input
-        arro, olen, &odone,         // Output
-        &tit, NULL, NULL);          // Configuration
-    if (error != 0)
+    if (snd.getFrequency() <= 0)
     {
-        yCError(SOUNDFILTERS) << "libsoxr resample failed";
-        delete[]arri;
-        delete[]arro;
+        yCError(SOUNDFILTERS) << "invalid frequency of the sound =" << snd.getFrequency();
+        snd.clear();
         return false;
     }
 
-    //copy from buffer to sound
-    snd.setFrequency(size_t(orate));
-    snd.resize(olen);
-    for (size_t t = 0; t < osmp; t++)
-    {
-        for (size_t c = 0; c < ochans; c++)
-        {
-            snd.setSafe(arro[t], t, c);
-        }
-    }
-
-    //clear buffer
-    delete[]arri;
-    delete[]arro;
+    const size_t channels = snd.getChannels();
+    Resampler resampler(snd.getFrequency(), frequency, channels);
+    std::vector<float> input;
+    std::vector<float> output;
+    toInterleaved(snd, input);
+    resampler.process(input.data(), snd.getSamples(), output);
+    resampler.flush(output);
 
+    // The duration of the sound, rounded to the nearest output sample
+    auto samples = static_cast<size_t>(static_cast<double>(snd.getSamples()) * frequency / snd.getFrequency() + .5);
+    output.resize(samples * channels, 0.0f);
+    snd.setFrequency(static_cast<int>(frequency));
+    fromInterleaved(output, samples, channels, snd);
     return true;
-#endif
 }
@@ -8,6 +8,9 @@
 
 #include <yarp/sig/Sound.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace yarp::sig::soundfilters {
 /**
  * Resample a sound
@@ -16,6 +19,100 @@ namespace yarp::sig::soundfilters {
  * @return true on success
  */
 bool YARP_sig_API resample(yarp::sig::Sound& snd, size_t frequency);
+
+/**
+ * Streaming resampler, for sounds that arrive in chunks.
+ *
+ * The sound is filtered with a windowed sinc, whose values are precomputed
+ * for each phase of the output samples with respect to the input ones (a
+ * polyphase filter bank).  The last input samples are kept between the
+ * chunks, so that the output is continuous, as if the whole stream were
+ * resampled at once.  Therefore each output sample is available only after
+ * getLatency() further input samples.
+ *
+ * The frames are processed with the channels interleaved, so that the
+ * inner loop computes all the channels of a frame at once, in SIMD
+ * registers.
+ */
+class YARP_sig_API Resampler
+{
+public:
+    /**
+     * @param inputFrequency the frequency of the input [Hz]
+     * @param outputFrequency the frequency of the output [Hz]
+     * @param channels the number of channels
+     * @param zeroCrossings the half length of the filter, in zero crossings
+     *        of the sinc: a longer filter has a sharper cutoff, but costs
+     *        more and has more latency
+     */
+    Resampler(size_t inputFrequency, size_t outputFrequency, size_t channels, size_t zeroCrossings = 16);
+
+    size_t getInputFrequency() const { return m_inputFrequency; }
+    size_t getOutputFrequency() const { return m_outputFrequency; }
+    size_t getChannels() const { return m_channels; }
+
+    /**
+     * @return the number of input frames needed after an input frame, before
+     *         the output frames around it are computed.
+     */
+    size_t getLatency() const { return m_taps / 2; }
+
+    /**
+     * Resample some frames.
+     *
+     * @param input the frames, with the channels interleaved
+     * @param frames the number of frames
+     * @param output the vector where the output frames are appended
+     * @return the number of frames appended
+     */
+    size_t process(const float* input, size_t frames, std::vector<float>& output);
+
+    /**
+     * Resample a sound, with the frequency and the channels of the resampler.
+     *
+     * @param input the sound to resample
+     * @param output the sound resized to the output frames computed
+     * @return false if the sound does not match the resampler
+     */
+    bool process(const yarp::sig::Sound& input, yarp::sig::Sound& output);
+
+    /**
+     * Compute the output frames still pending at the end of the stream, as
+     * if it were followed by silence, and start a new stream.
+     *
+     * @return the number of frames appended to output
+     */
+    size_t flush(std::vector<float>& output);
+
+    /**
+     * Forget the input received, and start a new stream.
+     */
+    void reset();
+
+private:
+    using Filter = void (*)(const float* x, const float* h, size_t taps, size_t channels, float* out);
+
+    size_t produce(std::vector<float>& output, std::int64_t end);
+
+    size_t m_inputFrequency;
+    size_t m_outputFrequency;
+    size_t m_channels;
+    size_t m_up;     // output samples in a period of the two frequencies
+    size_t m_down;   // input samples in a period of the two frequencies
+    size_t m_phases; // rows of the filter bank
+    size_t m_taps;   // coefficients of each row, an even number
+    std::vector<float> m_bank;
+    Filter m_filter;
+
+    std::vector<float> m_history;   // interleaved input frames
+    std::int64_t m_historyStart{0}; // index of the first frame in m_history
+    std::int64_t m_base{0};         // the input frame before the next output
+    size_t m_phase{0};              // the phase of the next output, in [0, m_up)
+    std::int64_t m_received{0};     // input frames received
+    std::vector<float> m_input;  // buffers for the sounds
+    std::vector<float> m_output;
+};
+
 } // namespace yarp::sig::soundfilters
 
 #endif // YARP_SIG_SOUNDFILTERS_H
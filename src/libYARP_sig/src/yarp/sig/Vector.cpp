@@ -62,6 +62,10 @@ bool VectorBase::read(yarp::os::ConnectionReader& connection) {
     {
         if ((size_t)getListSize() != (size_t)(header.listLen)) {
             resize(header.listLen);
+            // the vectors of fixed size cannot be resized
+            if ((size_t)getListSize() != (size_t)(header.listLen)) {
+                return false;
+            }
         }
         char* ptr = getMemoryBlock();
         yCAssert(VECTOR, ptr != nullptr);
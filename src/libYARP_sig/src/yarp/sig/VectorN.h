@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SIG_VECTORN_H
+#define YARP_SIG_VECTORN_H
+
+#include <yarp/sig/Vector.h>
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <span>
+
+namespace yarp::sig {
+
+/**
+ * \ingroup sig_class
+ *
+ * A vector of fixed size, known at compile time, whose elements are stored
+ * in the object itself instead of on the heap.
+ *
+ * It is meant for the small quantities (positions, quaternions, wrenches,
+ * ...) that are handled in the hot loops, where the allocations of a
+ * yarp::sig::VectorOf are not acceptable.
+ *
+ * The format on the network is the same of yarp::sig::VectorOf<T>,
+ * therefore a VectorN can be sent to a port that reads a VectorOf and vice
+ * versa.  Reading a vector of a different size fails.
+ */
+template <class T, size_t N>
+class VectorN : public VectorBase
+{
+private:
+    std::array<T, N> m_data {};
+
+public:
+    using value_type     =  T;
+    using iterator       =  typename std::array<T, N>::iterator;
+    using const_iterator =  typename std::array<T, N>::const_iterator;
+
+    /**
+     * Build a vector with all the elements set to zero.
+     */
+    VectorN() = default;
+
+    /**
+     * Build a vector from a list of values.  The elements that are not in
+     * the list are set to zero, the values in excess are ignored.
+     */
+    VectorN(std::initializer_list<T> values)
+    {
+        std::copy_n(values.begin(), std::min(values.size(), N), m_data.begin());
+    }
+
+    /**
+     * Build a vector from a VectorOf of the same size.
+     */
+    explicit VectorN(const VectorOf<T>& v)
+    {
+        yAssert(v.size() == N);
+        std::copy_n(v.data(), N, m_data.data());
+    }
+
+    VectorN(const VectorN& r) = default;
+    VectorN& operator=(const VectorN& r) = default;
+    VectorN(VectorN&& other) noexcept = default;
+    VectorN& operator=(VectorN&& other) noexcept = default;
+    ~VectorN() override = default;
+
+    /**
+     * Copy the elements of a VectorOf of the same size.
+     */
+    VectorN& operator=(const VectorOf<T>& v)
+    {
+        yAssert(v.size() == N);
+        std::copy_n(v.data(), N, m_data.data());
+        return *this;
+    }
+
+    /**
+     * Set all elements of the vector to a scalar.
+     */
+    VectorN& operator=(T v)
+    {
+        m_data.fill(v);
+        return *this;
+    }
+
+    /**
+     * Copy the elements to a VectorOf, resizing it if needed (i.e. without
+     * allocating memory if it has already the right size).
+     */
+    void toVector(VectorOf<T>& v) const
+    {
+        v.resize(N);
+        std::copy_n(m_data.data(), N, v.data());
+    }
+
+    /**
+     * @return a VectorOf with the same elements.
+     */
+    VectorOf<T> toVector() const
+    {
+        return VectorOf<T>(N, m_data.data());
+    }
+
+    size_t getElementSize() const override
+    {
+        return sizeof(T);
+    }
+
+    int getBottleTag() const override
+    {
+        return BottleTagMap<T>();
+    }
+
+    size_t getListSize() const override
+    {
+        return N;
+    }
+
+    const char* getMemoryBlock() const override
+    {
+        return reinterpret_cast<const char*>(m_data.data());
+    }
+
+    char* getMemoryBlock() override
+    {
+        return reinterpret_cast<char*>(m_data.data());
+    }
+
+    /**
+     * The size of the vector cannot change, this does nothing.
+     */
+    void resize(size_t size) override
+    {
+        YARP_UNUSED(size);
+    }
+
+    inline T* data() { return m_data.data(); }
+    inline const T* data() const { return m_data.data(); }
+
+    /**
+     * @return a view of the elements, that can be passed to the functions
+     *         that do not need to own the data.
+     */
+    std::span<T, N> span() { return std::span<T, N>(m_data); }
+    std::span<const T, N> span() const { return std::span<const T, N>(m_data); }
+
+    inline T& operator[](size_t i) { return m_data[i]; }
+    inline const T& operator[](size_t i) const { return m_data[i]; }
+    inline T& operator()(size_t i) { return m_data[i]; }
+    inline const T& operator()(size_t i) const { return m_data[i]; }
+
+    static constexpr size_t size() { return N; }
+    static constexpr size_t length() { return N; }
+
+    /**
+     * Zero the elements of the vector.
+     */
+    void zero()
+    {
+        m_data.fill(T(0));
+    }
+
+    /**
+     * Creates a string object containing a text representation of the
+     * object, in the same format of VectorOf::toString().
+     */
+    std::string toString(int precision = -1, int width = -1) const
+    {
+        return toVector().toString(precision, width);
+    }
+
+    bool operator==(const VectorN& r) const
+    {
+        return m_data == r.m_data;
+    }
+
+    iterator begin() noexcept { return m_data.begin(); }
+    iterator end() noexcept { return m_data.end(); }
+    const_iterator begin() const noexcept { return m_data.begin(); }
+    const_iterator end() const noexcept { return m_data.end(); }
+    const_iterator cbegin() const noexcept { return m_data.cbegin(); }
+    const_iterator cend() const noexcept { return m_data.cend(); }
+
+    yarp::os::Type getType() const override
+    {
+        return yarp::os::Type::byName("yarp/vector");
+    }
+};
+
+} // namespace yarp::sig
+
+#endif // YARP_SIG_VECTORN_H
@@ -16,7 +16,9 @@
 #include <yarp/sig/SoundFile.h>
 #include <yarp/sig/SoundUtils.h>
 #include <yarp/sig/Vector.h>
+#include <yarp/sig/VectorN.h>
 #include <yarp/sig/Matrix.h>
+#include <yarp/sig/MatrixN.h>
 #include <yarp/sig/PointCloud.h>
 
 #endif // YARP_SIG_ALL_H
@@ -0,0 +1,852 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/impl/PixelConversion.h>
+
+#include <yarp/os/NetUint16.h>
+#include <yarp/sig/Image.h>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ * The kernels for each instruction set are compiled with the corresponding
+ * target attribute, so that the library can be built for the baseline CPU
+ * and pick the best kernels at run time.  MSVC does not need it.
+ */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define YARP_SIG_SIMD_X86 1
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define YARP_TARGET_SSE41
+#        define YARP_TARGET_AVX2
+#    else
+#        define YARP_TARGET_SSE41 __attribute__((target("sse4.1")))
+#        define YARP_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#    define YARP_SSE41_KERNEL(...) __VA_ARGS__
+#    define YARP_AVX2_KERNEL(...) __VA_ARGS__
+#    define YARP_NEON_KERNEL(...) nullptr
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define YARP_SIG_SIMD_NEON 1
+#    include <arm_neon.h>
+#    define YARP_SSE41_KERNEL(...) nullptr
+#    define YARP_AVX2_KERNEL(...) nullptr
+#    define YARP_NEON_KERNEL(...) __VA_ARGS__
+#else
+#    define YARP_SSE41_KERNEL(...) nullptr
+#    define YARP_AVX2_KERNEL(...) nullptr
+#    define YARP_NEON_KERNEL(...) nullptr
+#endif
+
+using namespace yarp::sig;
+using namespace yarp::sig::impl;
+
+namespace {
+
+using Mask = std::array<unsigned char, 16>;
+
+// A shuffle index that clears the byte
+constexpr unsigned char zero = 0x80;
+
+
+/*
+ * Channel shuffles among the RGB, BGR, RGBA and BGRA pixels.
+ *
+ * S and D are the sizes of the source and of the destination pixels, Ck is
+ * the channel of the source copied to the channel k of the destination, or
+ * -1 for an opaque alpha channel.
+ */
+
+template <int S, int D, int C0, int C1, int C2, int C3>
+void shuffleScalar(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    constexpr int c[] = {C0, C1, C2, C3};
+    for (size_t i = 0; i < width; i++, src += S, dest += D) {
+        for (int k = 0; k < D; k++) {
+            dest[k] = (c[k] < 0) ? 255 : src[c[k]];
+        }
+    }
+}
+
+// The pshufb mask converting 4 pixels
+template <int S, int D, int C0, int C1, int C2, int C3>
+constexpr Mask shuffleMask()
+{
+    constexpr int c[] = {C0, C1, C2, C3};
+    Mask mask{};
+    for (auto& m : mask) {
+        m = zero;
+    }
+    for (int p = 0; p < 4; p++) {
+        for (int k = 0; k < D; k++) {
+            if (c[k] >= 0) {
+                mask[p * D + k] = static_cast<unsigned char>(p * S + c[k]);
+            }
+        }
+    }
+    return mask;
+}
+
+// The bytes set by an opaque alpha channel, in 4 pixels
+template <int D, int C3>
+constexpr Mask alphaMask()
+{
+    Mask mask{};
+    if (D == 4 && C3 < 0) {
+        for (int p = 0; p < 4; p++) {
+            mask[p * 4 + 3] = 255;
+        }
+    }
+    return mask;
+}
+
+
+/*
+ * Conversions from RGB, BGR, RGBA and BGRA to MONO, MONO16 and MONO_FLOAT,
+ * averaging the 3 color channels.
+ */
+
+template <int S, typename T>
+void toMonoScalar(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    T* out = reinterpret_cast<T*>(dest);
+    for (size_t i = 0; i < width; i++, src += S) {
+        int sum = src[0] + src[1] + src[2];
+        if constexpr (std::is_same_v<T, float>) {
+            out[i] = static_cast<float>(sum) / 3.0f;
+        } else {
+            out[i] = static_cast<T>(sum / 3);
+        }
+    }
+}
+
+// The pshufb mask extending the channel c of 4 pixels to 16 bits
+template <int S>
+constexpr Mask channelMask(int c)
+{
+    Mask mask{};
+    for (auto& m : mask) {
+        m = zero;
+    }
+    for (int p = 0; p < 4; p++) {
+        mask[2 * p] = static_cast<unsigned char>(p * S + c);
+    }
+    return mask;
+}
+
+// x / 3 == (x * 21846) >> 16, for 0 <= x <= 765
+constexpr short oneThird = 21846;
+
+
+/*
+ * Conversions from MONO to RGB, BGR, RGBA and BGRA.
+ */
+
+template <int D>
+void fromMonoScalar(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    for (size_t i = 0; i < width; i++, dest += D) {
+        dest[0] = src[i];
+        dest[1] = src[i];
+        dest[2] = src[i];
+        if constexpr (D == 4) {
+            dest[3] = 255;
+        }
+    }
+}
+
+// The pshufb masks spreading 16 pixels over D registers
+template <int D>
+constexpr std::array<Mask, 4> replicateMasks()
+{
+    std::array<Mask, 4> masks{};
+    for (int k = 0; k < D; k++) {
+        for (int j = 0; j < 16; j++) {
+            int byte = 16 * k + j;
+            masks[k][j] = (byte % D == 3) ? zero : static_cast<unsigned char>(byte / D);
+        }
+    }
+    return masks;
+}
+
+
+/*
+ * Conversions among MONO, MONO16 and MONO_FLOAT.  MONO16 to MONO keeps the
+ * low byte, as the generic conversion does, while the float values are
+ * truncated and saturated.
+ */
+
+inline void convertValue(unsigned char x, std::uint16_t& y)
+{
+    y = x;
+}
+
+inline void convertValue(std::uint16_t x, unsigned char& y)
+{
+    y = static_cast<unsigned char>(x);
+}
+
+inline void convertValue(unsigned char x, float& y)
+{
+    y = x;
+}
+
+inline void convertValue(std::uint16_t x, float& y)
+{
+    y = x;
+}
+
+inline void convertValue(float x, unsigned char& y)
+{
+    y = (x >= 255.0f) ? 255 : ((x > 0.0f) ? static_cast<unsigned char>(x) : 0);
+}
+
+inline void convertValue(float x, std::uint16_t& y)
+{
+    y = (x >= 65535.0f) ? 65535 : ((x > 0.0f) ? static_cast<std::uint16_t>(x) : 0);
+}
+
+template <typename T1, typename T2>
+void depthScalar(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const T1* in = reinterpret_cast<const T1*>(src);
+    T2* out = reinterpret_cast<T2*>(dest);
+    for (size_t i = 0; i < width; i++) {
+        convertValue(in[i], out[i]);
+    }
+}
+
+
+#if defined(YARP_SIG_SIMD_X86)
+
+inline __m128i load128(const void* p)
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(p));
+}
+
+inline void store128(void* p, __m128i v)
+{
+    _mm_storeu_si128(static_cast<__m128i*>(p), v);
+}
+
+
+template <int S, int D, int C0, int C1, int C2, int C3>
+YARP_TARGET_SSE41 void shuffleSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    static constexpr Mask maskBytes = shuffleMask<S, D, C0, C1, C2, C3>();
+    static constexpr Mask alphaBytes = alphaMask<D, C3>();
+    const __m128i mask = load128(maskBytes.data());
+    const __m128i alpha = load128(alphaBytes.data());
+    size_t i = 0;
+    // Each step converts 4 pixels, reading and writing 16 bytes: the bytes
+    // written past them are overwritten by the next step, or by the tail.
+    for (; i * S + 16 <= width * S && i * D + 16 <= width * D; i += 4) {
+        __m128i v = _mm_shuffle_epi8(load128(src + i * S), mask);
+        store128(dest + i * D, _mm_or_si128(v, alpha));
+    }
+    shuffleScalar<S, D, C0, C1, C2, C3>(src + i * S, dest + i * D, width - i);
+}
+
+
+template <int S, typename T>
+YARP_TARGET_SSE41 void toMonoSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    static constexpr Mask mask0 = channelMask<S>(0);
+    static constexpr Mask mask1 = channelMask<S>(1);
+    static constexpr Mask mask2 = channelMask<S>(2);
+    const __m128i c0 = load128(mask0.data());
+    const __m128i c1 = load128(mask1.data());
+    const __m128i c2 = load128(mask2.data());
+    T* out = reinterpret_cast<T*>(dest);
+    size_t i = 0;
+    // 8 pixels per step, the sum of the channels in 16 bit lanes
+    for (; (i + 4) * S + 16 <= width * S; i += 8) {
+        __m128i a = load128(src + i * S);
+        __m128i b = load128(src + (i + 4) * S);
+        __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(_mm_shuffle_epi8(a, c0), _mm_shuffle_epi8(b, c0)),
+                                    _mm_unpacklo_epi64(_mm_shuffle_epi8(a, c1), _mm_shuffle_epi8(b, c1)));
+        sum = _mm_add_epi16(sum, _mm_unpacklo_epi64(_mm_shuffle_epi8(a, c2), _mm_shuffle_epi8(b, c2)));
+        if constexpr (std::is_same_v<T, float>) {
+            const __m128 three = _mm_set1_ps(3.0f);
+            __m128 lo = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(sum));
+            __m128 hi = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(sum, 8)));
+            _mm_storeu_ps(out + i, _mm_div_ps(lo, three));
+            _mm_storeu_ps(out + i + 4, _mm_div_ps(hi, three));
+        } else {
+            __m128i mono = _mm_mulhi_epu16(sum, _mm_set1_epi16(oneThird));
+            if constexpr (sizeof(T) == 1) {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(mono, mono));
+            } else {
+                store128(out + i, mono);
+            }
+        }
+    }
+    toMonoScalar<S, T>(src + i * S, dest + i * sizeof(T), width - i);
+}
+
+
+template <int D>
+YARP_TARGET_SSE41 void fromMonoSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    static constexpr std::array<Mask, 4> maskBytes = replicateMasks<D>();
+    static constexpr Mask alphaBytes = alphaMask<D, -1>();
+    const __m128i alpha = load128(alphaBytes.data());
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i v = load128(src + i);
+        for (int k = 0; k < D; k++) {
+            __m128i mask = load128(maskBytes[k].data());
+            store128(dest + i * D + 16 * k, _mm_or_si128(_mm_shuffle_epi8(v, mask), alpha));
+        }
+    }
+    fromMonoScalar<D>(src + i, dest + i * D, width - i);
+}
+
+
+YARP_TARGET_SSE41 void monoToMono16Sse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i v = load128(src + i);
+        store128(out + i, _mm_cvtepu8_epi16(v));
+        store128(out + i + 8, _mm_cvtepu8_epi16(_mm_srli_si128(v, 8)));
+    }
+    depthScalar<unsigned char, std::uint16_t>(src + i, dest + i * 2, width - i);
+}
+
+YARP_TARGET_SSE41 void mono16ToMonoSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+    const __m128i low = _mm_set1_epi16(0xff);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i a = _mm_and_si128(load128(in + i), low);
+        __m128i b = _mm_and_si128(load128(in + i + 8), low);
+        store128(dest + i, _mm_packus_epi16(a, b));
+    }
+    depthScalar<std::uint16_t, unsigned char>(src + i * 2, dest + i, width - i);
+}
+
+YARP_TARGET_SSE41 void monoToFloatSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i v = load128(src + i);
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_ps(out + i + 4 * k, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v)));
+            v = _mm_srli_si128(v, 4);
+        }
+    }
+    depthScalar<unsigned char, float>(src + i, dest + i * 4, width - i);
+}
+
+YARP_TARGET_SSE41 void mono16ToFloatSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        __m128i v = load128(in + i);
+        _mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(v)));
+        _mm_storeu_ps(out + i + 4, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8))));
+    }
+    depthScalar<std::uint16_t, float>(src + i * 2, dest + i * 4, width - i);
+}
+
+// Clamp to [0, max] and truncate; NaNs become 0
+YARP_TARGET_SSE41 inline __m128i clampFloat(__m128 v, __m128 max)
+{
+    return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), max));
+}
+
+YARP_TARGET_SSE41 void floatToMonoSse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    const __m128 max = _mm_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i a = _mm_packus_epi32(clampFloat(_mm_loadu_ps(in + i), max), clampFloat(_mm_loadu_ps(in + i + 4), max));
+        __m128i b = _mm_packus_epi32(clampFloat(_mm_loadu_ps(in + i + 8), max), clampFloat(_mm_loadu_ps(in + i + 12), max));
+        store128(dest + i, _mm_packus_epi16(a, b));
+    }
+    depthScalar<float, unsigned char>(src + i * 4, dest + i, width - i);
+}
+
+YARP_TARGET_SSE41 void floatToMono16Sse41(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    const __m128 max = _mm_set1_ps(65535.0f);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        store128(out + i, _mm_packus_epi32(clampFloat(_mm_loadu_ps(in + i), max), clampFloat(_mm_loadu_ps(in + i + 4), max)));
+    }
+    depthScalar<float, std::uint16_t>(src + i * 4, dest + i * 2, width - i);
+}
+
+
+YARP_TARGET_AVX2 void monoToMono16Avx2(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtepu8_epi16(load128(src + i)));
+    }
+    depthScalar<unsigned char, std::uint16_t>(src + i, dest + i * 2, width - i);
+}
+
+YARP_TARGET_AVX2 void monoToFloatAvx2(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m128i v = load128(src + i);
+        _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+        _mm256_storeu_ps(out + i + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))));
+    }
+    depthScalar<unsigned char, float>(src + i, dest + i * 4, width - i);
+}
+
+YARP_TARGET_AVX2 void mono16ToFloatAvx2(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(load128(in + i))));
+    }
+    depthScalar<std::uint16_t, float>(src + i * 2, dest + i * 4, width - i);
+}
+
+YARP_TARGET_AVX2 inline __m256i clampFloat(__m256 v, __m256 max)
+{
+    return _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), max));
+}
+
+YARP_TARGET_AVX2 void floatToMono16Avx2(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    const __m256 max = _mm256_set1_ps(65535.0f);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        // The packs work within the 128 bit lanes, put them back in order
+        __m256i v = _mm256_packus_epi32(clampFloat(_mm256_loadu_ps(in + i), max), clampFloat(_mm256_loadu_ps(in + i + 8), max));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(v, 0xD8));
+    }
+    floatToMono16Sse41(src + i * 4, dest + i * 2, width - i);
+}
+
+YARP_TARGET_AVX2 void floatToMonoAvx2(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    const __m256 max = _mm256_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m256i v = _mm256_packus_epi32(clampFloat(_mm256_loadu_ps(in + i), max), clampFloat(_mm256_loadu_ps(in + i + 8), max));
+        v = _mm256_permute4x64_epi64(v, 0xD8);
+        __m128i lo = _mm256_castsi256_si128(v);
+        __m128i hi = _mm256_extracti128_si256(v, 1);
+        store128(dest + i, _mm_packus_epi16(lo, hi));
+    }
+    floatToMonoSse41(src + i * 4, dest + i, width - i);
+}
+
+#endif // YARP_SIG_SIMD_X86
+
+
+#if defined(YARP_SIG_SIMD_NEON)
+
+template <int S, int D, int C0, int C1, int C2, int C3>
+void shuffleNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    constexpr int c[] = {C0, C1, C2, C3};
+    const uint8x16_t opaque = vdupq_n_u8(255);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        uint8x16_t ch[4];
+        if constexpr (S == 3) {
+            uint8x16x3_t v = vld3q_u8(src + i * 3);
+            ch[0] = v.val[0];
+            ch[1] = v.val[1];
+            ch[2] = v.val[2];
+            ch[3] = opaque;
+        } else {
+            uint8x16x4_t v = vld4q_u8(src + i * 4);
+            ch[0] = v.val[0];
+            ch[1] = v.val[1];
+            ch[2] = v.val[2];
+            ch[3] = v.val[3];
+        }
+        auto pick = [&](int k) { return (c[k] < 0) ? opaque : ch[c[k]]; };
+        if constexpr (D == 3) {
+            uint8x16x3_t v = {{pick(0), pick(1), pick(2)}};
+            vst3q_u8(dest + i * 3, v);
+        } else {
+            uint8x16x4_t v = {{pick(0), pick(1), pick(2), pick(3)}};
+            vst4q_u8(dest + i * 4, v);
+        }
+    }
+    shuffleScalar<S, D, C0, C1, C2, C3>(src + i * S, dest + i * D, width - i);
+}
+
+template <int S, typename T>
+void toMonoNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    T* out = reinterpret_cast<T*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        uint8x8_t ch[3];
+        if constexpr (S == 3) {
+            uint8x8x3_t v = vld3_u8(src + i * 3);
+            ch[0] = v.val[0];
+            ch[1] = v.val[1];
+            ch[2] = v.val[2];
+        } else {
+            uint8x8x4_t v = vld4_u8(src + i * 4);
+            ch[0] = v.val[0];
+            ch[1] = v.val[1];
+            ch[2] = v.val[2];
+        }
+        uint16x8_t sum = vaddw_u8(vaddl_u8(ch[0], ch[1]), ch[2]);
+        if constexpr (std::is_same_v<T, float>) {
+            const float32x4_t third = vdupq_n_f32(3.0f);
+            vst1q_f32(out + i, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(sum))), third));
+            vst1q_f32(out + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(sum))), third));
+        } else {
+            const uint16x4_t third = vdup_n_u16(oneThird);
+            uint16x8_t mono = vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(sum), third), 16),
+                                           vshrn_n_u32(vmull_u16(vget_high_u16(sum), third), 16));
+            if constexpr (sizeof(T) == 1) {
+                vst1_u8(out + i, vmovn_u16(mono));
+            } else {
+                vst1q_u16(out + i, mono);
+            }
+        }
+    }
+    toMonoScalar<S, T>(src + i * S, dest + i * sizeof(T), width - i);
+}
+
+template <int D>
+void fromMonoNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        if constexpr (D == 3) {
+            uint8x16x3_t rgb = {{v, v, v}};
+            vst3q_u8(dest + i * 3, rgb);
+        } else {
+            uint8x16x4_t rgba = {{v, v, v, vdupq_n_u8(255)}};
+            vst4q_u8(dest + i * 4, rgba);
+        }
+    }
+    fromMonoScalar<D>(src + i, dest + i * D, width - i);
+}
+
+void monoToMono16Neon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        vst1q_u16(out + i, vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(out + i + 8, vmovl_u8(vget_high_u8(v)));
+    }
+    depthScalar<unsigned char, std::uint16_t>(src + i, dest + i * 2, width - i);
+}
+
+void mono16ToMonoNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+    size_t i = 0;
+    for (; i + 16 <= width; i += 16) {
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(vld1q_u16(in + i)), vmovn_u16(vld1q_u16(in + i + 8))));
+    }
+    depthScalar<std::uint16_t, unsigned char>(src + i * 2, dest + i, width - i);
+}
+
+void monoToFloatNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+        vst1q_f32(out + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+        vst1q_f32(out + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+    }
+    depthScalar<unsigned char, float>(src + i, dest + i * 4, width - i);
+}
+
+void mono16ToFloatNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const std::uint16_t*>(src);
+    auto* out = reinterpret_cast<float*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        uint16x8_t v = vld1q_u16(in + i);
+        vst1q_f32(out + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+        vst1q_f32(out + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+    }
+    depthScalar<std::uint16_t, float>(src + i * 2, dest + i * 4, width - i);
+}
+
+// The conversion to unsigned saturates, and turns NaNs into 0
+void floatToMono16Neon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    auto* out = reinterpret_cast<std::uint16_t*>(dest);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        uint16x4_t lo = vqmovn_u32(vcvtq_u32_f32(vld1q_f32(in + i)));
+        uint16x4_t hi = vqmovn_u32(vcvtq_u32_f32(vld1q_f32(in + i + 4)));
+        vst1q_u16(out + i, vcombine_u16(lo, hi));
+    }
+    depthScalar<float, std::uint16_t>(src + i * 4, dest + i * 2, width - i);
+}
+
+void floatToMonoNeon(const unsigned char* src, unsigned char* dest, size_t width)
+{
+    const auto* in = reinterpret_cast<const float*>(src);
+    size_t i = 0;
+    for (; i + 8 <= width; i += 8) {
+        uint16x4_t lo = vqmovn_u32(vcvtq_u32_f32(vld1q_f32(in + i)));
+        uint16x4_t hi = vqmovn_u32(vcvtq_u32_f32(vld1q_f32(in + i + 4)));
+        vst1_u8(dest + i, vqmovn_u16(vcombine_u16(lo, hi)));
+    }
+    depthScalar<float, unsigned char>(src + i * 4, dest + i, width - i);
+}
+
+#endif // YARP_SIG_SIMD_NEON
+
+
+/*
+ * The table of the conversions.
+ */
+
+// The AVX2 kernels are used only where they are faster than the SSE4.1 ones:
+// the byte shuffles are bound by the loads and the stores, and the lane
+// crossing needed by the 3 byte pixels makes them slower.
+struct Kernels
+{
+    int id1;
+    int id2;
+    PixelRowConversion scalar;
+    PixelRowConversion sse41;
+    PixelRowConversion avx2;
+    PixelRowConversion neon;
+};
+
+template <int S, int D, int C0, int C1, int C2, int C3>
+constexpr Kernels shuffle(int id1, int id2)
+{
+    return {id1,
+            id2,
+            shuffleScalar<S, D, C0, C1, C2, C3>,
+            YARP_SSE41_KERNEL(shuffleSse41<S, D, C0, C1, C2, C3>),
+            nullptr,
+            YARP_NEON_KERNEL(shuffleNeon<S, D, C0, C1, C2, C3>)};
+}
+
+template <int S, typename T>
+constexpr Kernels toMono(int id1, int id2)
+{
+    return {id1,
+            id2,
+            toMonoScalar<S, T>,
+            YARP_SSE41_KERNEL(toMonoSse41<S, T>),
+            nullptr,
+            YARP_NEON_KERNEL(toMonoNeon<S, T>)};
+}
+
+template <int D>
+constexpr Kernels fromMono(int id1, int id2)
+{
+    return {id1,
+            id2,
+            fromMonoScalar<D>,
+            YARP_SSE41_KERNEL(fromMonoSse41<D>),
+            nullptr,
+            YARP_NEON_KERNEL(fromMonoNeon<D>)};
+}
+
+const Kernels kernels[] = {
+    shuffle<3, 3, 2, 1, 0, -1>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_BGR),
+    shuffle<3, 3, 2, 1, 0, -1>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_RGB),
+    shuffle<4, 4, 2, 1, 0, 3>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_BGRA),
+    shuffle<4, 4, 2, 1, 0, 3>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_RGBA),
+    shuffle<3, 4, 0, 1, 2, -1>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_RGBA),
+    shuffle<3, 4, 0, 1, 2, -1>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_BGRA),
+    shuffle<3, 4, 2, 1, 0, -1>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_BGRA),
+    shuffle<3, 4, 2, 1, 0, -1>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_RGBA),
+    shuffle<4, 3, 0, 1, 2, -1>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_RGB),
+    shuffle<4, 3, 0, 1, 2, -1>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_BGR),
+    shuffle<4, 3, 2, 1, 0, -1>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_BGR),
+    shuffle<4, 3, 2, 1, 0, -1>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_RGB),
+
+    toMono<3, unsigned char>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO),
+    toMono<3, unsigned char>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_MONO),
+    toMono<4, unsigned char>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO),
+    toMono<4, unsigned char>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_MONO),
+    toMono<3, float>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO_FLOAT),
+    toMono<3, float>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_MONO_FLOAT),
+    toMono<4, float>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO_FLOAT),
+    toMono<4, float>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_MONO_FLOAT),
+
+    fromMono<3>(VOCAB_PIXEL_MONO, VOCAB_PIXEL_RGB),
+    fromMono<3>(VOCAB_PIXEL_MONO, VOCAB_PIXEL_BGR),
+    fromMono<4>(VOCAB_PIXEL_MONO, VOCAB_PIXEL_RGBA),
+    fromMono<4>(VOCAB_PIXEL_MONO, VOCAB_PIXEL_BGRA),
+
+    {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO_FLOAT,
+     depthScalar<unsigned char, float>,
+     YARP_SSE41_KERNEL(monoToFloatSse41),
+     YARP_AVX2_KERNEL(monoToFloatAvx2),
+     YARP_NEON_KERNEL(monoToFloatNeon)},
+    {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO,
+     depthScalar<float, unsigned char>,
+     YARP_SSE41_KERNEL(floatToMonoSse41),
+     YARP_AVX2_KERNEL(floatToMonoAvx2),
+     YARP_NEON_KERNEL(floatToMonoNeon)},
+
+// MONO16 pixels are stored in little endian order
+#ifdef YARP_LITTLE_ENDIAN
+    toMono<3, std::uint16_t>(VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO16),
+    toMono<3, std::uint16_t>(VOCAB_PIXEL_BGR, VOCAB_PIXEL_MONO16),
+    toMono<4, std::uint16_t>(VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO16),
+    toMono<4, std::uint16_t>(VOCAB_PIXEL_BGRA, VOCAB_PIXEL_MONO16),
+
+    {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO16,
+     depthScalar<unsigned char, std::uint16_t>,
+     YARP_SSE41_KERNEL(monoToMono16Sse41),
+     YARP_AVX2_KERNEL(monoToMono16Avx2),
+     YARP_NEON_KERNEL(monoToMono16Neon)},
+    {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO,
+     depthScalar<std::uint16_t, unsigned char>,
+     YARP_SSE41_KERNEL(mono16ToMonoSse41),
+     nullptr,
+     YARP_NEON_KERNEL(mono16ToMonoNeon)},
+    {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO_FLOAT,
+     depthScalar<std::uint16_t, float>,
+     YARP_SSE41_KERNEL(mono16ToFloatSse41),
+     YARP_AVX2_KERNEL(mono16ToFloatAvx2),
+     YARP_NEON_KERNEL(mono16ToFloatNeon)},
+    {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO16,
+     depthScalar<float, std::uint16_t>,
+     YARP_SSE41_KERNEL(floatToMono16Sse41),
+     YARP_AVX2_KERNEL(floatToMono16Avx2),
+     YARP_NEON_KERNEL(floatToMono16Neon)},
+#endif
+};
+
+
+SimdLevel detectSimdLevel()
+{
+#if defined(YARP_SIG_SIMD_X86)
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse41 = (info[2] & (1 << 19)) != 0;
+    // AVX2 also needs the OS to save the ymm registers
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    bool avx2 = false;
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#    else
+    __builtin_cpu_init();
+    bool sse41 = __builtin_cpu_supports("sse4.1");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#    endif
+    if (avx2) {
+        return SimdLevel::AVX2;
+    }
+    if (sse41) {
+        return SimdLevel::SSE41;
+    }
+    return SimdLevel::Scalar;
+#elif defined(YARP_SIG_SIMD_NEON)
+    return SimdLevel::NEON;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+} // namespace
+
+
+SimdLevel yarp::sig::impl::getSimdLevel()
+{
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+
+const char* yarp::sig::impl::getSimdLevelName(SimdLevel level)
+{
+    switch (level) {
+    case SimdLevel::SSE41:
+        return "sse4.1";
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::NEON:
+        return "neon";
+    case SimdLevel::Scalar:
+    default:
+        return "scalar";
+    }
+}
+
+
+PixelRowConversion yarp::sig::impl::getPixelRowConversion(int id1, int id2, SimdLevel level)
+{
+    // Never run instructions that the CPU does not have
+    SimdLevel best = getSimdLevel();
+    if (level == SimdLevel::AVX2 && best != SimdLevel::AVX2) {
+        level = SimdLevel::SSE41;
+    }
+    if (level == SimdLevel::SSE41 && best != SimdLevel::AVX2 && best != SimdLevel::SSE41) {
+        level = SimdLevel::Scalar;
+    }
+    if (level == SimdLevel::NEON && best != SimdLevel::NEON) {
+        level = SimdLevel::Scalar;
+    }
+
+    for (const auto& k : kernels) {
+        if (k.id1 != id1 || k.id2 != id2) {
+            continue;
+        }
+        switch (level) {
+        case SimdLevel::AVX2:
+            if (k.avx2 != nullptr) {
+                return k.avx2;
+            }
+            [[fallthrough]];
+        case SimdLevel::SSE41:
+            return (k.sse41 != nullptr) ? k.sse41 : k.scalar;
+        case SimdLevel::NEON:
+            return (k.neon != nullptr) ? k.neon : k.scalar;
+        case SimdLevel::Scalar:
+        default:
+            return k.scalar;
+        }
+    }
+    return nullptr;
+}
+
+
+PixelRowConversion yarp::sig::impl::getPixelRowConversion(int id1, int id2)
+{
+    return getPixelRowConversion(id1, id2, getSimdLevel());
+}
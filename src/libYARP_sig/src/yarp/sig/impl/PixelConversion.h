@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_SIG_IMPL_PIXELCONVERSION_H
+#define YARP_SIG_IMPL_PIXELCONVERSION_H
+
+#include <yarp/sig/api.h>
+
+#include <cstddef>
+
+namespace yarp::sig::impl {
+
+/**
+ * The instruction sets used by the vectorized pixel conversions.
+ */
+enum class SimdLevel
+{
+    Scalar,
+    SSE41,
+    AVX2,
+    NEON
+};
+
+/**
+ * @return the best instruction set supported both by this build of YARP and
+ *         by the CPU.
+ */
+YARP_sig_API SimdLevel getSimdLevel();
+
+/**
+ * @return the name of an instruction set, e.g. "avx2".
+ */
+YARP_sig_API const char* getSimdLevelName(SimdLevel level);
+
+/**
+ * Convert a row of pixels.
+ *
+ * @param src the first pixel of the row to convert
+ * @param dest the first pixel of the converted row
+ * @param width the number of pixels
+ */
+using PixelRowConversion = void (*)(const unsigned char* src, unsigned char* dest, size_t width);
+
+/**
+ * Get a vectorized conversion between two pixel types.
+ *
+ * The conversions available are the ones among the RGB, BGR, RGBA, BGRA
+ * and MONO pixels, and among the MONO, MONO16 and MONO_FLOAT pixels.  They
+ * give the same results as the generic pixel by pixel conversion used by
+ * yarp::sig::Image::copy(), except that the float values out of the range
+ * of the integer types are saturated.
+ *
+ * @param id1 the pixel code of the source
+ * @param id2 the pixel code of the destination
+ * @param level the instruction set to use, if a kernel is available for it,
+ *              otherwise the best one below it
+ * @return the conversion, or nullptr if there is none for these types.
+ */
+YARP_sig_API PixelRowConversion getPixelRowConversion(int id1, int id2, SimdLevel level);
+
+/**
+ * Get a vectorized conversion between two pixel types, for the best
+ * instruction set available.
+ */
+YARP_sig_API PixelRowConversion getPixelRowConversion(int id1, int id2);
+
+} // namespace yarp::sig::impl
+
+#endif // YARP_SIG_IMPL_PIXELCONVERSION_H
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/Image.h>
+#include <yarp/sig/ImageFile.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::sig;
+
+namespace {
+
+// A smooth image, that JPG encodes with small errors
+void fillImage(ImageOf<PixelRgb>& img, size_t width, size_t height)
+{
+    img.setQuantum(8);
+    img.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            PixelRgb& p = img.pixel(x, y);
+            p.r = static_cast<unsigned char>(x * 255 / width);
+            p.g = static_cast<unsigned char>(y * 255 / height);
+            p.b = static_cast<unsigned char>(255 - (x + y) * 127 / (width + height));
+        }
+    }
+}
+
+// The padding is not compared
+int maxDifference(const Image& a, const Image& b)
+{
+    if (a.width() != b.width() || a.height() != b.height() || a.getPixelCode() != b.getPixelCode()) {
+        return 256;
+    }
+    int diff = 0;
+    for (size_t y = 0; y < a.height(); y++) {
+        const unsigned char* ra = a.getRow(y);
+        const unsigned char* rb = b.getRow(y);
+        for (size_t i = 0; i < a.width() * a.getPixelSize(); i++) {
+            diff = std::max(diff, std::abs(ra[i] - rb[i]));
+        }
+    }
+    return diff;
+}
+
+} // namespace
+
+TEST_CASE("sig::ImageFileTest", "[yarp::sig]")
+{
+    ImageOf<PixelRgb> rgb;
+    fillImage(rgb, 67, 41);
+
+    ImageOf<PixelBgr> bgr;
+    bgr.copy(rgb);
+    ImageOf<PixelRgba> rgba;
+    rgba.copy(rgb);
+    ImageOf<PixelMono> mono;
+    mono.copy(rgb);
+
+#if defined (YARP_PNG_SUPPORTED)
+    SECTION("test PNG encoding and decoding.")
+    {
+        file::ImageCodec codec;
+        std::vector<unsigned char> data;
+        REQUIRE(codec.encode(rgb, data, file::FORMAT_PNG));
+
+        // Decoded directly in each format
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(codec.decode(data.data(), data.size(), rgb2));
+        CHECK(maxDifference(rgb2, rgb) == 0);
+        ImageOf<PixelBgr> bgr2;
+        REQUIRE(codec.decode(data.data(), data.size(), bgr2));
+        CHECK(maxDifference(bgr2, bgr) == 0);
+        ImageOf<PixelRgba> rgba2;
+        REQUIRE(codec.decode(data.data(), data.size(), rgba2));
+        CHECK(maxDifference(rgba2, rgba) == 0);
+
+        // The other formats are encoded directly
+        std::vector<unsigned char> data2;
+        REQUIRE(codec.encode(bgr, data2, file::FORMAT_PNG));
+        CHECK(data2 == data);
+        REQUIRE(codec.encode(rgba, data2, file::FORMAT_PNG));
+        CHECK(data2 == data);
+
+        REQUIRE(codec.encode(mono, data2, file::FORMAT_PNG));
+        ImageOf<PixelMono> mono2;
+        REQUIRE(codec.decode(data2.data(), data2.size(), mono2));
+        CHECK(maxDifference(mono2, mono) == 0);
+
+        // Converted from RGB
+        ImageOf<PixelFloat> flt;
+        REQUIRE(codec.decode(data2.data(), data2.size(), flt));
+        CHECK(flt.width() == mono.width());
+        CHECK(flt.pixel(10, 20) == static_cast<float>(mono.pixel(10, 20)));
+
+        // Different settings, same image
+        codec.setPngCompressionLevel(1);
+        REQUIRE(codec.encode(rgb, data2, file::FORMAT_PNG));
+        REQUIRE(codec.decode(data2.data(), data2.size(), rgb2));
+        CHECK(maxDifference(rgb2, rgb) == 0);
+    }
+#endif
+
+#if defined (YARP_JPEG_SUPPORTED)
+    SECTION("test JPG encoding and decoding.")
+    {
+        file::ImageCodec codec;
+        std::vector<unsigned char> data;
+        REQUIRE(codec.encode(rgb, data, file::FORMAT_JPG));
+
+        ImageOf<PixelRgb> rgb2;
+        REQUIRE(codec.decode(data.data(), data.size(), rgb2));
+        REQUIRE(rgb2.width() == rgb.width());
+        REQUIRE(rgb2.height() == rgb.height());
+        CHECK(maxDifference(rgb2, rgb) < 8);
+
+        // The same decoder, in a different format
+        ImageOf<PixelBgr> bgr2;
+        REQUIRE(codec.decode(data.data(), data.size(), bgr2));
+        ImageOf<PixelBgr> expected;
+        expected.copy(rgb2);
+        CHECK(maxDifference(bgr2, expected) == 0);
+        ImageOf<PixelRgba> rgba2;
+        REQUIRE(codec.decode(data.data(), data.size(), rgba2));
+        CHECK(rgba2.pixel(3, 5).a == 255);
+        CHECK(rgba2.pixel(3, 5).g == rgb2.pixel(3, 5).g);
+        ImageOf<PixelMono> mono2;
+        REQUIRE(codec.decode(data.data(), data.size(), mono2));
+        CHECK(maxDifference(mono2, mono) < 8);
+
+        // The codec can be reused, and gives the same result
+        std::vector<unsigned char> data2;
+        REQUIRE(codec.encode(bgr, data2, file::FORMAT_JPG));
+        CHECK(data2 == data);
+        REQUIRE(codec.encode(rgb, data2, file::FORMAT_JPG));
+        CHECK(data2 == data);
+
+        codec.setJpegQuality(50);
+        REQUIRE(codec.encode(rgb, data2, file::FORMAT_JPG));
+        CHECK(data2.size() < data.size());
+
+        // Corrupted data is reported, and the codec still works
+        std::vector<unsigned char> corrupted(data.begin(), data.begin() + 20);
+        CHECK_FALSE(codec.decode(corrupted.data(), corrupted.size(), rgb2));
+        CHECK_FALSE(codec.decode(data.data() + 1, data.size() - 1, rgb2));
+        REQUIRE(codec.decode(data.data(), data.size(), rgb2));
+        CHECK(maxDifference(rgb2, rgb) < 8);
+    }
+
+    SECTION("test parallel encoding.")
+    {
+        std::vector<ImageOf<PixelRgb>> images(7);
+        std::vector<const Image*> src;
+        for (size_t i = 0; i < images.size(); i++) {
+            fillImage(images[i], 40 + i, 30);
+            src.push_back(&images[i]);
+        }
+
+        file::ImageEncoderPool pool(3);
+        CHECK(pool.getThreads() == 3);
+        std::vector<std::vector<unsigned char>> encoded;
+        REQUIRE(pool.encode(src, encoded, file::FORMAT_JPG));
+        REQUIRE(encoded.size() == images.size());
+
+        file::ImageCodec codec;
+        for (size_t i = 0; i < images.size(); i++) {
+            std::vector<unsigned char> data;
+            REQUIRE(codec.encode(images[i], data, file::FORMAT_JPG));
+            CHECK(encoded[i] == data);
+        }
+
+        src.push_back(nullptr);
+        CHECK_FALSE(pool.encode(src, encoded, file::FORMAT_JPG));
+    }
+#endif
+
+#if defined (YARP_JPEG_SUPPORTED) && defined (YARP_PNG_SUPPORTED)
+    SECTION("test image files.")
+    {
+        // BGR and MONO images could not be read from these files
+        CHECK(file::write(rgb, "imagefiletest.png", file::FORMAT_PNG));
+        ImageOf<PixelBgr> bgr2;
+        CHECK(file::read(bgr2, "imagefiletest.png"));
+        CHECK(maxDifference(bgr2, bgr) == 0);
+
+        CHECK(file::write(bgr, "imagefiletest.jpg", file::FORMAT_JPG));
+        ImageOf<PixelMono> mono2;
+        CHECK(file::read(mono2, "imagefiletest.jpg"));
+        CHECK(maxDifference(mono2, mono) < 8);
+
+        CHECK_FALSE(file::read(mono2, "imagefiletest_missing.jpg"));
+
+        std::remove("imagefiletest.png");
+        std::remove("imagefiletest.jpg");
+    }
+#endif
+}
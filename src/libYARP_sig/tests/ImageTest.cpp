@@ -9,8 +9,10 @@
 #include <yarp/sig/Image.h>
 #include <yarp/sig/ImageDraw.h>
 #include <yarp/sig/ImageUtils.h>
+#include <yarp/sig/impl/PixelConversion.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/PortReaderBuffer.h>
+#include <yarp/os/BufferedPort.h>
 #include <yarp/os/Port.h>
 #include <yarp/os/Bottle.h>
 #include <yarp/os/Time.h>
@@ -21,6 +23,11 @@
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
 using namespace yarp::os::impl;
 using namespace yarp::sig;
 using namespace yarp::sig::draw;
@@ -144,6 +151,131 @@ TEST_CASE("sig::ImageTest", "[yarp::sig]")
         CHECK(imgdest.height()==24);
     }
 
+    SECTION("test vectorized pixel conversions.")
+    {
+        using namespace yarp::sig::impl;
+
+        const std::vector<std::pair<int, int>> pairs = {
+            {VOCAB_PIXEL_RGB, VOCAB_PIXEL_BGR},
+            {VOCAB_PIXEL_BGR, VOCAB_PIXEL_RGB},
+            {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_BGRA},
+            {VOCAB_PIXEL_BGRA, VOCAB_PIXEL_RGBA},
+            {VOCAB_PIXEL_RGB, VOCAB_PIXEL_RGBA},
+            {VOCAB_PIXEL_BGR, VOCAB_PIXEL_BGRA},
+            {VOCAB_PIXEL_RGB, VOCAB_PIXEL_BGRA},
+            {VOCAB_PIXEL_BGR, VOCAB_PIXEL_RGBA},
+            {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_RGB},
+            {VOCAB_PIXEL_BGRA, VOCAB_PIXEL_BGR},
+            {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_BGR},
+            {VOCAB_PIXEL_BGRA, VOCAB_PIXEL_RGB},
+            {VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO},
+            {VOCAB_PIXEL_BGRA, VOCAB_PIXEL_MONO},
+            {VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO16},
+            {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO16},
+            {VOCAB_PIXEL_BGR, VOCAB_PIXEL_MONO_FLOAT},
+            {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO_FLOAT},
+            {VOCAB_PIXEL_MONO, VOCAB_PIXEL_RGB},
+            {VOCAB_PIXEL_MONO, VOCAB_PIXEL_BGRA},
+            {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO16},
+            {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO},
+            {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO_FLOAT},
+            {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO_FLOAT},
+            {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO},
+            {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO16},
+        };
+
+        std::vector<SimdLevel> levels = {SimdLevel::Scalar, getSimdLevel()};
+        if (getSimdLevel() == SimdLevel::AVX2) {
+            levels.push_back(SimdLevel::SSE41);
+        }
+
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> byte(0, 255);
+        std::uniform_real_distribution<float> value(-1000.0f, 70000.0f);
+
+        for (const auto& [id1, id2] : pairs) {
+            // Odd widths, to exercise the tails of the vectorized loops
+            for (size_t width : {1, 5, 16, 37, 70}) {
+                INFO("conversion " << Vocab32::decode(id1) << " -> " << Vocab32::decode(id2) << ", width " << width);
+                FlexImage src;
+                src.setPixelCode(id1);
+                src.resize(width, 3);
+                for (size_t y = 0; y < src.height(); y++) {
+                    unsigned char* row = src.getRow(y);
+                    if (id1 == VOCAB_PIXEL_MONO_FLOAT) {
+                        auto* values = reinterpret_cast<float*>(row);
+                        for (size_t x = 0; x < width; x++) {
+                            values[x] = value(gen);
+                        }
+                    } else {
+                        for (size_t x = 0; x < width * src.getPixelSize(); x++) {
+                            row[x] = static_cast<unsigned char>(byte(gen));
+                        }
+                    }
+                }
+
+                FlexImage expected;
+                expected.setPixelCode(id2);
+                expected.setQuantum(1);
+                expected.resize(width, 3);
+                auto scalar = getPixelRowConversion(id1, id2, SimdLevel::Scalar);
+                REQUIRE(scalar != nullptr);
+                for (size_t y = 0; y < src.height(); y++) {
+                    scalar(src.getRow(y), expected.getRow(y), width);
+                }
+
+                const size_t rowSize = width * expected.getPixelSize();
+                for (auto level : levels) {
+                    FlexImage result;
+                    result.setPixelCode(id2);
+                    result.setQuantum(1);
+                    result.resize(width, 3);
+                    auto convert = getPixelRowConversion(id1, id2, level);
+                    for (size_t y = 0; y < src.height(); y++) {
+                        convert(src.getRow(y), result.getRow(y), width);
+                    }
+                    CHECK(std::memcmp(result.getRawImage(), expected.getRawImage(), expected.getRawImageSize()) == 0);
+                }
+
+                // Through Image::copy(), with padded rows
+                FlexImage copy;
+                copy.setPixelCode(id2);
+                copy.copy(src);
+                bool same = true;
+                for (size_t y = 0; y < src.height(); y++) {
+                    same &= std::memcmp(copy.getRow(y), expected.getRow(y), rowSize) == 0;
+                }
+                CHECK(same);
+            }
+        }
+
+        // Spot check the conversions against the generic ones
+        ImageOf<PixelRgb> rgb;
+        rgb.resize(20, 1);
+        rgb.zero();
+        rgb.pixel(17, 0) = PixelRgb(30, 60, 91);
+        ImageOf<PixelMono> mono;
+        mono.copy(rgb);
+        CHECK(mono.pixel(17, 0) == 60);
+        ImageOf<PixelFloat> monoFloat;
+        monoFloat.copy(rgb);
+        CHECK(monoFloat.pixel(17, 0) == 181.0f / 3.0f);
+        ImageOf<PixelBgra> bgra;
+        bgra.copy(rgb);
+        CHECK(bgra.pixel(17, 0).r == 30);
+        CHECK(bgra.pixel(17, 0).g == 60);
+        CHECK(bgra.pixel(17, 0).b == 91);
+        CHECK(bgra.pixel(17, 0).a == 255);
+
+        monoFloat.pixel(3, 0) = 300.0f;
+        monoFloat.pixel(4, 0) = -3.0f;
+        monoFloat.pixel(5, 0) = 12.7f;
+        mono.copy(monoFloat);
+        CHECK(mono.pixel(3, 0) == 255);
+        CHECK(mono.pixel(4, 0) == 0);
+        CHECK(mono.pixel(5, 0) == 12);
+    }
+
     SECTION("test Image::move().")
     {
         constexpr size_t width = 128;
@@ -399,6 +531,48 @@ TEST_CASE("sig::ImageTest", "[yarp::sig]")
     }
 
 
+    SECTION("test image transmission into receive buffers.")
+    {
+        const size_t w = 64;
+        const size_t h = 32;
+        ImageOf<PixelRgb> img1;
+        img1.setQuantum(1);
+        img1.resize(w, h);
+
+        // frames backed by memory owned by the application
+        std::vector<unsigned char> mem[2] = {std::vector<unsigned char>(w * h * 3),
+                                             std::vector<unsigned char>(w * h * 3)};
+        ImageOf<PixelRgb> frames[2];
+        for (int i = 0; i < 2; i++) {
+            frames[i].setQuantum(1);
+            frames[i].setExternal(mem[i].data(), w, h);
+        }
+
+        BufferedPort<ImageOf<PixelRgb>> input;
+        input.addReceiveBuffer(frames[0]);
+        input.addReceiveBuffer(frames[1]);
+        input.setStrict();
+        Port output;
+        input.open("/in");
+        output.open("/out");
+        Network::connect("/out", "/in", "tcp");
+        Network::sync("/out");
+
+        for (int i = 0; i < 4; i++) {
+            img1.pixel(3, 2).r = i;
+            output.write(img1);
+            ImageOf<PixelRgb>* result = input.read();
+            REQUIRE(result == &frames[i % 2]);
+            CHECK(result->getRawImage() == mem[i % 2].data()); // no reallocation
+            CHECK(result->width() == w);
+            CHECK(result->height() == h);
+            CHECK(result->pixel(3, 2).r == i);
+        }
+
+        output.close();
+        input.close();
+    }
+
     SECTION("check image padding.")
     {
         ImageOf<PixelMono> img1;
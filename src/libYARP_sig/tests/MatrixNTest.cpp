@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/MatrixN.h>
+#include <yarp/os/Portable.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+TEST_CASE("sig::MatrixNTest", "[yarp::sig]")
+{
+    SECTION("Check construction and element access")
+    {
+        MatrixN<double, 2, 3> m{1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0};
+        CHECK(m.rows() == 2);
+        CHECK(m.cols() == 3);
+        CHECK(m(0, 2) == 3.0);
+        CHECK(m[1][0] == 4.0);
+
+        CHECK(m.getRow(1) == VectorN<double, 3>{4.0, 5.0, 6.0});
+        CHECK(m.getCol(1) == VectorN<double, 2>{2.0, 5.0});
+
+        MatrixN<double, 3, 2> t = m.transposed();
+        CHECK(t == MatrixN<double, 3, 2>{1.0, 4.0,
+                                         2.0, 5.0,
+                                         3.0, 6.0});
+
+        MatrixN<double, 3, 3> id;
+        id.eye();
+        CHECK(id == MatrixN<double, 3, 3>{1.0, 0.0, 0.0,
+                                          0.0, 1.0, 0.0,
+                                          0.0, 0.0, 1.0});
+    }
+
+    SECTION("Check the products")
+    {
+        MatrixN<double, 2, 3> a{1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0};
+        MatrixN<double, 3, 2> b = a.transposed();
+        CHECK(a * b == MatrixN<double, 2, 2>{14.0, 32.0,
+                                             32.0, 77.0});
+
+        MatrixN<double, 3, 3> id;
+        id.eye();
+        CHECK(a * id == a);
+
+        VectorN<double, 3> v{1.0, 0.0, -1.0};
+        CHECK(a * v == VectorN<double, 2>{-2.0, -2.0});
+    }
+
+    SECTION("Check conversion from and to Matrix")
+    {
+        Matrix dyn(2, 2);
+        dyn(0, 0) = 1.0;
+        dyn(0, 1) = 2.0;
+        dyn(1, 0) = 3.0;
+        dyn(1, 1) = 4.0;
+
+        MatrixN<double, 2, 2> m(dyn);
+        CHECK(m == MatrixN<double, 2, 2>{1.0, 2.0, 3.0, 4.0});
+
+        m(1, 1) = 8.0;
+        Matrix out(2, 2);
+        const double* ptr = out.data();
+        m.toMatrix(out);
+        CHECK(out.data() == ptr);
+        CHECK(out(1, 1) == 8.0);
+        CHECK(m.toMatrix() == out);
+        CHECK(m.toString() == out.toString());
+    }
+
+    SECTION("Check the wire compatibility with Matrix")
+    {
+        MatrixN<double, 2, 3> m{1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0};
+        Matrix dyn;
+        REQUIRE(Portable::copyPortable(m, dyn));
+        CHECK(dyn.rows() == 2);
+        CHECK(dyn.cols() == 3);
+        CHECK(dyn(1, 2) == 6.0);
+
+        dyn(0, 0) = -1.0;
+        MatrixN<double, 2, 3> back;
+        REQUIRE(Portable::copyPortable(dyn, back));
+        CHECK(back == MatrixN<double, 2, 3>{-1.0, 2.0, 3.0,
+                                            4.0, 5.0, 6.0});
+    }
+
+    SECTION("Check that a matrix of a different size is not read")
+    {
+        Matrix dyn(3, 2);
+        dyn.zero();
+        MatrixN<double, 2, 3> m;
+        CHECK_FALSE(Portable::copyPortable(dyn, m));
+    }
+}
@@ -15,6 +15,8 @@
 #include <yarp/os/Time.h>
 #include <yarp/sig/Image.h>
 
+#include <cmath>
+
 #include <catch2/catch_amalgamated.hpp>
 #include <harness.h>
 
@@ -1205,5 +1207,107 @@ TEST_CASE("sig::PointCloudTest", "[yarp::sig]")
         CHECK(pcxyz(0, 0).x == -0.125); CHECK(pcxyz(0, 0).y == -0.25); CHECK(pcxyz(0, 0).z == -1.0);
     }
 
+    SECTION("Testing PointCloudProjector")
+    {
+        ImageOf<PixelFloat> depth;
+        size_t width {37};
+        size_t height {23};
+        depth.resize(width, height);
+        ImageOf<PixelRgb> color;
+        color.resize(width, height);
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                depth(x, y) = 0.5f + static_cast<float>(x * height + y) / 100.0f;
+                color(x, y) = PixelRgb(x, y, 42);
+            }
+        }
+        IntrinsicParams intp;
+        intp.principalPointX = 18.3;
+        intp.principalPointY = 11.7;
+        intp.focalLengthX = 31.0;
+        intp.focalLengthY = 29.0;
+
+        auto expectedX = [&](size_t u, size_t v) { return (u - intp.principalPointX) / intp.focalLengthX * depth(u, v); };
+        auto expectedY = [&](size_t u, size_t v) { return (v - intp.principalPointY) / intp.focalLengthY * depth(u, v); };
+
+        // The whole image, row by row
+        auto pc = utils::depthToPC(depth, intp);
+        REQUIRE(pc.width() == width);
+        REQUIRE(pc.height() == height);
+        bool ok = true;
+        for (size_t v = 0; v < height; v++) {
+            for (size_t u = 0; u < width; u++) {
+                ok &= std::abs(pc(u, v).x - expectedX(u, v)) < 1e-5;
+                ok &= std::abs(pc(u, v).y - expectedY(u, v)) < 1e-5;
+                ok &= pc(u, v).z == depth(u, v);
+            }
+        }
+        CHECK(ok);
+
+        // ROI whose size is not a multiple of the step, and several threads
+        utils::PointCloudProjector projector(intp, 3);
+        PointCloudXYZ pcRoi;
+        projector.depthToPC(depth, pcRoi, {3, 30, 2, 21}, 4, 3, "-Z+X-Y");
+        REQUIRE(pcRoi.width() == 6);
+        REQUIRE(pcRoi.height() == 6);
+        ok = true;
+        for (size_t j = 0; j < pcRoi.height(); j++) {
+            for (size_t i = 0; i < pcRoi.width(); i++) {
+                size_t u = 3 + i * 4;
+                size_t v = 2 + j * 3;
+                ok &= pcRoi(i, j).x == -depth(u, v);
+                ok &= std::abs(pcRoi(i, j).y - expectedX(u, v)) < 1e-5;
+                ok &= std::abs(pcRoi(i, j).z + expectedY(u, v)) < 1e-5;
+            }
+        }
+        CHECK(ok);
+
+        // The point cloud is reused
+        const char* data = pcRoi.getRawData();
+        depth(7, 5) = 10.0f;
+        projector.depthToPC(depth, pcRoi, {3, 30, 2, 21}, 4, 3, "-Z+X-Y");
+        CHECK(pcRoi.getRawData() == data);
+        CHECK(pcRoi(1, 1).x == -10.0f);
+
+        // Colored, organized and unorganized, with a step that does not
+        // divide the size of the image
+        for (size_t threads : {1, 4}) {
+            projector.setThreads(threads);
+            PointCloudXYZRGBA organized;
+            projector.depthRgbToPC(depth, color, organized, utils::OrganizationType::Organized, 2, 2);
+            REQUIRE(organized.width() == width / 2);
+            REQUIRE(organized.height() == height / 2);
+            ok = true;
+            for (size_t cv = 0; cv < organized.height(); cv++) {
+                for (size_t cu = 0; cu < organized.width(); cu++) {
+                    ok &= organized(cu, cv).z == depth(cu * 2, cv * 2);
+                    ok &= std::abs(organized(cu, cv).x - expectedX(cu * 2, cv * 2)) < 1e-5;
+                    ok &= organized(cu, cv).r == cu * 2;
+                    ok &= organized(cu, cv).g == cv * 2;
+                    ok &= organized(cu, cv).b == 42;
+                }
+            }
+            CHECK(ok);
+
+            PointCloudXYZRGBA unorganized;
+            projector.depthRgbToPC(depth, color, unorganized, utils::OrganizationType::Unorganized, 2, 2);
+            size_t size_x = (width + 1) / 2;
+            size_t size_y = (height + 1) / 2;
+            REQUIRE(unorganized.width() == size_x * size_y);
+            REQUIRE(unorganized.height() == 1);
+            ok = true;
+            for (size_t cu = 0; cu < size_x; cu++) {
+                for (size_t cv = 0; cv < size_y; cv++) {
+                    const auto& point = unorganized(cu * size_y + cv);
+                    ok &= point.z == depth(cu * 2, cv * 2);
+                    ok &= std::abs(point.y - expectedY(cu * 2, cv * 2)) < 1e-5;
+                    ok &= point.r == cu * 2;
+                    ok &= point.g == cv * 2;
+                }
+            }
+            CHECK(ok);
+        }
+    }
+
     Network::setLocalMode(false);
 }
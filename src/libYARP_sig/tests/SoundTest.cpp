@@ -6,10 +6,12 @@
 
 #include <yarp/sig/Sound.h>
 #include <yarp/sig/SoundFile.h>
+#include <yarp/sig/SoundFilters.h>
 #include <yarp/sig/SoundUtils.h>
 #include <yarp/os/Network.h>
 #include <yarp/os/BufferedPort.h>
 #include <yarp/os/Log.h>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
@@ -22,6 +24,10 @@ using namespace yarp::os::impl;
 using namespace yarp::sig;
 using namespace yarp::os;
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 void generate_test_sound(Sound& snd, size_t samples, size_t size_channels, int base=0, int factor=1)
 {
     for (size_t ch = 0; ch<snd.getChannels(); ch++)
@@ -467,6 +473,68 @@ TEST_CASE("sig::SoundTest", "[yarp::sig]")
         yDebug("%s", str.c_str());
     }
 
+    SECTION("check channel views.")
+    {
+        Sound snd1;
+        snd1.resize(5, 2);
+        generate_test_sound(snd1, 5, 2);
+
+        std::vector<short> test_vec_i = { 0, 100, 1, 101, 2, 102, 3, 103, 4, 104 };
+        std::vector<short> test_vec_ni = { 0, 1, 2, 3, 4, 100, 101, 102, 103, 104 };
+
+        auto planar = snd1.getNonInterleavedData();
+        CHECK(std::vector<short>(planar.begin(), planar.end()) == test_vec_ni);
+
+        auto channel = snd1.getChannelData(1);
+        CHECK(std::vector<short>(channel.begin(), channel.end()) == std::vector<short>{ 100, 101, 102, 103, 104 });
+        CHECK(snd1.getChannelData(2).empty());
+
+        // The old accessor returned the first sample five times
+        auto refs = snd1.getChannel(1);
+        CHECK(std::vector<short>(refs.begin(), refs.end()) == std::vector<short>{ 100, 101, 102, 103, 104 });
+
+        const Sound& csnd1 = snd1;
+        auto view = csnd1.getInterleavedView();
+        REQUIRE(view.size() == test_vec_i.size());
+        for (size_t i = 0; i < view.size(); i++) {
+            CHECK(view[i] == test_vec_i[i]);
+        }
+        CHECK(view(3, 1) == 103);
+
+        // The views write through to the sound
+        snd1.getInterleavedView()[3] = 42;
+        channel[4] = 43;
+        CHECK(snd1.get(1, 1) == 42);
+        CHECK(snd1.get(4, 1) == 43);
+
+        std::vector<short> interleaved(10);
+        CHECK(snd1.copyToInterleaved(interleaved.data(), 0, 5) == 5);
+        std::vector<short> expected = { 0, 100, 1, 42, 2, 102, 3, 103, 4, 43 };
+        CHECK(interleaved == expected);
+
+        Sound snd2;
+        snd2.resize(5, 2);
+        CHECK(snd2.copyFromInterleaved(test_vec_i.data(), 1, 10) == 4);
+        CHECK(snd2.get(0, 0) == 0);
+        CHECK(snd2.get(0, 1) == 0);
+        CHECK(snd2.get(1, 0) == 0);
+        CHECK(snd2.get(1, 1) == 100);
+        CHECK(snd2.get(4, 1) == 103);
+
+        // Any number of channels
+        Sound snd3;
+        snd3.resize(7, 5);
+        generate_test_sound(snd3, 7, 5);
+        std::vector<short> buf(7 * 5);
+        snd3.copyToInterleaved(buf.data(), 0, 7);
+        Sound snd4;
+        snd4.resize(7, 5);
+        snd4.copyFromInterleaved(buf.data(), 0, 7);
+        CHECK(snd4.getInterleavedView()(6, 4) == snd3.get(6, 4));
+        snd4.setFrequency(snd3.getFrequency());
+        CHECK(snd3 == snd4);
+    }
+
     SECTION("check sound transmission.")
     {
 
@@ -721,5 +789,85 @@ TEST_CASE("sig::SoundTest", "[yarp::sig]")
         #endif
     }
 
+    SECTION("check resampling.")
+    {
+        // 8 channels at 48 kHz, a tone per channel
+        const size_t channels = 8;
+        const size_t samples = 4800;
+        Sound snd;
+        snd.setFrequency(48000);
+        snd.resize(samples, channels);
+        auto tone = [](size_t c, double t) { return 10000.0 * std::sin(2.0 * M_PI * (200.0 + 800.0 * c) * t); };
+        for (size_t c = 0; c < channels; c++) {
+            for (size_t t = 0; t < samples; t++) {
+                snd.set(static_cast<Sound::audio_sample>(std::lround(tone(c, t / 48000.0))), t, c);
+            }
+        }
+
+        Sound oneshot = snd;
+        CHECK(soundfilters::resample(oneshot, 16000));
+        CHECK(oneshot.getFrequency() == 16000);
+        CHECK(oneshot.getSamples() == samples / 3);
+        CHECK(oneshot.getChannels() == channels);
+
+        // The tones are kept, apart from the start and the end of the sound
+        double maxError = 0;
+        for (size_t c = 0; c < channels; c++) {
+            for (size_t t = 50; t < oneshot.getSamples() - 50; t++) {
+                maxError = std::max(maxError, std::abs(oneshot.get(t, c) - tone(c, t / 16000.0)));
+            }
+        }
+        CHECK(maxError < 20);
+
+        // The same result, streaming chunks of 10 ms
+        soundfilters::Resampler resampler(48000, 16000, channels);
+        std::vector<Sound> chunks;
+        size_t streamed = 0;
+        for (size_t first = 0; first < samples; first += 480) {
+            Sound in = snd.subSound(first, 480);
+            Sound out;
+            REQUIRE(resampler.process(in, out));
+            CHECK(out.getFrequency() == 16000);
+            chunks.push_back(out);
+            streamed += out.getSamples();
+        }
+        CHECK(streamed + resampler.getLatency() / 3 + 1 >= samples / 3);
+        bool same = true;
+        size_t t0 = 0;
+        for (const auto& chunk : chunks) {
+            for (size_t t = 0; t < chunk.getSamples(); t++) {
+                for (size_t c = 0; c < channels; c++) {
+                    same &= chunk.get(t, c) == oneshot.get(t0 + t, c);
+                }
+            }
+            t0 += chunk.getSamples();
+        }
+        CHECK(same);
+
+        // The frequencies above the output Nyquist frequency are removed
+        Sound high;
+        high.setFrequency(48000);
+        high.resize(samples, 1);
+        for (size_t t = 0; t < samples; t++) {
+            high.set(static_cast<Sound::audio_sample>(std::lround(10000.0 * std::sin(2.0 * M_PI * 10000.0 * t / 48000.0))), t, 0);
+        }
+        CHECK(soundfilters::resample(high, 16000));
+        Sound::audio_sample peak = 0;
+        for (size_t t = 50; t < high.getSamples() - 50; t++) {
+            peak = std::max<Sound::audio_sample>(peak, std::abs(high.get(t, 0)));
+        }
+        CHECK(peak < 10);
+
+        // Upsampling, with a ratio that is not an integer
+        Sound up = snd.extractChannelAsSound(1);
+        CHECK(soundfilters::resample(up, 44100));
+        CHECK(up.getSamples() == 4410);
+        maxError = 0;
+        for (size_t t = 100; t < up.getSamples() - 100; t++) {
+            maxError = std::max(maxError, std::abs(up.get(t, 0) - tone(1, t / 44100.0)));
+        }
+        CHECK(maxError < 20);
+    }
+
     NetworkBase::setLocalMode(false);
 }
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/VectorN.h>
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Portable.h>
+
+#include <numeric>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+TEST_CASE("sig::VectorNTest", "[yarp::sig]")
+{
+    SECTION("Check construction and element access")
+    {
+        VectorN<double, 3> zero;
+        CHECK(zero.size() == 3);
+        CHECK(zero[0] == 0.0);
+        CHECK(zero[1] == 0.0);
+        CHECK(zero[2] == 0.0);
+
+        VectorN<double, 3> v{1.0, 2.0};
+        CHECK(v[0] == 1.0);
+        CHECK(v[1] == 2.0);
+        CHECK(v[2] == 0.0);
+
+        v(2) = 3.0;
+        CHECK(v[2] == 3.0);
+        CHECK(std::accumulate(v.begin(), v.end(), 0.0) == 6.0);
+
+        auto s = v.span();
+        CHECK(s.size() == 3);
+        CHECK(s.data() == v.data());
+        s[0] = 4.0;
+        CHECK(v[0] == 4.0);
+
+        v = 5.0;
+        CHECK(v == VectorN<double, 3>{5.0, 5.0, 5.0});
+        v.zero();
+        CHECK(v == zero);
+    }
+
+    SECTION("Check conversion from and to Vector")
+    {
+        Vector dyn{1.0, 2.0, 3.0};
+        VectorN<double, 3> v(dyn);
+        CHECK(v[0] == 1.0);
+        CHECK(v[1] == 2.0);
+        CHECK(v[2] == 3.0);
+
+        v[1] = 7.0;
+        Vector out(3);
+        const double* ptr = out.data();
+        v.toVector(out);
+        CHECK(out.data() == ptr);
+        CHECK(out.size() == 3);
+        CHECK(out[1] == 7.0);
+        CHECK(v.toVector() == out);
+        CHECK(v.toString() == out.toString());
+    }
+
+    SECTION("Check the wire compatibility with Vector")
+    {
+        VectorN<double, 3> v{1.0, 2.0, 3.0};
+        Vector dyn;
+        REQUIRE(Portable::copyPortable(v, dyn));
+        CHECK(dyn.size() == 3);
+        CHECK(dyn[0] == 1.0);
+        CHECK(dyn[1] == 2.0);
+        CHECK(dyn[2] == 3.0);
+
+        dyn[2] = 9.0;
+        VectorN<double, 3> back;
+        REQUIRE(Portable::copyPortable(dyn, back));
+        CHECK(back == VectorN<double, 3>{1.0, 2.0, 9.0});
+
+        Bottle b;
+        REQUIRE(Portable::copyPortable(v, b));
+        CHECK(b.toString() == "1.0 2.0 3.0");
+
+        VectorOf<int> ints{1, 2, 3, 4};
+        VectorN<int, 4> fixedInts;
+        REQUIRE(Portable::copyPortable(ints, fixedInts));
+        CHECK(fixedInts == VectorN<int, 4>{1, 2, 3, 4});
+    }
+
+    SECTION("Check that a vector of a different size is not read")
+    {
+        Vector dyn{1.0, 2.0, 3.0, 4.0};
+        VectorN<double, 3> v{5.0, 6.0, 7.0};
+        CHECK_FALSE(Portable::copyPortable(dyn, v));
+        CHECK(v.size() == 3);
+    }
+}
@@ -0,0 +1,450 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ImageRoiPortmonitor.h"
+
+#include <yarp/os/LogComponent.h>
+#include <yarp/os/LogStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+namespace {
+YARP_LOG_COMPONENT(IMAGEROI,
+                   "yarp.carrier.portmonitor.image_roi",
+                   yarp::os::Log::minimumPrintLevel(),
+                   yarp::os::Log::LogTypeReserved,
+                   yarp::os::Log::printCallback(),
+                   nullptr)
+
+// The message sent on the network is a bottle containing:
+//   width height pixelCode reset (rois) (tiles) blob
+// where width and height are the ones of the downscaled image, reset asks the
+// receiver to clear the image, rois and tiles are lists of x y w h, and the
+// blob contains the pixels of the tiles, one tile after the other.
+constexpr size_t messageSize = 7;
+
+// Largest image accepted by the receiver, in bytes
+constexpr size_t maxImageSize = size_t{1} << 30;
+
+bool isTileChanged(const Image& frame, const Image& previous, size_t x, size_t y, size_t w, size_t h)
+{
+    const size_t offset = x * frame.getPixelSize();
+    const size_t bytes = w * frame.getPixelSize();
+    for (size_t i = y; i < y + h; ++i) {
+        if (memcmp(frame.getRow(i) + offset, previous.getRow(i) + offset, bytes) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void copyTile(const Image& src, Image& dest, size_t x, size_t y, size_t w, size_t h)
+{
+    const size_t offset = x * src.getPixelSize();
+    const size_t bytes = w * src.getPixelSize();
+    for (size_t i = y; i < y + h; ++i) {
+        memcpy(dest.getRow(i) + offset, src.getRow(i) + offset, bytes);
+    }
+}
+
+bool readRect(const Bottle& b, size_t i, size_t width, size_t height, size_t& x, size_t& y, size_t& w, size_t& h)
+{
+    const int vx = b.get(i).asInt32();
+    const int vy = b.get(i + 1).asInt32();
+    const int vw = b.get(i + 2).asInt32();
+    const int vh = b.get(i + 3).asInt32();
+    if (vx < 0 || vy < 0 || vw < 0 || vh < 0) {
+        return false;
+    }
+    x = static_cast<size_t>(vx);
+    y = static_cast<size_t>(vy);
+    w = static_cast<size_t>(vw);
+    h = static_cast<size_t>(vh);
+    return x + w <= width && y + h <= height;
+}
+
+} // namespace
+
+
+bool ImageRoiMonitorObject::create(const yarp::os::Property& options)
+{
+    m_senderSide = options.find("sender_side").asBool();
+    if (!m_senderSide) {
+        m_crop = options.check("crop", Value(false)).asBool();
+        return true;
+    }
+    return parseOptions(options);
+}
+
+void ImageRoiMonitorObject::destroy()
+{
+}
+
+bool ImageRoiMonitorObject::setparam(const yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        return false;
+    }
+    return parseOptions(params);
+}
+
+bool ImageRoiMonitorObject::getparam(yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        params.put("crop", m_crop);
+        return true;
+    }
+    Bottle rois;
+    for (const auto& roi : m_rois) {
+        rois.addInt32(static_cast<int>(roi.x));
+        rois.addInt32(static_cast<int>(roi.y));
+        rois.addInt32(static_cast<int>(roi.w));
+        rois.addInt32(static_cast<int>(roi.h));
+    }
+    params.put("roi", Value::makeList(rois.toString().c_str()));
+    params.put("scale", static_cast<int>(m_scale));
+    params.put("delta", m_delta);
+    params.put("tile", static_cast<int>(m_tileSize));
+    params.put("keyframe", static_cast<int>(m_keyframe));
+    return true;
+}
+
+bool ImageRoiMonitorObject::parseOptions(const yarp::os::Property& options)
+{
+    if (options.check("roi")) {
+        // On the connection string the values are separated by underscores,
+        // e.g. roi.0_0_320_240, while setparam() can also pass a list.
+        std::vector<int> values;
+        const Value& v = options.find("roi");
+        if (v.isList()) {
+            for (size_t i = 0; i < v.asList()->size(); ++i) {
+                values.push_back(v.asList()->get(i).asInt32());
+            }
+        } else {
+            std::string str = v.toString();
+            std::replace(str.begin(), str.end(), '_', ' ');
+            std::istringstream ss(str);
+            int value = 0;
+            while (ss >> value) {
+                values.push_back(value);
+            }
+            if (!ss.eof()) {
+                yCError(IMAGEROI) << "Invalid value of `roi` parameter:" << v.toString();
+                return false;
+            }
+        }
+        if (values.empty() || values.size() % 4 != 0) {
+            yCError(IMAGEROI) << "The `roi` parameter must contain groups of 4 values (x y w h)";
+            return false;
+        }
+        std::vector<Rect> rois;
+        for (size_t i = 0; i < values.size(); i += 4) {
+            if (values[i] < 0 || values[i + 1] < 0 || values[i + 2] <= 0 || values[i + 3] <= 0) {
+                yCError(IMAGEROI) << "Invalid region of interest in `roi` parameter:" << v.toString();
+                return false;
+            }
+            rois.push_back({static_cast<size_t>(values[i]),
+                            static_cast<size_t>(values[i + 1]),
+                            static_cast<size_t>(values[i + 2]),
+                            static_cast<size_t>(values[i + 3])});
+        }
+        m_rois = std::move(rois);
+    }
+
+    if (options.check("scale")) {
+        const int scale = options.find("scale").asInt32();
+        if (scale < 1) {
+            yCError(IMAGEROI) << "Invalid value of `scale` parameter:" << scale;
+            return false;
+        }
+        m_scale = static_cast<size_t>(scale);
+    }
+
+    if (options.check("delta")) {
+        m_delta = options.find("delta").asBool();
+    }
+
+    if (options.check("tile")) {
+        const int tile = options.find("tile").asInt32();
+        if (tile < 1) {
+            yCError(IMAGEROI) << "Invalid value of `tile` parameter:" << tile;
+            return false;
+        }
+        m_tileSize = static_cast<size_t>(tile);
+    }
+
+    if (options.check("keyframe")) {
+        const int keyframe = options.find("keyframe").asInt32();
+        if (keyframe < 0) {
+            yCError(IMAGEROI) << "Invalid value of `keyframe` parameter:" << keyframe;
+            return false;
+        }
+        m_keyframe = static_cast<size_t>(keyframe);
+    }
+
+    // The regions sent might have changed, the receiver must start over
+    m_pixelCode = VOCAB_PIXEL_INVALID;
+    m_count = 0;
+
+    return true;
+}
+
+bool ImageRoiMonitorObject::accept(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        auto* img = thing.cast_as<Image>();
+        if (img == nullptr) {
+            yCError(IMAGEROI, "Expected type Image in sender side, but got wrong data type!");
+            return false;
+        }
+        if (img->getPixelSize() == 0) {
+            yCError(IMAGEROI, "Received image with invalid/unsupported pixelCode!");
+            return false;
+        }
+    } else {
+        auto* b = thing.cast_as<Bottle>();
+        if (b == nullptr) {
+            yCError(IMAGEROI, "Expected type Bottle in receiver side, but got wrong data type!");
+            return false;
+        }
+        // The invalid messages are dropped
+        if (!decode(*b)) {
+            yCError(IMAGEROI, "Invalid data received");
+            return false;
+        }
+    }
+    return true;
+}
+
+yarp::os::Things& ImageRoiMonitorObject::update(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        // sender side: it receives an image, it sends a bottle to the network
+        auto* img = thing.cast_as<Image>();
+        if (img == nullptr || img->getPixelSize() == 0) {
+            yCError(IMAGEROI, "Invalid image");
+            return thing;
+        }
+        encode(*img);
+        m_th.setPortWriter(&m_data);
+        return m_th;
+    }
+
+    // receiver side: the bottle received from the network was already
+    // decoded by accept()
+    m_th.setPortWriter(m_crop ? &m_cropped : &m_canvas);
+    return m_th;
+}
+
+void ImageRoiMonitorObject::addTile(const Image& frame, const Rect& tile)
+{
+    m_tiles.push_back(tile);
+    const size_t offset = tile.x * frame.getPixelSize();
+    const size_t bytes = tile.w * frame.getPixelSize();
+    for (size_t i = tile.y; i < tile.y + tile.h; ++i) {
+        const unsigned char* row = frame.getRow(i) + offset;
+        m_buffer.insert(m_buffer.end(), row, row + bytes);
+    }
+}
+
+void ImageRoiMonitorObject::encode(const Image& img)
+{
+    const size_t pixelSize = img.getPixelSize();
+    const size_t width = img.width() / m_scale;
+    const size_t height = img.height() / m_scale;
+
+    // Downscale by decimation, the cost depends on the size of the output
+    const Image* frame = &img;
+    if (m_scale > 1) {
+        m_scaled.setPixelCode(img.getPixelCode());
+        m_scaled.resize(width, height);
+        for (size_t y = 0; y < height; ++y) {
+            const unsigned char* src = img.getRow(y * m_scale);
+            unsigned char* dest = m_scaled.getRow(y);
+            for (size_t x = 0; x < width; ++x) {
+                memcpy(dest + x * pixelSize, src + x * m_scale * pixelSize, pixelSize);
+            }
+        }
+        frame = &m_scaled;
+    }
+
+    // The regions of interest, in the coordinates of the downscaled image
+    m_scaledRois.clear();
+    if (m_rois.empty()) {
+        m_scaledRois.push_back({0, 0, width, height});
+    } else {
+        for (const auto& roi : m_rois) {
+            const size_t x0 = std::min(roi.x / m_scale, width);
+            const size_t y0 = std::min(roi.y / m_scale, height);
+            const size_t x1 = std::min((roi.x + roi.w + m_scale - 1) / m_scale, width);
+            const size_t y1 = std::min((roi.y + roi.h + m_scale - 1) / m_scale, height);
+            if (x1 > x0 && y1 > y0) {
+                m_scaledRois.push_back({x0, y0, x1 - x0, y1 - y0});
+            }
+        }
+    }
+
+    const bool reset = m_width != width ||
+                       m_height != height ||
+                       m_pixelCode != img.getPixelCode();
+    m_width = width;
+    m_height = height;
+    m_pixelCode = img.getPixelCode();
+
+    m_tiles.clear();
+    m_buffer.clear();
+    if (!m_delta) {
+        for (const auto& roi : m_scaledRois) {
+            addTile(*frame, roi);
+        }
+    } else {
+        if (reset || m_previous.width() != width || m_previous.height() != height) {
+            m_previous.setPixelCode(img.getPixelCode());
+            m_previous.resize(width, height);
+            m_count = 0;
+        }
+        const bool keyframe = m_count == 0 || (m_keyframe > 0 && m_count % m_keyframe == 0);
+        for (const auto& roi : m_scaledRois) {
+            // The tiles are aligned to a grid, so that the same tile is
+            // compared in all the frames
+            for (size_t ty = roi.y / m_tileSize * m_tileSize; ty < roi.y + roi.h; ty += m_tileSize) {
+                for (size_t tx = roi.x / m_tileSize * m_tileSize; tx < roi.x + roi.w; tx += m_tileSize) {
+                    const size_t x0 = std::max(tx, roi.x);
+                    const size_t y0 = std::max(ty, roi.y);
+                    const size_t x1 = std::min(tx + m_tileSize, roi.x + roi.w);
+                    const size_t y1 = std::min(ty + m_tileSize, roi.y + roi.h);
+                    const Rect tile {x0, y0, x1 - x0, y1 - y0};
+                    if (keyframe || isTileChanged(*frame, m_previous, tile.x, tile.y, tile.w, tile.h)) {
+                        copyTile(*frame, m_previous, tile.x, tile.y, tile.w, tile.h);
+                        addTile(*frame, tile);
+                    }
+                }
+            }
+        }
+    }
+    ++m_count;
+
+    m_data.clear();
+    m_data.addInt32(static_cast<int>(width));
+    m_data.addInt32(static_cast<int>(height));
+    m_data.addInt32(img.getPixelCode());
+    m_data.addInt32(reset ? 1 : 0);
+    Bottle& rois = m_data.addList();
+    for (const auto& roi : m_scaledRois) {
+        rois.addInt32(static_cast<int>(roi.x));
+        rois.addInt32(static_cast<int>(roi.y));
+        rois.addInt32(static_cast<int>(roi.w));
+        rois.addInt32(static_cast<int>(roi.h));
+    }
+    Bottle& tiles = m_data.addList();
+    for (const auto& tile : m_tiles) {
+        tiles.addInt32(static_cast<int>(tile.x));
+        tiles.addInt32(static_cast<int>(tile.y));
+        tiles.addInt32(static_cast<int>(tile.w));
+        tiles.addInt32(static_cast<int>(tile.h));
+    }
+    m_data.add(Value::makeBlob(m_buffer.data(), static_cast<int>(m_buffer.size())));
+}
+
+bool ImageRoiMonitorObject::decode(const Bottle& data)
+{
+    if (data.size() != messageSize) {
+        return false;
+    }
+    const int width = data.get(0).asInt32();
+    const int height = data.get(1).asInt32();
+    const int pixelCode = data.get(2).asInt32();
+    bool reset = data.get(3).asBool();
+    const Bottle* rois = data.get(4).asList();
+    const Bottle* tiles = data.get(5).asList();
+    const Value& blob = data.get(6);
+    if (width < 0 || height < 0 || rois == nullptr || tiles == nullptr || !blob.isBlob() ||
+        rois->size() % 4 != 0 || tiles->size() % 4 != 0) {
+        return false;
+    }
+
+    if (m_canvas.getPixelCode() != pixelCode ||
+        m_canvas.width() != static_cast<size_t>(width) ||
+        m_canvas.height() != static_cast<size_t>(height)) {
+        m_canvas.setPixelCode(pixelCode);
+        // Check the size before allocating the image
+        const size_t pixelSize = m_canvas.getPixelSize();
+        if (pixelSize > 0 && height > 0 &&
+            static_cast<size_t>(width) > maxImageSize / pixelSize / static_cast<size_t>(height)) {
+            yCError(IMAGEROI, "Invalid data received: image too big (%dx%d)", width, height);
+            return false;
+        }
+        m_canvas.resize(width, height);
+        reset = true;
+    }
+    const size_t pixelSize = m_canvas.getPixelSize();
+    if (pixelSize == 0) {
+        return false;
+    }
+    if (reset) {
+        m_canvas.zero();
+    }
+
+    const auto* bytes = reinterpret_cast<const unsigned char*>(blob.asBlob());
+    const size_t length = blob.asBlobLength();
+    size_t offset = 0;
+    for (size_t i = 0; i < tiles->size(); i += 4) {
+        size_t x;
+        size_t y;
+        size_t w;
+        size_t h;
+        if (!readRect(*tiles, i, m_canvas.width(), m_canvas.height(), x, y, w, h) ||
+            offset + w * h * pixelSize > length) {
+            return false;
+        }
+        for (size_t row = y; row < y + h; ++row) {
+            memcpy(m_canvas.getRow(row) + x * pixelSize, bytes + offset, w * pixelSize);
+            offset += w * pixelSize;
+        }
+    }
+    if (offset != length) {
+        return false;
+    }
+
+    if (m_crop) {
+        // Output the bounding box of the regions of interest
+        size_t x0 = m_canvas.width();
+        size_t y0 = m_canvas.height();
+        size_t x1 = 0;
+        size_t y1 = 0;
+        for (size_t i = 0; i < rois->size(); i += 4) {
+            size_t x;
+            size_t y;
+            size_t w;
+            size_t h;
+            if (!readRect(*rois, i, m_canvas.width(), m_canvas.height(), x, y, w, h)) {
+                return false;
+            }
+            x0 = std::min(x0, x);
+            y0 = std::min(y0, y);
+            x1 = std::max(x1, x + w);
+            y1 = std::max(y1, y + h);
+        }
+        if (x1 <= x0 || y1 <= y0) {
+            x0 = 0;
+            y0 = 0;
+            x1 = m_canvas.width();
+            y1 = m_canvas.height();
+        }
+        m_cropped.setPixelCode(pixelCode);
+        m_cropped.resize(x1 - x0, y1 - y0);
+        for (size_t row = y0; row < y1; ++row) {
+            memcpy(m_cropped.getRow(row - y0), m_canvas.getRow(row) + x0 * pixelSize, (x1 - x0) * pixelSize);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_PORTMONITOR_IMAGEROI_H
+#define YARP_PORTMONITOR_IMAGEROI_H
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Things.h>
+#include <yarp/os/MonitorObject.h>
+#include <yarp/sig/Image.h>
+
+#include <vector>
+
+ /**
+  * @ingroup portmonitors_lists
+  * \brief `image_roi`: Portmonitor plugin that transmits only some regions of the images.
+  *
+  * The subscriber declares on the connection the regions of interest, a
+  * downscale factor and/or the delta mode, and the sender side sends only
+  * the requested tiles.  The receiver side puts them back together in an
+  * image as large as the (downscaled) original one.
+  *
+  * Sender side parameters:
+  * - `roi`: regions of the original image to send, as `x_y_w_h`, with more
+  *   regions concatenated as `x1_y1_w1_h1_x2_y2_w2_h2`.  Default: the whole image.
+  * - `scale`: downscale factor, the images are decimated (default: 1).
+  * - `delta`: 1 to send only the tiles that changed since the last image (default: 0).
+  * - `tile`: the size of the tiles of the delta mode, in pixels (default: 64).
+  * - `keyframe`: in delta mode, send all the tiles every `keyframe` images, 0 to
+  *   never do it (default: 30).
+  *
+  * Receiver side parameters:
+  * - `crop`: 1 to output only the bounding box of the regions of interest (default: 0).
+  *
+  * Example usage:
+  * yarp connect /grabber /view tcp+send.portmonitor+file.image_roi+type.dll+roi.0_0_640_480+recv.portmonitor+file.image_roi+type.dll
+  * yarp connect /grabber /view tcp+send.portmonitor+file.image_roi+type.dll+scale.4+delta.1+recv.portmonitor+file.image_roi+type.dll
+  */
+class ImageRoiMonitorObject : public yarp::os::MonitorObject
+{
+public:
+    bool create(const yarp::os::Property& options) override;
+    void destroy() override;
+
+    bool setparam(const yarp::os::Property& params) override;
+    bool getparam(yarp::os::Property& params) override;
+
+    bool accept(yarp::os::Things& thing) override;
+    yarp::os::Things& update(yarp::os::Things& thing) override;
+
+private:
+    struct Rect
+    {
+        size_t x;
+        size_t y;
+        size_t w;
+        size_t h;
+    };
+
+    bool parseOptions(const yarp::os::Property& options);
+    void encode(const yarp::sig::Image& img);
+    bool decode(const yarp::os::Bottle& data);
+    void addTile(const yarp::sig::Image& frame, const Rect& tile);
+
+    bool m_senderSide {false};
+
+    // sender side
+    std::vector<Rect> m_rois;
+    size_t m_scale {1};
+    bool m_delta {false};
+    size_t m_tileSize {64};
+    size_t m_keyframe {30};
+    size_t m_count {0};
+    size_t m_width {0};
+    size_t m_height {0};
+    int m_pixelCode {VOCAB_PIXEL_INVALID};
+    std::vector<Rect> m_scaledRois;
+    std::vector<Rect> m_tiles;
+    yarp::sig::FlexImage m_scaled;
+    yarp::sig::FlexImage m_previous;
+    std::vector<unsigned char> m_buffer;
+    yarp::os::Bottle m_data;
+
+    // receiver side
+    bool m_crop {false};
+    yarp::sig::FlexImage m_canvas;
+    yarp::sig::FlexImage m_cropped;
+
+    yarp::os::Things m_th;
+};
+
+#endif // YARP_PORTMONITOR_IMAGEROI_H
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/SystemClock.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/sig/Image.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using yarp::sig::ImageOf;
+using yarp::sig::PixelRgb;
+
+namespace {
+
+constexpr size_t width = 32;
+constexpr size_t height = 16;
+
+PixelRgb testPixel(size_t x, size_t y, unsigned char frame)
+{
+    return PixelRgb(static_cast<unsigned char>(x * 7), static_cast<unsigned char>(y * 13), frame);
+}
+
+void fillImage(ImageOf<PixelRgb>& img, unsigned char frame)
+{
+    img.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            img.pixel(x, y) = testPixel(x, y, frame);
+        }
+    }
+}
+
+bool samePixel(const PixelRgb& a, const PixelRgb& b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+} // namespace
+
+TEST_CASE("pm::image_roiTest", "[yarp::pm]")
+{
+    YARP_REQUIRE_PLUGIN("image_roi", "portmonitor")
+
+    yarp::os::Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    yarp::os::NetworkBase::setLocalMode(true);
+    yarp::os::Time::delay(1.0);
+
+    yarp::os::BufferedPort<ImageOf<PixelRgb>> sender;
+    yarp::os::BufferedPort<ImageOf<PixelRgb>> receiver;
+    sender.open("/send");
+    receiver.open("/recv");
+
+    SECTION("Test regions of interest")
+    {
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.image_roi+type.dll+roi.4_2_8_6_20_10_4_4+recv.portmonitor+file.image_roi+type.dll"));
+
+        fillImage(sender.prepare(), 1);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+
+        ImageOf<PixelRgb>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == width);
+        REQUIRE(received->height() == height);
+
+        bool ok = true;
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                bool inside = (x >= 4 && x < 12 && y >= 2 && y < 8) || (x >= 20 && x < 24 && y >= 10 && y < 14);
+                PixelRgb expected = inside ? testPixel(x, y, 1) : PixelRgb(0, 0, 0);
+                ok &= samePixel(received->pixel(x, y), expected);
+            }
+        }
+        CHECK(ok);
+    }
+
+    SECTION("Test cropping of the region of interest")
+    {
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.image_roi+type.dll+roi.4_2_8_6+recv.portmonitor+file.image_roi+type.dll+crop.1"));
+
+        fillImage(sender.prepare(), 1);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+
+        ImageOf<PixelRgb>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == 8);
+        REQUIRE(received->height() == 6);
+
+        bool ok = true;
+        for (size_t y = 0; y < 6; y++) {
+            for (size_t x = 0; x < 8; x++) {
+                ok &= samePixel(received->pixel(x, y), testPixel(x + 4, y + 2, 1));
+            }
+        }
+        CHECK(ok);
+    }
+
+    SECTION("Test downscaling")
+    {
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.image_roi+type.dll+scale.2+recv.portmonitor+file.image_roi+type.dll"));
+
+        fillImage(sender.prepare(), 1);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+
+        ImageOf<PixelRgb>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == width / 2);
+        REQUIRE(received->height() == height / 2);
+
+        bool ok = true;
+        for (size_t y = 0; y < height / 2; y++) {
+            for (size_t x = 0; x < width / 2; x++) {
+                ok &= samePixel(received->pixel(x, y), testPixel(x * 2, y * 2, 1));
+            }
+        }
+        CHECK(ok);
+    }
+
+    SECTION("Test delta mode")
+    {
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.image_roi+type.dll+delta.1+tile.8+recv.portmonitor+file.image_roi+type.dll"));
+
+        fillImage(sender.prepare(), 1);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+        ImageOf<PixelRgb>* received = receiver.read();
+        REQUIRE(received != nullptr);
+
+        // Change a single tile: the others are kept by the receiver
+        ImageOf<PixelRgb>& img = sender.prepare();
+        fillImage(img, 1);
+        img.pixel(13, 9) = PixelRgb(1, 2, 3);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+        received = receiver.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == width);
+        REQUIRE(received->height() == height);
+
+        bool ok = true;
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                PixelRgb expected = (x == 13 && y == 9) ? PixelRgb(1, 2, 3) : testPixel(x, y, 1);
+                ok &= samePixel(received->pixel(x, y), expected);
+            }
+        }
+        CHECK(ok);
+    }
+
+    receiver.close();
+    sender.close();
+
+    yarp::os::NetworkBase::setLocalMode(false);
+}
+
+TEST_CASE("pm::image_roiTest_malformed", "[yarp::pm]")
+{
+    YARP_REQUIRE_PLUGIN("image_roi", "portmonitor")
+
+    yarp::os::Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    yarp::os::NetworkBase::setLocalMode(true);
+
+    SECTION("Test malformed messages")
+    {
+        yarp::os::BufferedPort<yarp::os::Bottle> badSender;
+        yarp::os::BufferedPort<ImageOf<PixelRgb>> sender;
+        yarp::os::BufferedPort<ImageOf<PixelRgb>> receiver;
+
+        badSender.open("/badsend");
+        sender.open("/send");
+        receiver.open("/recv");
+        receiver.setStrict();
+
+        REQUIRE(yarp::os::Network::connect("/badsend", "/recv", "fast_tcp+recv.portmonitor+file.image_roi+type.dll"));
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.image_roi+type.dll+recv.portmonitor+file.image_roi+type.dll"));
+
+        // width height pixelCode reset (rois) (tiles) blob
+        const char pixels[] = "abc";
+        auto sendBad = [&](int w, int h, int tileW, int tileH) {
+            yarp::os::Bottle& b = badSender.prepare();
+            b.clear();
+            b.addInt32(w);
+            b.addInt32(h);
+            b.addInt32(VOCAB_PIXEL_RGB);
+            b.addInt32(1);
+            b.addList();
+            yarp::os::Bottle& tiles = b.addList();
+            tiles.addInt32(0);
+            tiles.addInt32(0);
+            tiles.addInt32(tileW);
+            tiles.addInt32(tileH);
+            b.add(yarp::os::Value::makeBlob(const_cast<char*>(pixels), 3));
+            badSender.writeStrict();
+        };
+
+        sendBad(0x7fffffff, 0x7fffffff, 1, 1); // too big
+        sendBad(1 << 16, 1 << 16, 1, 1);       // too big
+        sendBad(4, 4, 2, 2);                    // blob smaller than the tiles
+        sendBad(4, 4, 5, 1);                    // tile outside of the image
+        yarp::os::Time::delay(0.5);
+        CHECK(receiver.getPendingReads() == 0);
+
+        // the connection still works
+        fillImage(sender.prepare(), 1);
+        sender.write();
+        ImageOf<PixelRgb>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        CHECK(received->width() == width);
+        CHECK(received->height() == height);
+
+        receiver.close();
+        sender.close();
+        badSender.close();
+    }
+
+    yarp::os::NetworkBase::setLocalMode(false);
+}
@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "JointStateFieldsPortmonitor.h"
+
+#include <yarp/os/LogComponent.h>
+#include <yarp/os/LogStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+using namespace yarp::os;
+using yarp::dev::JointStateData;
+
+namespace {
+YARP_LOG_COMPONENT(JOINTSTATEFIELDS,
+                   "yarp.carrier.portmonitor.jointstate_fields",
+                   yarp::os::Log::minimumPrintLevel(),
+                   yarp::os::Log::LogTypeReserved,
+                   yarp::os::Log::printCallback(),
+                   nullptr)
+
+// The message sent on the network is a bottle containing:
+//   mask joints blob
+// where mask has a bit set for each field sent, and the blob contains the
+// values of the fields, in the order of the bits, each one as an array of
+// `joints` binary values (double, float or int32, as in JointStateData).
+constexpr size_t messageSize = 3;
+
+// Largest number of joints accepted by the receiver
+constexpr int maxJoints = 1 << 16;
+
+// The names of the fields, in the order of the bits of the mask
+constexpr const char* fieldNames[] = {
+    "pos", "vel", "acc", "mpos", "mvel", "macc", "trq", "pwm", "cur", "cmode", "imode", "temp"
+};
+constexpr size_t fieldCount = sizeof(fieldNames) / sizeof(fieldNames[0]);
+constexpr unsigned int allFields = (1U << fieldCount) - 1;
+
+// Calls f(bit, vector, isValid) for all the fields of the joint state
+template <typename S, typename F>
+void forEachField(S& s, F&& f)
+{
+    f(1U << 0, s.jointPosition, s.jointPosition_isValid);
+    f(1U << 1, s.jointVelocity, s.jointVelocity_isValid);
+    f(1U << 2, s.jointAcceleration, s.jointAcceleration_isValid);
+    f(1U << 3, s.motorPosition, s.motorPosition_isValid);
+    f(1U << 4, s.motorVelocity, s.motorVelocity_isValid);
+    f(1U << 5, s.motorAcceleration, s.motorAcceleration_isValid);
+    f(1U << 6, s.torque, s.torque_isValid);
+    f(1U << 7, s.pwmDutycycle, s.pwmDutycycle_isValid);
+    f(1U << 8, s.current, s.current_isValid);
+    f(1U << 9, s.controlMode, s.controlMode_isValid);
+    f(1U << 10, s.interactionMode, s.interactionMode_isValid);
+    f(1U << 11, s.temperature, s.temperature_isValid);
+}
+
+bool parseFields(const std::string& fields, unsigned int& mask)
+{
+    // On the connection string the names are separated by underscores,
+    // e.g. fields.pos_vel, while setparam() can also pass them with spaces.
+    std::string str = fields;
+    std::replace(str.begin(), str.end(), '_', ' ');
+    std::istringstream ss(str);
+    std::string name;
+    unsigned int result = 0;
+    while (ss >> name) {
+        if (name == "all") {
+            result |= allFields;
+            continue;
+        }
+        const auto* it = std::find(std::begin(fieldNames), std::end(fieldNames), name);
+        if (it == std::end(fieldNames)) {
+            return false;
+        }
+        result |= 1U << (it - std::begin(fieldNames));
+    }
+    if (result == 0) {
+        return false;
+    }
+    mask = result;
+    return true;
+}
+
+std::string fieldsToString(unsigned int mask)
+{
+    std::string str;
+    for (size_t i = 0; i < fieldCount; ++i) {
+        if ((mask & (1U << i)) != 0) {
+            str += (str.empty() ? "" : "_") + std::string(fieldNames[i]);
+        }
+    }
+    return str;
+}
+
+} // namespace
+
+
+bool JointStateFieldsMonitorObject::create(const yarp::os::Property& options)
+{
+    m_senderSide = options.find("sender_side").asBool();
+    if (!m_senderSide) {
+        return true;
+    }
+    m_mask = allFields;
+    return parseOptions(options);
+}
+
+void JointStateFieldsMonitorObject::destroy()
+{
+}
+
+bool JointStateFieldsMonitorObject::setparam(const yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        return false;
+    }
+    return parseOptions(params);
+}
+
+bool JointStateFieldsMonitorObject::getparam(yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        return false;
+    }
+    params.put("fields", fieldsToString(m_mask));
+    params.put("decimation", static_cast<int>(m_decimation));
+    return true;
+}
+
+bool JointStateFieldsMonitorObject::parseOptions(const yarp::os::Property& options)
+{
+    if (options.check("fields")) {
+        const std::string fields = options.find("fields").toString();
+        if (!parseFields(fields, m_mask)) {
+            yCError(JOINTSTATEFIELDS) << "Invalid value of `fields` parameter:" << fields;
+            return false;
+        }
+    }
+
+    if (options.check("decimation")) {
+        const int decimation = options.find("decimation").asInt32();
+        if (decimation < 1) {
+            yCError(JOINTSTATEFIELDS) << "Invalid value of `decimation` parameter:" << decimation;
+            return false;
+        }
+        m_decimation = static_cast<size_t>(decimation);
+        m_count = 0;
+    }
+
+    return true;
+}
+
+bool JointStateFieldsMonitorObject::accept(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        if (thing.cast_as<JointStateData>() == nullptr) {
+            yCError(JOINTSTATEFIELDS, "Expected type JointStateData in sender side, but got wrong data type!");
+            return false;
+        }
+        // Only one message every m_decimation is sent
+        return m_count++ % m_decimation == 0;
+    }
+
+    auto* b = thing.cast_as<Bottle>();
+    if (b == nullptr) {
+        yCError(JOINTSTATEFIELDS, "Expected type Bottle in receiver side, but got wrong data type!");
+        return false;
+    }
+    // The invalid messages are dropped
+    if (!decode(*b)) {
+        yCError(JOINTSTATEFIELDS, "Invalid data received");
+        return false;
+    }
+    return true;
+}
+
+yarp::os::Things& JointStateFieldsMonitorObject::update(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        // sender side: it receives the joint state, it sends a bottle to the network
+        auto* state = thing.cast_as<JointStateData>();
+        if (state == nullptr) {
+            yCError(JOINTSTATEFIELDS, "Invalid joint state");
+            return thing;
+        }
+        encode(*state);
+        m_th.setPortWriter(&m_data);
+        return m_th;
+    }
+
+    // receiver side: the bottle received from the network was already
+    // decoded by accept()
+    m_th.setPortWriter(&m_state);
+    return m_th;
+}
+
+void JointStateFieldsMonitorObject::encode(const JointStateData& state)
+{
+    size_t joints = 0;
+    forEachField(state, [&joints](unsigned int, const auto& vec, bool) {
+        joints = std::max(joints, vec.size());
+    });
+
+    // Only the requested fields that are valid and complete are sent
+    unsigned int mask = 0;
+    m_buffer.clear();
+    forEachField(state, [&](unsigned int bit, const auto& vec, bool isValid) {
+        if ((m_mask & bit) == 0 || !isValid || vec.size() != joints) {
+            return;
+        }
+        mask |= bit;
+        const auto* bytes = reinterpret_cast<const unsigned char*>(vec.data());
+        m_buffer.insert(m_buffer.end(), bytes, bytes + joints * sizeof(vec[0]));
+    });
+
+    m_data.clear();
+    m_data.addInt32(static_cast<int>(mask));
+    m_data.addInt32(static_cast<int>(joints));
+    m_data.add(Value::makeBlob(m_buffer.data(), static_cast<int>(m_buffer.size())));
+}
+
+bool JointStateFieldsMonitorObject::decode(const yarp::os::Bottle& data)
+{
+    if (data.size() != messageSize) {
+        return false;
+    }
+    const int mask = data.get(0).asInt32();
+    const int joints = data.get(1).asInt32();
+    const Value& blob = data.get(2);
+    if (mask < 0 || (static_cast<unsigned int>(mask) & ~allFields) != 0 || joints < 0 || joints > maxJoints || !blob.isBlob()) {
+        return false;
+    }
+
+    // Check the size of the blob before allocating anything
+    size_t expected = 0;
+    forEachField(m_state, [&](unsigned int bit, const auto& vec, bool) {
+        if ((static_cast<unsigned int>(mask) & bit) != 0) {
+            expected += static_cast<size_t>(joints) * sizeof(vec[0]);
+        }
+    });
+    const size_t length = blob.asBlobLength();
+    if (length != expected) {
+        return false;
+    }
+
+    const auto* bytes = reinterpret_cast<const unsigned char*>(blob.asBlob());
+    size_t offset = 0;
+    forEachField(m_state, [&](unsigned int bit, auto& vec, bool& isValid) {
+        // all the fields have the same size, the ones not sent are not valid
+        vec.resize(static_cast<size_t>(joints));
+        isValid = false;
+        if ((static_cast<unsigned int>(mask) & bit) == 0) {
+            return;
+        }
+        const size_t size = vec.size() * sizeof(vec[0]);
+        memcpy(vec.data(), bytes + offset, size);
+        offset += size;
+        isValid = true;
+    });
+    return true;
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_PORTMONITOR_JOINTSTATEFIELDS_H
+#define YARP_PORTMONITOR_JOINTSTATEFIELDS_H
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Things.h>
+#include <yarp/os/MonitorObject.h>
+#include <yarp/dev/JointStateData.h>
+
+#include <vector>
+
+ /**
+  * @ingroup portmonitors_lists
+  * \brief `jointstate_fields`: Portmonitor plugin that transmits only some fields of the joint state.
+  *
+  * It is meant for the `/stateExt:o` port of the `controlBoard_nws_yarp`
+  * device.  The subscriber declares on the connection the fields of the
+  * yarp::dev::JointStateData it needs and a decimation factor, and the
+  * sender side packs only the requested fields, as arrays of binary values
+  * of a fixed size.  The receiver side rebuilds a yarp::dev::JointStateData,
+  * where the fields that were not transmitted are not valid.
+  *
+  * Sender side parameters:
+  * - `fields`: the fields to send, concatenated with underscores, among
+  *   `pos`, `vel`, `acc`, `mpos`, `mvel`, `macc`, `trq`, `pwm`, `cur`,
+  *   `cmode`, `imode`, `temp`, or `all` (default: `all`).
+  * - `decimation`: send only one message every `decimation` (default: 1).
+  *
+  * Example usage:
+  * yarp connect /robot/left_arm/stateExt:o /logger/stateExt:i tcp+send.portmonitor+file.jointstate_fields+type.dll+fields.pos_trq+decimation.5+recv.portmonitor+file.jointstate_fields+type.dll
+  */
+class JointStateFieldsMonitorObject : public yarp::os::MonitorObject
+{
+public:
+    bool create(const yarp::os::Property& options) override;
+    void destroy() override;
+
+    bool setparam(const yarp::os::Property& params) override;
+    bool getparam(yarp::os::Property& params) override;
+
+    bool accept(yarp::os::Things& thing) override;
+    yarp::os::Things& update(yarp::os::Things& thing) override;
+
+private:
+    bool parseOptions(const yarp::os::Property& options);
+    void encode(const yarp::dev::JointStateData& state);
+    bool decode(const yarp::os::Bottle& data);
+
+    bool m_senderSide {false};
+
+    // sender side
+    unsigned int m_mask {0};
+    size_t m_decimation {1};
+    size_t m_count {0};
+    std::vector<unsigned char> m_buffer;
+    yarp::os::Bottle m_data;
+
+    // receiver side
+    yarp::dev::JointStateData m_state;
+
+    yarp::os::Things m_th;
+};
+
+#endif // YARP_PORTMONITOR_JOINTSTATEFIELDS_H
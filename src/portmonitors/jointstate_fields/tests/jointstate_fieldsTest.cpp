@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/SystemClock.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/dev/JointStateData.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <vector>
+
+using yarp::dev::JointStateData;
+
+namespace {
+
+constexpr size_t joints = 6;
+
+void fillState(JointStateData& state, double offset)
+{
+    state.jointPosition.resize(joints);
+    state.jointVelocity.resize(joints);
+    state.torque.resize(joints);
+    state.pwmDutycycle.resize(joints);
+    state.controlMode.resize(joints);
+    for (size_t i = 0; i < joints; i++) {
+        state.jointPosition[i] = offset + i;
+        state.jointVelocity[i] = offset + 10 * i;
+        state.torque[i] = offset - i;
+        state.pwmDutycycle[i] = static_cast<float>(offset + 0.5 * i);
+        state.controlMode[i] = static_cast<int>(i);
+    }
+    state.jointPosition_isValid = true;
+    state.jointVelocity_isValid = true;
+    state.torque_isValid = true;
+    state.pwmDutycycle_isValid = true;
+    state.controlMode_isValid = true;
+    state.current_isValid = false;
+}
+
+} // namespace
+
+TEST_CASE("pm::jointstate_fieldsTest", "[yarp::pm]")
+{
+    YARP_REQUIRE_PLUGIN("jointstate_fields", "portmonitor")
+
+    yarp::os::Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    yarp::os::NetworkBase::setLocalMode(true);
+    yarp::os::Time::delay(1.0);
+
+    yarp::os::BufferedPort<JointStateData> sender;
+    yarp::os::BufferedPort<JointStateData> receiver;
+    sender.open("/send");
+    receiver.open("/recv");
+
+    SECTION("Test selected fields")
+    {
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.jointstate_fields+type.dll+fields.pos_trq_pwm_cmode_cur+recv.portmonitor+file.jointstate_fields+type.dll"));
+
+        fillState(sender.prepare(), 1.0);
+        sender.write();
+        yarp::os::Time::delay(0.5);
+
+        JointStateData* received = receiver.read();
+        REQUIRE(received != nullptr);
+        CHECK(received->jointPosition_isValid);
+        CHECK(received->torque_isValid);
+        CHECK(received->pwmDutycycle_isValid);
+        CHECK(received->controlMode_isValid);
+        CHECK_FALSE(received->jointVelocity_isValid);
+        CHECK_FALSE(received->current_isValid);
+        CHECK_FALSE(received->temperature_isValid);
+        REQUIRE(received->jointPosition.size() == joints);
+        REQUIRE(received->jointVelocity.size() == joints);
+
+        bool ok = true;
+        for (size_t i = 0; i < joints; i++) {
+            ok &= received->jointPosition[i] == 1.0 + i;
+            ok &= received->torque[i] == 1.0 - i;
+            ok &= received->pwmDutycycle[i] == static_cast<float>(1.0 + 0.5 * i);
+            ok &= received->controlMode[i] == static_cast<int>(i);
+        }
+        CHECK(ok);
+    }
+
+    SECTION("Test decimation")
+    {
+        receiver.setStrict();
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.jointstate_fields+type.dll+fields.pos+decimation.3+recv.portmonitor+file.jointstate_fields+type.dll"));
+
+        for (int i = 0; i < 6; i++) {
+            fillState(sender.prepare(), i);
+            sender.writeStrict();
+            yarp::os::Time::delay(0.1);
+        }
+        yarp::os::Time::delay(0.5);
+
+        // only the messages 0 and 3 are sent
+        std::vector<double> received;
+        while (receiver.getPendingReads() > 0) {
+            JointStateData* state = receiver.read();
+            REQUIRE(state != nullptr);
+            received.push_back(state->jointPosition[0]);
+        }
+        CHECK(received == std::vector<double>{0.0, 3.0});
+    }
+
+    SECTION("Test malformed messages")
+    {
+        yarp::os::BufferedPort<yarp::os::Bottle> badSender;
+        badSender.open("/badsend");
+        receiver.setStrict();
+        REQUIRE(yarp::os::Network::connect("/badsend", "/recv", "fast_tcp+recv.portmonitor+file.jointstate_fields+type.dll"));
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.jointstate_fields+type.dll+fields.pos+recv.portmonitor+file.jointstate_fields+type.dll"));
+
+        // mask joints blob, the mask 1 is the position only
+        std::vector<double> positions(joints, 1.0);
+        auto sendBad = [&](int mask, int n, size_t blobSize) {
+            yarp::os::Bottle& b = badSender.prepare();
+            b.clear();
+            b.addInt32(mask);
+            b.addInt32(n);
+            b.add(yarp::os::Value::makeBlob(positions.data(), static_cast<int>(blobSize)));
+            badSender.writeStrict();
+        };
+
+        sendBad(1, 0x7fffffff, joints * sizeof(double));       // huge number of joints
+        sendBad(0, 0x7fffffff, 0);                             // huge number of joints, no fields
+        sendBad(1, joints, joints * sizeof(double) - 1);       // truncated
+        sendBad(1, joints - 1, joints * sizeof(double));       // oversized
+        sendBad(3, joints, joints * sizeof(double));           // missing field
+        yarp::os::Time::delay(0.5);
+        CHECK(receiver.getPendingReads() == 0);
+
+        // the connection still works
+        fillState(sender.prepare(), 7.0);
+        sender.write();
+        JointStateData* received = receiver.read();
+        REQUIRE(received != nullptr);
+        CHECK(received->jointPosition_isValid);
+        REQUIRE(received->jointPosition.size() == joints);
+        CHECK(received->jointPosition[1] == 8.0);
+
+        badSender.close();
+    }
+
+    receiver.close();
+    sender.close();
+
+    yarp::os::NetworkBase::setLocalMode(false);
+}
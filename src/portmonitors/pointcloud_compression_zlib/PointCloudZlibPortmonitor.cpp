@@ -0,0 +1,395 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "PointCloudZlibPortmonitor.h"
+
+#include <yarp/os/LogComponent.h>
+#include <yarp/os/LogStream.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <zlib.h>
+
+using namespace yarp::os;
+using namespace yarp::sig;
+
+namespace {
+YARP_LOG_COMPONENT(POINTCLOUD_ZLIB_MONITOR,
+                   "yarp.carrier.portmonitor.pointcloud_zlib",
+                   yarp::os::Log::minimumPrintLevel(),
+                   yarp::os::Log::LogTypeReserved,
+                   yarp::os::Log::printCallback(),
+                   nullptr)
+
+// The message sent on the network is a bottle containing:
+//   width height pointType isDense precision pointSize rawSize blob
+// where precision is the quantization step of the coordinates in meters (0
+// if they are not quantized), and the blob is the zlib compressed version of
+// rawSize bytes containing:
+// - if precision > 0, a bitmask of the points with finite coordinates,
+//   followed, for each of these points, by the differences between its
+//   quantized coordinates and the ones of the previous point, as zigzag
+//   varints;
+// - the remaining bytes of the points, grouped by their position in the
+//   point (i.e. the first byte of all the points, then the second one...),
+//   that makes the fields that change slowly (colors, padding...) easier to
+//   compress.
+constexpr size_t messageSize = 8;
+
+// Larger values cannot be stored exactly in a double
+constexpr double maxQuantized = 1e15;
+
+// Largest point cloud accepted by the receiver, in bytes
+constexpr size_t maxCloudSize = size_t{1} << 30;
+
+// Largest size of a zigzag varint encoding a 64 bit value
+constexpr size_t maxVarintSize = 10;
+
+// Size of the points of the supported types, 0 if the type is not supported
+size_t pointSizeOf(int pointType)
+{
+    switch (pointType) {
+    case PCL_POINT2D_XY:
+        return sizeof(DataXY);
+    case PCL_POINT_XYZ:
+        return sizeof(DataXYZ);
+    case PCL_POINT_XYZ_I:
+        return sizeof(DataXYZI);
+    case PCL_NORMAL:
+        return sizeof(DataNormal);
+    case PCL_POINT_XYZ_RGBA:
+        return sizeof(DataXYZRGBA);
+    case PCL_POINT_XYZ_NORMAL:
+        return sizeof(DataXYZNormal);
+    case PCL_POINT_XYZ_NORMAL_RGBA:
+        return sizeof(DataXYZNormalRGBA);
+    case PCL_INTEREST_POINT_XYZ:
+        return sizeof(DataInterestPointXYZ);
+    default:
+        return 0;
+    }
+}
+
+// In all the point types, the coordinates are the first fields of the point
+size_t coordinateCount(int pointType)
+{
+    if (pointType & PC_XYZ_DATA) {
+        return 3;
+    }
+    if (pointType & PC_XY_DATA) {
+        return 2;
+    }
+    return 0;
+}
+
+void appendVarint(std::vector<unsigned char>& out, std::int64_t value)
+{
+    auto v = (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    while (v >= 0x80) {
+        out.push_back(static_cast<unsigned char>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(v));
+}
+
+bool readVarint(const std::vector<unsigned char>& in, size_t& pos, std::int64_t& value)
+{
+    std::uint64_t v = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        if (pos >= in.size()) {
+            return false;
+        }
+        const unsigned char byte = in[pos++];
+        v |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            value = static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+
+bool PointCloudZlibMonitorObject::create(const yarp::os::Property& options)
+{
+    m_senderSide = options.find("sender_side").asBool();
+    if (!m_senderSide) {
+        return true;
+    }
+    return parseOptions(options);
+}
+
+void PointCloudZlibMonitorObject::destroy()
+{
+}
+
+bool PointCloudZlibMonitorObject::setparam(const yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        return false;
+    }
+    return parseOptions(params);
+}
+
+bool PointCloudZlibMonitorObject::getparam(yarp::os::Property& params)
+{
+    if (!m_senderSide) {
+        return false;
+    }
+    params.put("precision", m_precision);
+    params.put("level", m_level);
+    return true;
+}
+
+bool PointCloudZlibMonitorObject::parseOptions(const yarp::os::Property& options)
+{
+    const int precision = options.check("precision", Value(m_precision)).asInt32();
+    const int level = options.check("level", Value(m_level)).asInt32();
+    if (precision < 0) {
+        yCError(POINTCLOUD_ZLIB_MONITOR) << "Invalid value of `precision` parameter:" << precision;
+        return false;
+    }
+    if (level < 1 || level > 9) {
+        yCError(POINTCLOUD_ZLIB_MONITOR) << "Invalid value of `level` parameter:" << level;
+        return false;
+    }
+    m_precision = precision;
+    m_level = level;
+    return true;
+}
+
+bool PointCloudZlibMonitorObject::accept(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        //sender side / compressor
+        auto* pc = dynamic_cast<PointCloudBase*>(thing.getPortWriter());
+        if (pc == nullptr) {
+            yCError(POINTCLOUD_ZLIB_MONITOR, "Expected type PointCloud in sender side, but got wrong data type!");
+            return false;
+        }
+    } else {
+        //receiver side / decompressor
+        auto* b = thing.cast_as<Bottle>();
+        if (b == nullptr) {
+            yCError(POINTCLOUD_ZLIB_MONITOR, "Expected type Bottle in receiver side, but got wrong data type!");
+            return false;
+        }
+        // The invalid messages are dropped
+        return decode(*b);
+    }
+    return true;
+}
+
+yarp::os::Things& PointCloudZlibMonitorObject::update(yarp::os::Things& thing)
+{
+    if (m_senderSide) {
+        //sender side / compressor
+        //it receives a point cloud, it sends a bottle to the network
+        auto* pc = dynamic_cast<PointCloudBase*>(thing.getPortWriter());
+        if (!encode(*pc)) {
+            return thing;
+        }
+        m_th.setPortWriter(&m_data);
+    } else {
+        //receiver side / decompressor
+        //the bottle received from the network was already decoded by accept()
+    }
+    return m_th;
+}
+
+bool PointCloudZlibMonitorObject::encode(const yarp::sig::PointCloudBase& pc)
+{
+    const size_t count = pc.size();
+    const size_t pointSize = (count > 0) ? pc.dataSizeBytes() / count : 0;
+    const int pointType = pc.getPointType();
+    const size_t coords = (m_precision > 0) ? coordinateCount(pointType) : 0;
+    const double precision = (coords > 0) ? m_precision * 1e-6 : 0.0;
+    const auto* points = reinterpret_cast<const unsigned char*>(pc.getRawData());
+
+    m_raw.clear();
+    if (coords > 0) {
+        m_raw.resize((count + 7) / 8, 0);
+        std::array<std::int64_t, 3> last {0, 0, 0};
+        std::array<std::int64_t, 3> current {0, 0, 0};
+        for (size_t i = 0; i < count; ++i) {
+            std::array<float, 3> p {};
+            memcpy(p.data(), points + i * pointSize, coords * sizeof(float));
+            bool valid = true;
+            for (size_t c = 0; c < coords; ++c) {
+                const double v = p[c] / precision;
+                if (!std::isfinite(v) || std::fabs(v) > maxQuantized) {
+                    valid = false;
+                    break;
+                }
+                current[c] = std::llround(v);
+            }
+            if (!valid) {
+                continue;
+            }
+            m_raw[i / 8] |= static_cast<unsigned char>(1 << (i % 8));
+            for (size_t c = 0; c < coords; ++c) {
+                appendVarint(m_raw, current[c] - last[c]);
+                last[c] = current[c];
+            }
+        }
+    }
+
+    const size_t skip = coords * sizeof(float);
+    size_t pos = m_raw.size();
+    m_raw.resize(pos + count * (pointSize - skip));
+    for (size_t byte = skip; byte < pointSize; ++byte) {
+        for (size_t i = 0; i < count; ++i) {
+            m_raw[pos++] = points[i * pointSize + byte];
+        }
+    }
+
+    uLongf sizeCompressed = compressBound(m_raw.size());
+    m_compressed.resize(sizeCompressed);
+    int z_result = compress2(m_compressed.data(), &sizeCompressed, m_raw.data(), m_raw.size(), m_level);
+    if (z_result != Z_OK) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "zlib compression failed (error %d)", z_result);
+        return false;
+    }
+
+    m_data.clear();
+    m_data.addInt32(static_cast<int>(pc.width()));
+    m_data.addInt32(static_cast<int>(pc.height()));
+    m_data.addInt32(pointType);
+    m_data.addInt32(pc.isDense() ? 1 : 0);
+    m_data.addFloat64(precision);
+    m_data.addInt32(static_cast<int>(pointSize));
+    m_data.addInt32(static_cast<int>(m_raw.size()));
+    m_data.add(Value::makeBlob(m_compressed.data(), sizeCompressed));
+    return true;
+}
+
+bool PointCloudZlibMonitorObject::decode(const yarp::os::Bottle& data)
+{
+    if (data.size() != messageSize || !data.get(7).isBlob()) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: wrong message format");
+        return false;
+    }
+
+    const int width = data.get(0).asInt32();
+    const int height = data.get(1).asInt32();
+    const int pointType = data.get(2).asInt32();
+    const bool isDense = data.get(3).asInt32() != 0;
+    const double precision = data.get(4).asFloat64();
+    const int pointSize = data.get(5).asInt32();
+    const int rawSize = data.get(6).asInt32();
+    if (width < 0 || height < 0 || pointSize < 0 || rawSize < 0 || precision < 0.0) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: negative size");
+        return false;
+    }
+
+    // Check the sizes before allocating anything
+    if (pointSizeOf(pointType) == 0 || static_cast<size_t>(pointSize) != pointSizeOf(pointType)) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: wrong point size for point type %d", pointType);
+        return false;
+    }
+    const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+    if (count > maxCloudSize / static_cast<size_t>(pointSize)) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: point cloud too big (%dx%d)", width, height);
+        return false;
+    }
+    const size_t coords = (precision > 0.0) ? coordinateCount(pointType) : 0;
+    const size_t skip = (count > 0) ? coords * sizeof(float) : 0;
+    const size_t maskSize = (coords > 0) ? (count + 7) / 8 : 0;
+    const size_t minRawSize = maskSize + count * (pointSize - skip);
+    const size_t maxRawSize = minRawSize + count * coords * maxVarintSize;
+    if (static_cast<size_t>(rawSize) < minRawSize || static_cast<size_t>(rawSize) > maxRawSize) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: wrong raw size %d", rawSize);
+        return false;
+    }
+
+    m_raw.resize(rawSize);
+    uLongf sizeUncompressed = rawSize;
+    int z_result = uncompress(m_raw.data(), &sizeUncompressed,
+                              reinterpret_cast<const Bytef*>(data.get(7).asBlob()),
+                              data.get(7).asBlobLength());
+    if (z_result != Z_OK || sizeUncompressed != static_cast<uLongf>(rawSize)) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "zlib decompression failed (error %d)", z_result);
+        return false;
+    }
+
+    m_points.resize(count * pointSize);
+
+    size_t pos = 0;
+    if (coords > 0) {
+        pos = maskSize;
+        std::array<std::int64_t, 3> last {0, 0, 0};
+        for (size_t i = 0; i < count; ++i) {
+            std::array<float, 3> p;
+            if (m_raw[i / 8] & (1 << (i % 8))) {
+                for (size_t c = 0; c < coords; ++c) {
+                    std::int64_t delta = 0;
+                    if (!readVarint(m_raw, pos, delta)) {
+                        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: truncated data");
+                        return false;
+                    }
+                    last[c] += delta;
+                    p[c] = static_cast<float>(last[c] * precision);
+                }
+            } else {
+                p.fill(std::numeric_limits<float>::quiet_NaN());
+            }
+            memcpy(m_points.data() + i * pointSize, p.data(), skip);
+        }
+    }
+
+    if (m_raw.size() - pos != count * (pointSize - skip)) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: wrong blob size?");
+        return false;
+    }
+    for (size_t byte = skip; byte < static_cast<size_t>(pointSize); ++byte) {
+        for (size_t i = 0; i < count; ++i) {
+            m_points[i * pointSize + byte] = m_raw[pos++];
+        }
+    }
+
+    switch (pointType) {
+    case PCL_POINT2D_XY:
+        return fillCloud(m_cloudXY, width, height, isDense);
+    case PCL_POINT_XYZ:
+        return fillCloud(m_cloudXYZ, width, height, isDense);
+    case PCL_POINT_XYZ_I:
+        return fillCloud(m_cloudXYZI, width, height, isDense);
+    case PCL_NORMAL:
+        return fillCloud(m_cloudNormal, width, height, isDense);
+    case PCL_POINT_XYZ_RGBA:
+        return fillCloud(m_cloudXYZRGBA, width, height, isDense);
+    case PCL_POINT_XYZ_NORMAL:
+        return fillCloud(m_cloudXYZNormal, width, height, isDense);
+    case PCL_POINT_XYZ_NORMAL_RGBA:
+        return fillCloud(m_cloudXYZNormalRGBA, width, height, isDense);
+    case PCL_INTEREST_POINT_XYZ:
+        return fillCloud(m_cloudInterestPointXYZ, width, height, isDense);
+    default:
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: unsupported point type %d", pointType);
+        return false;
+    }
+}
+
+template <class T>
+bool PointCloudZlibMonitorObject::fillCloud(yarp::sig::PointCloud<T>& pc, size_t width, size_t height, bool isDense)
+{
+    if (m_points.size() != width * height * sizeof(T)) {
+        yCError(POINTCLOUD_ZLIB_MONITOR, "Invalid data received: wrong point size");
+        return false;
+    }
+    if (m_points.empty()) {
+        pc.resize(width, height);
+    } else {
+        pc.fromExternalPC(reinterpret_cast<const char*>(m_points.data()), pc.getPointType(), width, height, isDense);
+    }
+    m_th.setPortWriter(&pc);
+    return true;
+}
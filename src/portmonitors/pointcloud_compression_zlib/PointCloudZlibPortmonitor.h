@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef YARP_PORTMONITOR_POINTCLOUDZLIB_H
+#define YARP_PORTMONITOR_POINTCLOUDZLIB_H
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/Things.h>
+#include <yarp/os/MonitorObject.h>
+#include <yarp/sig/PointCloud.h>
+
+#include <vector>
+
+ /**
+  * @ingroup portmonitors_lists
+  * \brief `pointcloud_compression_zlib`: Portmonitor plugin for compression and decompression of point clouds.
+  *
+  * The sender side quantizes the coordinates of the points (x y z, or x y) to
+  * the requested precision, encodes each point as the difference from the
+  * previous one and compresses the result, together with the other fields
+  * of the points (color, normals, ...), using zlib.
+  * The receiver side rebuilds a point cloud of the same type and size.
+  * Points that have a non finite coordinate are received with all the
+  * coordinates set to NaN.
+  *
+  * Sender side parameters:
+  * - `precision`: the precision of the coordinates, in micrometers.  0 sends
+  *   the coordinates without loss (default: 1000, i.e. one millimeter).
+  * - `level`: the zlib compression level, from 1 (fastest) to 9 (smallest)
+  *   (default: 6).
+  *
+  * Example usage:
+  * yarp connect /depthCamera/pointCloud:o /view tcp+send.portmonitor+file.pointcloud_compression_zlib+type.dll+precision.500+recv.portmonitor+file.pointcloud_compression_zlib+type.dll
+  */
+class PointCloudZlibMonitorObject : public yarp::os::MonitorObject
+{
+public:
+    bool create(const yarp::os::Property& options) override;
+    void destroy() override;
+
+    bool setparam(const yarp::os::Property& params) override;
+    bool getparam(yarp::os::Property& params) override;
+
+    bool accept(yarp::os::Things& thing) override;
+    yarp::os::Things& update(yarp::os::Things& thing) override;
+
+private:
+    bool parseOptions(const yarp::os::Property& options);
+    bool encode(const yarp::sig::PointCloudBase& pc);
+    bool decode(const yarp::os::Bottle& data);
+
+    template <class T>
+    bool fillCloud(yarp::sig::PointCloud<T>& pc, size_t width, size_t height, bool isDense);
+
+    bool m_senderSide {false};
+
+    // sender side
+    int m_precision {1000};
+    int m_level {6};
+
+    // receiver side
+    yarp::sig::PointCloud<yarp::sig::DataXY> m_cloudXY;
+    yarp::sig::PointCloud<yarp::sig::DataXYZ> m_cloudXYZ;
+    yarp::sig::PointCloud<yarp::sig::DataXYZI> m_cloudXYZI;
+    yarp::sig::PointCloud<yarp::sig::DataNormal> m_cloudNormal;
+    yarp::sig::PointCloud<yarp::sig::DataXYZRGBA> m_cloudXYZRGBA;
+    yarp::sig::PointCloud<yarp::sig::DataXYZNormal> m_cloudXYZNormal;
+    yarp::sig::PointCloud<yarp::sig::DataXYZNormalRGBA> m_cloudXYZNormalRGBA;
+    yarp::sig::PointCloud<yarp::sig::DataInterestPointXYZ> m_cloudInterestPointXYZ;
+
+    std::vector<unsigned char> m_raw;
+    std::vector<unsigned char> m_compressed;
+    std::vector<unsigned char> m_points;
+    yarp::os::Bottle m_data;
+    yarp::os::Things m_th;
+};
+
+#endif // YARP_PORTMONITOR_POINTCLOUDZLIB_H
@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/SystemClock.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/LogStream.h>
+#include <yarp/os/Time.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/sig/PointCloud.h>
+
+#include <cmath>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using yarp::sig::DataXYZRGBA;
+using yarp::sig::PointCloud;
+
+namespace {
+
+constexpr size_t width = 16;
+constexpr size_t height = 8;
+
+void fillCloud(PointCloud<DataXYZRGBA>& pc)
+{
+    pc.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            DataXYZRGBA& p = pc(x, y);
+            p.x = 0.0123f * x;
+            p.y = -0.0321f * y;
+            p.z = 1.0f + 0.05f * std::sin(static_cast<float>(x + y));
+            p.r = static_cast<unsigned char>(x * 10);
+            p.g = static_cast<unsigned char>(y * 20);
+            p.b = 42;
+            p.a = 255;
+        }
+    }
+    pc(3, 2).z = std::nanf("");
+}
+
+} // namespace
+
+TEST_CASE("pm::pointcloud_compression_zlibTest", "[yarp::pm]")
+{
+    YARP_REQUIRE_PLUGIN("pointcloud_compression_zlib", "portmonitor")
+
+    yarp::os::Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    yarp::os::NetworkBase::setLocalMode(true);
+    yarp::os::Time::delay(1.0);
+
+    struct TestCase {
+        std::string carrier;
+        double tolerance;
+    };
+
+    auto tc = GENERATE(
+        TestCase {"fast_tcp+send.portmonitor+file.pointcloud_compression_zlib+type.dll+recv.portmonitor+file.pointcloud_compression_zlib+type.dll", 0.0005},
+        TestCase {"fast_tcp+send.portmonitor+file.pointcloud_compression_zlib+type.dll+precision.100+level.9+recv.portmonitor+file.pointcloud_compression_zlib+type.dll", 0.00005},
+        TestCase {"fast_tcp+send.portmonitor+file.pointcloud_compression_zlib+type.dll+precision.0+recv.portmonitor+file.pointcloud_compression_zlib+type.dll", 0.0}
+    );
+
+    SECTION("Test point cloud compression with portmonitor: " + tc.carrier)
+    {
+        yarp::os::BufferedPort<PointCloud<DataXYZRGBA>> sender;
+        yarp::os::BufferedPort<PointCloud<DataXYZRGBA>> receiver;
+
+        sender.open("/send");
+        receiver.open("/recv");
+
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", tc.carrier));
+
+        PointCloud<DataXYZRGBA>& pc = sender.prepare();
+        fillCloud(pc);
+        PointCloud<DataXYZRGBA> expected = pc;
+        sender.write();
+
+        yarp::os::Time::delay(0.5);
+
+        PointCloud<DataXYZRGBA>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        REQUIRE(received->width() == width);
+        REQUIRE(received->height() == height);
+
+        bool coordinates = true;
+        bool colors = true;
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                const DataXYZRGBA& e = expected(x, y);
+                const DataXYZRGBA& r = (*received)(x, y);
+                if (x == 3 && y == 2) {
+                    coordinates &= std::isnan(r.z);
+                } else {
+                    coordinates &= std::fabs(e.x - r.x) <= tc.tolerance;
+                    coordinates &= std::fabs(e.y - r.y) <= tc.tolerance;
+                    coordinates &= std::fabs(e.z - r.z) <= tc.tolerance;
+                }
+                colors &= (e.rgba == r.rgba);
+            }
+        }
+        CHECK(coordinates);
+        CHECK(colors);
+
+        receiver.close();
+        sender.close();
+    }
+
+    yarp::os::NetworkBase::setLocalMode(false);
+}
+
+TEST_CASE("pm::pointcloud_compression_zlibTest_malformed", "[yarp::pm]")
+{
+    YARP_REQUIRE_PLUGIN("pointcloud_compression_zlib", "portmonitor")
+
+    yarp::os::Network yarp(yarp::os::YARP_CLOCK_SYSTEM);
+
+    yarp::os::NetworkBase::setLocalMode(true);
+
+    SECTION("Test malformed messages")
+    {
+        yarp::os::BufferedPort<yarp::os::Bottle> badSender;
+        yarp::os::BufferedPort<PointCloud<DataXYZRGBA>> sender;
+        yarp::os::BufferedPort<PointCloud<DataXYZRGBA>> receiver;
+
+        badSender.open("/badsend");
+        sender.open("/send");
+        receiver.open("/recv");
+        receiver.setStrict();
+
+        REQUIRE(yarp::os::Network::connect("/badsend", "/recv", "fast_tcp+recv.portmonitor+file.pointcloud_compression_zlib+type.dll"));
+        REQUIRE(yarp::os::Network::connect("/send", "/recv", "fast_tcp+send.portmonitor+file.pointcloud_compression_zlib+type.dll+recv.portmonitor+file.pointcloud_compression_zlib+type.dll"));
+
+        // width height pointType isDense precision pointSize rawSize blob
+        const int pointSize = static_cast<int>(sizeof(DataXYZRGBA));
+        const char garbage[] = "not a zlib stream";
+        auto sendBad = [&](int w, int h, int type, int size, int rawSize) {
+            yarp::os::Bottle& b = badSender.prepare();
+            b.clear();
+            b.addInt32(w);
+            b.addInt32(h);
+            b.addInt32(type);
+            b.addInt32(1);
+            b.addFloat64(0.0);
+            b.addInt32(size);
+            b.addInt32(rawSize);
+            b.add(yarp::os::Value::makeBlob(const_cast<char*>(garbage), sizeof(garbage)));
+            badSender.writeStrict();
+        };
+
+        sendBad(1 << 30, 1 << 30, yarp::sig::PCL_POINT_XYZ_RGBA, pointSize, 0x7fffffff);  // too big
+        sendBad(100000, 100, yarp::sig::PCL_POINT_XYZ_RGBA, pointSize, 64);               // raw size smaller than the points
+        sendBad(4, 4, yarp::sig::PCL_POINT_XYZ_RGBA, pointSize, 0x7fffffff);              // wrong raw size
+        sendBad(4, 4, yarp::sig::PCL_POINT_XYZ_RGBA, 0x7fffffff, 16 * pointSize);         // wrong point size
+        sendBad(4, 4, 12345, pointSize, 16 * pointSize);                                   // wrong point type
+        sendBad(4, 4, yarp::sig::PCL_POINT_XYZ_RGBA, pointSize, 16 * pointSize);          // corrupted blob
+        yarp::os::Time::delay(0.5);
+        CHECK(receiver.getPendingReads() == 0);
+
+        // the connection still works
+        fillCloud(sender.prepare());
+        sender.write();
+        PointCloud<DataXYZRGBA>* received = receiver.read();
+        REQUIRE(received != nullptr);
+        CHECK(received->width() == width);
+        CHECK(received->height() == height);
+
+        receiver.close();
+        sender.close();
+        badSender.close();
+    }
+
+    yarp::os::NetworkBase::setLocalMode(false);
+}
@@ -68,6 +68,7 @@ bool SoundFilter_resample::setparam(const yarp::os::Property &params)
 {
     m_channel = params.find("channel").asInt8();
     m_output_freq = params.find("frequency").asInt32();
+    m_resampler.reset();
     return false;
 }
 
@@ -116,10 +117,21 @@ yarp::os::Things & SoundFilter_resample::update(yarp::os::Things &thing)
         m_s2.amplify(m_gain);
     }
 
-    if (m_output_freq>0)
+    if (m_output_freq > 0 && m_s2.getFrequency() > 0 && m_s2.getFrequency() != m_output_freq)
     {
-        bool b= yarp::sig::soundfilters::resample (m_s2,m_output_freq);
-        if (!b)  yCError(SOUNDFILTER_RESAMPLE, "Resample failed!\n");
+        // The resampler is created again when the format of the stream changes
+        if (!m_resampler ||
+            m_resampler->getInputFrequency() != static_cast<size_t>(m_s2.getFrequency()) ||
+            m_resampler->getChannels() != m_s2.getChannels())
+        {
+            m_resampler = std::make_unique<yarp::sig::soundfilters::Resampler>(m_s2.getFrequency(), m_output_freq, m_s2.getChannels());
+        }
+        if (!m_resampler->process(m_s2, m_resampled))
+        {
+            yCError(SOUNDFILTER_RESAMPLE, "Resample failed!\n");
+        }
+        m_th.setPortWriter(&m_resampled);
+        return m_th;
     }
 
     //send data
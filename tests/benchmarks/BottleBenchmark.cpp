@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <string>
+
+using namespace yarp::os;
+
+namespace {
+
+void fillFloat64(Bottle& b)
+{
+    b.clear();
+    for (int i = 0; i < 100; i++) {
+        b.addFloat64(i * 0.5);
+    }
+}
+
+void fillMixed(Bottle& b)
+{
+    b.clear();
+    for (int i = 0; i < 25; i++) {
+        b.addInt32(i);
+        b.addFloat64(i * 0.5);
+        b.addString("joint");
+        Bottle& l = b.addList();
+        l.addFloat64(0.1);
+        l.addFloat64(0.2);
+        l.addFloat64(0.3);
+    }
+}
+
+} // namespace
+
+TEST_CASE("os::BottleBenchmark", "[yarp::os][benchmark]")
+{
+    Bottle out;
+    Bottle in;
+    size_t size = 0;
+
+    fillFloat64(out);
+    std::string float64Bytes(out.toBinary(&size), size);
+    fillMixed(out);
+    std::string mixedBytes(out.toBinary(&size), size);
+
+    BENCHMARK("build 100 float64")
+    {
+        fillFloat64(out);
+        return out.size();
+    };
+
+    BENCHMARK("serialize 100 float64")
+    {
+        fillFloat64(out);
+        return out.toBinary(&size);
+    };
+
+    BENCHMARK("parse 100 float64")
+    {
+        in.fromBinary(float64Bytes.data(), float64Bytes.size());
+        return in.size();
+    };
+
+    BENCHMARK("build 100 mixed")
+    {
+        fillMixed(out);
+        return out.size();
+    };
+
+    BENCHMARK("serialize 100 mixed")
+    {
+        fillMixed(out);
+        return out.toBinary(&size);
+    };
+
+    BENCHMARK("parse 100 mixed")
+    {
+        in.fromBinary(mixedBytes.data(), mixedBytes.size());
+        return in.size();
+    };
+
+    BENCHMARK("fromString 100 mixed")
+    {
+        in.fromString("1 0.5 \"joint\" (0.1 0.2 0.3) 2 1.5 \"joint\" (0.1 0.2 0.3) 3 2.5 \"joint\" (0.1 0.2 0.3) "
+                      "4 3.5 \"joint\" (0.1 0.2 0.3) 5 4.5 \"joint\" (0.1 0.2 0.3)");
+        return in.size();
+    };
+}
@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/dev/FrameTransformContainer.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <string>
+#include <vector>
+
+using namespace yarp::dev;
+using namespace yarp::math;
+
+TEST_CASE("dev::FrameTransformContainerBenchmark", "[yarp::dev][benchmark]")
+{
+    // A chain of 100 frames, as published by the robot state publisher
+    constexpr int frames = 100;
+
+    FrameTransformContainer container;
+    double timestamp = 1.0;
+    for (int i = 0; i < frames; i++) {
+        FrameTransform t("frame" + std::to_string(i), "frame" + std::to_string(i + 1), 0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+        t.timestamp = timestamp;
+        container.setTransform(t);
+    }
+
+    FrameTransform last("frame" + std::to_string(frames - 1), "frame" + std::to_string(frames), 0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+    std::vector<FrameTransform> update;
+    for (int i = 0; i < frames; i++) {
+        update.emplace_back("frame" + std::to_string(i), "frame" + std::to_string(i + 1), 0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+    }
+    std::vector<FrameTransform> all;
+
+    BENCHMARK("setTransform update 1 of 100")
+    {
+        timestamp += 0.001;
+        last.timestamp = timestamp;
+        return container.setTransform(last);
+    };
+
+    BENCHMARK("setTransforms update 100 of 100")
+    {
+        timestamp += 0.001;
+        for (auto& t : update) {
+            t.timestamp = timestamp;
+        }
+        return container.setTransforms(update);
+    };
+
+    BENCHMARK("getTransforms 100")
+    {
+        container.getTransforms(all);
+        return all.size();
+    };
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Vocab.h>
+#include <yarp/sig/Image.h>
+#include <yarp/sig/impl/PixelConversion.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::sig;
+using namespace yarp::sig::impl;
+
+namespace {
+
+// The instruction sets supported by the CPU
+std::vector<SimdLevel> supportedSimdLevels()
+{
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    switch (getSimdLevel()) {
+    case SimdLevel::AVX2:
+        levels.push_back(SimdLevel::SSE41);
+        levels.push_back(SimdLevel::AVX2);
+        break;
+    case SimdLevel::SSE41:
+        levels.push_back(SimdLevel::SSE41);
+        break;
+    case SimdLevel::NEON:
+        levels.push_back(SimdLevel::NEON);
+        break;
+    case SimdLevel::Scalar:
+    default:
+        break;
+    }
+    return levels;
+}
+
+} // namespace
+
+TEST_CASE("sig::ImageBenchmark", "[yarp::sig][benchmark]")
+{
+    constexpr size_t width = 640;
+    constexpr size_t height = 480;
+
+    ImageOf<PixelRgb> rgb;
+    rgb.resize(width, height);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            rgb.pixel(x, y) = PixelRgb(x % 256, y % 256, (x + y) % 256);
+        }
+    }
+    ImageOf<PixelMono> mono;
+    mono.copy(rgb);
+
+    ImageOf<PixelRgb> rgbCopy;
+    ImageOf<PixelBgr> bgr;
+    ImageOf<PixelRgba> rgba;
+    ImageOf<PixelMono> monoCopy;
+    ImageOf<PixelRgbFloat> rgbFloat;
+    ImageOf<PixelRgb> rgbFromMono;
+
+    BENCHMARK("copyPixels 640x480 rgb to rgb")
+    {
+        rgbCopy.copy(rgb);
+        return rgbCopy.getRawImage();
+    };
+
+    BENCHMARK("copyPixels 640x480 rgb to bgr")
+    {
+        bgr.copy(rgb);
+        return bgr.getRawImage();
+    };
+
+    BENCHMARK("copyPixels 640x480 rgb to rgba")
+    {
+        rgba.copy(rgb);
+        return rgba.getRawImage();
+    };
+
+    BENCHMARK("copyPixels 640x480 rgb to mono")
+    {
+        monoCopy.copy(rgb);
+        return monoCopy.getRawImage();
+    };
+
+    BENCHMARK("copyPixels 640x480 rgb to rgb float")
+    {
+        rgbFloat.copy(rgb);
+        return rgbFloat.getRawImage();
+    };
+
+    BENCHMARK("copyPixels 640x480 mono to rgb")
+    {
+        rgbFromMono.copy(mono);
+        return rgbFromMono.getRawImage();
+    };
+}
+
+TEST_CASE("sig::PixelConversionBenchmark", "[yarp::sig][benchmark]")
+{
+    constexpr size_t width = 640;
+    constexpr size_t height = 480;
+
+    const std::vector<std::pair<int, int>> pairs = {
+        {VOCAB_PIXEL_RGB, VOCAB_PIXEL_BGR},
+        {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_BGRA},
+        {VOCAB_PIXEL_RGB, VOCAB_PIXEL_RGBA},
+        {VOCAB_PIXEL_BGR, VOCAB_PIXEL_RGBA},
+        {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_RGB},
+        {VOCAB_PIXEL_BGRA, VOCAB_PIXEL_RGB},
+        {VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO},
+        {VOCAB_PIXEL_RGBA, VOCAB_PIXEL_MONO},
+        {VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO16},
+        {VOCAB_PIXEL_RGB, VOCAB_PIXEL_MONO_FLOAT},
+        {VOCAB_PIXEL_MONO, VOCAB_PIXEL_RGB},
+        {VOCAB_PIXEL_MONO, VOCAB_PIXEL_RGBA},
+        {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO16},
+        {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO},
+        {VOCAB_PIXEL_MONO, VOCAB_PIXEL_MONO_FLOAT},
+        {VOCAB_PIXEL_MONO16, VOCAB_PIXEL_MONO_FLOAT},
+        {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO},
+        {VOCAB_PIXEL_MONO_FLOAT, VOCAB_PIXEL_MONO16},
+    };
+
+    // Each conversion with each instruction set, and with Image::copy(), that
+    // uses the best one
+    for (const auto& [id1, id2] : pairs) {
+        if (getPixelRowConversion(id1, id2) == nullptr) {
+            continue;
+        }
+
+        FlexImage src;
+        src.setPixelCode(id1);
+        src.resize(width, height);
+        // Small values, valid for the float images too
+        unsigned char* raw = src.getRawImage();
+        for (size_t i = 0; i < src.getRawImageSize(); i++) {
+            raw[i] = static_cast<unsigned char>(i % 61);
+        }
+
+        FlexImage dest;
+        dest.setPixelCode(id2);
+        dest.resize(width, height);
+
+        const std::string name = "convert 640x480 " + yarp::os::Vocab32::decode(id1) + " to " + yarp::os::Vocab32::decode(id2);
+        for (auto level : supportedSimdLevels()) {
+            auto convert = getPixelRowConversion(id1, id2, level);
+            BENCHMARK(name + " " + getSimdLevelName(level))
+            {
+                for (size_t y = 0; y < height; y++) {
+                    convert(src.getRow(y), dest.getRow(y), width);
+                }
+                return dest.getRawImage();
+            };
+        }
+
+        BENCHMARK(name + " copy()")
+        {
+            dest.copy(src);
+            return dest.getRawImage();
+        };
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/conf/version.h>
+
+#include <catch2/catch_amalgamated.hpp>
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+/*
+ * A Catch2 reporter that writes the results of the benchmarks in JSON, to
+ * compare them between releases, e.g.
+ *
+ *   yarp-benchmarks --reporter json::out=results.json
+ *
+ * The times are in nanoseconds, and the mean and the standard deviation are
+ * reported with the bounds of their confidence interval.
+ */
+
+#ifndef YARP_BENCHMARKS_BUILD_TYPE
+#  define YARP_BENCHMARKS_BUILD_TYPE ""
+#endif
+
+namespace {
+
+std::string escape(const std::string& str)
+{
+    std::string ret;
+    ret.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+        case '"':
+            ret += "\\\"";
+            break;
+        case '\\':
+            ret += "\\\\";
+            break;
+        case '\n':
+            ret += "\\n";
+            break;
+        case '\t':
+            ret += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                ret += buf;
+            } else {
+                ret += c;
+            }
+        }
+    }
+    return ret;
+}
+
+class JsonReporter : public Catch::StreamingReporterBase
+{
+public:
+    JsonReporter(Catch::ReporterConfig&& config) :
+            StreamingReporterBase(CATCH_MOVE(config))
+    {
+        m_preferences.shouldReportAllAssertions = false;
+    }
+
+    static std::string getDescription()
+    {
+        return "Reports the results of the benchmarks in JSON";
+    }
+
+    void testCaseStarting(Catch::TestCaseInfo const& testInfo) override
+    {
+        StreamingReporterBase::testCaseStarting(testInfo);
+        testCase = testInfo.name;
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+    {
+        Result result;
+        result.testCase = testCase;
+        result.name = stats.info.name;
+        result.samples = stats.info.samples;
+        result.iterations = stats.info.iterations;
+        result.mean = stats.mean.point.count();
+        result.meanLow = stats.mean.lower_bound.count();
+        result.meanHigh = stats.mean.upper_bound.count();
+        result.stdDev = stats.standardDeviation.point.count();
+        result.stdDevLow = stats.standardDeviation.lower_bound.count();
+        result.stdDevHigh = stats.standardDeviation.upper_bound.count();
+        result.outlierVariance = stats.outlierVariance;
+        results.push_back(result);
+    }
+
+    void benchmarkFailed(Catch::StringRef error) override
+    {
+        failures.emplace_back(testCase + ": " + std::string(error));
+    }
+
+    void testRunEnded(Catch::TestRunStats const& stats) override
+    {
+        StreamingReporterBase::testRunEnded(stats);
+
+        char date[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        auto& out = m_stream;
+        out << "{\n";
+        out << "  \"context\": {\n";
+        out << "    \"yarp_version\": \"" << YARP_VERSION << "\",\n";
+        out << "    \"build_type\": \"" << escape(YARP_BENCHMARKS_BUILD_TYPE) << "\",\n";
+        out << "    \"date\": \"" << date << "\"\n";
+        out << "  },\n";
+        out << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\n";
+            out << "      \"test_case\": \"" << escape(r.testCase) << "\",\n";
+            out << "      \"name\": \"" << escape(r.name) << "\",\n";
+            out << "      \"samples\": " << r.samples << ",\n";
+            out << "      \"iterations\": " << r.iterations << ",\n";
+            out << "      \"mean_ns\": " << r.mean << ",\n";
+            out << "      \"mean_low_ns\": " << r.meanLow << ",\n";
+            out << "      \"mean_high_ns\": " << r.meanHigh << ",\n";
+            out << "      \"std_dev_ns\": " << r.stdDev << ",\n";
+            out << "      \"std_dev_low_ns\": " << r.stdDevLow << ",\n";
+            out << "      \"std_dev_high_ns\": " << r.stdDevHigh << ",\n";
+            out << "      \"outlier_variance\": " << r.outlierVariance << "\n";
+            out << "    }";
+        }
+        out << (results.empty() ? "],\n" : "\n  ],\n");
+        out << "  \"failures\": [";
+        for (size_t i = 0; i < failures.size(); i++) {
+            out << (i == 0 ? "" : ", ") << "\"" << escape(failures[i]) << "\"";
+        }
+        out << "]\n";
+        out << "}\n";
+        out.flush();
+    }
+
+private:
+    struct Result
+    {
+        std::string testCase;
+        std::string name;
+        unsigned int samples;
+        int iterations;
+        double mean;
+        double meanLow;
+        double meanHigh;
+        double stdDev;
+        double stdDevLow;
+        double stdDevHigh;
+        double outlierVariance;
+    };
+
+    std::string testCase;
+    std::vector<Result> results;
+    std::vector<std::string> failures;
+};
+
+} // namespace
+
+CATCH_REGISTER_REPORTER("json", JsonReporter)
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/math/Math.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::sig;
+using namespace yarp::math;
+
+namespace {
+
+Matrix makeMatrix(size_t n)
+{
+    Matrix m(n, n);
+    for (size_t r = 0; r < n; r++) {
+        for (size_t c = 0; c < n; c++) {
+            m(r, c) = 1.0 / static_cast<double>(r + c + 1);
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("math::MathBenchmark", "[yarp::math][benchmark]")
+{
+    // Homogeneous transformations, as in a kinematic chain
+    Matrix a4 = makeMatrix(4);
+    Matrix b4 = makeMatrix(4);
+    Matrix c4(4, 4);
+
+    BENCHMARK("Matrix 4x4 * Matrix 4x4")
+    {
+        return a4 * b4;
+    };
+
+    BENCHMARK("multiplyInto 4x4")
+    {
+        multiplyInto(a4, b4, c4);
+        return c4(0, 0);
+    };
+
+    BENCHMARK("multiplyInto 4x4 chain of 10")
+    {
+        c4.eye();
+        for (int i = 0; i < 10; i++) {
+            multiplyInto(c4, a4, c4);
+        }
+        return c4(0, 0);
+    };
+
+    Matrix a6 = makeMatrix(6);
+    Matrix b6 = makeMatrix(6);
+    Matrix c6(6, 6);
+
+    BENCHMARK("multiplyInto 6x6")
+    {
+        multiplyInto(a6, b6, c6);
+        return c6(0, 0);
+    };
+
+    Matrix a10 = makeMatrix(10);
+    Matrix b10 = makeMatrix(10);
+    Matrix c10(10, 10);
+
+    BENCHMARK("multiplyInto 10x10")
+    {
+        multiplyInto(a10, b10, c10);
+        return c10(0, 0);
+    };
+
+    Vector v4(4, 1.0);
+    Vector r4(4);
+
+    BENCHMARK("multiplyInto 4x4 * Vector 4")
+    {
+        multiplyInto(a4, v4, r4);
+        return r4[0];
+    };
+
+    Vector v3(3, 1.0);
+    Vector w3(3, 2.0);
+    Vector r3(3);
+
+    BENCHMARK("Vector 3 + Vector 3")
+    {
+        return v3 + w3;
+    };
+
+    BENCHMARK("addInto Vector 3")
+    {
+        addInto(v3, w3, r3);
+        return r3[0];
+    };
+}
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/sig/IntrinsicParams.h>
+#include <yarp/sig/PointCloudUtils.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+using namespace yarp::sig;
+
+TEST_CASE("sig::PointCloudBenchmark", "[yarp::sig][benchmark]")
+{
+    ImageOf<PixelFloat> depth;
+    depth.resize(640, 480);
+    for (size_t y = 0; y < depth.height(); y++) {
+        for (size_t x = 0; x < depth.width(); x++) {
+            depth.pixel(x, y) = 1.0f + static_cast<float>(x + y) / 1000.0f;
+        }
+    }
+
+    IntrinsicParams intp;
+    intp.focalLengthX = 525.0;
+    intp.focalLengthY = 525.0;
+    intp.principalPointX = 319.5;
+    intp.principalPointY = 239.5;
+
+    BENCHMARK("depthToPC 640x480")
+    {
+        return utils::depthToPC(depth, intp);
+    };
+
+    BENCHMARK("depthToPC 640x480 roi step 2")
+    {
+        return utils::depthToPC(depth, intp, {100, 540, 80, 400}, 2, 2);
+    };
+
+    utils::PointCloudProjector projector(intp);
+    PointCloudXYZ pc;
+
+    BENCHMARK("PointCloudProjector 640x480")
+    {
+        projector.depthToPC(depth, pc);
+        return pc.getRawData();
+    };
+
+    projector.setThreads(4);
+    BENCHMARK("PointCloudProjector 640x480 4 threads")
+    {
+        projector.depthToPC(depth, pc);
+        return pc.getRawData();
+    };
+
+    ImageOf<PixelFloat> depthHd;
+    depthHd.resize(1280, 720);
+    for (size_t y = 0; y < depthHd.height(); y++) {
+        for (size_t x = 0; x < depthHd.width(); x++) {
+            depthHd.pixel(x, y) = 1.0f + static_cast<float>(x + y) / 1000.0f;
+        }
+    }
+    ImageOf<PixelRgb> colorHd;
+    colorHd.resize(1280, 720);
+    colorHd.zero();
+    PointCloudXYZRGBA pcColor;
+
+    projector.setThreads(1);
+    BENCHMARK("depthRgbToPC 1280x720")
+    {
+        return utils::depthRgbToPC<DataXYZRGBA, PixelRgb>(depthHd, colorHd, intp);
+    };
+
+    BENCHMARK("PointCloudProjector rgb 1280x720")
+    {
+        projector.depthRgbToPC(depthHd, colorHd, pcColor);
+        return pcColor.getRawData();
+    };
+}
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Bottle.h>
+#include <yarp/os/BufferedPort.h>
+#include <yarp/os/Network.h>
+#include <yarp/os/Semaphore.h>
+#include <yarp/os/SystemClock.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace yarp::os;
+
+namespace {
+
+class Receiver :
+        public BufferedPort<Bottle>
+{
+public:
+    using BufferedPort<Bottle>::onRead;
+    void onRead(Bottle& b) override
+    {
+        YARP_UNUSED(b);
+        received.post();
+    }
+
+    Semaphore received{0};
+};
+
+void send(BufferedPort<Bottle>& sender, int i)
+{
+    Bottle& b = sender.prepare();
+    b.clear();
+    b.addInt32(i);
+    for (int j = 0; j < 6; j++) {
+        b.addFloat64(j * 0.1);
+    }
+    sender.writeStrict();
+}
+
+} // namespace
+
+TEST_CASE("os::PortBenchmark", "[yarp::os][benchmark]")
+{
+    NetworkBase::setLocalMode(true);
+
+    SECTION("send fan-out")
+    {
+        constexpr size_t receivers = 4;
+
+        for (const char* carrier : {"local", "tcp", "unix_stream", "shmem"}) {
+            BufferedPort<Bottle> sender;
+            REQUIRE(sender.open("/bench/out"));
+
+            std::vector<std::unique_ptr<Receiver>> inputs;
+            bool connected = true;
+            for (size_t i = 0; i < receivers && connected; i++) {
+                inputs.emplace_back(std::make_unique<Receiver>());
+                auto& receiver = *inputs.back();
+                receiver.setStrict();
+                receiver.useCallback();
+                REQUIRE(receiver.open("/bench/in" + std::to_string(i)));
+                connected = Network::connect(sender.getName(), receiver.getName(), carrier, true);
+            }
+
+            if (!connected) {
+                WARN("Skipping the " << carrier << " carrier, that is not available");
+            } else {
+                Network::sync(sender.getName());
+
+                int count = 0;
+                BENCHMARK(std::string("send to 4 receivers over ") + carrier)
+                {
+                    send(sender, count++);
+                    for (auto& receiver : inputs) {
+                        receiver->received.wait();
+                    }
+                    return count;
+                };
+            }
+
+            sender.close();
+            for (auto& receiver : inputs) {
+                receiver->close();
+            }
+        }
+    }
+
+    SECTION("read latency")
+    {
+        BufferedPort<Bottle> sender;
+        BufferedPort<Bottle> receiver;
+        receiver.setStrict();
+        REQUIRE(sender.open("/bench/out"));
+        REQUIRE(receiver.open("/bench/in"));
+        REQUIRE(Network::connect(sender.getName(), receiver.getName(), "tcp", true));
+        Network::sync(sender.getName());
+
+        int count = 0;
+        BENCHMARK("write and read over tcp")
+        {
+            send(sender, count++);
+            return receiver.read()->size();
+        };
+
+        BENCHMARK_ADVANCED("read of a pending message")(Catch::Benchmark::Chronometer meter)
+        {
+            for (int i = 0; i < meter.runs(); i++) {
+                send(sender, count++);
+            }
+            while (receiver.getPendingReads() < meter.runs()) {
+                yarp::os::SystemClock::delaySystem(0.001);
+            }
+            meter.measure([&receiver] { return receiver.read()->size(); });
+        };
+
+        sender.close();
+        receiver.close();
+    }
+
+    NetworkBase::setLocalMode(false);
+}
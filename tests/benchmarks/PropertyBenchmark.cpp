@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: 2026-2026 Istituto Italiano di Tecnologia (IIT)
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <yarp/os/Property.h>
+
+#include <catch2/catch_amalgamated.hpp>
+#include <harness.h>
+
+#include <string>
+
+using namespace yarp::os;
+
+TEST_CASE("os::PropertyBenchmark", "[yarp::os][benchmark]")
+{
+    // A device configuration, with some nested groups
+    std::string text;
+    for (int i = 0; i < 50; i++) {
+        text += "(key" + std::to_string(i) + " " + std::to_string(i * 0.5) + ") ";
+    }
+    text += "(joints (j0 j1 j2 j3 j4 j5)) (limits (min -90 -90 -90 -90 -90 -90) (max 90 90 90 90 90 90))";
+
+    std::string config = "[GENERAL]\nname robot\nperiod 0.01\n[LIMITS]\n";
+    for (int i = 0; i < 50; i++) {
+        config += "joint" + std::to_string(i) + " -90 90\n";
+    }
+
+    Property p;
+    p.fromString(text);
+
+    BENCHMARK("fromString 52 keys")
+    {
+        Property prop;
+        prop.fromString(text);
+        return prop.check("key49");
+    };
+
+    BENCHMARK("fromConfig 2 groups 52 keys")
+    {
+        Property prop;
+        prop.fromConfig(config.c_str());
+        return prop.check("GENERAL");
+    };
+
+    BENCHMARK("find 52 keys")
+    {
+        double sum = 0;
+        for (int i = 0; i < 50; i++) {
+            sum += p.find("key" + std::to_string(i)).asFloat64();
+        }
+        return sum;
+    };
+}